@@ -364,10 +364,26 @@ namespace EE
                     #if EE_DEVELOPMENT_TOOLS
                     if ( m_pResourceSystem->RequiresHotReloading() )
                     {
+                        Timer<PlatformClock> hotReloadTimer;
+
+                        // Resources reloaded in place only require the components using them to be re-initialized, this needs to happen before any entity is unloaded
+                        if ( !m_pResourceSystem->GetUsersToBeReinitialized().empty() )
+                        {
+                            m_pEntityWorldManager->HotReload_ShutdownComponents( m_pResourceSystem->GetUsersToBeReinitialized(), m_pResourceSystem->GetResourcesReloadedInPlace() );
+                        }
+
                         m_pToolsUI->HotReload_UnloadResources( m_pResourceSystem->GetUsersToBeReloaded(), m_pResourceSystem->GetResourcesToBeReloaded() );
-                        m_pEntityWorldManager->HotReload_UnloadEntities( m_pResourceSystem->GetUsersToBeReloaded() );
+
+                        if ( !m_pResourceSystem->GetUsersToBeReloaded().empty() )
+                        {
+                            m_pEntityWorldManager->HotReload_UnloadEntities( m_pResourceSystem->GetUsersToBeReloaded() );
+                        }
+
+                        uint32_t const numUsersReloaded = (uint32_t) m_pResourceSystem->GetUsersToBeReloaded().size();
+                        uint32_t const numUsersReinitialized = (uint32_t) m_pResourceSystem->GetUsersToBeReinitialized().size();
 
                         // Ensure that all resource requests (both load/unload are completed before continuing with the hot-reload)
+                        m_pResourceSystem->SwapInPlaceReloadedResources();
                         m_pResourceSystem->ClearHotReloadRequests();
                         while ( m_pResourceSystem->IsBusy() )
                         {
@@ -377,6 +393,8 @@ namespace EE
 
                         m_pToolsUI->HotReload_ReloadResources();
                         m_pEntityWorldManager->HotReload_ReloadEntities();
+
+                        EE_LOG_INFO( "Resource", "Hot Reload", "Hot-reload took %.2fms (%u users reloaded, %u users re-initialized)", hotReloadTimer.GetElapsedTimeMilliseconds().ToFloat(), numUsersReloaded, numUsersReinitialized );
                     }
                     #endif
                 }
@@ -10,142 +10,230 @@
 
 namespace EE::TypeSystem::Reflection
 {
+    ClangParser::TranslationUnit::TranslationUnit( ProjectInfo const* pProject, TVector<HeaderInfo*> const& headers, FileSystem::Path const& amalgamatedHeaderPath, TVector<char const*> const& clangArgs )
+        : ITaskSet( 1 )
+        , m_pProject( pProject )
+        , m_headers( headers )
+        , m_amalgamatedHeaderPath( amalgamatedHeaderPath )
+        , m_clangArgs( clangArgs )
+    {
+        EE_ASSERT( m_pProject != nullptr && !m_headers.empty() );
+    }
+
+    ClangParser::TranslationUnit::~TranslationUnit()
+    {
+        if ( m_tu != nullptr )
+        {
+            clang_disposeTranslationUnit( m_tu );
+        }
+
+        if ( m_index != nullptr )
+        {
+            clang_disposeIndex( m_index );
+        }
+    }
+
+    void ClangParser::TranslationUnit::ExecuteRange( TaskSetPartition range, uint32_t threadnum )
+    {
+        EE_ASSERT( m_index == nullptr && m_tu == nullptr );
+
+        // Each translation unit gets its own index, libclang only requires that an index isnt used concurrently
+        ScopedTimer<PlatformClock> timer( m_parsingTime );
+        m_index = clang_createIndex( 0, 1 );
+        uint32_t const clangOptions = CXTranslationUnit_DetailedPreprocessingRecord | CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_IncludeBriefCommentsInCodeCompletion;
+        m_result = clang_parseTranslationUnit2( m_index, m_amalgamatedHeaderPath.c_str(), m_clangArgs.data(), (int32_t) m_clangArgs.size(), 0, 0, clangOptions, &m_tu );
+    }
+
+    //-------------------------------------------------------------------------
+
     ClangParser::ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath )
         : m_context( pSolution, pDatabase )
-        , m_totalParsingTime( 0 )
-        , m_totalVisitingTime( 0 )
         , m_reflectionDataPath( reflectionDataPath )
     {}
 
-    bool ClangParser::Parse( TVector<HeaderInfo*> const& headers, Pass pass )
+    ClangParser::~ClangParser()
     {
-        m_context.m_detectDevOnlyTypesAndProperties = ( pass == NoDevToolsPass );
+        DestroyTranslationUnits();
+    }
+
+    void ClangParser::AddTranslationUnit( ProjectInfo const* pProject, TVector<HeaderInfo*> const& headers )
+    {
+        EE_ASSERT( pProject != nullptr );
 
-        // Create single amalgamated header file for all headers to parse
+        // Create an amalgamated header file for all headers to parse
         //-------------------------------------------------------------------------
 
         std::ofstream reflectorFileStream;
-        FileSystem::Path const reflectorHeader = m_reflectionDataPath + "Reflector.h";
+        FileSystem::Path const reflectorHeader = m_reflectionDataPath + String( String::CtorSprintf(), "Reflector_%s.h", pProject->m_shortName.c_str() ).c_str();
         reflectorHeader.EnsureDirectoryExists();
         reflectorFileStream.open( reflectorHeader.c_str(), std::ios::out | std::ios::trunc );
         EE_ASSERT( !reflectorFileStream.fail() );
 
         String includeStr;
-        m_context.m_headersToVisit.clear();
         for ( HeaderInfo const* pHeader : headers )
         {
-            // Exclude dev tools
-            if ( pass == NoDevToolsPass && pHeader->IsInToolsLayer() )
-            {
-                continue;
-            }
-
-            m_context.m_headersToVisit.emplace_back( pHeader->m_ID, pHeader );
             includeStr += "#include \"" + pHeader->m_filePath.GetString() + "\"\n";
         }
 
         reflectorFileStream.write( includeStr.c_str(), includeStr.size() );
         reflectorFileStream.close();
 
-        // Clang args
-        TInlineVector<String, 10> fullIncludePaths;
-        TInlineVector<char const*, 10> clangArgs;
+        //-------------------------------------------------------------------------
+
+        m_translationUnits.emplace_back( EE::New<TranslationUnit>( pProject, headers, reflectorHeader, m_clangArgs ) );
+    }
+
+    void ClangParser::DestroyTranslationUnits()
+    {
+        for ( auto& pTranslationUnit : m_translationUnits )
+        {
+            EE::Delete( pTranslationUnit );
+        }
+
+        m_translationUnits.clear();
+    }
+
+    bool ClangParser::CreateClangArgs()
+    {
+        m_fullIncludePaths.clear();
+        m_clangArgs.clear();
+
         int32_t const numIncludePaths = sizeof( Settings::g_includePaths ) / sizeof( Settings::g_includePaths[0] );
         for ( auto i = 0; i < numIncludePaths; i++ )
         {
             String const fullPath = m_context.m_pSolution->m_path.GetString() + Settings::g_includePaths[i];
-            String const shortPath = Platform::Win32::GetShortPath( fullPath );
-            fullIncludePaths.push_back( "-I" + shortPath );
-            clangArgs.push_back( fullIncludePaths.back().c_str() );
-
             if ( !FileSystem::Exists( fullPath ) )
             {
                 m_context.LogError( "Invalid include path: %s", fullPath.c_str() );
                 return false;
             }
+
+            String const shortPath = Platform::Win32::GetShortPath( fullPath );
+            m_fullIncludePaths.push_back( "-I" + shortPath );
         }
 
-        clangArgs.push_back( "-x" );
-        clangArgs.push_back( "c++" );
-        clangArgs.push_back( "-std=c++17" );
-        clangArgs.push_back( "-O0" );
-        clangArgs.push_back( "-D NDEBUG" );
-        clangArgs.push_back( "-Werror" );
-        clangArgs.push_back( "-Wno-deprecated-builtins" );
-        clangArgs.push_back( "-fparse-all-comments" );
-        clangArgs.push_back( "-fms-extensions" );
-        clangArgs.push_back( "-fms-compatibility" );
-        clangArgs.push_back( "-Wno-unknown-warning-option" );
-        clangArgs.push_back( "-Wno-return-type-c-linkage" );
-        clangArgs.push_back( "-Wno-gnu-folding-constant" );
-
-        // Exclude dev tools
-        if ( pass == NoDevToolsPass )
+        // Only take the string ptrs once all paths are added, since adding paths can move the strings
+        for ( auto const& includePath : m_fullIncludePaths )
         {
-            clangArgs.push_back( Settings::g_devToolsExclusionDefine );
+            m_clangArgs.push_back( includePath.c_str() );
         }
 
+        m_clangArgs.push_back( "-x" );
+        m_clangArgs.push_back( "c++" );
+        m_clangArgs.push_back( "-std=c++17" );
+        m_clangArgs.push_back( "-O0" );
+        m_clangArgs.push_back( "-D NDEBUG" );
+        m_clangArgs.push_back( "-Werror" );
+        m_clangArgs.push_back( "-Wno-deprecated-builtins" );
+        m_clangArgs.push_back( "-fparse-all-comments" );
+        m_clangArgs.push_back( "-fms-extensions" );
+        m_clangArgs.push_back( "-fms-compatibility" );
+        m_clangArgs.push_back( "-Wno-unknown-warning-option" );
+        m_clangArgs.push_back( "-Wno-return-type-c-linkage" );
+        m_clangArgs.push_back( "-Wno-gnu-folding-constant" );
+
         // Note: i am not sure if this is the proper way to add custom macro
-        clangArgs.push_back( Settings::g_engineGraphicBackendMacroDefine );
-        
-        //-------------------------------------------------------------------------
+        m_clangArgs.push_back( Settings::g_engineGraphicBackendMacroDefine );
 
-        // Set up clang
-        auto idx = clang_createIndex( 0, 1 );
-        uint32_t const clangOptions = CXTranslationUnit_DetailedPreprocessingRecord | CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_IncludeBriefCommentsInCodeCompletion;
+        return true;
+    }
 
-        // Parse Headers
-        CXTranslationUnit tu;
-        CXErrorCode result = CXError_Failure;
+    bool ClangParser::Parse( TaskSystem& taskSystem )
+    {
+        EE_ASSERT( taskSystem.IsInitialized() );
+
+        if ( !CreateClangArgs() )
         {
-            ScopedTimer<PlatformClock> timer( m_totalParsingTime );
-            result = clang_parseTranslationUnit2( idx, reflectorHeader.c_str(), clangArgs.data(), clangArgs.size(), 0, 0, clangOptions, &tu );
+            DestroyTranslationUnits();
+            return false;
         }
 
-        // Handle result of parse
-        if ( result == CXError_Success )
+        // Kick off all parses
+        //-------------------------------------------------------------------------
+
+        for ( auto pTranslationUnit : m_translationUnits )
         {
-            ScopedTimer<PlatformClock> timer( m_totalVisitingTime );
-            m_context.Reset( &tu );
-            auto cursor = clang_getTranslationUnitCursor( tu );
-            clang_visitChildren( cursor, VisitTranslationUnit, &m_context );
+            taskSystem.ScheduleTask( pTranslationUnit );
         }
-        else
+
+        // Visit each translation unit as soon as it (and all the ones before it) have been parsed
+        //-------------------------------------------------------------------------
+
+        for ( auto pTranslationUnit : m_translationUnits )
         {
-            switch ( result )
+            taskSystem.WaitForTask( pTranslationUnit );
+
+            if ( !m_context.HasErrorOccured() )
             {
-                case CXError_Failure:
-                m_context.LogError( "Clang Unknown failure" );
-                break;
+                VisitParsedTranslationUnit( pTranslationUnit );
+            }
 
-                case CXError_Crashed:
-                m_context.LogError( "Clang crashed" );
-                break;
+            // Release the AST as soon as possible since they are quite large
+            if ( pTranslationUnit->m_tu != nullptr )
+            {
+                clang_disposeTranslationUnit( pTranslationUnit->m_tu );
+                pTranslationUnit->m_tu = nullptr;
+            }
+        }
 
-                case CXError_InvalidArguments:
-                m_context.LogError( "Clang Invalid arguments" );
-                break;
+        //-------------------------------------------------------------------------
 
-                case CXError_ASTReadError:
-                m_context.LogError( "Clang AST read error" );
-                break;
-            }
+        // If we have an error from the parser, prepend the header to it
+        if ( m_context.HasErrorOccured() )
+        {
+            m_context.LogError( "\n%s", m_context.GetErrorMessage() );
+        }
+
+        return !m_context.HasErrorOccured();
+    }
+
+    bool ClangParser::VisitParsedTranslationUnit( TranslationUnit* pTranslationUnit )
+    {
+        switch ( pTranslationUnit->m_result )
+        {
+            case CXError_Success:
+            break;
+
+            case CXError_Failure:
+            m_context.LogError( "Clang Unknown failure (%s)", pTranslationUnit->m_pProject->m_name.c_str() );
+            return false;
+
+            case CXError_Crashed:
+            m_context.LogError( "Clang crashed (%s)", pTranslationUnit->m_pProject->m_name.c_str() );
+            return false;
+
+            case CXError_InvalidArguments:
+            m_context.LogError( "Clang Invalid arguments (%s)", pTranslationUnit->m_pProject->m_name.c_str() );
+            return false;
+
+            case CXError_ASTReadError:
+            m_context.LogError( "Clang AST read error (%s)", pTranslationUnit->m_pProject->m_name.c_str() );
+            return false;
         }
-        clang_disposeIndex( idx );
 
         //-------------------------------------------------------------------------
 
-        if ( !m_context.HasErrorOccured() )
         {
-            m_context.CheckForOrphanedReflectionMacros();
+            ScopedTimer<PlatformClock> timer( pTranslationUnit->m_visitingTime );
+
+            m_context.m_headersToVisit.clear();
+            for ( HeaderInfo const* pHeader : pTranslationUnit->m_headers )
+            {
+                m_context.m_headersToVisit.emplace_back( pHeader->m_ID, pHeader );
+            }
+
+            m_context.Reset( &pTranslationUnit->m_tu );
+            auto cursor = clang_getTranslationUnitCursor( pTranslationUnit->m_tu );
+            clang_visitChildren( cursor, VisitTranslationUnit, &m_context );
         }
 
-        // If we have an error from the parser, prepend the header to it
-        if ( m_context.HasErrorOccured() )
+        //-------------------------------------------------------------------------
+
+        if ( !m_context.HasErrorOccured() )
         {
-            m_context.LogError( "\n%s", m_context.GetErrorMessage() );
+            m_context.CheckForOrphanedReflectionMacros();
         }
 
         return !m_context.HasErrorOccured();
     }
-}
\ No newline at end of file
+}
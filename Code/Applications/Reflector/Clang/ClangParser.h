@@ -1,9 +1,15 @@
 #pragma once
 
 #include "ClangParserContext.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
+// Clang Parser
+//-------------------------------------------------------------------------
+// We create a translation unit per module, containing only the headers of that module that need to be reflected
+// All translation units are parsed concurrently, and then visited on the calling thread in the order they were added
+// Visiting needs to happen in module dependency order since we validate property types against the already registered types
 
 namespace EE::TypeSystem::Reflection
 {
@@ -11,27 +17,63 @@ namespace EE::TypeSystem::Reflection
     {
     public:
 
-        enum Pass
+        class TranslationUnit final : public ITaskSet
         {
-            DevToolsPass,
-            NoDevToolsPass
+            friend ClangParser;
+
+        public:
+
+            TranslationUnit( ProjectInfo const* pProject, TVector<HeaderInfo*> const& headers, FileSystem::Path const& amalgamatedHeaderPath, TVector<char const*> const& clangArgs );
+            ~TranslationUnit();
+
+            inline ProjectInfo const* GetProject() const { return m_pProject; }
+            inline int32_t GetNumHeaders() const { return (int32_t) m_headers.size(); }
+            inline Milliseconds GetParsingTime() const { return m_parsingTime; }
+            inline Milliseconds GetVisitingTime() const { return m_visitingTime; }
+
+        private:
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final;
+
+        private:
+
+            ProjectInfo const*                  m_pProject = nullptr;
+            TVector<HeaderInfo*>                m_headers;
+            FileSystem::Path                    m_amalgamatedHeaderPath;
+            TVector<char const*> const&         m_clangArgs;
+            CXIndex                             m_index = nullptr;
+            CXTranslationUnit                   m_tu = nullptr;
+            CXErrorCode                         m_result = CXError_Failure;
+            Milliseconds                        m_parsingTime = 0;
+            Milliseconds                        m_visitingTime = 0;
         };
 
     public:
 
         ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath );
+        ~ClangParser();
+
+        // Add a translation unit for a set of headers from a single module, these need to be added in dependency order
+        void AddTranslationUnit( ProjectInfo const* pProject, TVector<HeaderInfo*> const& headers );
 
-        inline Milliseconds GetParsingTime() const { return m_totalParsingTime; }
-        inline Milliseconds GetVisitingTime() const { return m_totalVisitingTime; }
+        // Parse all the translation units concurrently and visit them in order
+        bool Parse( TaskSystem& taskSystem );
 
-        bool Parse( TVector<HeaderInfo*> const& headers, Pass pass );
+        inline TVector<TranslationUnit*> const& GetTranslationUnits() const { return m_translationUnits; }
         String GetErrorMessage() const { return m_context.GetErrorMessage(); }
 
+    private:
+
+        bool CreateClangArgs();
+        bool VisitParsedTranslationUnit( TranslationUnit* pTranslationUnit );
+        void DestroyTranslationUnits();
+
     private:
 
         ClangParserContext                  m_context;
-        Milliseconds                        m_totalParsingTime;
-        Milliseconds                        m_totalVisitingTime;
         FileSystem::Path                    m_reflectionDataPath;
+        TVector<TranslationUnit*>           m_translationUnits;
+        TInlineVector<String, 10>           m_fullIncludePaths;
+        TVector<char const*>                m_clangArgs;
     };
 }
@@ -153,6 +153,20 @@ namespace EE::TypeSystem::Reflection
         return nullptr;
     }
 
+    bool ClangParserContext::IsDevelopmentToolsOnly( HeaderID headerID, uint32_t lineNumber ) const
+    {
+        HeaderInfo const* pHeaderInfo = GetHeaderInfo( headerID );
+        EE_ASSERT( pHeaderInfo != nullptr );
+
+        // Everything in the tools layer is excluded from non-dev builds
+        if ( pHeaderInfo->IsInToolsLayer() )
+        {
+            return true;
+        }
+
+        return pHeaderInfo->IsLineInDevelopmentToolsOnlyBlock( lineNumber );
+    }
+
     void ClangParserContext::Reset( CXTranslationUnit* pTU )
     {
         EE_ASSERT( m_namespaceStack.empty() );
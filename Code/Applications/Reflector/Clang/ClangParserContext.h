@@ -88,6 +88,9 @@ namespace EE::TypeSystem::Reflection
 
         HeaderInfo const* GetHeaderInfo( HeaderID headerID ) const;
 
+        // Is the declaration at this line only available when the development tools are enabled
+        bool IsDevelopmentToolsOnly( HeaderID headerID, uint32_t lineNumber ) const;
+
         void Reset( CXTranslationUnit* pTU );
         void PushNamespace( String const& name );
         void PopNamespace();
@@ -118,10 +121,6 @@ namespace EE::TypeSystem::Reflection
     public:
 
         CXTranslationUnit*                                      m_pTU;
-
-        // Should we do a full pass or just update the flags?
-        bool                                                    m_detectDevOnlyTypesAndProperties = false;
-
         SolutionInfo*                                           m_pSolution;
         ReflectionDatabase*                                     m_pDatabase;
         TVector<HeaderToVisit>                                  m_headersToVisit;
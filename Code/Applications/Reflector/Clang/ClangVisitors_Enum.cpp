@@ -121,13 +121,14 @@ namespace EE
                 ReflectionMacro macro;
                 if ( pContext->GetReflectionMacroForType( headerID, cr, macro ) )
                 {
-                    if ( pContext->m_detectDevOnlyTypesAndProperties || !pContext->m_pDatabase->IsTypeRegistered( enumTypeID ) )
+                    if ( !pContext->m_pDatabase->IsTypeRegistered( enumTypeID ) )
                     {
                         ReflectedType enumDescriptor( enumTypeID, cursorName );
                         enumDescriptor.m_headerID = headerID;
                         enumDescriptor.m_namespace = pContext->GetCurrentNamespace();
                         enumDescriptor.m_flags.SetFlag( ReflectedType::Flags::IsEnum );
                         enumDescriptor.m_underlyingType = underlyingCoreType;
+                        enumDescriptor.m_isDevOnly = pContext->IsDevelopmentToolsOnly( headerID, ClangUtils::GetLineNumberForCursor( cr ) );
 
                         // Record current parent type, and update it to the new type
                         void* pPreviousParentReflectedType = pContext->m_pParentReflectedType;
@@ -138,7 +139,7 @@ namespace EE
                         // Reset parent type back to original parent
                         pContext->m_pParentReflectedType = pPreviousParentReflectedType;
 
-                        pContext->m_pDatabase->RegisterType( &enumDescriptor, pContext->m_detectDevOnlyTypesAndProperties );
+                        pContext->m_pDatabase->RegisterType( &enumDescriptor );
                     }
                 }
 
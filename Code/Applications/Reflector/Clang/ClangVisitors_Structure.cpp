@@ -147,6 +147,7 @@ namespace EE::TypeSystem::Reflection
                 {
                     pClass->m_properties.push_back( ReflectedProperty( ClangUtils::GetCursorDisplayName( cr ), lineNumber ) );
                     ReflectedProperty& propertyDesc = pClass->m_properties.back();
+                    propertyDesc.m_isDevOnly = pClass->m_isDevOnly || pContext->IsDevelopmentToolsOnly( pClass->m_headerID, lineNumber );
 
                     // Try read any user comments for this field
                     CXString const commentString = clang_Cursor_getBriefCommentText( cr );
@@ -374,7 +375,7 @@ namespace EE::TypeSystem::Reflection
             EE_ASSERT( macro.IsValid() );
 
             // Modules
-            if ( macro.IsModuleMacro() && !pContext->m_detectDevOnlyTypesAndProperties )
+            if ( macro.IsModuleMacro() )
             {
                 String const moduleName = pContext->GetCurrentNamespace() + cursorName;
 
@@ -388,7 +389,7 @@ namespace EE::TypeSystem::Reflection
 
             //-------------------------------------------------------------------------
 
-            if ( macro.IsRegisteredResourceMacro() && !pContext->m_detectDevOnlyTypesAndProperties )
+            if ( macro.IsRegisteredResourceMacro() )
             {
                 // Register the resource
                 ReflectedResourceType resource;
@@ -446,6 +447,7 @@ namespace EE::TypeSystem::Reflection
                 classDescriptor.m_flags.SetFlag( ReflectedType::Flags::IsEntitySystem, ( macro.IsEntitySystemMacro() || cursorName == Reflection::Settings::g_baseEntitySystemClassName ) );
                 classDescriptor.m_flags.SetFlag( ReflectedType::Flags::IsEntityWorldSystem, ( macro.IsEntityWorldSystemMacro() ) );
                 classDescriptor.m_flags.SetFlag( ReflectedType::Flags::IsAbstract, pRecordDecl->isAbstract() );
+                classDescriptor.m_isDevOnly = pContext->IsDevelopmentToolsOnly( headerID, ClangUtils::GetLineNumberForCursor( cr ) );
 
                 // Record current parent type, and update it to the new type
                 void* pPreviousParentReflectedType = pContext->m_pParentReflectedType;
@@ -461,7 +463,7 @@ namespace EE::TypeSystem::Reflection
                     return CXChildVisit_Break;
                 }
 
-                pContext->m_pDatabase->RegisterType( &classDescriptor, pContext->m_detectDevOnlyTypesAndProperties );
+                pContext->m_pDatabase->RegisterType( &classDescriptor );
             }
         }
 
@@ -2,6 +2,7 @@
 #include "Applications/Reflector/ReflectorSettingsAndUtils.h"
 #include "Base/TypeSystem/TypeID.h"
 #include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Time/Timers.h"
 #include "Base/Utils/TopologicalSort.h"
 #include <eastl/sort.h>
 #include <fstream>
@@ -145,6 +146,8 @@ namespace EE::TypeSystem::Reflection
         // Generate code per project
         //-------------------------------------------------------------------------
 
+        m_projectGenerationTimes.clear();
+
         for ( ProjectInfo const& prj : solutionInfo.m_projects )
         {
             // Ignore module less projects
@@ -153,6 +156,15 @@ namespace EE::TypeSystem::Reflection
                 continue;
             }
 
+            ProjectGenerationTime& projectTime = m_projectGenerationTimes.emplace_back();
+            projectTime.m_pProject = &prj;
+
+            for ( HeaderInfo const& headerInfo : prj.m_headerFiles )
+            {
+                projectTime.m_numGeneratedHeaders += headerInfo.m_isDirty ? 1 : 0;
+            }
+
+            ScopedTimer<PlatformClock> timer( projectTime.m_generationTime );
             GenerateCodeForProject( prj );
         }
 
@@ -182,17 +194,8 @@ namespace EE::TypeSystem::Reflection
         FileSystem::Path const projectAutoGenDirectoryPath = projectInfo.GetAutogeneratedDirectoryPath();
         projectAutoGenDirectoryPath.EnsureDirectoryExists();
 
-        // Delete any unknown files from the auto generated directory
-        //-------------------------------------------------------------------------
-
-        TVector<FileSystem::Path> files;
-        FileSystem::GetDirectoryContents( projectAutoGenDirectoryPath, files, FileSystem::DirectoryReaderOutput::OnlyFiles );
-        for ( auto const& file : files )
-        {
-            FileSystem::EraseFile( file );
-        }
-
         // Generate code files for the dirty headers
+        // Clean headers only need to be generated if their generated file is missing
         //-------------------------------------------------------------------------
 
         TVector<FileSystem::Path> generatedTypeInfoHeaders;
@@ -211,9 +214,12 @@ namespace EE::TypeSystem::Reflection
             {
                 // Generate typeinfo file for header
                 generatedTypeInfoHeaders.emplace_back( headerInfo.GetTypeInfoFilePath( projectAutoGenDirectoryPath ) );
-                if ( !GenerateTypeInfoFileForHeader( projectInfo, headerInfo, typesInHeader, generatedTypeInfoHeaders.back() ) )
+                if ( headerInfo.m_isDirty || !FileSystem::Exists( generatedTypeInfoHeaders.back() ) )
                 {
-                    return false;
+                    if ( !GenerateTypeInfoFileForHeader( projectInfo, headerInfo, typesInHeader, generatedTypeInfoHeaders.back() ) )
+                    {
+                        return false;
+                    }
                 }
 
                 //-------------------------------------------------------------------------
@@ -246,9 +252,12 @@ namespace EE::TypeSystem::Reflection
                     if ( hasEntityComponentTypeInfo )
                     {
                         generatedCodeGenHeaders.emplace_back( headerInfo.GetCodeGenFilePath( projectAutoGenDirectoryPath ) );
-                        if ( !GenerateCodeGenFileForHeader( projectInfo, headerInfo, typesInHeader, generatedCodeGenHeaders.back() ) )
+                        if ( headerInfo.m_isDirty || !FileSystem::Exists( generatedCodeGenHeaders.back() ) )
                         {
-                            return false;
+                            if ( !GenerateCodeGenFileForHeader( projectInfo, headerInfo, typesInHeader, generatedCodeGenHeaders.back() ) )
+                            {
+                                return false;
+                            }
                         }
                     }
                 }
@@ -271,6 +280,29 @@ namespace EE::TypeSystem::Reflection
             }
         }
 
+        // Delete any unknown files from the auto generated directory
+        //-------------------------------------------------------------------------
+
+        FileSystem::Path const projectTypeInfoFilePath = projectInfo.GetTypeInfoFilePath();
+        FileSystem::Path const projectCodeGenFilePath = projectInfo.GetCodeGenFilePath();
+
+        TVector<FileSystem::Path> files;
+        FileSystem::GetDirectoryContents( projectAutoGenDirectoryPath, files, FileSystem::DirectoryReaderOutput::OnlyFiles );
+        for ( auto const& file : files )
+        {
+            if ( file == projectTypeInfoFilePath || file == projectCodeGenFilePath )
+            {
+                continue;
+            }
+
+            if ( VectorContains( generatedTypeInfoHeaders, file ) || VectorContains( generatedCodeGenHeaders, file ) )
+            {
+                continue;
+            }
+
+            FileSystem::EraseFile( file );
+        }
+
         return true;
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Applications/Reflector/Database/ReflectionDatabase.h"
+#include "Base/Time/Time.h"
 #include <sstream>
 
 //-------------------------------------------------------------------------
@@ -20,6 +21,15 @@ namespace EE::TypeSystem::Reflection
             Tools
         };
 
+    public:
+
+        struct ProjectGenerationTime
+        {
+            ProjectInfo const*              m_pProject = nullptr;
+            int32_t                         m_numGeneratedHeaders = 0;
+            Milliseconds                    m_generationTime = 0;
+        };
+
     public:
 
         CodeGenerator( ReflectionDatabase const& database ) : m_pDatabase( &database ) {}
@@ -33,6 +43,8 @@ namespace EE::TypeSystem::Reflection
 
         bool GenerateCodeForSolution( SolutionInfo const& solutionInfo );
 
+        inline TVector<ProjectGenerationTime> const& GetProjectGenerationTimes() const { return m_projectGenerationTimes; }
+
     private:
 
         // Solution/Project Generation Entry Points
@@ -83,6 +95,7 @@ namespace EE::TypeSystem::Reflection
     private:
 
         ReflectionDatabase const*           m_pDatabase;
+        TVector<ProjectGenerationTime>      m_projectGenerationTimes;
         mutable String                      m_warningMessage;
         mutable String                      m_errorMessage;
     };
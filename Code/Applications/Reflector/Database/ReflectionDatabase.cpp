@@ -310,28 +310,10 @@ namespace EE::TypeSystem::Reflection
         }
     }
 
-    void ReflectionDatabase::RegisterType( ReflectedType const* pType, bool onlyUpdateDevFlag )
+    void ReflectionDatabase::RegisterType( ReflectedType const* pType )
     {
-        if ( onlyUpdateDevFlag )
-        {
-            auto pReflectedType = GetType( pType->m_ID );
-            EE_ASSERT( pReflectedType != nullptr );
-            pReflectedType->m_isDevOnly = false;
-
-            for ( auto const& property : pType->m_properties )
-            {
-                auto foundIter = VectorFind( pReflectedType->m_properties, property );
-                if ( foundIter != pReflectedType->m_properties.end() )
-                {
-                    foundIter->m_isDevOnly = false;
-                }
-            }
-        }
-        else
-        {
-            EE_ASSERT( pType != nullptr && !IsTypeRegistered( pType->m_ID ) );
-            m_reflectedTypes.emplace_back( *pType );
-        }
+        EE_ASSERT( pType != nullptr && !IsTypeRegistered( pType->m_ID ) );
+        m_reflectedTypes.emplace_back( *pType );
     }
 
     ReflectedProperty const* ReflectionDatabase::GetPropertyTypeDescriptor( TypeID typeID, PropertyPath const& pathID ) const
@@ -447,6 +429,15 @@ namespace EE::TypeSystem::Reflection
             return false;
         }
 
+        // If the database is from an older version, discard its contents so that we re-reflect everything
+        if ( GetDatabaseVersion() != s_databaseVersion )
+        {
+            if ( !DropTables() )
+            {
+                return false;
+            }
+        }
+
         if ( !CreateTables() )
         {
             return false;
@@ -455,6 +446,7 @@ namespace EE::TypeSystem::Reflection
         m_reflectedProjects.clear();
         m_reflectedHeaders.clear();
         m_reflectedTypes.clear();
+        m_reflectedResourceTypes.clear();
 
         // Read all projects
         //-------------------------------------------------------------------------
@@ -528,6 +520,7 @@ namespace EE::TypeSystem::Reflection
                 type.m_name = (char const*) sqlite3_column_text( pStatement, 3 );
                 type.m_namespace = (char const*) sqlite3_column_text( pStatement, 4 );
                 type.m_flags.Set( (uint32_t) sqlite3_column_int( pStatement, 5 ) );
+                type.m_isDevOnly = sqlite3_column_int( pStatement, 6 ) != 0;
 
                 // Read additional type data
                 if ( type.IsEnum() )
@@ -575,12 +568,13 @@ namespace EE::TypeSystem::Reflection
                 resourceType.m_headerID = StringID( sqlite3_column_int( pStatement, 3 ) );
                 resourceType.m_className = (char const*) sqlite3_column_text( pStatement, 4 );
                 resourceType.m_namespace = (char const*) sqlite3_column_text( pStatement, 5 );
-                m_reflectedResourceTypes.push_back( resourceType );
 
                 if ( !ReadAdditionalResourceTypeData( resourceType ) )
                 {
                     return false;
                 }
+
+                m_reflectedResourceTypes.push_back( resourceType );
             }
 
             if ( !IsValidSQLiteResult( sqlite3_finalize( pStatement ) ) )
@@ -620,6 +614,11 @@ namespace EE::TypeSystem::Reflection
             return false;
         }
 
+        if ( !ExecuteSimpleQuery( "PRAGMA user_version = %d;", s_databaseVersion ) )
+        {
+            return false;
+        }
+
         // Write all projects
         //-------------------------------------------------------------------------
 
@@ -647,7 +646,7 @@ namespace EE::TypeSystem::Reflection
 
         for ( auto const& type : m_reflectedTypes )
         {
-            if ( !ExecuteSimpleQuery( "INSERT OR REPLACE INTO `Types`(`TypeID`, `ParentID`, `HeaderID`,`Name`,`Namespace`,`TypeFlags`) VALUES ( %u, %u, %u, \"%s\", \"%s\", %u );", (uint32_t) type.m_ID, (uint32_t) type.m_parentID, (uint32_t) type.m_headerID, type.m_name.c_str(), type.m_namespace.c_str(), (uint32_t) type.m_flags ) )
+            if ( !ExecuteSimpleQuery( "INSERT OR REPLACE INTO `Types`(`TypeID`, `ParentID`, `HeaderID`,`Name`,`Namespace`,`TypeFlags`,`IsDevOnly`) VALUES ( %u, %u, %u, \"%s\", \"%s\", %u, %d );", (uint32_t) type.m_ID, (uint32_t) type.m_parentID, (uint32_t) type.m_headerID, type.m_name.c_str(), type.m_namespace.c_str(), (uint32_t) type.m_flags, type.m_isDevOnly ? 1 : 0 ) )
             {
                 return false;
             }
@@ -719,12 +718,12 @@ namespace EE::TypeSystem::Reflection
         // Type registration tables
         //-------------------------------------------------------------------------
 
-        if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `Types` ( `TypeID` INTEGER UNIQUE, `ParentID` INTEGER, `HeaderID` INTEGER, `Name` TEXT, `Namespace` TEXT, `TypeFlags` INTEGER, PRIMARY KEY( `TypeID` ) );" ) )
+        if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `Types` ( `TypeID` INTEGER UNIQUE, `ParentID` INTEGER, `HeaderID` INTEGER, `Name` TEXT, `Namespace` TEXT, `TypeFlags` INTEGER, `IsDevOnly` INTEGER, PRIMARY KEY( `TypeID` ) );" ) )
         {
             return false;
         }
 
-        if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `Properties` ( `PropertyID` INTEGER, `LineNumber` INTEGER, `OwnerTypeID` INTEGER, `TypeID` INTEGER, `Name` TEXT, `Description` TEXT, `TypeName` TEXT, `TemplateTypeName` TEXT, `PropertyFlags` INTEGER, `ArraySize` INTEGER DEFAULT -1, `MetaData` TEXT, PRIMARY KEY( PropertyID, OwnerTypeID ) );" ) )
+        if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `Properties` ( `PropertyID` INTEGER, `LineNumber` INTEGER, `OwnerTypeID` INTEGER, `TypeID` INTEGER, `Name` TEXT, `Description` TEXT, `TypeName` TEXT, `TemplateTypeName` TEXT, `PropertyFlags` INTEGER, `ArraySize` INTEGER DEFAULT -1, `MetaData` TEXT, `IsDevOnly` INTEGER, PRIMARY KEY( PropertyID, OwnerTypeID ) );" ) )
         {
             return false;
         }
@@ -755,6 +754,25 @@ namespace EE::TypeSystem::Reflection
         return true;
     }
 
+    int32_t ReflectionDatabase::GetDatabaseVersion() const
+    {
+        EE_ASSERT( m_pDatabase != nullptr );
+
+        int32_t version = 0;
+        sqlite3_stmt* pStatement = nullptr;
+        if ( sqlite3_prepare_v2( m_pDatabase, "PRAGMA user_version;", -1, &pStatement, nullptr ) == SQLITE_OK )
+        {
+            if ( sqlite3_step( pStatement ) == SQLITE_ROW )
+            {
+                version = sqlite3_column_int( pStatement, 0 );
+            }
+
+            sqlite3_finalize( pStatement );
+        }
+
+        return version;
+    }
+
     bool ReflectionDatabase::DropTables()
     {
         EE_ASSERT( m_pDatabase != nullptr );
@@ -828,6 +846,7 @@ namespace EE::TypeSystem::Reflection
                 propDesc.m_flags.Set( (uint32_t) sqlite3_column_int( pStatement, 8 ) );
                 propDesc.m_arraySize = sqlite3_column_int( pStatement, 9 );
                 propDesc.m_metaData = (char const*) sqlite3_column_text( pStatement, 10 );
+                propDesc.m_isDevOnly = sqlite3_column_int( pStatement, 11 ) != 0;
                 propDesc.m_propertyID = StringID( propDesc.m_name );
                 EE_ASSERT( propDesc.m_propertyID == (uint32_t) sqlite3_column_int( pStatement, 0 ) ); // Ensure the property ID matches the recorded one
 
@@ -930,7 +949,7 @@ namespace EE::TypeSystem::Reflection
                 StringUtils::ReplaceAllOccurrencesInPlace( escapedMetaData, "\"", "\"\"" );
             }
 
-            if ( !ExecuteSimpleQuery( "INSERT OR REPLACE INTO `Properties`(`PropertyID`, `LineNumber`, `OwnerTypeID`,`TypeID`,`Name`,`Description`,`TypeName`,`TemplateTypeName`,`PropertyFlags`,`ArraySize`,`MetaData`) VALUES ( %u, %d, %u, %u, \"%s\", \"%s\", \"%s\", \"%s\", %u, %d, \"%s\" );", (uint32_t) propertyDesc.m_propertyID, propertyDesc.m_lineNumber, (uint32_t) type.m_ID, (uint32_t) propertyDesc.m_typeID, propertyDesc.m_name.c_str(), escapedDescription.c_str(), propertyDesc.m_typeName.c_str(), propertyDesc.m_templateArgTypeName.c_str(), (uint32_t) propertyDesc.m_flags, propertyDesc.m_arraySize, escapedMetaData.c_str() ) )
+            if ( !ExecuteSimpleQuery( "INSERT OR REPLACE INTO `Properties`(`PropertyID`, `LineNumber`, `OwnerTypeID`,`TypeID`,`Name`,`Description`,`TypeName`,`TemplateTypeName`,`PropertyFlags`,`ArraySize`,`MetaData`,`IsDevOnly`) VALUES ( %u, %d, %u, %u, \"%s\", \"%s\", \"%s\", \"%s\", %u, %d, \"%s\", %d );", (uint32_t) propertyDesc.m_propertyID, propertyDesc.m_lineNumber, (uint32_t) type.m_ID, (uint32_t) propertyDesc.m_typeID, propertyDesc.m_name.c_str(), escapedDescription.c_str(), propertyDesc.m_typeName.c_str(), propertyDesc.m_templateArgTypeName.c_str(), (uint32_t) propertyDesc.m_flags, propertyDesc.m_arraySize, escapedMetaData.c_str(), propertyDesc.m_isDevOnly ? 1 : 0 ) )
             {
                 return false;
             }
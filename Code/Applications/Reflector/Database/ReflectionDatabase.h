@@ -14,6 +14,9 @@ namespace EE::TypeSystem::Reflection
     {
         static uint32_t const constexpr s_defaultStatementBufferSize = 8096;
 
+        // Bump this whenever the schema or the generated code changes, this will cause a full re-reflection of the solution
+        static int32_t const constexpr s_databaseVersion = 1;
+
     public:
 
         ReflectionDatabase();
@@ -51,7 +54,7 @@ namespace EE::TypeSystem::Reflection
         bool IsTypeDerivedFrom( TypeID typeID, TypeID parentTypeID ) const;
         void GetAllTypesForHeader( HeaderID headerID, TVector<ReflectedType>& types ) const;
         void GetAllTypesForProject( ProjectID projectID, TVector<ReflectedType>& types ) const;
-        void RegisterType( ReflectedType const* pType, bool onlyUpdateDevFlag );
+        void RegisterType( ReflectedType const* pType );
 
         // Property functions
         //-------------------------------------------------------------------------
@@ -82,6 +85,7 @@ namespace EE::TypeSystem::Reflection
 
         bool CreateTables();
         bool DropTables();
+        int32_t GetDatabaseVersion() const;
 
         bool ReadAdditionalTypeData( ReflectedType& type );
         bool ReadAdditionalEnumData( ReflectedType& type );
@@ -15,6 +15,21 @@ namespace EE::TypeSystem::Reflection
 
     struct HeaderInfo
     {
+        // An inclusive (1-based) range of lines in the header
+        struct LineRange
+        {
+            LineRange( uint32_t startLine, uint32_t endLine ) : m_startLine( startLine ), m_endLine( endLine ) {}
+
+            inline bool ContainsLine( uint32_t lineNumber ) const { return lineNumber >= m_startLine && lineNumber <= m_endLine; }
+
+        public:
+
+            uint32_t                    m_startLine;
+            uint32_t                    m_endLine;
+        };
+
+    public:
+
         inline static HeaderID GetHeaderID( FileSystem::Path const& headerFilePath )
         {
             String lowercasePath = headerFilePath.GetString();
@@ -29,6 +44,20 @@ namespace EE::TypeSystem::Reflection
             return Utils::IsFileUnderToolsProject( m_filePath );
         }
 
+        // Is this line only compiled when the development tools are enabled
+        inline bool IsLineInDevelopmentToolsOnlyBlock( uint32_t lineNumber ) const
+        {
+            for ( auto const& range : m_devToolsOnlyLineRanges )
+            {
+                if ( range.ContainsLine( lineNumber ) )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         inline FileSystem::Path const GetTypeInfoFilePath( FileSystem::Path const& projectDirectoryPath ) const
         {
             return Utils::GetAutogeneratedFilePath( projectDirectoryPath, m_filePath.GetFileNameWithoutExtension().c_str(), Settings::g_typeinfoFileSuffix, "h" );
@@ -45,8 +74,10 @@ namespace EE::TypeSystem::Reflection
         ProjectID                       m_projectID;
         FileSystem::Path                m_filePath;
         uint64_t                        m_timestamp = 0;
-        uint64_t                        m_checksum = 0;
+        uint64_t                        m_checksum = 0; // Hash of the file contents
         TVector<String>                 m_fileContents;
+        TVector<LineRange>              m_devToolsOnlyLineRanges;
+        bool                            m_isDirty = true; // Does this header need to be reflected in this run, not serialized
     };
 
     //-------------------------------------------------------------------------
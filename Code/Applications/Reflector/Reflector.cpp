@@ -6,6 +6,9 @@
 #include "Base/ThirdParty/cmdParser/cmdParser.h"
 
 #include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Encoding/Hash.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Threading/Threading.h"
 #include "Base/Time/Timers.h"
 #include "Base/Utils/TopologicalSort.h"
 
@@ -98,6 +101,110 @@ namespace EE::TypeSystem::Reflection
             projects.swap( sortedProjects );
             return true;
         }
+
+        // Find all the line ranges that are only compiled when the development tools are enabled
+        // This lets us detect dev-only types and properties from a single parse (with the dev tools enabled)
+        void FindDevelopmentToolsOnlyBlocks( TVector<String> const& headerFileContents, TVector<HeaderInfo::LineRange>& outRanges )
+        {
+            struct ConditionalBlock
+            {
+                bool    m_isActiveBranchDevOnly = false;
+                bool    m_areOtherBranchesDevOnly = false;
+            };
+
+            auto IsInDevOnlyBlock = [] ( TInlineVector<ConditionalBlock, 8> const& blockStack )
+            {
+                for ( auto const& block : blockStack )
+                {
+                    if ( block.m_isActiveBranchDevOnly )
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            };
+
+            //-------------------------------------------------------------------------
+
+            outRanges.clear();
+
+            TInlineVector<ConditionalBlock, 8> blockStack;
+            uint32_t rangeStartLine = 0;
+
+            int32_t const numLines = (int32_t) headerFileContents.size();
+            for ( int32_t i = 0; i < numLines; i++ )
+            {
+                String line = headerFileContents[i];
+                line.ltrim();
+                if ( line.empty() || line[0] != '#' )
+                {
+                    continue;
+                }
+
+                // Split the directive and its condition, ignoring any trailing comments
+                line = line.substr( 1 );
+                size_t const commentIdx = line.find( "//" );
+                if ( commentIdx != String::npos )
+                {
+                    line = line.substr( 0, commentIdx );
+                }
+                line.trim();
+
+                size_t const conditionIdx = line.find_first_of( " \t(!" );
+                String const directive = line.substr( 0, conditionIdx );
+                String condition = ( conditionIdx != String::npos ) ? line.substr( conditionIdx ) : String();
+                condition.trim();
+                StringUtils::RemoveAllOccurrencesInPlace( condition, " " );
+
+                //-------------------------------------------------------------------------
+
+                bool const wasInDevOnlyBlock = IsInDevOnlyBlock( blockStack );
+
+                if ( directive == "if" || directive == "ifdef" || directive == "ifndef" )
+                {
+                    bool const isDevToolsCondition = ( directive == "if" && ( condition == "EE_DEVELOPMENT_TOOLS" || condition == "!EE_SHIPPING" ) ) || ( directive == "ifdef" && condition == "EE_DEVELOPMENT_TOOLS" ) || ( directive == "ifndef" && condition == "EE_SHIPPING" );
+                    bool const isNoDevToolsCondition = ( directive == "if" && ( condition == "!EE_DEVELOPMENT_TOOLS" || condition == "EE_SHIPPING" ) ) || ( directive == "ifndef" && condition == "EE_DEVELOPMENT_TOOLS" ) || ( directive == "ifdef" && condition == "EE_SHIPPING" );
+
+                    ConditionalBlock& block = blockStack.emplace_back();
+                    block.m_isActiveBranchDevOnly = isDevToolsCondition;
+                    block.m_areOtherBranchesDevOnly = isNoDevToolsCondition;
+                }
+                else if ( directive == "elif" || directive == "else" )
+                {
+                    if ( !blockStack.empty() )
+                    {
+                        blockStack.back().m_isActiveBranchDevOnly = blockStack.back().m_areOtherBranchesDevOnly;
+                    }
+                }
+                else if ( directive == "endif" )
+                {
+                    if ( !blockStack.empty() )
+                    {
+                        blockStack.pop_back();
+                    }
+                }
+
+                //-------------------------------------------------------------------------
+
+                uint32_t const lineNumber = i + 1;
+                bool const isInDevOnlyBlock = IsInDevOnlyBlock( blockStack );
+                if ( !wasInDevOnlyBlock && isInDevOnlyBlock )
+                {
+                    rangeStartLine = lineNumber;
+                }
+                else if ( wasInDevOnlyBlock && !isInDevOnlyBlock )
+                {
+                    outRanges.emplace_back( rangeStartLine, lineNumber );
+                }
+            }
+
+            // Unterminated block, the header wont compile but dont lose the range
+            if ( IsInDevOnlyBlock( blockStack ) )
+            {
+                outRanges.emplace_back( rangeStartLine, (uint32_t) numLines );
+            }
+        }
     }
 
     bool Reflector::ParseSolution( FileSystem::Path const& slnPath )
@@ -212,11 +319,16 @@ namespace EE::TypeSystem::Reflection
         return true;
     }
 
-    uint64_t Reflector::CalculateHeaderChecksum( FileSystem::Path const& engineIncludePath, FileSystem::Path const& filePath )
+    uint64_t Reflector::CalculateHeaderChecksum( TVector<String> const& headerFileContents ) const
     {
-        static char const* headerString = "Note: including file: ";
-        uint64_t checksum = FileSystem::GetFileModifiedTime( filePath );
-        return checksum;
+        String contents;
+        for ( auto const& line : headerFileContents )
+        {
+            contents.append( line );
+            contents.append( "\n" );
+        }
+
+        return Hash::GetHash64( contents );
     }
 
     bool Reflector::ParseProject( FileSystem::Path const& prjPath )
@@ -322,11 +434,10 @@ namespace EE::TypeSystem::Reflection
                         headerInfo.m_projectID = prj.m_ID;
                         headerInfo.m_filePath = headerFileFullPath;
                         headerInfo.m_timestamp = FileSystem::GetFileModifiedTime( headerFileFullPath );
+                        headerInfo.m_checksum = CalculateHeaderChecksum( headerFileContents );
+                        FindDevelopmentToolsOnlyBlocks( headerFileContents, headerInfo.m_devToolsOnlyLineRanges );
                         headerInfo.m_fileContents.swap( headerFileContents );
 
-                        // Add to registered timestamp cache, use in up to date checks
-                        m_registeredHeaderTimestamps.push_back( HeaderTimestamp( headerInfo.m_ID, headerInfo.m_timestamp ) );
-
                         if ( isModuleHeader )
                         {
                             prj.m_moduleHeaderID = headerInfo.m_ID;
@@ -606,9 +717,25 @@ namespace EE::TypeSystem::Reflection
 
             // Open connection to type database and read all previous data
             FileSystem::Path databasePath( m_reflectionDataPath + "TypeDatabase.db" );
-            m_database.ReadDatabase( databasePath );
+            if ( !m_database.ReadDatabase( databasePath ) )
+            {
+                return LogError( m_database.GetError().c_str() );
+            }
+
+            // Remove all data for headers that no longer exist
+            TVector<HeaderID> registeredHeaders;
+            for ( ProjectInfo const& projectInfo : m_solution.m_projects )
+            {
+                for ( HeaderInfo const& headerInfo : projectInfo.m_headerFiles )
+                {
+                    registeredHeaders.emplace_back( headerInfo.m_ID );
+                }
+            }
+            m_database.DeleteObseleteHeadersAndTypes( registeredHeaders );
+
+            // Figure out what needs to be reflected before we update the header records
+            UpdateDirtyHeaders();
 
-            // For now just reflect all detected headers as we have disabled the up-to-date check
             for ( ProjectInfo& projectInfo : m_solution.m_projects )
             {
                 for ( HeaderInfo const& headerInfo : projectInfo.m_headerFiles )
@@ -631,10 +758,117 @@ namespace EE::TypeSystem::Reflection
         return true;
     }
 
+    void Reflector::UpdateDirtyHeaders()
+    {
+        THashMap<HeaderID, HeaderInfo*> headerLookup;
+
+        // Any header whose contents changed since the last run is dirty
+        //-------------------------------------------------------------------------
+
+        for ( ProjectInfo& projectInfo : m_solution.m_projects )
+        {
+            for ( HeaderInfo& headerInfo : projectInfo.m_headerFiles )
+            {
+                HeaderInfo const* pPreviousHeaderInfo = m_database.GetHeaderDesc( headerInfo.m_ID );
+                headerInfo.m_isDirty = ( pPreviousHeaderInfo == nullptr ) || ( pPreviousHeaderInfo->m_checksum != headerInfo.m_checksum ) || ( pPreviousHeaderInfo->m_projectID != headerInfo.m_projectID );
+                headerLookup.insert( TPair<HeaderID, HeaderInfo*>( headerInfo.m_ID, &headerInfo ) );
+            }
+
+            // The module class name is only set when visiting the module header, so restore it if we are not going to visit it
+            if ( projectInfo.m_moduleHeaderID.IsValid() )
+            {
+                HeaderInfo* pModuleHeaderInfo = headerLookup[projectInfo.m_moduleHeaderID];
+                ProjectInfo const* pPreviousProjectInfo = m_database.GetProjectDesc( projectInfo.m_ID );
+                if ( !pModuleHeaderInfo->m_isDirty && pPreviousProjectInfo != nullptr && !pPreviousProjectInfo->m_moduleClassName.empty() )
+                {
+                    projectInfo.m_moduleClassName = pPreviousProjectInfo->m_moduleClassName;
+                }
+                else
+                {
+                    pModuleHeaderInfo->m_isDirty = true;
+                }
+            }
+        }
+
+        // Types in clean headers contain data from the types they reference (parent properties, enum flags, etc...)
+        // So any header that references a type from a dirty header needs to be re-reflected as well
+        //-------------------------------------------------------------------------
+
+        THashMap<TypeID, HeaderID> typeToHeaderLookup;
+        for ( ReflectedType const& type : m_database.GetAllTypes() )
+        {
+            typeToHeaderLookup.insert( TPair<TypeID, HeaderID>( type.m_ID, type.m_headerID ) );
+        }
+
+        for ( ReflectedResourceType const& resourceType : m_database.GetAllRegisteredResourceTypes() )
+        {
+            typeToHeaderLookup.insert( TPair<TypeID, HeaderID>( resourceType.m_typeID, resourceType.m_headerID ) );
+        }
+
+        auto IsTypeFromDirtyHeader = [&] ( TypeID typeID )
+        {
+            auto typeIter = typeToHeaderLookup.find( typeID );
+            if ( typeIter == typeToHeaderLookup.end() )
+            {
+                return false;
+            }
+
+            auto headerIter = headerLookup.find( typeIter->second );
+            return headerIter == headerLookup.end() || headerIter->second->m_isDirty;
+        };
+
+        auto DependsOnDirtyHeader = [&] ( ReflectedType const& type )
+        {
+            if ( IsTypeFromDirtyHeader( type.m_parentID ) )
+            {
+                return true;
+            }
+
+            for ( ReflectedProperty const& property : type.m_properties )
+            {
+                if ( IsTypeFromDirtyHeader( property.m_typeID ) )
+                {
+                    return true;
+                }
+
+                if ( !property.m_templateArgTypeName.empty() && IsTypeFromDirtyHeader( TypeID( property.m_templateArgTypeName ) ) )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        bool dirtyHeadersAdded = true;
+        while ( dirtyHeadersAdded )
+        {
+            dirtyHeadersAdded = false;
+
+            for ( ReflectedType const& type : m_database.GetAllTypes() )
+            {
+                auto headerIter = headerLookup.find( type.m_headerID );
+                if ( headerIter == headerLookup.end() || headerIter->second->m_isDirty )
+                {
+                    continue;
+                }
+
+                if ( DependsOnDirtyHeader( type ) )
+                {
+                    headerIter->second->m_isDirty = true;
+                    dirtyHeadersAdded = true;
+                }
+            }
+        }
+    }
+
     bool Reflector::ReflectRegisteredHeaders()
     {
-        // Create list of all headers to parse
-        TVector<HeaderInfo*> headersToParse;
+        ClangParser clangParser( &m_solution, &m_database, m_reflectionDataPath );
+
+        // Create a translation unit per module for all the dirty headers
+        int32_t numHeadersToParse = 0;
+        int32_t numHeaders = 0;
         for ( auto& prj : m_solution.m_projects )
         {
             // Ignore projects with no module header
@@ -643,51 +877,62 @@ namespace EE::TypeSystem::Reflection
                 continue;
             }
 
-            // Add all dirty headers to the list of file to be parsed
-            bool moduleHeaderAdded = false;
+            TVector<HeaderInfo*> headersToParse;
             for ( HeaderInfo& headerInfo : prj.m_headerFiles )
             {
+                numHeaders++;
+
+                if ( !headerInfo.m_isDirty )
+                {
+                    continue;
+                }
+
                 headersToParse.push_back( &headerInfo );
 
                 // Erase all types associated with this header from the database
                 m_database.DeleteTypesForHeader( headerInfo.m_ID );
             }
+
+            if ( !headersToParse.empty() )
+            {
+                clangParser.AddTranslationUnit( &prj, headersToParse );
+                numHeadersToParse += (int32_t) headersToParse.size();
+            }
         }
 
         //-------------------------------------------------------------------------
 
-        if ( !headersToParse.empty() )
+        std::cout << " * Reflecting C++ Code - " << numHeadersToParse << " / " << numHeaders << " header(s) changed - ";
+
+        if ( numHeadersToParse > 0 )
         {
-            std::cout << " * Reflecting C++ Code - First Pass (With Dev Tools) - ";
+            TaskSystem taskSystem( Threading::GetProcessorInfo().m_numLogicalCores );
+            taskSystem.Initialize();
+            bool const parseResult = clangParser.Parse( taskSystem );
+            taskSystem.Shutdown();
 
-            // Parse headers
-            ClangParser clangParser( &m_solution, &m_database, m_reflectionDataPath );
-            if ( !clangParser.Parse( headersToParse, ClangParser::DevToolsPass ) )
+            if ( !parseResult )
             {
                 std::cout << "Error occurred!\n\n  Error: " << clangParser.GetErrorMessage().c_str() << std::endl;
                 return false;
             }
-            Milliseconds clangParsingTime = clangParser.GetParsingTime();
-            Milliseconds clangVisitingTime = clangParser.GetVisitingTime();
-            std::cout << "Complete! ( P:" << (float) clangParsingTime << "ms, V:" << (float) clangVisitingTime << "ms )" << std::endl;
 
-            std::cout << " * Reflecting C++ Code - Second Pass (No Dev Tools) - ";
+            std::cout << "Complete!" << std::endl;
 
-            // Second parse to detect dev-only types
-            if ( !clangParser.Parse( headersToParse, ClangParser::NoDevToolsPass ) )
+            for ( auto pTranslationUnit : clangParser.GetTranslationUnits() )
             {
-                std::cout << "Error occurred!\n\n  Error: " << clangParser.GetErrorMessage().c_str() << std::endl;
-                return false;
+                std::cout << "     - " << pTranslationUnit->GetProject()->m_name.c_str() << " ( " << pTranslationUnit->GetNumHeaders() << " header(s), P:" << (float) pTranslationUnit->GetParsingTime() << "ms, V:" << (float) pTranslationUnit->GetVisitingTime() << "ms )" << std::endl;
             }
-            clangParsingTime = clangParser.GetParsingTime();
-            clangVisitingTime = clangParser.GetVisitingTime();
-            std::cout << "Complete! ( P:" << (float) clangParsingTime << "ms, V:" << (float) clangVisitingTime << "ms )" << std::endl;
-
-            // Finalize database data
-            m_database.UpdateProjectList( m_solution.m_projects );
-            m_database.CleanupResourceHierarchy();
+        }
+        else
+        {
+            std::cout << "Up to date!" << std::endl;
         }
 
+        // Finalize database data
+        m_database.UpdateProjectList( m_solution.m_projects );
+        m_database.CleanupResourceHierarchy();
+
         //-------------------------------------------------------------------------
 
         std::cout << " * Generating Code - ";
@@ -704,6 +949,11 @@ namespace EE::TypeSystem::Reflection
 
         std::cout << "Complete! ( " << (float) time << "ms )" << std::endl;
 
+        for ( auto const& projectTime : generator.GetProjectGenerationTimes() )
+        {
+            std::cout << "     - " << projectTime.m_pProject->m_name.c_str() << " ( " << projectTime.m_numGeneratedHeaders << " header(s), G:" << (float) projectTime.m_generationTime << "ms )" << std::endl;
+        }
+
         //-------------------------------------------------------------------------
 
         if ( !WriteTypeData() )
@@ -776,20 +1026,21 @@ int main( int argc, char *argv[] )
     std::cout << "===============================================" << std::endl << std::endl;
 
     // Parse solution
+    // Note: builds are incremental, only headers that changed since the last build are reflected. Run a clean to force a full reflection.
     EE::TypeSystem::Reflection::Reflector reflector;
     if ( reflector.ParseSolution( slnPath ) )
     {
+        if ( shouldBuild )
+        {
+            return reflector.Build() ? 0 : 1;
+        }
+
         if ( !reflector.Clean() )
         {
             std::cout << std::endl << "Failed to clean: " << slnPath.c_str() << std::endl;
             EE_TRACE_MSG( "Failed to clean: %s", slnPath.c_str() );
             return 1;
         }
-
-        if ( shouldBuild )
-        {
-            return reflector.Build() ? 0 : 1;
-        }
     }
 
     return 0;
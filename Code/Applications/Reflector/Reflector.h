@@ -17,14 +17,6 @@ namespace EE::TypeSystem::Reflection
             IgnoreHeader,
         };
 
-        struct HeaderTimestamp
-        {
-            HeaderTimestamp( HeaderID ID, uint64_t timestamp ) : m_ID( ID ), m_timestamp( timestamp ) {}
-
-            HeaderID                        m_ID;
-            uint64_t                        m_timestamp;
-        };
-
     public:
 
         Reflector() = default;
@@ -41,7 +33,10 @@ namespace EE::TypeSystem::Reflection
         bool ParseProject( FileSystem::Path const& prjPath );
 
         HeaderProcessResult ProcessHeaderFile( FileSystem::Path const& filePath, String& exportMacro, TVector<String>& headerFileContents );
-        uint64_t CalculateHeaderChecksum( FileSystem::Path const& engineIncludePath, FileSystem::Path const& filePath );
+        uint64_t CalculateHeaderChecksum( TVector<String> const& headerFileContents ) const;
+
+        // Compare the headers against the previous database and flag all the headers that need to be re-reflected
+        void UpdateDirtyHeaders();
 
         bool ReflectRegisteredHeaders();
         bool WriteTypeData();
@@ -51,8 +46,5 @@ namespace EE::TypeSystem::Reflection
         FileSystem::Path                    m_reflectionDataPath;
         SolutionInfo                        m_solution;
         ReflectionDatabase                  m_database;
-
-        // Up to data checks
-        TVector<HeaderTimestamp>            m_registeredHeaderTimestamps;
     };
 }
\ No newline at end of file
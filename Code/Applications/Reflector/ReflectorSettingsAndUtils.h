@@ -37,7 +37,6 @@ namespace EE::TypeSystem::Reflection
 
         constexpr static char const* const g_engineNamespace = "EE";
         constexpr static char const* const g_engineNamespacePlusDelimiter = "EE::";
-        constexpr static char const* const g_devToolsExclusionDefine = "-D EE_SHIPPING";
 
         #if defined(_WIN32) && defined(EE_DX11)
         constexpr static char const* const g_engineGraphicBackendMacroDefine = "-D EE_DX11";
@@ -2,10 +2,14 @@
 #include "CompiledResourceDatabase.h"
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompilerRegistry.h"
+#include "EngineTools/Import/ImportCache.h"
+#include "Engine/Entity/EntityDescriptors.h"
+#include "Engine/Navmesh/NavmeshData.h"
 #include "Base/Application/ApplicationGlobalState.h"
 #include "Base/ThirdParty/cmdParser/cmdParser.h"
 #include "Base/Resource/Settings/GlobalSettings_Resource.h"
 #include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Encoding/Hash.h"
 #include "Base/Settings/IniFile.h"
 
 #include <windows.h>
@@ -78,9 +82,11 @@ namespace EE::Resource
         m_compiledRecord.Clear();
         m_sourcePath.Clear();
         m_targetPath.Clear();
-        m_timestamp = m_combinedHash = 0;
+        m_additionalInputs.clear();
+        m_timestamp = m_combinedHash = m_contentHash = 0;
         m_sourceExists = m_targetExists = false;
         m_errorOccurredReadingDependencies = false;
+        m_hasUnhashedInputs = false;
         m_compilerVersion = -1;
         DestroyDependencies();
     }
@@ -187,6 +193,20 @@ namespace EE::Resource
             return false;
         }
 
+        // Compiled resource cache
+        //-------------------------------------------------------------------------
+
+        // The cache is an optimization, so we can continue without it
+        if ( !argParser.m_isForPackagedBuild )
+        {
+            m_compiledResourceCache.Initialize( pSettings->m_compiledResourceCachePath, uint64_t( pSettings->m_compiledResourceCacheMaxSizeMB ) * 1024 * 1024 );
+
+            // Imported source data lives inside the compiled resource cache so it shares the same eviction
+            FileSystem::Path importCachePath = pSettings->m_compiledResourceCachePath + "Import";
+            importCachePath.MakeIntoDirectoryPath();
+            Import::ImportCache::Initialize( importCachePath );
+        }
+
         // Create compiler registry
         //-------------------------------------------------------------------------
 
@@ -214,6 +234,16 @@ namespace EE::Resource
 
         EE::Delete( m_pCompilerRegistry );
 
+        if ( m_compiledResourceCache.IsInitialized() )
+        {
+            m_compiledResourceCache.Shutdown();
+        }
+
+        if ( Import::ImportCache::IsInitialized() )
+        {
+            Import::ImportCache::Shutdown();
+        }
+
         if ( m_compiledResourceDB.IsConnected() )
         {
             m_compiledResourceDB.Disconnect();
@@ -226,12 +256,12 @@ namespace EE::Resource
 
     bool ResourceCompilerApplication::ShouldCheckCompileDependenciesForResourceType( ResourceID const& resourceID )
     {
-        if ( resourceID.GetResourceTypeID() == ResourceTypeID( "map" ) )
+        if ( resourceID.GetResourceTypeID() == EntityModel::SerializedEntityMap::GetStaticResourceTypeID() )
         {
             return false;
         }
 
-        if ( resourceID.GetResourceTypeID() == ResourceTypeID( "nav" ) )
+        if ( resourceID.GetResourceTypeID() == Navmesh::NavmeshData::GetStaticResourceTypeID() )
         {
             return false;
         }
@@ -303,15 +333,19 @@ namespace EE::Resource
             return Resource::CompilationResult::SuccessUpToDate;
         }
 
-        m_pCompileContext->m_sourceResourceHash = m_compileDependencyTreeRoot.m_combinedHash;
-
-        // Compile
+        // Content Hash
         //-------------------------------------------------------------------------
+        // Timestamps change on checkouts and branch switches, so the content hash is what identifies the inputs of this compilation
 
-        Resource::CompilationResult const compilationResult = pCompiler->Compile( *m_pCompileContext );
+        if ( !CalculateContentHash( &m_compileDependencyTreeRoot ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Failed to hash compile dependencies: %s", m_errorMessage.c_str() );
+            return Resource::CompilationResult::Failure;
+        }
 
-        // Update database
-        if ( compilationResult == Resource::CompilationResult::Success || compilationResult == Resource::CompilationResult::SuccessWithWarnings )
+        m_pCompileContext->m_sourceResourceHash = m_compileDependencyTreeRoot.m_contentHash;
+
+        auto WriteCompiledResourceRecord = [this] ()
         {
             Resource::CompiledResourceRecord record;
             record.m_resourceID = m_pCompileContext->m_resourceID;
@@ -319,6 +353,38 @@ namespace EE::Resource
             record.m_fileTimestamp = m_compileDependencyTreeRoot.m_timestamp;
             record.m_sourceTimestampHash = m_compileDependencyTreeRoot.m_combinedHash;
             m_compiledResourceDB.WriteRecord( record );
+        };
+
+        // Try restore from the cache
+        //-------------------------------------------------------------------------
+        // Resources without inputs or with inputs that are not tracked by the dependency tree (maps, navmeshes) cant be content addressed, so they always get compiled
+
+        bool const canUseCache = m_compiledResourceCache.IsInitialized() && !m_compileDependencyTreeRoot.m_forceRecompile && !m_compileDependencyTreeRoot.m_hasUnhashedInputs;
+        if ( canUseCache && !m_forceCompilation )
+        {
+            if ( m_compiledResourceCache.TryRestore( m_compileDependencyTreeRoot.m_contentHash, m_pCompileContext->m_outputFilePath ) )
+            {
+                WriteCompiledResourceRecord();
+                EE_LOG_INFO( "Resource", "Resource Compiler", "Restored from compiled resource cache (%016llx)", m_compileDependencyTreeRoot.m_contentHash );
+                return Resource::CompilationResult::SuccessFromCache;
+            }
+        }
+
+        // Compile
+        //-------------------------------------------------------------------------
+
+        Resource::CompilationResult const compilationResult = pCompiler->Compile( *m_pCompileContext );
+
+        // Update database
+        if ( compilationResult == Resource::CompilationResult::Success || compilationResult == Resource::CompilationResult::SuccessWithWarnings )
+        {
+            WriteCompiledResourceRecord();
+        }
+
+        // Only cache clean compilations, restoring a resource would otherwise hide its warnings
+        if ( canUseCache && compilationResult == Resource::CompilationResult::Success )
+        {
+            m_compiledResourceCache.Store( m_compileDependencyTreeRoot.m_contentHash, m_pCompileContext->m_outputFilePath );
         }
 
         return compilationResult;
@@ -398,6 +464,9 @@ namespace EE::Resource
             skipDependencyCheck = !isCompilableResource || !ShouldCheckCompileDependenciesForResourceType( pNode->m_ID );
             if ( isCompilableResource )
             {
+                // The real inputs of these resources (i.e. the map's entities and everything they reference) are not in the dependency tree, so we cant content address them
+                pNode->m_hasUnhashedInputs = !ShouldCheckCompileDependenciesForResourceType( pNode->m_ID );
+
                 pNode->m_targetPath = ResourcePath::ToFileSystemPath( m_pCompileContext->m_compiledResourceDirectoryPath, resourcePath );
                 pNode->m_targetExists = FileSystem::Exists( pNode->m_targetPath );
 
@@ -410,6 +479,15 @@ namespace EE::Resource
                     pNode->m_forceRecompile = true;
                     skipDependencyCheck = true;
                 }
+
+                // Gather any files the compiler reads that arent declared as compile dependencies, if these cant be determined we cant content address this resource
+                if ( !skipDependencyCheck && pNode->m_sourceExists )
+                {
+                    if ( !pCompiler->GetAdditionalCompileInputs( pNode->m_ID, pNode->m_additionalInputs ) )
+                    {
+                        pNode->m_hasUnhashedInputs = true;
+                    }
+                }
             }
         }
 
@@ -468,11 +546,64 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         pNode->m_combinedHash = pNode->m_timestamp;
+
+        for ( auto const& additionalInputPath : pNode->m_additionalInputs )
+        {
+            pNode->m_combinedHash += FileSystem::Exists( additionalInputPath ) ? FileSystem::GetFileModifiedTime( additionalInputPath ) : 0;
+        }
+
         for ( auto const pDep : pNode->m_dependencies )
         {
             pNode->m_combinedHash += pDep->m_combinedHash;
+            pNode->m_hasUnhashedInputs |= pDep->m_hasUnhashedInputs;
+        }
+
+        return true;
+    }
+
+    bool ResourceCompilerApplication::CalculateContentHash( CompileDependencyNode* pNode )
+    {
+        EE_ASSERT( pNode != nullptr );
+
+        TInlineVector<uint64_t, 16> hashes;
+
+        // Resource path and compiler version, so that identical files at different paths or compiled with different compiler versions dont collide
+        hashes.emplace_back( Hash::GetHash64( pNode->m_ID.GetResourcePath().GetString() ) );
+        hashes.emplace_back( (uint64_t) pNode->m_compilerVersion );
+
+        // File contents (descriptor or source asset)
+        if ( pNode->m_sourceExists )
+        {
+            Blob fileData;
+            if ( !FileSystem::LoadFile( pNode->m_sourcePath, fileData ) )
+            {
+                m_errorMessage.sprintf( "Failed to read file: %s", pNode->m_sourcePath.c_str() );
+                return false;
+            }
+
+            hashes.emplace_back( Hash::GetHash64( fileData ) );
+        }
+
+        // Additional inputs, missing files still contribute so that adding them later changes the hash
+        for ( auto const& additionalInputPath : pNode->m_additionalInputs )
+        {
+            Blob fileData;
+            bool const fileRead = FileSystem::Exists( additionalInputPath ) && FileSystem::LoadFile( additionalInputPath, fileData );
+            hashes.emplace_back( fileRead ? Hash::GetHash64( fileData ) : 0 );
+        }
+
+        // Dependencies
+        for ( auto const pDep : pNode->m_dependencies )
+        {
+            if ( !CalculateContentHash( pDep ) )
+            {
+                return false;
+            }
+
+            hashes.emplace_back( pDep->m_contentHash );
         }
 
+        pNode->m_contentHash = Hash::GetHash64( hashes.data(), hashes.size() * sizeof( uint64_t ) );
         return true;
     }
 }
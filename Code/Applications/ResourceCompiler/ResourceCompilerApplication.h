@@ -1,6 +1,7 @@
 #pragma once
 #include "EngineTools/Resource/ResourceCompiler.h"
 #include "CompiledResourceDatabase.h"
+#include "EngineTools/Resource/CompiledResourceCache.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Settings/SettingsRegistry.h"
 
@@ -35,14 +36,17 @@ namespace EE::Resource
             ResourceID                              m_ID;
             FileSystem::Path                        m_sourcePath;
             FileSystem::Path                        m_targetPath;
+            TVector<FileSystem::Path>               m_additionalInputs;                // Files read by the compiler that arent part of the dependency tree (e.g. external gltf buffers, shader includes)
             bool                                    m_sourceExists = false;
             bool                                    m_targetExists = false;
             bool                                    m_errorOccurredReadingDependencies = true;
             bool                                    m_forceRecompile = false;
+            bool                                    m_hasUnhashedInputs = false;       // Set if any resource in this tree has inputs that are not part of the dependency tree
             int32_t                                 m_compilerVersion = -1;
             CompiledResourceRecord                  m_compiledRecord;
             uint64_t                                m_timestamp = 0;
             uint64_t                                m_combinedHash = 0;
+            uint64_t                                m_contentHash = 0;
 
             CompileDependencyNode*                  m_pParentNode = nullptr;
             TVector<CompileDependencyNode*>         m_dependencies;
@@ -68,11 +72,15 @@ namespace EE::Resource
         bool TryReadCompileDependencies( ResourceID const& resourceID, TVector<ResourcePath>& outDependencies );
         bool FillCompileDependencyNode( CompileDependencyNode* pNode, ResourcePath const& resourceID );
 
+        // Hash the contents of all files in the dependency tree, only needed when we are not up to date
+        bool CalculateContentHash( CompileDependencyNode* pNode );
+
     private:
 
         TypeSystem::TypeRegistry                m_typeRegistry;
         Settings::SettingsRegistry              m_settingsRegistry;
         CompiledResourceDatabase                m_compiledResourceDB;
+        CompiledResourceCache                   m_compiledResourceCache;
         CompilerRegistry*                       m_pCompilerRegistry = nullptr;
         CompileContext*                         m_pCompileContext = nullptr;
         bool                                    m_forceCompilation = false;
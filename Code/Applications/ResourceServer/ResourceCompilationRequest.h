@@ -22,6 +22,7 @@ namespace EE::Resource
             Succeeded,
             SucceededWithWarnings,
             SucceededUpToDate,
+            SucceededFromCache,
             Failed
         };
 
@@ -34,6 +35,26 @@ namespace EE::Resource
             Package
         };
 
+        // Pending requests are scheduled per priority lane, lower lanes are always served first
+        enum class Priority : uint8_t
+        {
+            Client = 0,     // Requests from connected clients and manual requests, someone is waiting on these
+            HotReload,      // File watcher recompiles
+            Packaging,
+
+            NumPriorities
+        };
+
+        static Priority GetPriorityForOrigin( Origin origin )
+        {
+            switch ( origin )
+            {
+                case Origin::FileWatcher: return Priority::HotReload;
+                case Origin::Package: return Priority::Packaging;
+                default: return Priority::Client;
+            }
+        }
+
     public:
 
         // Get the client that requested this resource
@@ -45,6 +66,9 @@ namespace EE::Resource
         // Returns whether the request was externally requested (i.e. by a client) or internally requested (i.e. due to a file changing and being detected)
         inline bool IsInternalRequest() const { return m_origin != Origin::External; }
 
+        // The lane this request is queued in, can be raised if a higher priority request depends on it
+        inline Priority GetPriority() const { return m_priority; }
+
         // Do we require a force recompile of this resource even if it's up to date
         inline bool RequiresForcedRecompiliation() const { return m_origin == Origin::ManualCompileForced || m_origin == Origin::Package; }
 
@@ -52,7 +76,7 @@ namespace EE::Resource
         inline Status GetStatus() const { return m_status; }
         inline bool IsPending() const { return m_status == Status::Pending; }
         inline bool IsCompiling() const { return m_status == Status::Compiling; }
-        inline bool HasSucceeded() const { return m_status == Status::Succeeded || m_status == Status::SucceededWithWarnings || m_status == Status::SucceededUpToDate; }
+        inline bool HasSucceeded() const { return m_status == Status::Succeeded || m_status == Status::SucceededWithWarnings || m_status == Status::SucceededUpToDate || m_status == Status::SucceededFromCache; }
         inline bool HasFailed() const { return m_status == Status::Failed; }
         inline bool IsComplete() const { return HasSucceeded() || HasFailed(); }
 
@@ -64,6 +88,17 @@ namespace EE::Resource
 
         inline TimeStamp const& GetTimeRequested() const { return m_timeRequested; }
 
+        // How long the request waited for its dependencies and for a free compilation slot
+        inline Milliseconds GetQueueElapsedTime() const
+        {
+            if ( m_status == Status::Pending )
+            {
+                return Milliseconds( PlatformClock::GetTime() - m_timeQueued );
+            }
+
+            return Milliseconds( m_compilationTimeStarted - m_timeQueued );
+        }
+
         inline Milliseconds GetCompilationElapsedTime() const
         {
             if ( m_status == Status::Pending )
@@ -91,11 +126,18 @@ namespace EE::Resource
         String                              m_compilerArgs;
 
         TimeStamp                           m_timeRequested;
+        Nanoseconds                         m_timeQueued = 0;
         Nanoseconds                         m_compilationTimeStarted = 0;
         Nanoseconds                         m_compilationTimeFinished = 0;
 
         String                              m_log;
         Status                              m_status = Status::Pending;
         Origin                              m_origin = Origin::External;
+        Priority                            m_priority = Priority::Client;
+
+        // Compilation order
+        uint64_t                            m_sequenceID = 0;               // Requests are only ever blocked by requests created before them, so we cant deadlock
+        TVector<ResourceID>                 m_compileDependencies;          // Compilable resources that need to be compiled before this one
+        bool                                m_compileDependenciesResolved = false;
     };
 }
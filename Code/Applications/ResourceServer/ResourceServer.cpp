@@ -2,9 +2,11 @@
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "Game/_Module/GameModule.h"
 #include "EngineTools/Resource/ResourceCompiler.h"
+#include "EngineTools/Resource/ResourceDescriptor.h"
 #include "EngineTools/ThirdParty/subprocess/subprocess.h"
 #include "Engine/Entity/EntityDescriptors.h"
 #include "Engine/Entity/EntitySerialization.h"
+#include "Engine/Navmesh/NavmeshData.h"
 #include "Engine/_Module/EngineModule.h"
 #include "Base/Resource/ResourceProviders/ResourceNetworkMessages.h"
 #include "Base/Settings/IniFile.h"
@@ -117,6 +119,12 @@ namespace EE::Resource
                     }
                     break;
 
+                    case CompilationResult::SuccessFromCache:
+                    {
+                        m_pRequest->m_status = CompilationRequest::Status::SucceededFromCache;
+                    }
+                    break;
+
                     default:
                     {
                         m_pRequest->m_status = CompilationRequest::Status::Failed;
@@ -270,10 +278,20 @@ namespace EE::Resource
         m_pSettings->m_compiledResourcePath.EnsureDirectoryExists();
         m_fileSystemWatcher.StartWatching( m_pSettings->m_rawResourcePath );
 
+        // Compiled Resource Cache
+        //-------------------------------------------------------------------------
+        // The compilers read and write the cache, we only track statistics and handle eviction
+
+        if ( m_compiledResourceCache.Initialize( m_pSettings->m_compiledResourceCachePath, uint64_t( m_pSettings->m_compiledResourceCacheMaxSizeMB ) * 1024 * 1024 ) )
+        {
+            m_compiledResourceCache.EvictEntries();
+        }
+
         // Create Workers
         //-------------------------------------------------------------------------
 
         m_taskSystem.Initialize();
+        m_maxConcurrentCompilations = (int32_t) m_taskSystem.GetNumWorkers();
 
         m_context.m_rawResourcePath = m_pSettings->m_rawResourcePath;
         m_context.m_compiledResourcePath = m_pSettings->m_compiledResourcePath;
@@ -293,6 +311,24 @@ namespace EE::Resource
     {
         m_context.m_isExiting = true;
 
+        // Drop all requests that we havent started yet
+        //-------------------------------------------------------------------------
+
+        for ( auto& lane : m_pendingRequests )
+        {
+            for ( auto pRequest : lane )
+            {
+                pRequest->m_status = CompilationRequest::Status::Failed;
+                pRequest->m_log = "Resource server shutdown before compilation started!";
+                m_numScheduledTasks--;
+            }
+
+            lane.clear();
+        }
+
+        m_incompleteRequests.clear();
+        m_compileDependencyCache.clear();
+
         // Complete all scheduled requests
         //-------------------------------------------------------------------------
 
@@ -319,6 +355,14 @@ namespace EE::Resource
             m_fileSystemWatcher.StopWatching();
         }
 
+        // Compiled Resource Cache
+        //-------------------------------------------------------------------------
+
+        if ( m_compiledResourceCache.IsInitialized() )
+        {
+            m_compiledResourceCache.Shutdown();
+        }
+
         // Delete requests
         //-------------------------------------------------------------------------
 
@@ -416,6 +460,11 @@ namespace EE::Resource
         
         ProcessCompletedRequests();
 
+        // Start new compilations
+        //-------------------------------------------------------------------------
+
+        SchedulePendingRequests();
+
         // Process cleanup request
         //-------------------------------------------------------------------------
 
@@ -521,11 +570,23 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         m_requests.emplace_back( pRequest );
-        auto pTask = EE::New<CompilationTask>( m_context, pRequest );
-        m_taskSystem.ScheduleTask( pTask );
-        m_activeTasks.emplace_back( pTask );
         m_numScheduledTasks++;
 
+        pRequest->m_sequenceID = m_nextRequestSequenceID++;
+        pRequest->m_timeQueued = PlatformClock::GetTime();
+
+        // Invalid requests have already failed, so just send them through the task flow immediately
+        if ( pRequest->IsComplete() )
+        {
+            StartCompilationTask( pRequest );
+        }
+        else
+        {
+            pRequest->m_priority = CompilationRequest::GetPriorityForOrigin( origin );
+            m_pendingRequests[(int32_t) pRequest->m_priority].emplace_back( pRequest );
+            m_incompleteRequests[resourceID].emplace_back( pRequest );
+        }
+
         //-------------------------------------------------------------------------
 
         return pRequest;
@@ -538,34 +599,29 @@ namespace EE::Resource
 
         struct Bucket
         {
+            // Keep messages small so that clients can start processing results while the rest are still in transit
+            constexpr static size_t const s_maxResultsPerMessage = 64;
+
             void AddUpdateResponse( ResourceID const& ID, String const& filePath, String const& log = String() )
             {
-                if ( m_updateResponses.empty() )
+                // Only start a new message once we actually have a result for it, so we never send empty messages
+                if ( m_updateResponses.empty() || m_updateResponses.back().m_results.size() == s_maxResultsPerMessage )
                 {
                     m_updateResponses.push_back();
                 }
 
                 m_updateResponses.back().m_results.emplace_back( ID, filePath, log );
-
-                if ( m_updateResponses.size() == 64 )
-                {
-                    m_updateResponses.push_back();
-                }
             }
 
             void AddRequestResponse( ResourceID const& ID, String const& filePath, String const& log = String() )
             {
-                if ( m_requestResponses.empty() )
+                // Only start a new message once we actually have a result for it, so we never send empty messages
+                if ( m_requestResponses.empty() || m_requestResponses.back().m_results.size() == s_maxResultsPerMessage )
                 {
                     m_requestResponses.push_back();
                 }
 
                 m_requestResponses.back().m_results.emplace_back( ID, filePath, log );
-
-                if ( m_requestResponses.size() == 64 )
-                {
-                    m_requestResponses.push_back();
-                }
             }
 
             TVector<NetworkResourceResponse> m_updateResponses;
@@ -632,6 +688,31 @@ namespace EE::Resource
                     }
                 }
 
+                // Unblock any requests waiting on this one
+                auto incompleteIter = m_incompleteRequests.find( pRequest->GetResourceID() );
+                if ( incompleteIter != m_incompleteRequests.end() )
+                {
+                    incompleteIter->second.erase_first( pRequest );
+                    if ( incompleteIter->second.empty() )
+                    {
+                        m_incompleteRequests.erase( incompleteIter );
+                    }
+                }
+
+                // Track cache usage, forced and packaging requests dont use the cache
+                if ( m_compiledResourceCache.IsInitialized() && !pRequest->RequiresForcedRecompiliation() )
+                {
+                    if ( pRequest->m_status == CompilationRequest::Status::SucceededFromCache )
+                    {
+                        m_compiledResourceCache.RecordLookup( true );
+                    }
+                    else if ( pRequest->m_status == CompilationRequest::Status::Succeeded || pRequest->m_status == CompilationRequest::Status::SucceededWithWarnings )
+                    {
+                        m_compiledResourceCache.RecordLookup( false );
+                        m_numCacheEntriesAddedSinceEviction++;
+                    }
+                }
+
                 // Delete task
                 EE::Delete( pActiveTask );
                 m_activeTasks.erase_unsorted( m_activeTasks.begin() + i );
@@ -641,6 +722,13 @@ namespace EE::Resource
             }
         }
 
+        // Periodically trim the cache, we only do this here since the compilers are short-lived processes
+        if ( m_numCacheEntriesAddedSinceEviction >= s_numCacheEntriesAddedBetweenEvictions )
+        {
+            m_compiledResourceCache.EvictEntries();
+            m_numCacheEntriesAddedSinceEviction = 0;
+        }
+
         // Send Messages
         //-------------------------------------------------------------------------
 
@@ -669,6 +757,206 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    void ResourceServer::StartCompilationTask( CompilationRequest* pRequest )
+    {
+        auto pTask = EE::New<CompilationTask>( m_context, pRequest );
+        m_taskSystem.ScheduleTask( pTask );
+        m_activeTasks.emplace_back( pTask );
+    }
+
+    void ResourceServer::ResolveCompileDependencies( CompilationRequest* pRequest )
+    {
+        EE_ASSERT( !pRequest->m_compileDependenciesResolved );
+        pRequest->m_compileDependenciesResolved = true;
+
+        ResourceID const& resourceID = pRequest->GetResourceID();
+
+        // Sub-resources are compiled from their parent
+        if ( resourceID.IsSubResourceID() )
+        {
+            pRequest->m_compileDependencies.emplace_back( resourceID.GetParentResourceID() );
+            return;
+        }
+
+        // Maps and navmeshes dont check their compile dependencies (same as the compiler)
+        if ( resourceID.GetResourceTypeID() == EntityModel::SerializedEntityMap::GetStaticResourceTypeID() || resourceID.GetResourceTypeID() == Navmesh::NavmeshData::GetStaticResourceTypeID() )
+        {
+            return;
+        }
+
+        if ( !m_pCompilerRegistry->HasCompilerForResourceType( resourceID.GetResourceTypeID() ) || !FileSystem::Exists( pRequest->m_sourceFile ) )
+        {
+            return;
+        }
+
+        // Reuse the dependencies we read previously if the descriptor hasnt changed
+        //-------------------------------------------------------------------------
+
+        uint64_t const descriptorTimestamp = FileSystem::GetFileModifiedTime( pRequest->m_sourceFile );
+
+        auto cachedIter = m_compileDependencyCache.find( resourceID );
+        if ( cachedIter != m_compileDependencyCache.end() && cachedIter->second.m_descriptorTimestamp == descriptorTimestamp )
+        {
+            pRequest->m_compileDependencies = cachedIter->second.m_dependencies;
+            return;
+        }
+
+        // Read descriptor
+        //-------------------------------------------------------------------------
+
+        CachedCompileDependencies& cachedDependencies = m_compileDependencyCache[resourceID];
+        cachedDependencies.m_descriptorTimestamp = descriptorTimestamp;
+        cachedDependencies.m_dependencies.clear();
+
+        auto pDescriptor = ResourceDescriptor::TryReadFromFile( m_typeRegistry, pRequest->m_sourceFile );
+        if ( pDescriptor != nullptr )
+        {
+            TVector<ResourcePath> dependencies;
+            pDescriptor->GetCompileDependencies( dependencies );
+            EE::Delete( pDescriptor );
+
+            // We only care about dependencies that are compiled themselves, source files can't be blocked on
+            for ( auto const& dependencyPath : dependencies )
+            {
+                ResourceID const dependencyID( dependencyPath );
+                if ( dependencyID.IsValid() && m_pCompilerRegistry->HasCompilerForResourceType( dependencyID.GetResourceTypeID() ) )
+                {
+                    cachedDependencies.m_dependencies.emplace_back( dependencyID );
+                }
+            }
+        }
+
+        pRequest->m_compileDependencies = cachedDependencies.m_dependencies;
+    }
+
+    CompilationRequest* ResourceServer::FindBlockingRequest( CompilationRequest const* pRequest ) const
+    {
+        EE_ASSERT( pRequest->m_compileDependenciesResolved );
+
+        // Never compile the same resource twice at the same time, the compilers would both write the same output
+        auto ownIter = m_incompleteRequests.find( pRequest->GetResourceID() );
+        EE_ASSERT( ownIter != m_incompleteRequests.end() );
+        if ( ownIter->second.front() != pRequest )
+        {
+            return ownIter->second.front();
+        }
+
+        // Wait for any earlier requests for our dependencies
+        for ( auto const& dependencyID : pRequest->m_compileDependencies )
+        {
+            auto dependencyIter = m_incompleteRequests.find( dependencyID );
+            if ( dependencyIter != m_incompleteRequests.end() && dependencyIter->second.front()->m_sequenceID < pRequest->m_sequenceID )
+            {
+                return dependencyIter->second.front();
+            }
+        }
+
+        return nullptr;
+    }
+
+    void ResourceServer::SchedulePendingRequests()
+    {
+        if ( m_context.m_isExiting )
+        {
+            return;
+        }
+
+        int32_t numDependencyResolvesRemaining = s_maxDependencyResolvesPerUpdate;
+
+        for ( int32_t laneIdx = 0; laneIdx < s_numPriorities; laneIdx++ )
+        {
+            auto& lane = m_pendingRequests[laneIdx];
+
+            size_t requestIdx = 0;
+            while ( requestIdx < lane.size() )
+            {
+                if ( (int32_t) m_activeTasks.size() >= m_maxConcurrentCompilations )
+                {
+                    return;
+                }
+
+                CompilationRequest* pRequest = lane[requestIdx];
+
+                // Resolve dependencies
+                //-------------------------------------------------------------------------
+
+                if ( !pRequest->m_compileDependenciesResolved )
+                {
+                    if ( numDependencyResolvesRemaining == 0 )
+                    {
+                        requestIdx++;
+                        continue;
+                    }
+
+                    ResolveCompileDependencies( pRequest );
+                    numDependencyResolvesRemaining--;
+                }
+
+                // Wait for blocking requests
+                //-------------------------------------------------------------------------
+
+                CompilationRequest* pBlockingRequest = FindBlockingRequest( pRequest );
+                if ( pBlockingRequest != nullptr )
+                {
+                    // Dont let a request wait on a lower priority lane, move the blocking request into our lane instead
+                    if ( pBlockingRequest->m_priority > pRequest->m_priority )
+                    {
+                        auto& blockingRequestLane = m_pendingRequests[(int32_t) pBlockingRequest->m_priority];
+                        auto blockingRequestIter = VectorFind( blockingRequestLane, pBlockingRequest );
+                        if ( blockingRequestIter != blockingRequestLane.end() )
+                        {
+                            blockingRequestLane.erase( blockingRequestIter );
+                            pBlockingRequest->m_priority = pRequest->m_priority;
+                            lane.emplace_back( pBlockingRequest );
+                        }
+                    }
+
+                    requestIdx++;
+                    continue;
+                }
+
+                // Start compilation
+                //-------------------------------------------------------------------------
+
+                lane.erase( lane.begin() + requestIdx );
+
+                m_totalQueueTime[laneIdx] += Milliseconds( PlatformClock::GetTime() - pRequest->m_timeQueued );
+                m_numDequeuedRequests[laneIdx]++;
+
+                StartCompilationTask( pRequest );
+            }
+        }
+    }
+
+    ResourceServer::QueueMetrics ResourceServer::GetQueueMetrics() const
+    {
+        QueueMetrics metrics;
+        metrics.m_numActiveCompilations = (int32_t) m_activeTasks.size();
+        metrics.m_maxConcurrentCompilations = m_maxConcurrentCompilations;
+
+        for ( int32_t laneIdx = 0; laneIdx < s_numPriorities; laneIdx++ )
+        {
+            metrics.m_numPendingRequests[laneIdx] = (int32_t) m_pendingRequests[laneIdx].size();
+
+            if ( m_numDequeuedRequests[laneIdx] > 0 )
+            {
+                metrics.m_averageQueueTime[laneIdx] = m_totalQueueTime[laneIdx].ToFloat() / m_numDequeuedRequests[laneIdx];
+            }
+
+            for ( auto pRequest : m_pendingRequests[laneIdx] )
+            {
+                if ( pRequest->m_compileDependenciesResolved && FindBlockingRequest( pRequest ) != nullptr )
+                {
+                    metrics.m_numBlockedRequests++;
+                }
+            }
+        }
+
+        return metrics;
+    }
+
+    //-------------------------------------------------------------------------
+
     void ResourceServer::RefreshAvailableMapList()
     {
         m_allMaps.clear();
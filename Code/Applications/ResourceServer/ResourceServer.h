@@ -3,12 +3,14 @@
 #include "ResourceServerContext.h"
 #include "ResourceCompilationRequest.h"
 #include "EngineTools/Core/FileSystem/FileSystemWatcher.h"
+#include "EngineTools/Resource/CompiledResourceCache.h"
 #include "Base/Network/IPC/IPCMessageServer.h"
 #include "Base/Resource/Settings/GlobalSettings_Resource.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Threading/TaskSystem.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Settings/SettingsRegistry.h"
+#include "Base/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 // The network resource server
@@ -28,6 +30,16 @@ namespace EE::Resource
     {
         friend class LocalResourceProvider;
 
+        constexpr static int32_t const s_numCacheEntriesAddedBetweenEvictions = 32;
+        constexpr static int32_t const s_maxDependencyResolvesPerUpdate = 32; // Reading descriptors happens on the main thread, so bound the work per update
+        constexpr static int32_t const s_numPriorities = (int32_t) CompilationRequest::Priority::NumPriorities;
+
+        struct CachedCompileDependencies
+        {
+            uint64_t                m_descriptorTimestamp = 0;
+            TVector<ResourceID>     m_dependencies;
+        };
+
     public:
 
         struct BusyState
@@ -37,6 +49,15 @@ namespace EE::Resource
             bool        m_isBusy = false;
         };
 
+        struct QueueMetrics
+        {
+            int32_t                                 m_numPendingRequests[s_numPriorities] = {};
+            Milliseconds                            m_averageQueueTime[s_numPriorities];
+            int32_t                                 m_numBlockedRequests = 0; // Pending requests waiting on a dependency or an earlier request for the same resource
+            int32_t                                 m_numActiveCompilations = 0;
+            int32_t                                 m_maxConcurrentCompilations = 0;
+        };
+
         enum class PackagingStage
         {
             None, // Not Packaging
@@ -56,6 +77,9 @@ namespace EE::Resource
 
         bool IsBusy() const;
 
+        // Sleep until a client sends us a request or the wait time elapses
+        inline void WaitForIncomingRequests( Milliseconds maxWaitTime ) { m_networkServer.WaitForIncomingMessages( maxWaitTime ); }
+
         inline String const& GetErrorMessage() const { return m_errorMessage; }
         inline String const& GetNetworkAddress() const { return m_pSettings->m_resourceServerNetworkAddress; }
         inline uint16_t GetNetworkPort() const { return m_pSettings->m_resourceServerPort; }
@@ -69,12 +93,23 @@ namespace EE::Resource
         inline void CompileResource( ResourceID const& resourceID, bool forceRecompile = true ) { CreateResourceRequest( resourceID, 0, forceRecompile ? CompilationRequest::Origin::ManualCompileForced : CompilationRequest::Origin::ManualCompile ); }
         inline void PackageResource( ResourceID const& resourceID ) { CreateResourceRequest( resourceID, 0, CompilationRequest::Origin::Package ); }
 
+        // Compiled Resource Cache
+        //-------------------------------------------------------------------------
+
+        inline bool IsCompiledResourceCacheEnabled() const { return m_compiledResourceCache.IsInitialized(); }
+        inline FileSystem::Path const& GetCompiledResourceCacheDir() const { return m_compiledResourceCache.GetCacheDirectoryPath(); }
+        inline uint64_t GetCompiledResourceCacheMaxSize() const { return m_compiledResourceCache.GetMaxCacheSize(); }
+        inline CompiledResourceCache::Statistics GetCompiledResourceCacheStatistics() const { return m_compiledResourceCache.GetStatistics(); }
+
         // Requests
         //-------------------------------------------------------------------------
 
         TVector<CompilationRequest const*> const& GetRequests() const { return ( TVector<CompilationRequest const*>& ) m_requests; }
         inline void CleanHistory() { m_cleanupRequested = true; }
 
+        // Get the state of the compilation queue
+        QueueMetrics GetQueueMetrics() const;
+
         // Clients
         //-------------------------------------------------------------------------
 
@@ -123,6 +158,20 @@ namespace EE::Resource
         CompilationRequest* CreateResourceRequest( ResourceID const& resourceID, uint32_t clientID = 0, CompilationRequest::Origin origin = CompilationRequest::Origin::External );
         void ProcessCompletedRequests();
 
+        // Scheduling
+        //-------------------------------------------------------------------------
+
+        // Start compilation tasks for pending requests in priority order, as long as their dependencies are complete
+        void SchedulePendingRequests();
+
+        // Fill the list of compilable resources that this request depends on
+        void ResolveCompileDependencies( CompilationRequest* pRequest );
+
+        // Returns an incomplete request that was created before this one and that needs to finish first (if any)
+        CompilationRequest* FindBlockingRequest( CompilationRequest const* pRequest ) const;
+
+        void StartCompilationTask( CompilationRequest* pRequest );
+
     private:
 
         Network::IPC::Server                                        m_networkServer;
@@ -141,6 +190,19 @@ namespace EE::Resource
         TVector<CompilationTask*>                                   m_activeTasks;
         std::atomic<int64_t>                                        m_numScheduledTasks = 0;
 
+        // Scheduling
+        TArray<TVector<CompilationRequest*>, s_numPriorities>       m_pendingRequests;
+        THashMap<ResourceID, TInlineVector<CompilationRequest*, 2>> m_incompleteRequests; // All incomplete requests per resource, in creation order
+        THashMap<ResourceID, CachedCompileDependencies>             m_compileDependencyCache;
+        uint64_t                                                    m_nextRequestSequenceID = 0;
+        int32_t                                                     m_maxConcurrentCompilations = 0;
+        TArray<Milliseconds, s_numPriorities>                       m_totalQueueTime;
+        TArray<uint32_t, s_numPriorities>                           m_numDequeuedRequests = {};
+
+        // Compiled Resource Cache
+        CompiledResourceCache                                       m_compiledResourceCache;
+        int32_t                                                     m_numCacheEntriesAddedSinceEviction = 0;
+
         // Workers
         ResourceServerContext                                       m_context;
 
@@ -356,11 +356,11 @@ namespace EE
 
             m_resourceServer.Update();
 
-            // Sleep when idle to reduce CPU load
+            // Sleep when idle to reduce CPU load, local clients will wake us up as soon as they send a request
             auto const isBusy = m_resourceServer.IsBusy();
             if ( !isBusy )
             {
-                Threading::Sleep( 1 );
+                m_resourceServer.WaitForIncomingRequests( 1 );
             }
 
             m_resourceSystem.Update();
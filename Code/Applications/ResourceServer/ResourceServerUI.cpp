@@ -224,6 +224,15 @@ namespace EE::Resource
                             }
                             break;
 
+                            case CompilationRequest::Status::SucceededFromCache:
+                            {
+                                itemColor = Colors::Lime.ToFloat4();
+                                ImGui::TextColored( itemColor, EE_ICON_DATABASE_CHECK );
+                                HandleContextMenuOpening();
+                                ImGuiX::TextTooltip( "Restored From Cache" );
+                            }
+                            break;
+
                             case CompilationRequest::Status::Failed:
                             {
                                 itemColor = Colors::Red.ToFloat4();
@@ -448,6 +457,37 @@ namespace EE::Resource
 
             //-------------------------------------------------------------------------
 
+            ImGui::SeparatorText( "Compiled Resource Cache" );
+
+            if ( m_resourceServer.IsCompiledResourceCacheEnabled() )
+            {
+                auto const cacheStats = m_resourceServer.GetCompiledResourceCacheStatistics();
+                ImGui::Text( "Cache Path: %s", m_resourceServer.GetCompiledResourceCacheDir().c_str() );
+                ImGui::Text( "Hits: %u, Misses: %u (%.1f%%)", cacheStats.m_numHits, cacheStats.m_numMisses, cacheStats.GetHitRate() * 100.0f );
+                ImGui::Text( "Entries: %u (%.2fMB / %.2fMB), Evicted: %u", cacheStats.m_numEntries, float( cacheStats.m_totalSize ) / ( 1024 * 1024 ), float( m_resourceServer.GetCompiledResourceCacheMaxSize() ) / ( 1024 * 1024 ), cacheStats.m_numEvictedEntries );
+            }
+            else
+            {
+                ImGui::TextColored( Colors::Yellow.ToFloat4(), "Cache Disabled" );
+            }
+
+            //-------------------------------------------------------------------------
+
+            ImGui::SeparatorText( "Compilation Queue" );
+
+            auto const queueMetrics = m_resourceServer.GetQueueMetrics();
+            ImGui::Text( "Compiling: %d / %d, Blocked On Dependencies: %d", queueMetrics.m_numActiveCompilations, queueMetrics.m_maxConcurrentCompilations, queueMetrics.m_numBlockedRequests );
+
+            constexpr static char const* const laneNames[] = { "Client", "Hot Reload", "Packaging" };
+            static_assert( sizeof( laneNames ) / sizeof( laneNames[0] ) == (size_t) CompilationRequest::Priority::NumPriorities, "Missing lane names" );
+
+            for ( int32_t laneIdx = 0; laneIdx < (int32_t) CompilationRequest::Priority::NumPriorities; laneIdx++ )
+            {
+                ImGui::Text( "%s: %d pending, %.2fms average wait", laneNames[laneIdx], queueMetrics.m_numPendingRequests[laneIdx], queueMetrics.m_averageQueueTime[laneIdx].ToFloat() );
+            }
+
+            //-------------------------------------------------------------------------
+
             ImGui::SeparatorText( "Tools" );
 
             ImVec2 buttonSize( 155, 0 );
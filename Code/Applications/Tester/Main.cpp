@@ -13,6 +13,40 @@
 #include "Base/Time/Timers.h"
 #include "Base/Encoding/Quantization.h"
 #include "Base/Types/RefCounting.h"
+#include "Base/Network/SharedMemoryTransport.h"
+#include "Base/Resource/ResourceProviders/ResourceNetworkMessages.h"
+#include "Base/ThirdParty/cmdParser/cmdParser.h"
+#include "Engine/Entity/Entity.h"
+#include "Engine/Entity/EntitySpatialComponent.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Animation/Systems/EntitySystem_Animation.h"
+#include "Engine/UpdateContext.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Resource/ResourceSystem.h"
+#include "Base/RenderGraph/RenderGraphTransientAliasing.h"
+#include "Base/Serialization/JsonSerialization.h"
+#include "Engine/Animation/AnimationSkeleton.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_RootMotionDebugger.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Parameters.h"
+#include "EngineTools/Animation/ToolsGraph/Animation_ToolsGraph_Definition.h"
+#include "EngineTools/Animation/ToolsGraph/Animation_ToolsGraph_Compilation.h"
+#include "EngineTools/Animation/ToolsGraph/Animation_ToolsGraph_ValuePrograms.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Instance.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_InstancePool.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationGraph.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationClip.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationSkeleton.h"
+#include "Base/Resource/ResourceProviders/PackagedResourceProvider.h"
+#include "Base/Resource/Settings/GlobalSettings_Resource.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include "Engine/Entity/EntityDescriptors.h"
+#include "EngineTools/Entity/EntitySerializationTools.h"
+#include "Engine/AI/AIScheduler.h"
+#include "Engine/AI/Components/Component_AI.h"
+#include "Base/Math/ViewVolume.h"
+#include <thread>
+#include <filesystem>
 
 //-------------------------------------------------------------------------
 
@@ -125,10 +159,1247 @@ template struct access<class CxSecret, &C::y>;
 template struct access<class CxSecret, &C::z>;
 template struct access<class CxSecret, &C::w>;
 
+//-------------------------------------------------------------------------
+// Shared memory transport benchmark
+//-------------------------------------------------------------------------
+// Simulates resource server traffic: bursts of small requests and large batches of compiled resource paths
+// Only run when requested via the command line, the port needs to be free on this machine
+
+static void BenchmarkSharedMemoryTransport( uint16_t benchmarkPort )
+{
+    constexpr static int32_t const numIterations = 1000;
+
+    Network::SharedMemoryHost host;
+    Network::SharedMemoryClient client;
+
+    if ( !host.Create( benchmarkPort ) || !client.TryConnect( benchmarkPort ) )
+    {
+        std::cout << "Shared memory transport: failed to create connection!" << std::endl;
+        client.Disconnect();
+        host.Destroy();
+        return;
+    }
+
+    host.UpdateConnections( [] ( uint32_t ) {}, [] ( uint32_t ) {} );
+
+    // Build the messages the same way the resource provider/server do
+    //-------------------------------------------------------------------------
+
+    Resource::NetworkResourceRequest request;
+    request.m_resourceIDs.emplace_back( ResourceID( "data://Characters/Player/Player.msh" ) );
+    Network::IPC::Message smallMessage( 1, request );
+
+    Resource::NetworkResourceResponse response;
+    for ( int32_t i = 0; i < 128; i++ )
+    {
+        String const path( String::CtorSprintf(), "D:/Esoterica/Compiled/Characters/Crowd/Character_%03d/Character_%03d.msh", i, i );
+        response.m_results.emplace_back( ResourceID( "data://Characters/Player/Player.msh" ), path );
+    }
+    Network::IPC::Message largeMessage( 2, response );
+
+    // Round trips
+    //-------------------------------------------------------------------------
+
+    auto RunRoundTrips = [&] ( Network::IPC::Message const& message, int32_t numMessagesPerBurst )
+    {
+        Milliseconds elapsedTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( elapsedTime );
+
+            for ( int32_t i = 0; i < numIterations; i++ )
+            {
+                for ( int32_t j = 0; j < numMessagesPerBurst; j++ )
+                {
+                    client.QueueMessage( message.GetPayloadData(), (uint32_t) message.GetPayloadDataSize() );
+                }
+                client.Flush();
+
+                int32_t numReceived = 0;
+                while ( numReceived < numMessagesPerBurst )
+                {
+                    host.ReceiveMessages( [&] ( uint32_t connectionID, void* pData, size_t size ) { host.QueueMessage( connectionID, pData, (uint32_t) size ); numReceived++; } );
+                    host.Flush();
+                }
+
+                int32_t numReplies = 0;
+                while ( numReplies < numMessagesPerBurst )
+                {
+                    client.ReceiveMessages( [&] ( void* pData, size_t size ) { numReplies++; } );
+                    client.Flush();
+                }
+            }
+        }
+
+        float const numBytes = float( message.GetPayloadDataSize() ) * numMessagesPerBurst * numIterations * 2;
+        std::cout << "  " << numMessagesPerBurst << " x " << message.GetPayloadDataSize() << " bytes: " << ( elapsedTime.ToFloat() * 1000.0f / numIterations ) << "us per burst, " << ( numBytes / ( elapsedTime.ToFloat() / 1000.0f ) / ( 1024 * 1024 ) ) << "MB/s" << std::endl;
+    };
+
+    std::cout << "Shared memory transport (round trip):" << std::endl;
+    RunRoundTrips( smallMessage, 1 );
+    RunRoundTrips( smallMessage, 128 );
+    RunRoundTrips( largeMessage, 1 );
+    RunRoundTrips( largeMessage, 16 );
+
+    //-------------------------------------------------------------------------
+
+    client.Disconnect();
+    host.Destroy();
+}
+
+//-------------------------------------------------------------------------
+// World transform contention benchmark
+//-------------------------------------------------------------------------
+// One thread keeps moving the roots of a set of attachment chains while all other threads read the world transforms of the leaves (i.e. the parallel entity update)
+// Once all threads are done, every leaf must match its root, any mismatch means that an invalidation was lost while a transform was being recalculated
+
+static void BenchmarkWorldTransformContention()
+{
+    constexpr static int32_t const numChains = 64;
+    constexpr static int32_t const chainDepth = 8;
+    constexpr static int32_t const numWriteIterations = 2000;
+
+    // Unloaded entities add components immediately, so we dont need a world to build the hierarchies
+    //-------------------------------------------------------------------------
+
+    TVector<Entity*> entities;
+    TVector<SpatialEntityComponent*> rootComponents;
+    TVector<SpatialEntityComponent*> leafComponents;
+
+    Transform const childLocalTransform( Quaternion::Identity, Vector( 0, 0, 1 ) );
+
+    for ( int32_t i = 0; i < numChains; i++ )
+    {
+        Entity* pEntity = entities.emplace_back( EE::New<Entity>( StringID( "TransformChain" ) ) );
+
+        SpatialEntityComponent* pParentComponent = nullptr;
+        for ( int32_t j = 0; j < chainDepth; j++ )
+        {
+            auto pComponent = EE::New<SpatialEntityComponent>();
+            pComponent->SetLocalTransform( ( j == 0 ) ? Transform::Identity : childLocalTransform );
+            pEntity->AddComponent( pComponent, ( pParentComponent != nullptr ) ? pParentComponent->GetID() : ComponentID() );
+            pParentComponent = pComponent;
+        }
+
+        rootComponents.emplace_back( pEntity->GetRootSpatialComponent() );
+        leafComponents.emplace_back( pParentComponent );
+    }
+
+    // Run
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    SpatialEntityComponent::WorldTransformStats const initialStats = SpatialEntityComponent::GetWorldTransformStats();
+    #endif
+
+    std::atomic<bool> isWriterDone = false;
+    std::atomic<uint64_t> numReads = 0;
+    int32_t const numReaderThreads = Math::Max( (int32_t) std::thread::hardware_concurrency() - 1, 1 );
+
+    Milliseconds elapsedTime = 0;
+    {
+        ScopedTimer<PlatformClock> timer( elapsedTime );
+
+        TVector<std::thread> readerThreads;
+        for ( int32_t t = 0; t < numReaderThreads; t++ )
+        {
+            readerThreads.emplace_back( [&, t] ()
+            {
+                uint64_t numThreadReads = 0;
+                float accumulatedHeight = 0.0f;
+                while ( !isWriterDone.load( std::memory_order_relaxed ) )
+                {
+                    // Offset each reader so that they dont all contend on the same chain at the same time
+                    for ( int32_t i = 0; i < numChains; i++ )
+                    {
+                        accumulatedHeight += leafComponents[( i + t ) % numChains]->GetPosition().GetZ();
+                    }
+                    numThreadReads += numChains;
+                }
+
+                numReads.fetch_add( numThreadReads + ( accumulatedHeight < 0.0f ? 1 : 0 ), std::memory_order_relaxed );
+            } );
+        }
+
+        for ( int32_t i = 0; i < numWriteIterations; i++ )
+        {
+            for ( auto pRootComponent : rootComponents )
+            {
+                pRootComponent->SetLocalTransform( Transform( Quaternion::Identity, Vector( float( i ), 0, float( i % 7 ) ) ) );
+            }
+        }
+
+        isWriterDone = true;
+
+        for ( auto& thread : readerThreads )
+        {
+            thread.join();
+        }
+    }
+
+    // Validate
+    //-------------------------------------------------------------------------
+
+    int32_t numStaleTransforms = 0;
+    Vector const leafOffset( 0, 0, float( chainDepth - 1 ) );
+    for ( int32_t i = 0; i < numChains; i++ )
+    {
+        Vector const expectedPosition = rootComponents[i]->GetLocalTransform().GetTranslation() + leafOffset;
+        if ( !leafComponents[i]->GetPosition().IsNearEqual3( expectedPosition ) )
+        {
+            numStaleTransforms++;
+        }
+    }
+
+    std::cout << "World transform contention (" << numChains << " chains of depth " << chainDepth << ", " << numReaderThreads << " reader threads):" << std::endl;
+    std::cout << "  " << ( numChains * numWriteIterations ) << " root moves in " << elapsedTime.ToFloat() << "ms, " << numReads.load() << " leaf reads (" << ( elapsedTime.ToFloat() * 1000000.0f / Math::Max( numReads.load(), 1ull ) ) << "ns per read)" << std::endl;
+
+    #if EE_DEVELOPMENT_TOOLS
+    SpatialEntityComponent::WorldTransformStats const finalStats = SpatialEntityComponent::GetWorldTransformStats();
+    std::cout << "  " << ( finalStats.m_numInvalidations - initialStats.m_numInvalidations ) << " invalidations, " << ( finalStats.m_numCalculations - initialStats.m_numCalculations ) << " calculations" << std::endl;
+    #endif
+
+    std::cout << "  Stale leaf transforms: " << numStaleTransforms << ( ( numStaleTransforms == 0 ) ? " (OK)" : " (FAILED - lost invalidation)" ) << std::endl;
+
+    //-------------------------------------------------------------------------
+
+    for ( auto pEntity : entities )
+    {
+        EE::Delete( pEntity );
+    }
+}
+
+//-------------------------------------------------------------------------
+// Entity update benchmark
+//-------------------------------------------------------------------------
+// A world of simple entities, each one has a spatial component that is moved every frame and an animation system (the only batchable system)
+// The same world is updated with entity-major and with batched system updates so that the frame times can be compared
+// The world is set up without a resource provider since none of the entities need any resources
+
+class BenchmarkUpdateContext : public UpdateContext
+{
+public:
+
+    BenchmarkUpdateContext( SystemRegistry* pSystemRegistry ) { m_pSystemRegistry = pSystemRegistry; }
+
+    inline void SetUpdateStage( UpdateStage stage ) { m_stage = stage; }
+    inline void AdvanceFrame() { UpdateDeltaTime( Milliseconds( 1000.0f / 60.0f ) ); }
+};
+
+static void BenchmarkEntityUpdate( TypeSystem::TypeRegistry& typeRegistry )
+{
+    constexpr static int32_t const numEntities = 10000;
+    constexpr static int32_t const numWarmupFrames = 60;
+    constexpr static int32_t const numFrames = 500;
+
+    // Minimal set of systems needed by a world
+    //-------------------------------------------------------------------------
+
+    TaskSystem taskSystem( Threading::GetProcessorInfo().m_numLogicalCores );
+    taskSystem.Initialize();
+
+    Resource::ResourceSystem resourceSystem( taskSystem );
+    Settings::SettingsRegistry settingsRegistry( typeRegistry );
+
+    SystemRegistry systemRegistry;
+    systemRegistry.RegisterSystem( &taskSystem );
+    systemRegistry.RegisterSystem( &typeRegistry );
+    systemRegistry.RegisterSystem( &resourceSystem );
+    systemRegistry.RegisterSystem( &settingsRegistry );
+
+    EntityWorld world;
+    world.Initialize( systemRegistry, {} );
+
+    // Create entities
+    //-------------------------------------------------------------------------
+
+    TVector<Entity*> entities;
+    TVector<SpatialEntityComponent*> rootComponents;
+    entities.reserve( numEntities );
+    rootComponents.reserve( numEntities );
+
+    for ( int32_t i = 0; i < numEntities; i++ )
+    {
+        Entity* pEntity = EE::New<Entity>( StringID( String( String::CtorSprintf(), "Entity_%05d", i ).c_str() ) );
+        auto pComponent = EE::New<SpatialEntityComponent>();
+        pEntity->AddComponent( pComponent );
+        pEntity->CreateSystem<Animation::AnimationSystem>();
+        world.GetPersistentMap()->AddEntity( pEntity );
+        entities.emplace_back( pEntity );
+        rootComponents.emplace_back( pComponent );
+    }
+
+    // Entities go through a few loading states before they are registered for updates
+    auto AreAllEntitiesRegistered = [&] ()
+    {
+        for ( auto pEntity : entities )
+        {
+            if ( !pEntity->IsRegisteredForUpdates() )
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    constexpr static int32_t const maxLoadingUpdates = 100;
+    int32_t numLoadingUpdates = 0;
+    while ( !AreAllEntitiesRegistered() && numLoadingUpdates < maxLoadingUpdates )
+    {
+        world.UpdateLoading();
+        numLoadingUpdates++;
+    }
+
+    bool const isWorldReady = AreAllEntitiesRegistered();
+    if ( !isWorldReady )
+    {
+        std::cout << "Entity update: failed to register all entities for updates!" << std::endl;
+    }
+
+    // Run
+    //-------------------------------------------------------------------------
+
+    BenchmarkUpdateContext updateContext( &systemRegistry );
+
+    auto RunFrames = [&] ( int32_t numFramesToRun, Milliseconds& outMaxFrameTime ) -> Milliseconds
+    {
+        Milliseconds totalTime = 0;
+        outMaxFrameTime = 0;
+
+        for ( int32_t f = 0; f < numFramesToRun; f++ )
+        {
+            updateContext.AdvanceFrame();
+
+            // Move all entities, this requests a world transform update for each one of them
+            for ( int32_t i = 0; i < numEntities; i++ )
+            {
+                rootComponents[i]->SetLocalTransform( Transform( Quaternion::Identity, Vector( float( i % 100 ), float( i / 100 ), float( f % 10 ) ) ) );
+            }
+
+            Milliseconds frameTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( frameTime );
+                for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::Paused; stageIdx++ )
+                {
+                    updateContext.SetUpdateStage( (UpdateStage) stageIdx );
+                    world.Update( updateContext );
+                }
+            }
+
+            totalTime += frameTime;
+            outMaxFrameTime = Math::Max( outMaxFrameTime, frameTime );
+        }
+
+        return totalTime;
+    };
+
+    auto RunMode = [&] ( char const* pModeName, bool isBatched )
+    {
+        world.SetBatchedSystemUpdateEnabled( isBatched );
+
+        // Warm up, this also lets the update schedule sample the entity costs
+        Milliseconds maxFrameTime = 0;
+        RunFrames( numWarmupFrames, maxFrameTime );
+
+        Milliseconds const totalTime = RunFrames( numFrames, maxFrameTime );
+        EntityWorld::EntityUpdateStats const& stats = world.GetEntityUpdateStats( UpdateStage::PrePhysics );
+
+        std::cout << "  " << pModeName << ": " << ( totalTime.ToFloat() / numFrames ) << "ms avg frame, " << maxFrameTime.ToFloat() << "ms max frame, ";
+        std::cout << world.GetNumBatchedSystems( UpdateStage::PrePhysics ) << " batched systems, pre-physics entity update: " << stats.m_updateTime.ToFloat() << "ms (" << stats.m_numPartitions << " partitions)" << std::endl;
+    };
+
+    if ( isWorldReady )
+    {
+        std::cout << "Entity update (" << numEntities << " entities, " << taskSystem.GetNumWorkers() << " workers):" << std::endl;
+        RunMode( "Entity-major", false );
+        RunMode( "Batched", true );
+    }
+
+    // Shutdown
+    //-------------------------------------------------------------------------
+
+    world.Shutdown();
+
+    systemRegistry.UnregisterSystem( &settingsRegistry );
+    systemRegistry.UnregisterSystem( &resourceSystem );
+    systemRegistry.UnregisterSystem( &typeRegistry );
+    systemRegistry.UnregisterSystem( &taskSystem );
+
+    taskSystem.Shutdown();
+}
+
+//-------------------------------------------------------------------------
+// Render graph transient aliasing test
+//-------------------------------------------------------------------------
+// Device-free test of the transient aliasing planner and of the barrier skipping for aliased resources
+// A frame of transient resources is planned, every slot is validated and the barriers of two resources sharing a slot are recorded the same way as the render graph does
+
+static bool TestRenderGraphTransientAliasing()
+{
+    using namespace RG;
+
+    int32_t numFailedChecks = 0;
+    auto Check = [&numFailedChecks] ( bool condition, char const* pDescription )
+    {
+        if ( !condition )
+        {
+            std::cout << "  FAILED: " << pDescription << std::endl;
+            numFailedChecks++;
+        }
+    };
+
+    // Planner
+    //-------------------------------------------------------------------------
+
+    struct TestResource
+    {
+        RHI::RHITextureCreateDesc           m_textureDesc;
+        RHI::RHIBufferCreateDesc            m_bufferDesc;
+        RGResourceLifetime                  m_lifetime;
+        bool                                m_isBuffer = false;
+    };
+
+    auto AddTexture = [] ( TVector<TestResource>& resources, RHI::RHITextureCreateDesc const& desc, int32_t start, int32_t end )
+    {
+        auto& resource = resources.emplace_back();
+        resource.m_textureDesc = desc;
+        resource.m_lifetime = { start, end };
+    };
+
+    auto AddBuffer = [] ( TVector<TestResource>& resources, RHI::RHIBufferCreateDesc const& desc, int32_t start, int32_t end )
+    {
+        auto& resource = resources.emplace_back();
+        resource.m_bufferDesc = desc;
+        resource.m_lifetime = { start, end };
+        resource.m_isBuffer = true;
+    };
+
+    RHI::RHITextureCreateDesc const colorDesc = RHI::RHITextureCreateDesc::New2D( 1920, 1080, RHI::EPixelFormat::RGBA16Float );
+    RHI::RHITextureCreateDesc const halfResDesc = RHI::RHITextureCreateDesc::New2D( 960, 540, RHI::EPixelFormat::RGBA16Float );
+    RHI::RHIBufferCreateDesc const bufferDesc = RHI::RHIBufferCreateDesc::NewStorageBuffer( 64 * 1024 );
+
+    // Lifetimes are the first and last node that uses the resource, the post process chain ping-pongs between full and half resolution targets
+    TVector<TestResource> resources;
+    AddTexture( resources, colorDesc, 0, 2 );
+    AddTexture( resources, colorDesc, 1, 4 );
+    AddTexture( resources, halfResDesc, 3, 5 );
+    AddTexture( resources, colorDesc, 3, 6 );
+    AddTexture( resources, halfResDesc, 6, 7 );
+    AddTexture( resources, colorDesc, 5, 8 );
+    AddTexture( resources, colorDesc, 7, 9 );
+    AddBuffer( resources, bufferDesc, 0, 0 );
+    AddBuffer( resources, bufferDesc, 1, 1 );
+    AddBuffer( resources, bufferDesc, 1, 3 );
+
+    RGTransientAliasingPlanner planner;
+    for ( uint32_t i = 0; i < (uint32_t) resources.size(); i++ )
+    {
+        if ( resources[i].m_isBuffer )
+        {
+            planner.AddBuffer( i, resources[i].m_bufferDesc, resources[i].m_lifetime );
+        }
+        else
+        {
+            planner.AddTexture( i, resources[i].m_textureDesc, resources[i].m_lifetime );
+        }
+    }
+
+    // Leave an unplanned resource at the end, i.e. a named or imported resource
+    uint32_t const numResources = (uint32_t) resources.size() + 1;
+    RGTransientAliasingPlan const plan = planner.CreatePlan( numResources );
+
+    Check( plan.m_resourceSlots.size() == numResources, "The plan has a slot entry per resource" );
+    Check( plan.m_numPlannedResources == (int32_t) resources.size(), "All added resources are planned" );
+    Check( !plan.IsAliased( numResources - 1 ), "Resources that were not added are not aliased" );
+
+    for ( uint32_t i = 0; i < (uint32_t) resources.size(); i++ )
+    {
+        Check( plan.IsAliased( i ) && plan.m_resourceSlots[i] < plan.m_numSlots, "Every planned resource has a valid slot" );
+
+        for ( uint32_t j = i + 1; j < (uint32_t) resources.size(); j++ )
+        {
+            if ( plan.m_resourceSlots[i] != plan.m_resourceSlots[j] )
+            {
+                continue;
+            }
+
+            TestResource const& lhs = resources[i];
+            TestResource const& rhs = resources[j];
+            bool const areLifetimesDisjoint = lhs.m_lifetime.m_lifeEndTimePoint < rhs.m_lifetime.m_lifeStartTimePoint || rhs.m_lifetime.m_lifeEndTimePoint < lhs.m_lifetime.m_lifeStartTimePoint;
+            bool const areDescsEqual = ( lhs.m_isBuffer == rhs.m_isBuffer ) && ( lhs.m_isBuffer ? ( lhs.m_bufferDesc == rhs.m_bufferDesc ) : ( lhs.m_textureDesc == rhs.m_textureDesc ) );
+            Check( areLifetimesDisjoint, "Resources sharing a slot have disjoint lifetimes" );
+            Check( areDescsEqual, "Resources sharing a slot have identical descriptions" );
+        }
+    }
+
+    // At most two full resolution targets, one half resolution target and two buffers are alive at the same time
+    Check( plan.m_numSlots == 5, "The plan uses the minimum number of slots" );
+    Check( plan.m_peakMemoryWithAliasing < plan.m_peakMemoryWithoutAliasing, "Aliasing reduces the peak memory" );
+
+    // Barriers
+    //-------------------------------------------------------------------------
+    // Mirrors RenderGraph::TransitionResource, returns whether a barrier was recorded
+
+    auto RecordTransition = [] ( RGCompiledResource& resource, RHI::RenderResourceBarrierState state )
+    {
+        RHI::RenderResourceAccessState const access( state, true );
+        if ( resource.CanSkipTransition( access ) )
+        {
+            return false;
+        }
+
+        resource.TransiteTo( access.GetCurrentAccess() );
+        return true;
+    };
+
+    RGAliasedResourceState aliasedState;
+    RGCompiledResource firstAliasedResource;
+    RGCompiledResource secondAliasedResource;
+    firstAliasedResource.SetAliasedState( &aliasedState, true );
+    secondAliasedResource.SetAliasedState( &aliasedState, false );
+
+    Check( RecordTransition( firstAliasedResource, RHI::RenderResourceBarrierState::ComputeShaderWrite ), "The first use of the slot owner records a barrier" );
+    Check( !RecordTransition( firstAliasedResource, RHI::RenderResourceBarrierState::ComputeShaderWrite ), "Continuous writes of the same aliased resource skip the barrier" );
+    Check( RecordTransition( secondAliasedResource, RHI::RenderResourceBarrierState::ComputeShaderWrite ), "The first use of an aliased resource records a barrier even if the slot is already in the same state" );
+    Check( !RecordTransition( secondAliasedResource, RHI::RenderResourceBarrierState::ComputeShaderWrite ), "Continuous writes of the new slot user skip the barrier" );
+    Check( RecordTransition( firstAliasedResource, RHI::RenderResourceBarrierState::ComputeShaderWrite ), "Switching back to a previous slot user records a barrier" );
+    Check( firstAliasedResource.GetCurrentAccessState().GetCurrentAccess() == secondAliasedResource.GetCurrentAccessState().GetCurrentAccess(), "Aliased resources share their access state" );
+
+    RGCompiledResource standaloneResource;
+    Check( RecordTransition( standaloneResource, RHI::RenderResourceBarrierState::ComputeShaderWrite ), "The first use of a standalone resource records a barrier" );
+    Check( !RecordTransition( standaloneResource, RHI::RenderResourceBarrierState::ComputeShaderWrite ), "Continuous writes of a standalone resource skip the barrier" );
+    Check( RecordTransition( standaloneResource, RHI::RenderResourceBarrierState::ComputeShaderReadOther ), "A different access of a standalone resource records a barrier" );
+
+    //-------------------------------------------------------------------------
+
+    std::cout << "Render graph transient aliasing (" << plan.m_numPlannedResources << " resources in " << plan.m_numSlots << " slots):" << std::endl;
+    std::cout << "  Peak memory: " << ( plan.m_peakMemoryWithoutAliasing / ( 1024.0f * 1024.0f ) ) << "MB -> " << ( plan.m_peakMemoryWithAliasing / ( 1024.0f * 1024.0f ) ) << "MB" << std::endl;
+    std::cout << "  " << ( ( numFailedChecks == 0 ) ? "OK" : "FAILED" ) << std::endl;
+
+    return numFailedChecks == 0;
+}
+
+//-------------------------------------------------------------------------
+// Value program benchmark
+//-------------------------------------------------------------------------
+// Compiles an animation graph with and without value programs and evaluates every value tree that only depends on control parameters through both paths
+// Only the nodes of these trees are instantiated (outside of a graph instance) since the rest of the graph needs the graph's resources to be loaded
+
+class BenchmarkValueTrees
+{
+public:
+
+    BenchmarkValueTrees( Animation::GraphDefinition const* pGraphDefinition, Animation::Skeleton const* pSkeleton )
+        : m_pGraphDefinition( pGraphDefinition )
+        , m_taskSystem( pSkeleton )
+        , m_context( 1, pSkeleton )
+    {}
+
+    ~BenchmarkValueTrees()
+    {
+        if ( m_pInstanceMemory == nullptr )
+        {
+            return;
+        }
+
+        for ( auto rootNodeIdx : m_rootNodeIndices )
+        {
+            m_nodePtrs[rootNodeIdx]->Shutdown( m_context );
+        }
+
+        m_context.Shutdown();
+
+        for ( auto nodeIdx : m_nodeIndices )
+        {
+            m_nodePtrs[nodeIdx]->~GraphNode();
+        }
+
+        EE::Free( m_pInstanceMemory );
+    }
+
+    // Get all the nodes of the tree starting at the supplied node, fails if the tree depends on anything other than control parameters
+    static bool TryGetTreeNodes( Animation::GraphDefinition const* pGraphDefinition, int16_t rootNodeIdx, TVector<int16_t>& outTreeNodeIndices )
+    {
+        using namespace Animation;
+        using namespace Animation::GraphNodes;
+
+        outTreeNodeIndices.clear();
+        TInlineVector<int16_t, 16> nodesToVisit = { rootNodeIdx };
+        TInlineVector<int16_t, 4> inputNodeIndices;
+
+        while ( !nodesToVisit.empty() )
+        {
+            int16_t const nodeIdx = nodesToVisit.back();
+            nodesToVisit.pop_back();
+
+            if ( VectorContains( outTreeNodeIndices, nodeIdx ) )
+            {
+                continue;
+            }
+
+            GraphNode::Definition const* pDefinition = pGraphDefinition->GetNodeDefinition( nodeIdx );
+            if ( auto pFloatProgramDefinition = TryCast<FloatValueProgramNode::Definition>( pDefinition ) )
+            {
+                inputNodeIndices.assign( pFloatProgramDefinition->m_program.m_inputNodeIndices.begin(), pFloatProgramDefinition->m_program.m_inputNodeIndices.end() );
+            }
+            else if ( auto pBoolProgramDefinition = TryCast<BoolValueProgramNode::Definition>( pDefinition ) )
+            {
+                inputNodeIndices.assign( pBoolProgramDefinition->m_program.m_inputNodeIndices.begin(), pBoolProgramDefinition->m_program.m_inputNodeIndices.end() );
+            }
+            else if ( ValueProgramCompiler::IsFlattenableNode( pDefinition ) )
+            {
+                ValueProgramCompiler::GetNodeInputs( pDefinition, inputNodeIndices );
+            }
+            else if ( IsOfType<ControlParameterFloatNode::Definition>( pDefinition ) || IsOfType<ControlParameterBoolNode::Definition>( pDefinition ) )
+            {
+                inputNodeIndices.clear();
+            }
+            else
+            {
+                return false;
+            }
+
+            outTreeNodeIndices.emplace_back( nodeIdx );
+            nodesToVisit.insert( nodesToVisit.end(), inputNodeIndices.begin(), inputNodeIndices.end() );
+        }
+
+        return true;
+    }
+
+    void AddTree( int16_t rootNodeIdx, TVector<int16_t> const& treeNodeIndices )
+    {
+        EE_ASSERT( m_pInstanceMemory == nullptr );
+
+        for ( auto nodeIdx : treeNodeIndices )
+        {
+            if ( !VectorContains( m_nodeIndices, nodeIdx ) )
+            {
+                m_nodeIndices.emplace_back( nodeIdx );
+            }
+        }
+
+        m_rootNodeIndices.emplace_back( rootNodeIdx );
+    }
+
+    // Create and initialize the nodes of all added trees
+    void Instantiate()
+    {
+        using namespace Animation;
+
+        EE_ASSERT( m_pInstanceMemory == nullptr );
+
+        m_pInstanceMemory = reinterpret_cast<uint8_t*>( EE::Alloc( m_pGraphDefinition->GetInstanceRequiredMemory(), m_pGraphDefinition->GetInstanceRequiredAlignment() ) );
+        for ( auto const& nodeOffset : m_pGraphDefinition->GetInstanceNodeStartOffsets() )
+        {
+            m_nodePtrs.emplace_back( reinterpret_cast<GraphNode*>( m_pInstanceMemory + nodeOffset ) );
+        }
+
+        THashMap<StringID, int16_t> const parameterLookupMap;
+        TInlineVector<GraphInstance*, 20> const childGraphInstances;
+        InstantiationContext instantiationContext = { (int16_t) InvalidIndex, m_nodePtrs, childGraphInstances, parameterLookupMap, nullptr, 1 };
+
+        #if EE_DEVELOPMENT_TOOLS
+        instantiationContext.m_pLog = &m_log;
+        #endif
+
+        for ( auto nodeIdx : m_nodeIndices )
+        {
+            instantiationContext.m_currentNodeIdx = nodeIdx;
+            m_pGraphDefinition->GetNodeDefinition( nodeIdx )->InstantiateNode( instantiationContext, InstantiationOptions::CreateNode );
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_context.Initialize( &m_taskSystem, &m_sampledEventsBuffer );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_context.SetDebugSystems( &m_rootMotionDebugger, &m_activeNodes, &m_log );
+        #endif
+
+        for ( auto rootNodeIdx : m_rootNodeIndices )
+        {
+            m_nodePtrs[rootNodeIdx]->Initialize( m_context );
+        }
+    }
+
+    // Set all control parameters, both compiled versions of a graph have the same parameter indices so they get the same values
+    // Returns the sum of all tree values
+    float Evaluate( int32_t frameIdx )
+    {
+        using namespace Animation;
+        using namespace Animation::GraphNodes;
+
+        m_context.Update( Seconds( 1.0f / 60.0f ), Transform::Identity, nullptr );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_activeNodes.clear();
+        m_log.clear();
+        #endif
+
+        for ( auto nodeIdx : m_nodeIndices )
+        {
+            GraphNode::Definition const* pDefinition = m_pGraphDefinition->GetNodeDefinition( nodeIdx );
+            if ( IsOfType<ControlParameterFloatNode::Definition>( pDefinition ) )
+            {
+                static_cast<ValueNode*>( m_nodePtrs[nodeIdx] )->SetValue<float>( Math::Sin( frameIdx * 0.05f + nodeIdx ) * 10.0f );
+            }
+            else if ( IsOfType<ControlParameterBoolNode::Definition>( pDefinition ) )
+            {
+                static_cast<ValueNode*>( m_nodePtrs[nodeIdx] )->SetValue<bool>( ( ( frameIdx + nodeIdx ) % 3 ) == 0 );
+            }
+        }
+
+        float result = 0.0f;
+        for ( auto rootNodeIdx : m_rootNodeIndices )
+        {
+            auto pRootNode = static_cast<ValueNode*>( m_nodePtrs[rootNodeIdx] );
+            if ( pRootNode->GetValueType() == GraphValueType::Bool )
+            {
+                result += pRootNode->GetValue<bool>( m_context ) ? 1.0f : 0.0f;
+            }
+            else
+            {
+                result += pRootNode->GetValue<float>( m_context );
+            }
+        }
+
+        return result;
+    }
+
+    inline int32_t GetNumTrees() const { return (int32_t) m_rootNodeIndices.size(); }
+    inline int32_t GetNumInstantiatedNodes() const { return (int32_t) m_nodeIndices.size(); }
+
+private:
+
+    Animation::GraphDefinition const*           m_pGraphDefinition = nullptr;
+    Animation::TaskSystem                       m_taskSystem;
+    Animation::SampledEventsBuffer              m_sampledEventsBuffer;
+    Animation::GraphContext                     m_context;
+    TVector<int16_t>                            m_rootNodeIndices;
+    TVector<int16_t>                            m_nodeIndices;
+    TVector<Animation::GraphNode*>              m_nodePtrs;
+    uint8_t*                                    m_pInstanceMemory = nullptr;
+
+    #if EE_DEVELOPMENT_TOOLS
+    Animation::RootMotionDebugger               m_rootMotionDebugger;
+    TVector<int16_t>                            m_activeNodes;
+    TVector<Animation::GraphLogEntry>           m_log;
+    #endif
+};
+
+static void BenchmarkValuePrograms( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& graphFilePath )
+{
+    using namespace Animation;
+    using namespace Animation::GraphNodes;
+
+    constexpr static int32_t const numWarmupFrames = 100;
+    constexpr static int32_t const numFrames = 10000;
+
+    // Load and compile the graph with and without value programs
+    //-------------------------------------------------------------------------
+
+    Serialization::JsonArchiveReader archive;
+    ToolsGraphDefinition toolsGraph;
+    if ( !archive.ReadFromFile( graphFilePath ) || !toolsGraph.LoadFromJson( typeRegistry, archive.GetDocument() ) )
+    {
+        std::cout << "Value programs: failed to load animation graph: " << graphFilePath.c_str() << std::endl;
+        return;
+    }
+
+    GraphDefinitionCompiler programCompiler;
+    GraphDefinitionCompiler nodeCompiler;
+    if ( !programCompiler.CompileGraph( toolsGraph ) || !nodeCompiler.CompileGraph( toolsGraph, false ) )
+    {
+        std::cout << "Value programs: failed to compile animation graph: " << graphFilePath.c_str() << std::endl;
+        return;
+    }
+
+    GraphDefinition const* pProgramGraph = programCompiler.GetCompiledGraph();
+    GraphDefinition const* pNodeGraph = nodeCompiler.GetCompiledGraph();
+
+    // Find all program trees that only depend on control parameters and the matching node trees
+    //-------------------------------------------------------------------------
+
+    // The value trees dont use the skeleton, the context just requires one
+    Skeleton skeleton;
+    BenchmarkValueTrees programTrees( pProgramGraph, &skeleton );
+    BenchmarkValueTrees nodeTrees( pNodeGraph, &skeleton );
+    TVector<int16_t> programTreeNodeIndices, nodeTreeNodeIndices;
+    int32_t numPrograms = 0;
+
+    for ( int16_t i = 0; i < pProgramGraph->GetNumNodes(); i++ )
+    {
+        GraphNode::Definition const* pDefinition = pProgramGraph->GetNodeDefinition( i );
+        if ( !IsOfType<FloatValueProgramNode::Definition>( pDefinition ) && !IsOfType<BoolValueProgramNode::Definition>( pDefinition ) )
+        {
+            continue;
+        }
+
+        numPrograms++;
+
+        // Both compiled graphs share the node IDs
+        auto const foundIDIter = programCompiler.GetRuntimeIndexToUUIDMap().find( i );
+        EE_ASSERT( foundIDIter != programCompiler.GetRuntimeIndexToUUIDMap().end() );
+        auto const foundIndexIter = nodeCompiler.GetUUIDToRuntimeIndexMap().find( foundIDIter->second );
+        EE_ASSERT( foundIndexIter != nodeCompiler.GetUUIDToRuntimeIndexMap().end() );
+        int16_t const nodeTreeRootIdx = foundIndexIter->second;
+
+        if ( BenchmarkValueTrees::TryGetTreeNodes( pProgramGraph, i, programTreeNodeIndices ) && BenchmarkValueTrees::TryGetTreeNodes( pNodeGraph, nodeTreeRootIdx, nodeTreeNodeIndices ) )
+        {
+            programTrees.AddTree( i, programTreeNodeIndices );
+            nodeTrees.AddTree( nodeTreeRootIdx, nodeTreeNodeIndices );
+        }
+    }
+
+    std::cout << "Value programs (" << graphFilePath.c_str() << "):" << std::endl;
+    std::cout << "  Nodes: " << pNodeGraph->GetNumNodes() << " -> " << pProgramGraph->GetNumNodes() << ", instance memory: " << pNodeGraph->GetInstanceRequiredMemory() << " -> " << pProgramGraph->GetInstanceRequiredMemory() << " bytes" << std::endl;
+
+    if ( programTrees.GetNumTrees() == 0 )
+    {
+        std::cout << "  None of the " << numPrograms << " value programs only depend on control parameters, nothing to benchmark" << std::endl;
+        return;
+    }
+
+    // Run
+    //-------------------------------------------------------------------------
+
+    programTrees.Instantiate();
+    nodeTrees.Instantiate();
+
+    TVector<float> programResults( numFrames );
+    TVector<float> nodeResults( numFrames );
+
+    auto Run = [&] ( char const* pModeName, BenchmarkValueTrees& trees, TVector<float>& results )
+    {
+        for ( int32_t f = 0; f < numWarmupFrames; f++ )
+        {
+            trees.Evaluate( f );
+        }
+
+        Milliseconds time = 0;
+        {
+            ScopedTimer<PlatformClock> timer( time );
+            for ( int32_t f = 0; f < numFrames; f++ )
+            {
+                results[f] = trees.Evaluate( f );
+            }
+        }
+
+        std::cout << "  " << pModeName << ": " << ( time.ToFloat() * 1000.0f / numFrames ) << "us per frame (" << trees.GetNumInstantiatedNodes() << " nodes)" << std::endl;
+    };
+
+    std::cout << "  " << programTrees.GetNumTrees() << " of " << numPrograms << " value programs only depend on control parameters" << std::endl;
+    Run( "Node pull", nodeTrees, nodeResults );
+    Run( "Value programs", programTrees, programResults );
+
+    int32_t numMismatches = 0;
+    for ( int32_t f = 0; f < numFrames; f++ )
+    {
+        if ( !Math::IsNearEqual( programResults[f], nodeResults[f], 1.0e-3f ) )
+        {
+            numMismatches++;
+        }
+    }
+
+    std::cout << "  " << ( ( numMismatches == 0 ) ? "Results match" : "RESULTS DIFFER" ) << " (" << numMismatches << " of " << numFrames << " frames differ)" << std::endl;
+}
+
+//-------------------------------------------------------------------------
+// Graph instance pool benchmark
+//-------------------------------------------------------------------------
+// Loads a compiled graph variation and spawns/despawns waves of characters, once through the variation's instance pool and once by creating/destroying every instance
+// The resources are read straight from the compiled resource directory (i.e. the packaged provider), so the variation and all its dependencies need to be compiled
+
+static void BenchmarkGraphInstancePool( TypeSystem::TypeRegistry& typeRegistry, ResourceID const& graphVariationID )
+{
+    constexpr static int32_t const numWaves = 100;
+
+    if ( !graphVariationID.IsValid() || graphVariationID.GetResourceTypeID() != Animation::GraphVariation::GetStaticResourceTypeID() )
+    {
+        std::cout << "Graph instance pool: invalid graph variation resource path: " << graphVariationID.c_str() << std::endl;
+        return;
+    }
+
+    // Minimal set of systems needed to load an animation graph
+    //-------------------------------------------------------------------------
+
+    TaskSystem taskSystem( Threading::GetProcessorInfo().m_numLogicalCores );
+    taskSystem.Initialize();
+
+    Settings::SettingsRegistry settingsRegistry( typeRegistry );
+    if ( !settingsRegistry.Initialize( FileSystem::GetCurrentProcessPath().Append( "Esoterica.ini" ) ) )
+    {
+        std::cout << "Graph instance pool: failed to load the settings!" << std::endl;
+        taskSystem.Shutdown();
+        return;
+    }
+
+    Resource::PackagedResourceProvider resourceProvider( *settingsRegistry.GetGlobalSettings<Resource::ResourceGlobalSettings>() );
+    static_cast<Resource::ResourceProvider&>( resourceProvider ).Initialize();
+
+    Resource::ResourceSystem resourceSystem( taskSystem );
+    resourceSystem.Initialize( &resourceProvider );
+
+    Animation::SkeletonLoader skeletonLoader;
+    Animation::AnimationClipLoader animationClipLoader;
+    Animation::GraphLoader graphLoader;
+    animationClipLoader.SetTypeRegistryPtr( &typeRegistry );
+    graphLoader.SetTypeRegistryPtr( &typeRegistry );
+
+    resourceSystem.RegisterResourceLoader( &skeletonLoader );
+    resourceSystem.RegisterResourceLoader( &animationClipLoader );
+    resourceSystem.RegisterResourceLoader( &graphLoader );
+
+    // Load the variation, this also prewarms its pool
+    //-------------------------------------------------------------------------
+
+    TResourcePtr<Animation::GraphVariation> graphVariation( graphVariationID );
+    resourceSystem.LoadResource( graphVariation );
+    resourceSystem.WaitForAllRequestsToComplete();
+
+    // Run
+    //-------------------------------------------------------------------------
+
+    if ( graphVariation.IsLoaded() )
+    {
+        Animation::GraphVariation const* pGraphVariation = graphVariation.GetPtr();
+        Animation::GraphInstancePool* pInstancePool = pGraphVariation->GetInstancePool();
+
+        // Each wave spawns as many characters as the pool holds, so the pooled path never has to fall back to creating instances
+        int32_t const waveSize = Math::Max( pInstancePool->GetPoolSize(), 1 );
+        TVector<Animation::GraphInstance*> instances( waveSize, nullptr );
+
+        auto RunMode = [&] ( char const* pModeName, bool isPooled )
+        {
+            Milliseconds totalSpawnTime = 0;
+            Milliseconds totalDespawnTime = 0;
+            Milliseconds maxWaveSpawnTime = 0;
+
+            for ( int32_t w = 0; w < numWaves; w++ )
+            {
+                Milliseconds waveTime = 0;
+                {
+                    ScopedTimer<PlatformClock> timer( waveTime );
+                    for ( int32_t i = 0; i < waveSize; i++ )
+                    {
+                        uint64_t const ownerID = uint64_t( w ) * waveSize + i + 1;
+                        instances[i] = isPooled ? pInstancePool->AcquireInstance( ownerID ) : EE::New<Animation::GraphInstance>( pGraphVariation, ownerID );
+                    }
+                }
+
+                totalSpawnTime += waveTime;
+                maxWaveSpawnTime = Math::Max( maxWaveSpawnTime, waveTime );
+
+                {
+                    ScopedTimer<PlatformClock> timer( waveTime );
+                    for ( int32_t i = 0; i < waveSize; i++ )
+                    {
+                        if ( isPooled )
+                        {
+                            pInstancePool->ReleaseInstance( instances[i] );
+                        }
+                        else
+                        {
+                            EE::Delete( instances[i] );
+                        }
+                    }
+                }
+
+                totalDespawnTime += waveTime;
+            }
+
+            float const numSpawns = float( numWaves * waveSize );
+            std::cout << "  " << pModeName << ": " << ( totalSpawnTime.ToFloat() * 1000.0f / numSpawns ) << "us spawn, " << ( totalDespawnTime.ToFloat() * 1000.0f / numSpawns ) << "us despawn per instance, ";
+            std::cout << maxWaveSpawnTime.ToFloat() << "ms worst wave spawn" << std::endl;
+        };
+
+        std::cout << "Graph instance pool (" << graphVariationID.c_str() << ", " << numWaves << " waves of " << waveSize << " instances):" << std::endl;
+        RunMode( "Fresh", false );
+        RunMode( "Pooled", true );
+
+        #if EE_DEVELOPMENT_TOOLS
+        Animation::GraphInstancePool::Stats const& stats = pInstancePool->GetStats();
+        std::cout << "  Pool: " << stats.m_numCreated << " created, " << stats.m_numReused << " reused, " << stats.m_numRecycled << " recycled, " << stats.m_numDestroyed << " destroyed" << std::endl;
+        #endif
+    }
+    else
+    {
+        std::cout << "Graph instance pool: failed to load graph variation: " << graphVariationID.c_str() << std::endl;
+    }
+
+    // Shutdown
+    //-------------------------------------------------------------------------
+
+    resourceSystem.UnloadResource( graphVariation );
+    resourceSystem.WaitForAllRequestsToComplete();
+
+    resourceSystem.UnregisterResourceLoader( &graphLoader );
+    resourceSystem.UnregisterResourceLoader( &animationClipLoader );
+    resourceSystem.UnregisterResourceLoader( &skeletonLoader );
+    graphLoader.ClearTypeRegistryPtr();
+    animationClipLoader.ClearTypeRegistryPtr();
+
+    resourceSystem.Shutdown();
+    settingsRegistry.Shutdown();
+    taskSystem.Shutdown();
+}
+
+//-------------------------------------------------------------------------
+// Map reader benchmark
+//-------------------------------------------------------------------------
+// Reads the largest map found at the supplied path (a .map file or a directory that is searched recursively) with both the document (DOM) and the streaming reader
+// Both readers share the entity validation/conversion, so the difference is purely the cost of building the json document
+// Peak memory is the json parser memory (document nodes or reader stack), the file buffer and the output descriptors are the same for both readers
+
+static void BenchmarkMapReaders( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& path )
+{
+    constexpr static int32_t const numIterations = 10;
+
+    // Find the largest map
+    //-------------------------------------------------------------------------
+
+    TVector<FileSystem::Path> mapFilePaths;
+    if ( FileSystem::IsExistingDirectory( path.c_str() ) )
+    {
+        FileSystem::GetDirectoryContents( path, mapFilePaths, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::Expand, { "map" } );
+    }
+    else if ( FileSystem::IsExistingFile( path.c_str() ) )
+    {
+        mapFilePaths.emplace_back( path );
+    }
+
+    FileSystem::Path mapFilePath;
+    uintmax_t mapFileSize = 0;
+    for ( auto const& mapPath : mapFilePaths )
+    {
+        uintmax_t const fileSize = std::filesystem::file_size( mapPath.c_str() );
+        if ( fileSize >= mapFileSize )
+        {
+            mapFilePath = mapPath;
+            mapFileSize = fileSize;
+        }
+    }
+
+    if ( !mapFilePath.IsValid() )
+    {
+        std::cout << "Map readers: no map found at: " << path.c_str() << std::endl;
+        return;
+    }
+
+    // Run
+    //-------------------------------------------------------------------------
+
+    using ReadFunction = bool( * )( TypeSystem::TypeRegistry const&, FileSystem::Path const&, EntityModel::SerializedEntityCollection&, size_t* );
+
+    auto RunReader = [&] ( char const* pReaderName, ReadFunction pReadFunction )
+    {
+        Milliseconds totalTime = 0;
+        Milliseconds minTime = FLT_MAX;
+        size_t peakParserMemory = 0;
+        int32_t numEntities = 0;
+
+        for ( int32_t i = 0; i < numIterations; i++ )
+        {
+            EntityModel::SerializedEntityMap map;
+            size_t iterationPeakParserMemory = 0;
+            bool result = false;
+
+            Milliseconds readTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( readTime );
+                result = pReadFunction( typeRegistry, mapFilePath, map, &iterationPeakParserMemory );
+            }
+
+            if ( !result )
+            {
+                std::cout << "  " << pReaderName << ": failed to read the map!" << std::endl;
+                return;
+            }
+
+            totalTime += readTime;
+            minTime = Math::Min( minTime, readTime );
+            peakParserMemory = Math::Max( peakParserMemory, iterationPeakParserMemory );
+            numEntities = map.GetNumEntityDescriptors();
+        }
+
+        std::cout << "  " << pReaderName << ": " << ( totalTime.ToFloat() / numIterations ) << "ms avg, " << minTime.ToFloat() << "ms min, ";
+        std::cout << ( peakParserMemory / 1024 ) << "KB peak parser memory, " << numEntities << " entities" << std::endl;
+    };
+
+    std::cout << "Map readers (" << mapFilePath.c_str() << ", " << ( mapFileSize / 1024 ) << "KB, " << numIterations << " iterations):" << std::endl;
+    RunReader( "Document", &EntityModel::ReadSerializedEntityCollectionFromFileUsingDocument );
+    RunReader( "Streaming", &EntityModel::ReadSerializedEntityCollectionFromFile );
+}
+
+//-------------------------------------------------------------------------
+// AI scheduler benchmark
+//-------------------------------------------------------------------------
+// Agents are spread around a viewer at the origin and a quarter of them are in combat
+// Each decision update runs a fixed synthetic workload that stands in for a behavior's goal selection and path query
+// Running every agent's decisions every frame is compared against the time-sliced schedule, steering is not included since it runs every frame in both cases
+
+static float RunSyntheticAIDecisionUpdate( int32_t agentIdx )
+{
+    float result = float( agentIdx );
+    for ( int32_t i = 0; i < 2000; i++ )
+    {
+        result = sinf( result ) * 0.5f + float( i ) * 0.001f;
+    }
+    return result;
+}
+
+static void BenchmarkAIScheduler( int32_t numAgents )
+{
+    constexpr static int32_t const numWarmupFrames = 60;
+    constexpr static int32_t const numFrames = 600;
+    constexpr static float const worldHalfSize = 150.0f;
+    Seconds const frameDeltaTime = 1.0f / 60.0f;
+
+    // Unloaded entities add components immediately, so we dont need a world to create the agents
+    //-------------------------------------------------------------------------
+
+    TVector<Entity*> entities;
+    TVector<AI::AIComponent*> aiComponents;
+    entities.reserve( numAgents );
+    aiComponents.reserve( numAgents );
+
+    AI::AIScheduler scheduler;
+
+    for ( int32_t i = 0; i < numAgents; i++ )
+    {
+        Entity* pEntity = entities.emplace_back( EE::New<Entity>( StringID( "AI" ) ) );
+
+        auto pSpatialComponent = EE::New<SpatialEntityComponent>();
+        pSpatialComponent->SetLocalTransform( Transform( Quaternion::Identity, Vector( Math::GetRandomFloat( -worldHalfSize, worldHalfSize ), Math::GetRandomFloat( -worldHalfSize, worldHalfSize ), 0.0f ) ) );
+        pEntity->AddComponent( pSpatialComponent );
+
+        auto pAIComponent = aiComponents.emplace_back( EE::New<AI::AIComponent>() );
+        pAIComponent->SetInCombat( ( i % 4 ) == 0 );
+        pEntity->AddComponent( pAIComponent );
+
+        scheduler.AddAgent( pEntity, pAIComponent );
+    }
+
+    Math::ViewVolume const viewVolume( Float2( 1920, 1080 ), FloatRange( 0.1f, 500.0f ), Radians::PiDivTwo );
+
+    // Run
+    //-------------------------------------------------------------------------
+
+    float volatile decisionResult = 0.0f;
+
+    auto RunMode = [&] ( char const* pModeName, bool isScheduled )
+    {
+        Milliseconds totalTime = 0;
+        Milliseconds maxFrameTime = 0;
+        int32_t numFramesOverBudget = 0;
+        int32_t numUpdates[AI::AIScheduler::s_numBuckets] = {};
+        Seconds maxLatency[AI::AIScheduler::s_numBuckets] = {};
+
+        for ( int32_t f = 0; f < ( numWarmupFrames + numFrames ); f++ )
+        {
+            // Same order as in the game, the agents consume last frame's schedule and then the AI manager schedules the next frame
+            Milliseconds frameTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( frameTime );
+
+                for ( int32_t i = 0; i < numAgents; i++ )
+                {
+                    if ( isScheduled && !aiComponents[i]->IsDecisionUpdateScheduled() )
+                    {
+                        continue;
+                    }
+
+                    Milliseconds decisionUpdateCost = 0;
+                    {
+                        ScopedTimer<PlatformClock> decisionTimer( decisionUpdateCost );
+                        decisionResult = RunSyntheticAIDecisionUpdate( i );
+                    }
+
+                    if ( isScheduled )
+                    {
+                        aiComponents[i]->OnDecisionsUpdated( decisionUpdateCost );
+                    }
+                }
+
+                if ( isScheduled )
+                {
+                    scheduler.Update( frameDeltaTime, &viewVolume );
+                }
+            }
+
+            if ( f < numWarmupFrames )
+            {
+                continue;
+            }
+
+            totalTime += frameTime;
+            maxFrameTime = Math::Max( maxFrameTime, frameTime );
+            numFramesOverBudget += ( frameTime.ToFloat() > scheduler.GetSettings().m_frameBudget.ToFloat() ) ? 1 : 0;
+
+            if ( isScheduled )
+            {
+                for ( int32_t b = 0; b < AI::AIScheduler::s_numBuckets; b++ )
+                {
+                    AI::AIScheduler::BucketStats const& stats = scheduler.GetBucketStats( (AI::AIImportance) b );
+                    numUpdates[b] += stats.m_numUpdated;
+                    maxLatency[b] = Math::Max( maxLatency[b].ToFloat(), stats.m_maxTimeSinceUpdate.ToFloat() );
+                }
+            }
+        }
+
+        std::cout << "  " << pModeName << ": " << ( totalTime.ToFloat() / numFrames ) << "ms avg frame, " << maxFrameTime.ToFloat() << "ms max frame, " << numFramesOverBudget << " frames over budget" << std::endl;
+
+        if ( isScheduled )
+        {
+            char const* const bucketNames[AI::AIScheduler::s_numBuckets] = { "High", "Medium", "Low" };
+            for ( int32_t b = 0; b < AI::AIScheduler::s_numBuckets; b++ )
+            {
+                AI::AIScheduler::BucketStats const& stats = scheduler.GetBucketStats( (AI::AIImportance) b );
+                std::cout << "    " << bucketNames[b] << ": " << stats.m_numAgents << " agents, " << ( float( numUpdates[b] ) / numFrames ) << " updates per frame, ";
+                std::cout << stats.m_averageAgentCost.ToFloat() << "ms avg agent cost, " << maxLatency[b].ToFloat() << "s max latency" << std::endl;
+            }
+        }
+    };
+
+    std::cout << "AI scheduler (" << numAgents << " agents, " << scheduler.GetSettings().m_frameBudget.ToFloat() << "ms budget):" << std::endl;
+    RunMode( "Every frame", false );
+    RunMode( "Scheduled", true );
+
+    // Shutdown
+    //-------------------------------------------------------------------------
+
+    for ( auto pAIComponent : aiComponents )
+    {
+        scheduler.RemoveAgent( pAIComponent );
+    }
+
+    for ( auto pEntity : entities )
+    {
+        EE::Delete( pEntity );
+    }
+}
+
 //-------------------------------------------------------------------------
 
 int main( int argc, char *argv[] )
 {
+    cli::Parser cmdParser( argc, argv );
+    cmdParser.set_optional<bool>( "benchmarkSharedMemory", "benchmarkSharedMemory", false, "Run the shared memory transport benchmark." );
+    cmdParser.set_optional<int>( "benchmarkPort", "benchmarkPort", 5999, "The port to use for the shared memory transport benchmark." );
+    cmdParser.set_optional<bool>( "benchmarkTransformContention", "benchmarkTransformContention", false, "Run the world transform contention benchmark." );
+    cmdParser.set_optional<bool>( "testRenderGraphAliasing", "testRenderGraphAliasing", false, "Run the render graph transient aliasing test." );
+    cmdParser.set_optional<bool>( "benchmarkEntityUpdate", "benchmarkEntityUpdate", false, "Run the entity-major vs batched entity update benchmark." );
+    cmdParser.set_optional<std::string>( "benchmarkValuePrograms", "benchmarkValuePrograms", "", "Run the value program vs node pull benchmark on the supplied animation graph (.ag) file." );
+    cmdParser.set_optional<std::string>( "benchmarkGraphInstancePool", "benchmarkGraphInstancePool", "", "Run the pooled vs fresh graph instance spawn benchmark on the supplied compiled graph variation (data path)." );
+    cmdParser.set_optional<int>( "benchmarkAIScheduler", "benchmarkAIScheduler", 0, "Run the every frame vs scheduled AI decision update benchmark with the supplied number of agents (e.g. 1000)." );
+    cmdParser.set_optional<std::string>( "benchmarkMapReaders", "benchmarkMapReaders", "", "Run the document vs streaming map reader benchmark on the largest map at the supplied path (map file or directory)." );
+
+    if ( !cmdParser.run() )
+    {
+        return 1;
+    }
+
+    bool testsPassed = true;
+
     {
         EE::ApplicationGlobalState State;
         TypeSystem::TypeRegistry typeRegistry;
@@ -142,6 +1413,52 @@ int main( int argc, char *argv[] )
 
         //-------------------------------------------------------------------------
 
+        if ( cmdParser.get<bool>( "benchmarkSharedMemory" ) )
+        {
+            BenchmarkSharedMemoryTransport( (uint16_t) cmdParser.get<int>( "benchmarkPort" ) );
+        }
+
+        if ( cmdParser.get<bool>( "benchmarkTransformContention" ) )
+        {
+            BenchmarkWorldTransformContention();
+        }
+
+        if ( cmdParser.get<bool>( "testRenderGraphAliasing" ) )
+        {
+            testsPassed &= TestRenderGraphTransientAliasing();
+        }
+
+        if ( cmdParser.get<bool>( "benchmarkEntityUpdate" ) )
+        {
+            BenchmarkEntityUpdate( typeRegistry );
+        }
+
+        std::string const valueProgramGraphPath = cmdParser.get<std::string>( "benchmarkValuePrograms" );
+        if ( !valueProgramGraphPath.empty() )
+        {
+            BenchmarkValuePrograms( typeRegistry, FileSystem::Path( valueProgramGraphPath.c_str() ) );
+        }
+
+        std::string const graphVariationPath = cmdParser.get<std::string>( "benchmarkGraphInstancePool" );
+        if ( !graphVariationPath.empty() )
+        {
+            BenchmarkGraphInstancePool( typeRegistry, ResourceID( graphVariationPath.c_str() ) );
+        }
+
+        std::string const mapReadersPath = cmdParser.get<std::string>( "benchmarkMapReaders" );
+        if ( !mapReadersPath.empty() )
+        {
+            BenchmarkMapReaders( typeRegistry, FileSystem::Path( mapReadersPath.c_str() ) );
+        }
+
+        int32_t const numSchedulerAgents = cmdParser.get<int>( "benchmarkAIScheduler" );
+        if ( numSchedulerAgents > 0 )
+        {
+            BenchmarkAIScheduler( numSchedulerAgents );
+        }
+
+        //-------------------------------------------------------------------------
+
         //constexpr static int32_t const size = 10000;
 
         //Float4 s[size];
@@ -231,5 +1548,5 @@ int main( int argc, char *argv[] )
         TypeSystem::Reflection::UnregisterTypes( typeRegistry );
     }
 
-    return 0;
+    return testsPassed ? 0 : 1;
 }
\ No newline at end of file
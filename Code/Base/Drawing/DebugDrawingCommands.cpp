@@ -1,62 +1,114 @@
 #include "DebugDrawingCommands.h"
+#include <EASTL/algorithm.h>
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Drawing
 {
-    void CommandBuffer::Reset( Seconds deltaTime )
+    template<typename T>
+    static void AppendPersistentCommands( TVector<T>& commands, TVector<T> const& newCommands, Seconds currentTime )
     {
-        // NAIVE delete version - profile this
-
-        for ( int32_t i = (int32_t) m_pointCommands.size() - 1; i >= 0; i-- )
+        size_t const firstNewCommandIdx = commands.size();
+        commands.insert( commands.end(), newCommands.begin(), newCommands.end() );
+        for ( size_t i = firstNewCommandIdx; i < commands.size(); i++ )
         {
-            m_pointCommands[i].m_TTL -= deltaTime;
-            if ( m_pointCommands[i].m_TTL <= 0.0f )
-            {
-                m_pointCommands.erase_unsorted( m_pointCommands.begin() + i );
-            }
+            commands[i].m_TTL += currentTime;
         }
+    }
+
+    template<typename T>
+    static void RemoveExpiredCommandsFromList( TVector<T>& commands, Seconds currentTime )
+    {
+        auto Predicate = [currentTime] ( T const& cmd ) { return cmd.m_TTL <= currentTime; };
+        commands.erase( eastl::remove_if( commands.begin(), commands.end(), Predicate ), commands.end() );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CommandBuffer::AppendPersistent( CommandBuffer const& buffer, Seconds currentTime )
+    {
+        AppendPersistentCommands( m_pointCommands, buffer.m_pointCommands, currentTime );
+        AppendPersistentCommands( m_lineCommands, buffer.m_lineCommands, currentTime );
+        AppendPersistentCommands( m_triangleCommands, buffer.m_triangleCommands, currentTime );
+        AppendPersistentCommands( m_textCommands, buffer.m_textCommands, currentTime );
+    }
+
+    void CommandBuffer::RemoveExpiredCommands( Seconds currentTime )
+    {
+        RemoveExpiredCommandsFromList( m_pointCommands, currentTime );
+        RemoveExpiredCommandsFromList( m_lineCommands, currentTime );
+        RemoveExpiredCommandsFromList( m_triangleCommands, currentTime );
+        RemoveExpiredCommandsFromList( m_textCommands, currentTime );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void FrameCommandBuffer::AddThreadCommands( ThreadCommandBuffer& threadCommands )
+    {
+        // TODO:
+        // Broad-phase culling
+        // Sort transparent and depth test off primitives by distance to camera
+        // Sort text by font
 
-        for ( int32_t i = (int32_t) m_lineCommands.size() - 1; i >= 0; i-- )
+        // Swap the thread's commands with an empty recycled set, this hands the thread back the storage from a previous frame
+        CommandBufferSet& threadFrameCommands = threadCommands.GetFrameCommands();
+        if ( !threadFrameCommands.IsEmpty() )
         {
-            m_lineCommands[i].m_TTL -= deltaTime;
-            if ( m_lineCommands[i].m_TTL <= 0.0f )
+            if ( m_numFrameCommandSets == (int32_t) m_frameCommandSets.size() )
             {
-                m_lineCommands.erase_unsorted( m_lineCommands.begin() + i );
+                m_frameCommandSets.emplace_back();
             }
+
+            CommandBufferSet& frameCommandSet = m_frameCommandSets[m_numFrameCommandSets];
+            EE_ASSERT( frameCommandSet.IsEmpty() );
+            frameCommandSet.Swap( threadFrameCommands );
+            m_numFrameCommandSets++;
         }
 
-        for ( int32_t i = (int32_t) m_triangleCommands.size() - 1; i >= 0; i-- )
+        // Commands with a TTL are rare, so these are just copied into the persistent storage
+        CommandBufferSet& threadPersistentCommands = threadCommands.GetPersistentCommands();
+        for ( int32_t i = 0; i < CommandBufferSet::s_numBuffers; i++ )
         {
-            m_triangleCommands[i].m_TTL -= deltaTime;
-            if ( m_triangleCommands[i].m_TTL <= 0.0f )
-            {
-                m_triangleCommands.erase_unsorted( m_triangleCommands.begin() + i );
-            }
+            m_persistentCommands.m_buffers[i].AppendPersistent( threadPersistentCommands.m_buffers[i], m_elapsedTime );
         }
+        threadPersistentCommands.Clear();
+    }
 
-        for ( int32_t i = (int32_t) m_textCommands.size() - 1; i >= 0; i-- )
+    void FrameCommandBuffer::Clear()
+    {
+        for ( auto& commandSet : m_frameCommandSets )
         {
-            m_textCommands[i].m_TTL -= deltaTime;
-            if ( m_textCommands[i].m_TTL <= 0.0f )
-            {
-                m_textCommands.erase_unsorted( m_textCommands.begin() + i );
-            }
+            commandSet.Clear();
         }
+
+        m_numFrameCommandSets = 0;
+        m_persistentCommands.Clear();
     }
 
-    void FrameCommandBuffer::AddThreadCommands( ThreadCommandBuffer const& threadCommands )
+    void FrameCommandBuffer::Reset( Seconds deltaTime )
     {
-        // TODO:
-        // Broad-phase culling
-        // Sort transparent and depth test off primitives by distance to camera
-        // Sort text by font
+        // Clearing keeps the capacity so the sets can be swapped back into the thread buffers
+        for ( int32_t i = 0; i < m_numFrameCommandSets; i++ )
+        {
+            m_frameCommandSets[i].Clear();
+        }
+
+        m_numFrameCommandSets = 0;
+
+        //-------------------------------------------------------------------------
 
-        m_opaqueDepthOn.Append( threadCommands.GetOpaqueDepthTestEnabledBuffer() );
-        m_opaqueDepthOff.Append( threadCommands.GetOpaqueDepthTestDisabledBuffer() );
-        m_transparentDepthOn.Append( threadCommands.GetTransparentDepthTestEnabledBuffer() );
-        m_transparentDepthOff.Append( threadCommands.GetTransparentDepthTestDisabledBuffer() );
+        m_elapsedTime += deltaTime;
+        for ( auto& buffer : m_persistentCommands.m_buffers )
+        {
+            buffer.RemoveExpiredCommands( m_elapsedTime );
+        }
+
+        // Restart the clock whenever nothing is alive, this keeps the expiry times precise
+        if ( m_persistentCommands.IsEmpty() )
+        {
+            m_elapsedTime = 0.0f;
+        }
     }
 }
 #endif
\ No newline at end of file
@@ -44,6 +44,8 @@ namespace EE::Drawing
 
     struct PointCommand
     {
+        PointCommand() = default;
+
         PointCommand( Float3 const& position, Float4 const& color, float pointThickness, Seconds TTL )
             : m_position( position )
             , m_thickness( pointThickness )
@@ -63,6 +65,8 @@ namespace EE::Drawing
 
     struct LineCommand
     {
+        LineCommand() = default;
+
         LineCommand( Float3 const& startPosition, Float3 const& endPosition, Float4 const& color, float lineThickness, Seconds TTL )
             : m_startPosition( startPosition )
             , m_startThickness( lineThickness )
@@ -119,6 +123,8 @@ namespace EE::Drawing
 
     struct TriangleCommand
     {
+        TriangleCommand() = default;
+
         TriangleCommand( Float3 const& V0, Float3 const& V1, Float3 const& V2, Float4 const& color, Seconds TTL )
             : m_vertex0( V0 )
             , m_color0( color )
@@ -217,7 +223,25 @@ namespace EE::Drawing
             m_textCommands.clear();
         }
 
-        void Reset( Seconds deltaTime );
+        inline bool IsEmpty() const
+        {
+            return m_pointCommands.empty() && m_lineCommands.empty() && m_triangleCommands.empty() && m_textCommands.empty();
+        }
+
+        // Swaps the command storage, no commands are copied
+        inline void Swap( CommandBuffer& buffer )
+        {
+            m_pointCommands.swap( buffer.m_pointCommands );
+            m_lineCommands.swap( buffer.m_lineCommands );
+            m_triangleCommands.swap( buffer.m_triangleCommands );
+            m_textCommands.swap( buffer.m_textCommands );
+        }
+
+        // Appends all commands and converts their TTLs to an absolute expiry time
+        void AppendPersistent( CommandBuffer const& buffer, Seconds currentTime );
+
+        // Removes all commands whose expiry time has passed, only valid for buffers filled via 'AppendPersistent'
+        void RemoveExpiredCommands( Seconds currentTime );
 
     public:
 
@@ -227,10 +251,78 @@ namespace EE::Drawing
         TVector<TextCommand>        m_textCommands;
     };
 
+    //-------------------------------------------------------------------------
+    // Command Buffer Set
+    //-------------------------------------------------------------------------
+    // Commands are split by depth test state and transparency since each combination is drawn with different render state
+
+    enum class CommandBufferType : uint8_t
+    {
+        OpaqueDepthOn = 0,
+        OpaqueDepthOff,
+        TransparentDepthOn,
+        TransparentDepthOff,
+
+        NumTypes
+    };
+
+    struct CommandBufferSet
+    {
+        constexpr static int32_t const s_numBuffers = (int32_t) CommandBufferType::NumTypes;
+
+        EE_FORCE_INLINE static CommandBufferType GetBufferType( DepthTest depthTestState, bool isTransparent )
+        {
+            if ( depthTestState == DepthTest::Enable )
+            {
+                return isTransparent ? CommandBufferType::TransparentDepthOn : CommandBufferType::OpaqueDepthOn;
+            }
+            else // Disable depth test
+            {
+                return isTransparent ? CommandBufferType::TransparentDepthOff : CommandBufferType::OpaqueDepthOff;
+            }
+        }
+
+        EE_FORCE_INLINE CommandBuffer& GetBuffer( CommandBufferType type ) { return m_buffers[(int32_t) type]; }
+        EE_FORCE_INLINE CommandBuffer const& GetBuffer( CommandBufferType type ) const { return m_buffers[(int32_t) type]; }
+
+        inline void Clear()
+        {
+            for ( auto& buffer : m_buffers )
+            {
+                buffer.Clear();
+            }
+        }
+
+        inline bool IsEmpty() const
+        {
+            for ( auto const& buffer : m_buffers )
+            {
+                if ( !buffer.IsEmpty() )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        inline void Swap( CommandBufferSet& set )
+        {
+            for ( int32_t i = 0; i < s_numBuffers; i++ )
+            {
+                m_buffers[i].Swap( set.m_buffers[i] );
+            }
+        }
+
+    public:
+
+        CommandBuffer               m_buffers[s_numBuffers];
+    };
+
     //-------------------------------------------------------------------------
     // Per-Thread command buffer
     //-------------------------------------------------------------------------
-    // These are fully cleared each frame
+    // These are fully emptied each frame, commands with a TTL are kept separately so they can be moved to the frame buffer's persistent storage
 
     class ThreadCommandBuffer
     {
@@ -245,104 +337,82 @@ namespace EE::Drawing
 
         EE_FORCE_INLINE void AddCommand( PointCommand&& cmd, DepthTest depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent(), cmd.m_TTL );
             pBuffer->m_pointCommands.emplace_back( eastl::move( cmd ) );
         }
 
         EE_FORCE_INLINE void AddCommand( LineCommand&& cmd, DepthTest depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent(), cmd.m_TTL );
             pBuffer->m_lineCommands.emplace_back( eastl::move( cmd ) );
         }
 
         EE_FORCE_INLINE void AddCommand( TriangleCommand&& cmd, DepthTest depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent(), cmd.m_TTL );
             pBuffer->m_triangleCommands.emplace_back( eastl::move( cmd ) );
         }
 
         EE_FORCE_INLINE void AddCommand( TextCommand&& cmd, DepthTest depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent(), cmd.m_TTL );
             pBuffer->m_textCommands.emplace_back( eastl::move( cmd ) );
         }
 
         inline void Clear()
         {
-            m_opaqueDepthOn.Clear();
-            m_opaqueDepthOff.Clear();
-            m_transparentDepthOn.Clear();
-            m_transparentDepthOff.Clear();
+            m_frameCommands.Clear();
+            m_persistentCommands.Clear();
         }
 
-        CommandBuffer const& GetOpaqueDepthTestEnabledBuffer() const { return m_opaqueDepthOn; }
-        CommandBuffer const& GetOpaqueDepthTestDisabledBuffer() const { return m_opaqueDepthOff; }
-        CommandBuffer const& GetTransparentDepthTestEnabledBuffer() const { return m_transparentDepthOn; }
-        CommandBuffer const& GetTransparentDepthTestDisabledBuffer() const { return m_transparentDepthOff; }
+        inline CommandBufferSet& GetFrameCommands() { return m_frameCommands; }
+        inline CommandBufferSet& GetPersistentCommands() { return m_persistentCommands; }
 
     private:
 
-        inline CommandBuffer* GetCommandBuffer( DepthTest depthTestState, bool isTransparent )
+        EE_FORCE_INLINE CommandBuffer* GetCommandBuffer( DepthTest depthTestState, bool isTransparent, Seconds TTL )
         {
-            CommandBuffer* pBuffer = nullptr;
-
-            if ( depthTestState == DepthTest::Enable )
-            {
-                pBuffer = isTransparent ? &m_transparentDepthOn : &m_opaqueDepthOn;
-            }
-            else // Disable depth test
-            {
-                pBuffer = isTransparent ? &m_transparentDepthOff : &m_opaqueDepthOff;
-            }
-
-            return pBuffer;
+            CommandBufferSet& set = ( TTL > 0.0f ) ? m_persistentCommands : m_frameCommands;
+            return &set.GetBuffer( CommandBufferSet::GetBufferType( depthTestState, isTransparent ) );
         }
 
     private:
 
         Threading::ThreadID         m_ID;
-        CommandBuffer               m_opaqueDepthOn;
-        CommandBuffer               m_opaqueDepthOff;
-        CommandBuffer               m_transparentDepthOn;
-        CommandBuffer               m_transparentDepthOff;
+        CommandBufferSet            m_frameCommands;
+        CommandBufferSet            m_persistentCommands;
     };
 
     //-------------------------------------------------------------------------
     // Frame Buffer
     //-------------------------------------------------------------------------
     // This contains all the commands we need to actually draw this frame
-    // Any command with a TTL, will be left in this buffer at the end of the frame to be drawn again
+    // The per-thread frame commands are swapped in (not copied) and the sets are recycled so that steady state drawing doesnt allocate
+    // Commands with a TTL are moved into a persistent set that stores absolute expiry times, so expiring them is a single compaction pass
 
     class EE_BASE_API FrameCommandBuffer
     {
     public:
 
-        void AddThreadCommands( ThreadCommandBuffer const& threadCommands );
+        // Takes all the commands from the thread buffer, the thread buffer is left empty
+        void AddThreadCommands( ThreadCommandBuffer& threadCommands );
 
         // Empties the command buffer ignoring any TTL state
-        inline void Clear()
-        {
-            m_opaqueDepthOn.Clear();
-            m_opaqueDepthOff.Clear();
-            m_transparentDepthOn.Clear();
-            m_transparentDepthOff.Clear();
-        }
+        void Clear();
 
-        // Resets the buffer, will remove all commands with an expired TTL
-        inline void Reset( Seconds deltaTime )
-        {
-            m_opaqueDepthOn.Reset( deltaTime );
-            m_opaqueDepthOff.Reset( deltaTime );
-            m_transparentDepthOn.Reset( deltaTime );
-            m_transparentDepthOff.Reset( deltaTime );
-        }
+        // Resets the buffer for a new frame, will remove all per-frame commands and all persistent commands with an expired TTL
+        void Reset( Seconds deltaTime );
 
-    public:
+        // Get all the command sets that need to be drawn this frame, the persistent set is always the last set
+        inline int32_t GetNumCommandSets() const { return m_numFrameCommandSets + 1; }
+        inline CommandBufferSet const& GetCommandSet( int32_t setIdx ) const { EE_ASSERT( setIdx >= 0 && setIdx <= m_numFrameCommandSets ); return ( setIdx < m_numFrameCommandSets ) ? m_frameCommandSets[setIdx] : m_persistentCommands; }
+
+    private:
 
-        CommandBuffer               m_opaqueDepthOn;
-        CommandBuffer               m_opaqueDepthOff;
-        CommandBuffer               m_transparentDepthOn;
-        CommandBuffer               m_transparentDepthOff;
+        TVector<CommandBufferSet>   m_frameCommandSets;
+        int32_t                     m_numFrameCommandSets = 0;
+        CommandBufferSet            m_persistentCommands;
+        Seconds                     m_elapsedTime = 0.0f;
     };
 }
 #endif
\ No newline at end of file
@@ -1,11 +1,62 @@
 #include "DebugDrawingSystem.h"
+#include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Drawing
 {
+    // IDs are never reused so stale cache entries for destroyed systems can never match
+    static std::atomic<uint32_t> g_nextDrawingSystemID = 1;
+
+    // Threads rarely draw into more than a couple of worlds, so a tiny cache is enough
+    constexpr static int32_t const g_threadBufferCacheSize = 4;
+
+    struct ThreadBufferCacheEntry
+    {
+        uint32_t                    m_systemID = 0;
+        ThreadCommandBuffer*        m_pBuffer = nullptr;
+    };
+
+    static thread_local ThreadBufferCacheEntry g_threadBufferCache[g_threadBufferCacheSize];
+    static thread_local int32_t g_nextThreadBufferCacheEntryIdx = 0;
+
+    //-------------------------------------------------------------------------
+
+    DrawingSystem::DrawingSystem()
+        : m_ID( g_nextDrawingSystemID++ )
+    {}
+
+    DrawingSystem::~DrawingSystem()
+    {
+        for ( auto& pBuffer : m_threadCommandBuffers )
+        {
+            EE::Delete( pBuffer );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     ThreadCommandBuffer& DrawingSystem::GetThreadCommandBuffer()
+    {
+        for ( auto const& entry : g_threadBufferCache )
+        {
+            if ( entry.m_systemID == m_ID )
+            {
+                return *entry.m_pBuffer;
+            }
+        }
+
+        // Cache miss, replace the oldest entry
+        ThreadCommandBuffer& threadBuffer = FindOrCreateThreadCommandBuffer();
+        ThreadBufferCacheEntry& entry = g_threadBufferCache[g_nextThreadBufferCacheEntryIdx];
+        entry.m_systemID = m_ID;
+        entry.m_pBuffer = &threadBuffer;
+        g_nextThreadBufferCacheEntryIdx = ( g_nextThreadBufferCacheEntryIdx + 1 ) % g_threadBufferCacheSize;
+        return threadBuffer;
+    }
+
+    ThreadCommandBuffer& DrawingSystem::FindOrCreateThreadCommandBuffer()
     {
         Threading::ScopeLock Lock( m_commandBufferMutex );
 
@@ -25,25 +76,20 @@ namespace EE::Drawing
         return *pThreadBuffer;
     }
 
-    DrawingSystem::~DrawingSystem()
-    {
-        for ( auto& pBuffer : m_threadCommandBuffers )
-        {
-            EE::Delete( pBuffer );
-        }
-    }
+    //-------------------------------------------------------------------------
 
     void DrawingSystem::ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands )
     {
+        EE_PROFILE_FUNCTION();
+
         // Reset the frame buffer for a new frame, flush old commands and only keep ones with a valid TTL
         reflectedFrameCommands.Reset( deltaTime );
 
-        // Reflect all the new commands into the frame buffer
+        // Swap all the new commands into the frame buffer, the lock only protects the buffer list against threads drawing for the first time
         Threading::ScopeLock Lock( m_commandBufferMutex );
         for ( auto& pThreadBuffer : m_threadCommandBuffers )
         {
             reflectedFrameCommands.AddThreadCommands( *pThreadBuffer );
-            pThreadBuffer->Clear();
         }
     }
 
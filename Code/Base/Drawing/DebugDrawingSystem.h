@@ -3,9 +3,13 @@
 #include "Base/_Module/API.h"
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Threading/Threading.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
+// Each thread caches the buffers it draws into in thread local storage, so only the first draw from a thread needs to take the lock.
+// At the end of the frame the per-thread buffers are swapped into the frame buffer, drawing threads never wait on the reflection.
+
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Drawing
 {
@@ -14,7 +18,7 @@ namespace EE::Drawing
 
     public:
 
-        DrawingSystem() = default;
+        DrawingSystem();
         ~DrawingSystem();
 
         // Empty all per thread buffers
@@ -23,15 +27,18 @@ namespace EE::Drawing
         // Returns a per-thread drawing context, this removes the need for constantly calling get thread command buffer
         inline DrawContext GetDrawingContext() { return DrawContext( GetThreadCommandBuffer() ); }
 
-        // Reflects all the individual per-thread buffers into a single supplied frame command buffer. Clears all thread buffers.
+        // Reflects all the individual per-thread buffers into a single supplied frame command buffer. Empties all thread buffers.
+        // This must not run concurrently with any drawing into this system.
         void ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands );
 
     private:
 
         ThreadCommandBuffer& GetThreadCommandBuffer();
+        ThreadCommandBuffer& FindOrCreateThreadCommandBuffer();
 
     private:
 
+        uint32_t                            m_ID = 0;                   // Unique per drawing system, used to validate the thread local cache
         TVector<ThreadCommandBuffer*>       m_threadCommandBuffers;
         Threading::Mutex                    m_commandBufferMutex;
     };
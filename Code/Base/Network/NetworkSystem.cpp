@@ -1,5 +1,5 @@
 #include "NetworkSystem.h"
-
+#include "SharedMemoryTransport.h"
 #include "Base/Threading/Threading.h"
 
 #include <steam/steamnetworkingsockets.h>
@@ -51,6 +51,7 @@ namespace EE::Network
     ServerConnection::~ServerConnection()
     {
         EE_ASSERT( m_pollingGroupHandle == k_HSteamNetPollGroup_Invalid && m_socketHandle == k_HSteamListenSocket_Invalid );
+        EE_ASSERT( m_pSharedMemoryHost == nullptr );
     }
 
     void ServerConnection::AddConnectedClient( ClientConnectionID clientHandle, AddressString const& clientAddress )
@@ -94,6 +95,16 @@ namespace EE::Network
             return false;
         }
 
+        // Create the same-host transport, this is optional so failing here is not fatal
+        //-------------------------------------------------------------------------
+
+        m_pSharedMemoryHost = EE::New<SharedMemoryHost>();
+        if ( !m_pSharedMemoryHost->Create( portNumber ) )
+        {
+            EE_LOG_WARNING( "Network", "Server Connection", "Failed to create shared memory transport for port %d, local clients will use sockets", portNumber );
+            EE::Delete( m_pSharedMemoryHost );
+        }
+
         return true;
     }
 
@@ -106,10 +117,19 @@ namespace EE::Network
 
         for ( auto const& clientInfo : m_connectedClients )
         {
-            pInterface->CloseConnection( clientInfo.m_ID, 0, "Server Shutdown", true );
+            if ( !SharedMemory::IsSharedMemoryConnection( clientInfo.m_ID ) )
+            {
+                pInterface->CloseConnection( clientInfo.m_ID, 0, "Server Shutdown", true );
+            }
         }
         m_connectedClients.clear();
 
+        if ( m_pSharedMemoryHost != nullptr )
+        {
+            m_pSharedMemoryHost->Destroy();
+            EE::Delete( m_pSharedMemoryHost );
+        }
+
         //-------------------------------------------------------------------------
 
         if ( m_pollingGroupHandle != k_HSteamNetPollGroup_Invalid )
@@ -148,15 +168,50 @@ namespace EE::Network
             pIncomingMsg->Release();
         }
 
+        if ( m_pSharedMemoryHost != nullptr )
+        {
+            auto OnClientConnected = [this] ( ClientConnectionID clientID ) { AddConnectedClient( clientID, "127.0.0.1 (Shared Memory)" ); };
+            auto OnClientDisconnected = [this] ( ClientConnectionID clientID ) { RemoveConnectedClient( clientID ); };
+            m_pSharedMemoryHost->UpdateConnections( OnClientConnected, OnClientDisconnected );
+
+            auto ProcessSharedMemoryMessage = [this] ( ClientConnectionID clientID, void* pData, size_t size ) { ProcessMessage( clientID, pData, size ); };
+            m_pSharedMemoryHost->ReceiveMessages( ProcessSharedMemoryMessage );
+        }
+
         // Send
         //-------------------------------------------------------------------------
 
-        auto ServerSendFunction = [pInterface]( uint32_t connectionHandle, void* pData, uint32_t size )
+        auto ServerSendFunction = [pInterface, this]( uint32_t connectionHandle, void* pData, uint32_t size )
         {
-            pInterface->SendMessageToConnection( connectionHandle, pData, size, k_nSteamNetworkingSend_Reliable, nullptr );
+            if ( SharedMemory::IsSharedMemoryConnection( connectionHandle ) )
+            {
+                EE_ASSERT( m_pSharedMemoryHost != nullptr );
+                m_pSharedMemoryHost->QueueMessage( connectionHandle, pData, size );
+            }
+            else
+            {
+                pInterface->SendMessageToConnection( connectionHandle, pData, size, k_nSteamNetworkingSend_Reliable, nullptr );
+            }
         };
 
         SendMessages( ServerSendFunction );
+
+        if ( m_pSharedMemoryHost != nullptr )
+        {
+            m_pSharedMemoryHost->Flush();
+        }
+    }
+
+    void ServerConnection::WaitForIncomingMessages( Milliseconds maxWaitTime )
+    {
+        if ( m_pSharedMemoryHost != nullptr )
+        {
+            m_pSharedMemoryHost->WaitForIncomingData( maxWaitTime );
+        }
+        else
+        {
+            Threading::Sleep( maxWaitTime );
+        }
     }
 
     void ServerConnection::ConnectionChangedCallback( SteamNetConnectionStatusChangedCallback_t* pInfo )
@@ -255,6 +310,7 @@ namespace EE::Network
     ClientConnection::~ClientConnection()
     {
         EE_ASSERT( m_connectionHandle == k_HSteamNetConnection_Invalid );
+        EE_ASSERT( m_pSharedMemoryClient == nullptr );
     }
 
     bool ClientConnection::TryStartConnection()
@@ -272,6 +328,14 @@ namespace EE::Network
             return false;
         }
 
+        // Prefer the shared memory transport if the server is running on this machine
+        //-------------------------------------------------------------------------
+
+        if ( serverAddr.IsLocalHost() && TryStartSharedMemoryConnection( serverAddr.m_port ) )
+        {
+            return true;
+        }
+
         //-------------------------------------------------------------------------
 
         ISteamNetworkingSockets* pInterface = SteamNetworkingSockets();
@@ -290,12 +354,36 @@ namespace EE::Network
         return true;
     }
 
+    bool ClientConnection::TryStartSharedMemoryConnection( uint16_t portNumber )
+    {
+        EE_ASSERT( m_pSharedMemoryClient == nullptr );
+
+        m_pSharedMemoryClient = EE::New<SharedMemoryClient>();
+        if ( !m_pSharedMemoryClient->TryConnect( portNumber ) )
+        {
+            EE::Delete( m_pSharedMemoryClient );
+            return false;
+        }
+
+        // There is no handshake for shared memory connections, we are connected as soon as we have a slot
+        m_connectionHandle = m_pSharedMemoryClient->GetConnectionID();
+        m_reconnectionAttemptsRemaining = 5;
+        m_status = Status::Connected;
+        return true;
+    }
+
     void ClientConnection::CloseConnection()
     {
         ISteamNetworkingSockets* pInterface = SteamNetworkingSockets();
         EE_ASSERT( pInterface != nullptr );
 
-        if ( m_connectionHandle != k_HSteamNetConnection_Invalid )
+        if ( m_pSharedMemoryClient != nullptr )
+        {
+            m_pSharedMemoryClient->Disconnect();
+            EE::Delete( m_pSharedMemoryClient );
+            m_connectionHandle = k_HSteamNetConnection_Invalid;
+        }
+        else if ( m_connectionHandle != k_HSteamNetConnection_Invalid )
         {
             pInterface->CloseConnection( m_connectionHandle, k_ESteamNetConnectionEnd_App_Generic, "Closing Connection", false );
             m_connectionHandle = k_HSteamNetConnection_Invalid;
@@ -331,6 +419,30 @@ namespace EE::Network
             }
         }
 
+        // Run Shared Memory Client Update
+        //-------------------------------------------------------------------------
+
+        if ( m_pSharedMemoryClient != nullptr )
+        {
+            // The server has shutdown or restarted, try to restore the connection
+            if ( m_pSharedMemoryClient->HasLostConnection() )
+            {
+                m_pSharedMemoryClient->Disconnect();
+                EE::Delete( m_pSharedMemoryClient );
+                m_connectionHandle = k_HSteamNetConnection_Invalid;
+                m_status = Status::Reconnecting;
+                return;
+            }
+
+            auto ProcessSharedMemoryMessage = [this] ( void* pData, size_t size ) { ProcessMessage( pData, size ); };
+            m_pSharedMemoryClient->ReceiveMessages( ProcessSharedMemoryMessage );
+
+            auto ClientSendFunction = [this] ( void* pData, uint32_t size ) { m_pSharedMemoryClient->QueueMessage( pData, size ); };
+            SendMessages( ClientSendFunction );
+            m_pSharedMemoryClient->Flush();
+            return;
+        }
+
         // Run Client Update
         //-------------------------------------------------------------------------
 
@@ -3,6 +3,7 @@
 #include "Base/Types/Arrays.h"
 #include "Base/Types/Function.h"
 #include "Base/Types/String.h"
+#include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
@@ -13,6 +14,8 @@ struct SteamNetConnectionStatusChangedCallback_t;
 namespace EE::Network
 {
     class NetworkSystem;
+    class SharedMemoryHost;
+    class SharedMemoryClient;
 
     //-------------------------------------------------------------------------
 
@@ -81,6 +84,9 @@ namespace EE::Network
         virtual void ProcessMessage( uint32_t connectionID, void* pData, size_t size ) = 0;
         virtual void SendMessages( TFunction<void( ClientConnectionID, void*, uint32_t )> const& sendFunction ) = 0;
 
+        // Sleep until a same-host client sends us data or the wait time elapses (plain sleep if there is no same-host transport)
+        void WaitForIncomingMessages( Milliseconds maxWaitTime );
+
     private:
 
         bool TryStartConnection( uint16_t portNumber );
@@ -95,6 +101,7 @@ namespace EE::Network
         uint32_t                                        m_socketHandle = 0;
         uint32_t                                        m_pollingGroupHandle = 0;
         TVector<ClientInfo>                             m_connectedClients;
+        SharedMemoryHost*                               m_pSharedMemoryHost = nullptr; // Same-host transport, used by clients connecting via a loopback address
     };
 
     //-------------------------------------------------------------------------
@@ -132,6 +139,9 @@ namespace EE::Network
         inline uint32_t const& GetClientConnectionID() const { return m_connectionHandle; }
         inline AddressString const& GetAddress() const { return m_address; }
 
+        // Are we connected to a server on this machine via shared memory rather than via sockets
+        inline bool IsUsingSharedMemoryTransport() const { return m_pSharedMemoryClient != nullptr; }
+
         virtual void ProcessMessage( void* pData, size_t size ) = 0;
 
         virtual void SendMessages( TFunction<void( void*, uint32_t )> const& sendFunction ) = 0;
@@ -139,12 +149,14 @@ namespace EE::Network
     private:
 
         bool TryStartConnection();
+        bool TryStartSharedMemoryConnection( uint16_t portNumber );
         void CloseConnection();
         void Update();
 
     private:
 
         AddressString                                   m_address;
+        SharedMemoryClient*                             m_pSharedMemoryClient = nullptr;
         uint32_t                                        m_connectionHandle = 0;
         uint32_t                                        m_reconnectionAttemptsRemaining = 5;
         Status                                          m_status = Status::Disconnected;
@@ -167,6 +179,7 @@ namespace EE::Network
         static void StopServerConnection( ServerConnection* pServerConnection );
 
         // Start a client connection to a specified address. Address format: "XXX.XXX.XXX.XXX:Port"
+        // Loopback addresses will use the shared memory transport if the server is running on this machine
         static bool StartClientConnection( ClientConnection* pClientConnection, char const* pAddress );
         static void StopClientConnection( ClientConnection* pClientConnection );
 
@@ -0,0 +1,127 @@
+#if _WIN32
+#include "Base/Network/SharedMemoryTransport.h"
+#include "Base/Types/String.h"
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <windows.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Network::SharedMemory
+{
+    static InlineString GetSharedBlockName( uint16_t portNumber )
+    {
+        return InlineString( InlineString::CtorSprintf(), "Local\\EsotericaIPC_%u", portNumber );
+    }
+
+    static InlineString GetWakeEventName( uint16_t portNumber )
+    {
+        return InlineString( InlineString::CtorSprintf(), "Local\\EsotericaIPC_%u_Server", portNumber );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void* CreateSharedBlock( uint16_t portNumber, void*& pOutNativeHandle )
+    {
+        uint64_t const blockSize = sizeof( SharedBlock );
+        HANDLE hMapping = CreateFileMappingA( INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD) ( blockSize >> 32 ), (DWORD) blockSize, GetSharedBlockName( portNumber ).c_str() );
+        if ( hMapping == nullptr )
+        {
+            return nullptr;
+        }
+
+        void* pSharedBlock = MapViewOfFile( hMapping, FILE_MAP_ALL_ACCESS, 0, 0, blockSize );
+        if ( pSharedBlock == nullptr )
+        {
+            CloseHandle( hMapping );
+            return nullptr;
+        }
+
+        pOutNativeHandle = hMapping;
+        return pSharedBlock;
+    }
+
+    void* OpenSharedBlock( uint16_t portNumber, void*& pOutNativeHandle )
+    {
+        HANDLE hMapping = OpenFileMappingA( FILE_MAP_ALL_ACCESS, FALSE, GetSharedBlockName( portNumber ).c_str() );
+        if ( hMapping == nullptr )
+        {
+            return nullptr;
+        }
+
+        void* pSharedBlock = MapViewOfFile( hMapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof( SharedBlock ) );
+        if ( pSharedBlock == nullptr )
+        {
+            CloseHandle( hMapping );
+            return nullptr;
+        }
+
+        pOutNativeHandle = hMapping;
+        return pSharedBlock;
+    }
+
+    void CloseSharedBlock( void* pSharedBlock, void* pNativeHandle )
+    {
+        EE_ASSERT( pSharedBlock != nullptr && pNativeHandle != nullptr );
+        UnmapViewOfFile( pSharedBlock );
+        CloseHandle( pNativeHandle );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void* CreateWakeEvent( uint16_t portNumber )
+    {
+        return CreateEventA( nullptr, FALSE, FALSE, GetWakeEventName( portNumber ).c_str() );
+    }
+
+    void* OpenWakeEvent( uint16_t portNumber )
+    {
+        return OpenEventA( EVENT_MODIFY_STATE, FALSE, GetWakeEventName( portNumber ).c_str() );
+    }
+
+    void CloseWakeEvent( void* pEvent )
+    {
+        EE_ASSERT( pEvent != nullptr );
+        CloseHandle( pEvent );
+    }
+
+    void SignalWakeEvent( void* pEvent )
+    {
+        EE_ASSERT( pEvent != nullptr );
+        SetEvent( pEvent );
+    }
+
+    void WaitForWakeEvent( void* pEvent, Milliseconds maxWaitTime )
+    {
+        EE_ASSERT( pEvent != nullptr );
+        WaitForSingleObject( pEvent, (uint32_t) maxWaitTime );
+    }
+
+    //-------------------------------------------------------------------------
+
+    uint32_t GetCurrentProcessID()
+    {
+        return (uint32_t) GetCurrentProcessId();
+    }
+
+    void* OpenProcessHandle( uint32_t processID )
+    {
+        return OpenProcess( SYNCHRONIZE, FALSE, processID );
+    }
+
+    void CloseProcessHandle( void* pProcessHandle )
+    {
+        EE_ASSERT( pProcessHandle != nullptr );
+        CloseHandle( pProcessHandle );
+    }
+
+    bool IsProcessAlive( void* pProcessHandle )
+    {
+        EE_ASSERT( pProcessHandle != nullptr );
+        return WaitForSingleObject( pProcessHandle, 0 ) == WAIT_TIMEOUT;
+    }
+}
+#endif
@@ -0,0 +1,653 @@
+#include "SharedMemoryTransport.h"
+#include "Base/Math/Math.h"
+#include "Base/Logging/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Network
+{
+    namespace SharedMemory
+    {
+        void RingBuffer::Reset()
+        {
+            m_writePosition.store( 0, std::memory_order_relaxed );
+            m_readPosition.store( 0, std::memory_order_release );
+        }
+
+        uint32_t RingBuffer::Write( uint8_t const* pData, uint32_t size )
+        {
+            uint64_t const writePosition = m_writePosition.load( std::memory_order_relaxed );
+            uint64_t const readPosition = m_readPosition.load( std::memory_order_acquire );
+            uint32_t const freeSpace = s_ringBufferSize - (uint32_t) ( writePosition - readPosition );
+            uint32_t const numBytesToWrite = Math::Min( size, freeSpace );
+            if ( numBytesToWrite == 0 )
+            {
+                return 0;
+            }
+
+            // Copy in up to two parts, to handle the wrap around
+            uint32_t const startIdx = (uint32_t) ( writePosition & ( s_ringBufferSize - 1 ) );
+            uint32_t const firstPartSize = Math::Min( numBytesToWrite, s_ringBufferSize - startIdx );
+            memcpy( m_data + startIdx, pData, firstPartSize );
+            memcpy( m_data, pData + firstPartSize, numBytesToWrite - firstPartSize );
+
+            m_writePosition.store( writePosition + numBytesToWrite, std::memory_order_release );
+            return numBytesToWrite;
+        }
+
+        uint32_t RingBuffer::Read( uint8_t* pData, uint32_t maxSize )
+        {
+            uint64_t const readPosition = m_readPosition.load( std::memory_order_relaxed );
+            uint64_t const writePosition = m_writePosition.load( std::memory_order_acquire );
+            uint32_t const numBytesToRead = Math::Min( maxSize, (uint32_t) ( writePosition - readPosition ) );
+            if ( numBytesToRead == 0 )
+            {
+                return 0;
+            }
+
+            uint32_t const startIdx = (uint32_t) ( readPosition & ( s_ringBufferSize - 1 ) );
+            uint32_t const firstPartSize = Math::Min( numBytesToRead, s_ringBufferSize - startIdx );
+            memcpy( pData, m_data + startIdx, firstPartSize );
+            memcpy( pData + firstPartSize, m_data, numBytesToRead - firstPartSize );
+
+            m_readPosition.store( readPosition + numBytesToRead, std::memory_order_release );
+            return numBytesToRead;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Endpoint
+    //-------------------------------------------------------------------------
+
+    void SharedMemoryEndpoint::Initialize( SharedMemory::RingBuffer* pOutgoing, SharedMemory::RingBuffer* pIncoming, void* pRemoteWakeEvent )
+    {
+        EE_ASSERT( pOutgoing != nullptr && pIncoming != nullptr );
+        m_pOutgoing = pOutgoing;
+        m_pIncoming = pIncoming;
+        m_pRemoteWakeEvent = pRemoteWakeEvent;
+    }
+
+    void SharedMemoryEndpoint::Shutdown()
+    {
+        m_pOutgoing = nullptr;
+        m_pIncoming = nullptr;
+        m_pRemoteWakeEvent = nullptr;
+
+        m_pendingData.clear();
+        m_pendingDataOffset = 0;
+        m_pendingDataSize = 0;
+        m_hasWrittenData = false;
+
+        m_incomingMessage.clear();
+        m_incomingMessageSize = 0;
+        m_incomingBytesRead = 0;
+        m_incomingSizeBytesRead = 0;
+    }
+
+    uint32_t SharedMemoryEndpoint::WriteToRing( uint8_t const* pData, uint32_t size )
+    {
+        uint32_t const numBytesWritten = m_pOutgoing->Write( pData, size );
+        m_hasWrittenData |= ( numBytesWritten > 0 );
+        return numBytesWritten;
+    }
+
+    Blob& SharedMemoryEndpoint::AddPendingData( uint32_t size )
+    {
+        Blob& pendingData = m_pendingData.emplace_back();
+        pendingData.resize( size );
+        m_pendingDataSize += size;
+        return pendingData;
+    }
+
+    bool SharedMemoryEndpoint::QueueMessage( void const* pData, uint32_t size )
+    {
+        EE_ASSERT( m_pOutgoing != nullptr );
+        EE_ASSERT( pData != nullptr && size > 0 );
+
+        uint8_t const* pByteData = (uint8_t const*) pData;
+
+        // Refuse to buffer any more data if the remote side isnt reading, a single message is always accepted so that large messages still get through
+        if ( !m_pendingData.empty() && ( m_pendingDataSize + sizeof( uint32_t ) + size ) > SharedMemory::s_maxPendingDataSize )
+        {
+            return false;
+        }
+
+        // If nothing is waiting, write straight into the ring
+        //-------------------------------------------------------------------------
+        // The size header is never split from the pending list, so we only write it if it fits entirely
+
+        uint32_t numPayloadBytesWritten = 0;
+        if ( m_pendingData.empty() )
+        {
+            uint32_t const numHeaderBytesWritten = WriteToRing( (uint8_t const*) &size, sizeof( uint32_t ) );
+            if ( numHeaderBytesWritten == sizeof( uint32_t ) )
+            {
+                numPayloadBytesWritten = WriteToRing( pByteData, size );
+                if ( numPayloadBytesWritten == size )
+                {
+                    return true;
+                }
+            }
+            else if ( numHeaderBytesWritten > 0 )
+            {
+                // Keep the rest of the header with the payload
+                Blob& pendingData = AddPendingData( sizeof( uint32_t ) - numHeaderBytesWritten + size );
+                memcpy( pendingData.data(), ( (uint8_t const*) &size ) + numHeaderBytesWritten, sizeof( uint32_t ) - numHeaderBytesWritten );
+                memcpy( pendingData.data() + sizeof( uint32_t ) - numHeaderBytesWritten, pByteData, size );
+                return true;
+            }
+            else // Ring is full
+            {
+                Blob& pendingData = AddPendingData( sizeof( uint32_t ) + size );
+                memcpy( pendingData.data(), &size, sizeof( uint32_t ) );
+                memcpy( pendingData.data() + sizeof( uint32_t ), pByteData, size );
+                return true;
+            }
+
+            // Keep the remainder of the payload
+            Blob& pendingData = AddPendingData( size - numPayloadBytesWritten );
+            memcpy( pendingData.data(), pByteData + numPayloadBytesWritten, size - numPayloadBytesWritten );
+        }
+        else // Preserve ordering behind any data that is already waiting
+        {
+            Blob& pendingData = AddPendingData( sizeof( uint32_t ) + size );
+            memcpy( pendingData.data(), &size, sizeof( uint32_t ) );
+            memcpy( pendingData.data() + sizeof( uint32_t ), pByteData, size );
+        }
+
+        return true;
+    }
+
+    void SharedMemoryEndpoint::Flush()
+    {
+        EE_ASSERT( m_pOutgoing != nullptr );
+
+        // Write any pending data
+        //-------------------------------------------------------------------------
+
+        int32_t numCompletedEntries = 0;
+        for ( auto const& pendingData : m_pendingData )
+        {
+            uint32_t const numBytesRemaining = (uint32_t) pendingData.size() - m_pendingDataOffset;
+            uint32_t const numBytesWritten = WriteToRing( pendingData.data() + m_pendingDataOffset, numBytesRemaining );
+            m_pendingDataSize -= numBytesWritten;
+            if ( numBytesWritten < numBytesRemaining )
+            {
+                m_pendingDataOffset += numBytesWritten;
+                break;
+            }
+
+            m_pendingDataOffset = 0;
+            numCompletedEntries++;
+        }
+
+        m_pendingData.erase( m_pendingData.begin(), m_pendingData.begin() + numCompletedEntries );
+
+        // Wake up the reader
+        //-------------------------------------------------------------------------
+
+        if ( m_hasWrittenData )
+        {
+            if ( m_pRemoteWakeEvent != nullptr )
+            {
+                SharedMemory::SignalWakeEvent( m_pRemoteWakeEvent );
+            }
+
+            m_hasWrittenData = false;
+        }
+    }
+
+    void SharedMemoryEndpoint::ReceiveMessages( TFunction<void( void*, size_t )> const& processFunction )
+    {
+        EE_ASSERT( m_pIncoming != nullptr );
+
+        while ( true )
+        {
+            // Read the message size
+            if ( m_incomingSizeBytesRead < sizeof( uint32_t ) )
+            {
+                m_incomingSizeBytesRead += m_pIncoming->Read( ( (uint8_t*) &m_incomingMessageSize ) + m_incomingSizeBytesRead, sizeof( uint32_t ) - m_incomingSizeBytesRead );
+                if ( m_incomingSizeBytesRead < sizeof( uint32_t ) )
+                {
+                    break;
+                }
+
+                EE_ASSERT( m_incomingMessageSize > 0 );
+                m_incomingMessage.resize( m_incomingMessageSize );
+                m_incomingBytesRead = 0;
+            }
+
+            // Read the payload
+            m_incomingBytesRead += m_pIncoming->Read( m_incomingMessage.data() + m_incomingBytesRead, m_incomingMessageSize - m_incomingBytesRead );
+            if ( m_incomingBytesRead < m_incomingMessageSize )
+            {
+                break;
+            }
+
+            processFunction( m_incomingMessage.data(), m_incomingMessageSize );
+            m_incomingSizeBytesRead = 0;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Host
+    //-------------------------------------------------------------------------
+
+    bool SharedMemoryHost::Create( uint16_t portNumber )
+    {
+        EE_ASSERT( m_pSharedBlock == nullptr );
+
+        m_pSharedBlock = (SharedMemory::SharedBlock*) SharedMemory::CreateSharedBlock( portNumber, m_pNativeHandle );
+        if ( m_pSharedBlock == nullptr )
+        {
+            return false;
+        }
+
+        m_pServerWakeEvent = SharedMemory::CreateWakeEvent( portNumber );
+        if ( m_pServerWakeEvent == nullptr )
+        {
+            Destroy();
+            return false;
+        }
+
+        // (Re)initialize the block, a previous server might have left stale state behind if clients kept the block alive
+        //-------------------------------------------------------------------------
+
+        // Invalidate the previous session before touching any slots, so its clients stop using the rings we are about to reset
+        uint32_t const previousSessionID = m_pSharedBlock->m_serverSessionID.exchange( 0, std::memory_order_seq_cst );
+
+        m_pSharedBlock->m_version = SharedMemory::s_version;
+
+        for ( int32_t i = 0; i < SharedMemory::s_maxClients; i++ )
+        {
+            auto& slot = m_pSharedBlock->m_slots[i];
+            slot.m_clientToServer.Reset();
+            slot.m_serverToClient.Reset();
+            slot.m_state.store( (uint32_t) SharedMemory::SlotState::Free, std::memory_order_release );
+            slot.m_clientProcessID.store( 0, std::memory_order_release );
+            m_isSlotConnected[i] = false;
+            m_isSlotStalled[i] = false;
+        }
+
+        // Publish the new session ID last, only then can new clients connect
+        uint32_t sessionID = previousSessionID + 1;
+        sessionID = ( sessionID == 0 ) ? 1 : sessionID;
+        m_pSharedBlock->m_serverSessionID.store( sessionID, std::memory_order_release );
+
+        return true;
+    }
+
+    void SharedMemoryHost::Destroy()
+    {
+        if ( m_pSharedBlock != nullptr )
+        {
+            m_pSharedBlock->m_serverSessionID.store( 0, std::memory_order_release );
+        }
+
+        for ( int32_t i = 0; i < SharedMemory::s_maxClients; i++ )
+        {
+            m_endpoints[i].Shutdown();
+            m_isSlotConnected[i] = false;
+            m_isSlotStalled[i] = false;
+
+            if ( m_clientProcesses[i] != nullptr )
+            {
+                SharedMemory::CloseProcessHandle( m_clientProcesses[i] );
+                m_clientProcesses[i] = nullptr;
+            }
+        }
+
+        if ( m_pServerWakeEvent != nullptr )
+        {
+            SharedMemory::CloseWakeEvent( m_pServerWakeEvent );
+            m_pServerWakeEvent = nullptr;
+        }
+
+        if ( m_pSharedBlock != nullptr )
+        {
+            SharedMemory::CloseSharedBlock( m_pSharedBlock, m_pNativeHandle );
+            m_pSharedBlock = nullptr;
+            m_pNativeHandle = nullptr;
+        }
+    }
+
+    void SharedMemoryHost::UpdateConnections( TFunction<void( uint32_t )> const& onClientConnected, TFunction<void( uint32_t )> const& onClientDisconnected )
+    {
+        EE_ASSERT( m_pSharedBlock != nullptr );
+
+        for ( int32_t i = 0; i < SharedMemory::s_maxClients; i++ )
+        {
+            auto& slot = m_pSharedBlock->m_slots[i];
+            auto const state = (SharedMemory::SlotState) slot.m_state.load( std::memory_order_acquire );
+
+            switch ( state )
+            {
+                case SharedMemory::SlotState::Free:
+                {
+                    // A client is in the middle of claiming this slot, make sure it didnt die while doing so
+                    uint32_t const processID = slot.m_clientProcessID.load( std::memory_order_acquire );
+                    if ( processID != 0 )
+                    {
+                        void* pProcessHandle = SharedMemory::OpenProcessHandle( processID );
+                        if ( pProcessHandle == nullptr )
+                        {
+                            ReleaseSlot( i );
+                        }
+                        else
+                        {
+                            SharedMemory::CloseProcessHandle( pProcessHandle );
+                        }
+                    }
+                }
+                break;
+
+                case SharedMemory::SlotState::Connecting:
+                {
+                    EE_ASSERT( !m_isSlotConnected[i] && m_clientProcesses[i] == nullptr );
+
+                    // If we cant open the client process, it is already gone
+                    m_clientProcesses[i] = SharedMemory::OpenProcessHandle( slot.m_clientProcessID.load( std::memory_order_acquire ) );
+                    if ( m_clientProcesses[i] == nullptr )
+                    {
+                        ReleaseSlot( i );
+                        break;
+                    }
+
+                    m_endpoints[i].Initialize( &slot.m_serverToClient, &slot.m_clientToServer, nullptr );
+                    m_isSlotConnected[i] = true;
+                    slot.m_state.store( (uint32_t) SharedMemory::SlotState::Connected, std::memory_order_release );
+                    onClientConnected( SharedMemory::GetConnectionID( i ) );
+                }
+                break;
+
+                case SharedMemory::SlotState::Connected:
+                {
+                    EE_ASSERT( m_isSlotConnected[i] );
+
+                    if ( !SharedMemory::IsProcessAlive( m_clientProcesses[i] ) )
+                    {
+                        EE_LOG_WARNING( "Network", "Shared Memory", "Client process for connection %u has exited without disconnecting, freeing its slot", SharedMemory::GetConnectionID( i ) );
+                        DisconnectClient( i, onClientDisconnected );
+                        ReleaseSlot( i );
+                    }
+                    else if ( m_isSlotStalled[i] )
+                    {
+                        // The client will notice that it was dropped and release the slot, it might have disconnected in the meantime
+                        EE_LOG_WARNING( "Network", "Shared Memory", "Client for connection %u has stopped reading its messages, dropping it", SharedMemory::GetConnectionID( i ) );
+                        DisconnectClient( i, onClientDisconnected );
+
+                        uint32_t expectedState = (uint32_t) SharedMemory::SlotState::Connected;
+                        slot.m_state.compare_exchange_strong( expectedState, (uint32_t) SharedMemory::SlotState::Dropped, std::memory_order_acq_rel );
+                    }
+                }
+                break;
+
+                case SharedMemory::SlotState::Dropped:
+                {
+                    // Waiting on the client to release the slot
+                    if ( !SharedMemory::IsProcessAlive( m_clientProcesses[i] ) )
+                    {
+                        ReleaseSlot( i );
+                    }
+                }
+                break;
+
+                case SharedMemory::SlotState::Disconnected:
+                {
+                    DisconnectClient( i, onClientDisconnected );
+                    ReleaseSlot( i );
+                }
+                break;
+
+                default:
+                break;
+            }
+        }
+    }
+
+    void SharedMemoryHost::DisconnectClient( int32_t slotIdx, TFunction<void( uint32_t )> const& onClientDisconnected )
+    {
+        if ( m_isSlotConnected[slotIdx] )
+        {
+            onClientDisconnected( SharedMemory::GetConnectionID( slotIdx ) );
+            m_endpoints[slotIdx].Shutdown();
+            m_isSlotConnected[slotIdx] = false;
+        }
+
+        m_isSlotStalled[slotIdx] = false;
+    }
+
+    void SharedMemoryHost::ReleaseSlot( int32_t slotIdx )
+    {
+        EE_ASSERT( !m_isSlotConnected[slotIdx] );
+
+        if ( m_clientProcesses[slotIdx] != nullptr )
+        {
+            SharedMemory::CloseProcessHandle( m_clientProcesses[slotIdx] );
+            m_clientProcesses[slotIdx] = nullptr;
+        }
+
+        // The process ID is cleared last, since that is what new clients use to claim the slot
+        auto& slot = m_pSharedBlock->m_slots[slotIdx];
+        slot.m_clientToServer.Reset();
+        slot.m_serverToClient.Reset();
+        slot.m_state.store( (uint32_t) SharedMemory::SlotState::Free, std::memory_order_release );
+        slot.m_clientProcessID.store( 0, std::memory_order_release );
+    }
+
+    void SharedMemoryHost::ReceiveMessages( TFunction<void( uint32_t, void*, size_t )> const& processFunction )
+    {
+        EE_ASSERT( m_pSharedBlock != nullptr );
+
+        for ( int32_t i = 0; i < SharedMemory::s_maxClients; i++ )
+        {
+            if ( m_isSlotConnected[i] )
+            {
+                uint32_t const connectionID = SharedMemory::GetConnectionID( i );
+                m_endpoints[i].ReceiveMessages( [&processFunction, connectionID] ( void* pData, size_t size ) { processFunction( connectionID, pData, size ); } );
+            }
+        }
+    }
+
+    void SharedMemoryHost::QueueMessage( uint32_t connectionID, void const* pData, uint32_t size )
+    {
+        int32_t const slotIdx = SharedMemory::GetSlotIndex( connectionID );
+        EE_ASSERT( slotIdx >= 0 && slotIdx < SharedMemory::s_maxClients );
+
+        // The client might have just disconnected or be about to be dropped
+        if ( m_isSlotConnected[slotIdx] && !m_isSlotStalled[slotIdx] )
+        {
+            m_isSlotStalled[slotIdx] = !m_endpoints[slotIdx].QueueMessage( pData, size );
+        }
+    }
+
+    void SharedMemoryHost::Flush()
+    {
+        for ( int32_t i = 0; i < SharedMemory::s_maxClients; i++ )
+        {
+            if ( m_isSlotConnected[i] )
+            {
+                m_endpoints[i].Flush();
+            }
+        }
+    }
+
+    void SharedMemoryHost::WaitForIncomingData( Milliseconds maxWaitTime )
+    {
+        EE_ASSERT( m_pServerWakeEvent != nullptr );
+        SharedMemory::WaitForWakeEvent( m_pServerWakeEvent, maxWaitTime );
+    }
+
+    //-------------------------------------------------------------------------
+    // Client
+    //-------------------------------------------------------------------------
+
+    bool SharedMemoryClient::TryConnect( uint16_t portNumber )
+    {
+        EE_ASSERT( m_pSharedBlock == nullptr );
+
+        // Is there a server running on this machine?
+        //-------------------------------------------------------------------------
+
+        m_pSharedBlock = (SharedMemory::SharedBlock*) SharedMemory::OpenSharedBlock( portNumber, m_pNativeHandle );
+        if ( m_pSharedBlock == nullptr )
+        {
+            return false;
+        }
+
+        m_serverSessionID = m_pSharedBlock->m_serverSessionID.load( std::memory_order_acquire );
+        if ( m_serverSessionID == 0 || m_pSharedBlock->m_version != SharedMemory::s_version )
+        {
+            Disconnect();
+            return false;
+        }
+
+        // Claim a slot
+        //-------------------------------------------------------------------------
+        // Slots are claimed via the process ID so that the server can always tell which process owns a slot
+
+        uint32_t const processID = SharedMemory::GetCurrentProcessID();
+        for ( int32_t i = 0; i < SharedMemory::s_maxClients; i++ )
+        {
+            auto& slot = m_pSharedBlock->m_slots[i];
+            if ( slot.m_state.load( std::memory_order_acquire ) != (uint32_t) SharedMemory::SlotState::Free )
+            {
+                continue;
+            }
+
+            uint32_t expectedProcessID = 0;
+            if ( slot.m_clientProcessID.compare_exchange_strong( expectedProcessID, processID, std::memory_order_acq_rel ) )
+            {
+                // Clear out anything a client of a previous session might have written after the server reset the slot
+                slot.m_clientToServer.Reset();
+                slot.m_serverToClient.Reset();
+                slot.m_state.store( (uint32_t) SharedMemory::SlotState::Connecting, std::memory_order_release );
+                m_slotIdx = i;
+                break;
+            }
+        }
+
+        if ( m_slotIdx == InvalidIndex )
+        {
+            Disconnect();
+            return false;
+        }
+
+        // The server might have been restarted while we were claiming the slot, in which case the new server owns the slot state
+        if ( !IsConnectedToSameServerSession() )
+        {
+            auto& slot = m_pSharedBlock->m_slots[m_slotIdx];
+            if ( slot.m_clientProcessID.load( std::memory_order_acquire ) == processID )
+            {
+                slot.m_state.store( (uint32_t) SharedMemory::SlotState::Free, std::memory_order_release );
+
+                uint32_t expectedProcessID = processID;
+                slot.m_clientProcessID.compare_exchange_strong( expectedProcessID, 0, std::memory_order_acq_rel );
+            }
+
+            m_slotIdx = InvalidIndex;
+            Disconnect();
+            return false;
+        }
+
+        // Open wake event
+        //-------------------------------------------------------------------------
+
+        m_pServerWakeEvent = SharedMemory::OpenWakeEvent( portNumber );
+        if ( m_pServerWakeEvent == nullptr )
+        {
+            Disconnect();
+            return false;
+        }
+
+        auto& slot = m_pSharedBlock->m_slots[m_slotIdx];
+        m_endpoint.Initialize( &slot.m_clientToServer, &slot.m_serverToClient, m_pServerWakeEvent );
+
+        // Let the server know that we are here
+        SharedMemory::SignalWakeEvent( m_pServerWakeEvent );
+        return true;
+    }
+
+    void SharedMemoryClient::Disconnect()
+    {
+        m_endpoint.Shutdown();
+
+        if ( m_pSharedBlock != nullptr && m_slotIdx != InvalidIndex )
+        {
+            // Only release the slot if it still belongs to the server session we connected to
+            if ( IsConnectedToSameServerSession() )
+            {
+                m_pSharedBlock->m_slots[m_slotIdx].m_state.store( (uint32_t) SharedMemory::SlotState::Disconnected, std::memory_order_release );
+
+                // We might have failed to open the event while connecting, the server will still pick up the state change on its next update
+                if ( m_pServerWakeEvent != nullptr )
+                {
+                    SharedMemory::SignalWakeEvent( m_pServerWakeEvent );
+                }
+            }
+        }
+
+        m_slotIdx = InvalidIndex;
+        m_serverSessionID = 0;
+        m_isServerStalled = false;
+
+        if ( m_pServerWakeEvent != nullptr )
+        {
+            SharedMemory::CloseWakeEvent( m_pServerWakeEvent );
+            m_pServerWakeEvent = nullptr;
+        }
+
+        if ( m_pSharedBlock != nullptr )
+        {
+            SharedMemory::CloseSharedBlock( m_pSharedBlock, m_pNativeHandle );
+            m_pSharedBlock = nullptr;
+            m_pNativeHandle = nullptr;
+        }
+    }
+
+    void SharedMemoryClient::Flush()
+    {
+        // Never write into the rings of a different server session, they have been (or are being) reset
+        if ( !IsConnectedToSameServerSession() )
+        {
+            return;
+        }
+
+        m_endpoint.Flush();
+    }
+
+    void SharedMemoryClient::ReceiveMessages( TFunction<void( void*, size_t )> const& processFunction )
+    {
+        if ( !IsConnectedToSameServerSession() )
+        {
+            return;
+        }
+
+        // The server might have reset the ring while we were reading a message, only hand out messages that were read before the session changed
+        m_endpoint.ReceiveMessages( [this, &processFunction] ( void* pData, size_t size )
+        {
+            if ( IsConnectedToSameServerSession() )
+            {
+                processFunction( pData, size );
+            }
+        } );
+    }
+
+    bool SharedMemoryClient::IsConnectedToSameServerSession() const
+    {
+        EE_ASSERT( m_pSharedBlock != nullptr );
+        return m_pSharedBlock->m_serverSessionID.load( std::memory_order_acquire ) == m_serverSessionID;
+    }
+
+    bool SharedMemoryClient::HasLostConnection() const
+    {
+        EE_ASSERT( m_pSharedBlock != nullptr && m_slotIdx != InvalidIndex );
+
+        if ( !IsConnectedToSameServerSession() || m_isServerStalled )
+        {
+            return true;
+        }
+
+        return m_pSharedBlock->m_slots[m_slotIdx].m_state.load( std::memory_order_acquire ) == (uint32_t) SharedMemory::SlotState::Dropped;
+    }
+}
@@ -0,0 +1,232 @@
+#pragma once
+#include "Base/_Module/API.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Types/Function.h"
+#include "Base/Time/Time.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+// Shared Memory Transport
+//-------------------------------------------------------------------------
+// Same-host transport used when a client connects to a server via a loopback address
+// The server creates a named shared memory block (per port) with a fixed number of client slots
+// Each slot has two single producer/single consumer byte rings (one per direction)
+// Clients signal a named event after writing so that the server can sleep until there is data available
+// Messages are streamed through the rings as [uint32_t size][payload], so messages larger than the ring are supported
+// Clients register their process ID in their slot, the server uses it to detect and free the slots of clients that died
+
+namespace EE::Network
+{
+    namespace SharedMemory
+    {
+        constexpr static uint32_t const s_version = 2;
+        constexpr static int32_t const s_maxClients = 4;
+        constexpr static uint32_t const s_ringBufferSize = 2 * 1024 * 1024;
+        constexpr static uint32_t const s_connectionIDFlag = 0x80000000;
+
+        // The max amount of data we will hold on to when the remote side is not reading, anything beyond this means the remote side is stalled
+        constexpr static uint32_t const s_maxPendingDataSize = 64 * 1024 * 1024;
+
+        //-------------------------------------------------------------------------
+
+        // Single producer/single consumer byte ring that lives in shared memory
+        struct RingBuffer
+        {
+            static_assert( ( s_ringBufferSize & ( s_ringBufferSize - 1 ) ) == 0, "Ring buffer size must be a power of 2" );
+
+            void Reset();
+
+            // Returns the number of bytes written
+            uint32_t Write( uint8_t const* pData, uint32_t size );
+
+            // Returns the number of bytes read
+            uint32_t Read( uint8_t* pData, uint32_t maxSize );
+
+        public:
+
+            alignas( 64 ) std::atomic<uint64_t>     m_writePosition;
+            alignas( 64 ) std::atomic<uint64_t>     m_readPosition;
+            alignas( 64 ) uint8_t                   m_data[s_ringBufferSize];
+        };
+
+        //-------------------------------------------------------------------------
+
+        enum class SlotState : uint32_t
+        {
+            Free = 0,
+            Connecting,     // Claimed by a client, the server hasnt seen it yet
+            Connected,      // Acknowledged by the server
+            Disconnected,   // Released by the client, the server needs to clean it up
+            Dropped,        // Dropped by the server since the client stopped reading, the client needs to release it
+        };
+
+        struct Slot
+        {
+            std::atomic<uint32_t>                   m_state;
+            std::atomic<uint32_t>                   m_clientProcessID; // Clients claim a slot by setting this, it is cleared by the server once the slot is free
+            RingBuffer                              m_clientToServer;
+            RingBuffer                              m_serverToClient;
+        };
+
+        struct SharedBlock
+        {
+            uint32_t                                m_version;
+            std::atomic<uint32_t>                   m_serverSessionID; // Changes every time a server (re)creates the block, 0 when no server is running
+            Slot                                    m_slots[s_maxClients];
+        };
+
+        //-------------------------------------------------------------------------
+
+        EE_FORCE_INLINE bool IsSharedMemoryConnection( uint32_t connectionID ) { return ( connectionID & s_connectionIDFlag ) != 0; }
+        EE_FORCE_INLINE uint32_t GetConnectionID( int32_t slotIdx ) { return s_connectionIDFlag | (uint32_t) ( slotIdx + 1 ); }
+        EE_FORCE_INLINE int32_t GetSlotIndex( uint32_t connectionID ) { return (int32_t) ( connectionID & ~s_connectionIDFlag ) - 1; }
+
+        // Platform specific functions
+        //-------------------------------------------------------------------------
+
+        void* CreateSharedBlock( uint16_t portNumber, void*& pOutNativeHandle );
+        void* OpenSharedBlock( uint16_t portNumber, void*& pOutNativeHandle );
+        void CloseSharedBlock( void* pSharedBlock, void* pNativeHandle );
+
+        // The server wake event is an auto-reset event, identified by port
+        void* CreateWakeEvent( uint16_t portNumber );
+        void* OpenWakeEvent( uint16_t portNumber );
+        void CloseWakeEvent( void* pEvent );
+        void SignalWakeEvent( void* pEvent );
+        void WaitForWakeEvent( void* pEvent, Milliseconds maxWaitTime );
+
+        // Client process tracking, opening a process handle fails if the process no longer exists
+        uint32_t GetCurrentProcessID();
+        void* OpenProcessHandle( uint32_t processID );
+        void CloseProcessHandle( void* pProcessHandle );
+        bool IsProcessAlive( void* pProcessHandle );
+    }
+
+    //-------------------------------------------------------------------------
+
+    // One side of a shared memory connection, streams messages into one ring and out of the other
+    class EE_BASE_API SharedMemoryEndpoint
+    {
+    public:
+
+        // The remote wake event is optional, only the server has one
+        void Initialize( SharedMemory::RingBuffer* pOutgoing, SharedMemory::RingBuffer* pIncoming, void* pRemoteWakeEvent );
+        void Shutdown();
+
+        // Write a message to the outgoing ring, anything that doesnt fit is kept until the next flush
+        // Returns false and drops the message if there is already too much data waiting, this means the remote side has stopped reading
+        bool QueueMessage( void const* pData, uint32_t size );
+
+        // Write as much of the pending data as will fit and wake the remote side if we wrote anything
+        void Flush();
+
+        // Read all fully received messages from the incoming ring
+        void ReceiveMessages( TFunction<void( void*, size_t )> const& processFunction );
+
+    private:
+
+        // Returns the number of bytes of the data that were written
+        uint32_t WriteToRing( uint8_t const* pData, uint32_t size );
+
+        // Add a new pending data entry of the specified size
+        Blob& AddPendingData( uint32_t size );
+
+    private:
+
+        SharedMemory::RingBuffer*                   m_pOutgoing = nullptr;
+        SharedMemory::RingBuffer*                   m_pIncoming = nullptr;
+        void*                                       m_pRemoteWakeEvent = nullptr;
+
+        // Data that didnt fit in the ring yet, the first entry may be partially written
+        TVector<Blob>                               m_pendingData;
+        uint32_t                                    m_pendingDataOffset = 0;
+        uint32_t                                    m_pendingDataSize = 0;
+        bool                                        m_hasWrittenData = false;
+
+        // The message we are currently receiving
+        Blob                                        m_incomingMessage;
+        uint32_t                                    m_incomingMessageSize = 0;
+        uint32_t                                    m_incomingBytesRead = 0;
+        uint32_t                                    m_incomingSizeBytesRead = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API SharedMemoryHost
+    {
+    public:
+
+        ~SharedMemoryHost() { EE_ASSERT( m_pSharedBlock == nullptr ); }
+
+        bool Create( uint16_t portNumber );
+        void Destroy();
+
+        // Handle client slot state changes, this also drops clients that have died or stopped reading
+        void UpdateConnections( TFunction<void( uint32_t )> const& onClientConnected, TFunction<void( uint32_t )> const& onClientDisconnected );
+
+        // Read all incoming messages from all connected clients
+        void ReceiveMessages( TFunction<void( uint32_t, void*, size_t )> const& processFunction );
+
+        // Queue a message for a specific client, call Flush to send
+        void QueueMessage( uint32_t connectionID, void const* pData, uint32_t size );
+        void Flush();
+
+        // Sleep until a client writes data or the wait time elapses
+        void WaitForIncomingData( Milliseconds maxWaitTime );
+
+    private:
+
+        void DisconnectClient( int32_t slotIdx, TFunction<void( uint32_t )> const& onClientDisconnected );
+
+        // Make the slot available to new clients
+        void ReleaseSlot( int32_t slotIdx );
+
+    private:
+
+        SharedMemory::SharedBlock*                  m_pSharedBlock = nullptr;
+        void*                                       m_pNativeHandle = nullptr;
+        void*                                       m_pServerWakeEvent = nullptr;
+        void*                                       m_clientProcesses[SharedMemory::s_maxClients] = {};
+        SharedMemoryEndpoint                        m_endpoints[SharedMemory::s_maxClients];
+        bool                                        m_isSlotConnected[SharedMemory::s_maxClients] = {};
+        bool                                        m_isSlotStalled[SharedMemory::s_maxClients] = {};
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API SharedMemoryClient
+    {
+    public:
+
+        ~SharedMemoryClient() { EE_ASSERT( m_pSharedBlock == nullptr ); }
+
+        // Try to connect to a server running on this machine, fails if there is no server or no free slot
+        bool TryConnect( uint16_t portNumber );
+        void Disconnect();
+
+        inline uint32_t GetConnectionID() const { return SharedMemory::GetConnectionID( m_slotIdx ); }
+
+        // Has the server we connected to shutdown, been restarted or dropped us, or has the server stopped reading our messages
+        bool HasLostConnection() const;
+
+        inline void QueueMessage( void const* pData, uint32_t size ) { m_isServerStalled |= !m_endpoint.QueueMessage( pData, size ); }
+        // Both of these are no-ops once the server session has changed, check 'HasLostConnection' to find out when that happens
+        void Flush();
+        void ReceiveMessages( TFunction<void( void*, size_t )> const& processFunction );
+
+    private:
+
+        // Does our slot still belong to the server session we connected to
+        bool IsConnectedToSameServerSession() const;
+
+    private:
+
+        SharedMemory::SharedBlock*                  m_pSharedBlock = nullptr;
+        void*                                       m_pNativeHandle = nullptr;
+        void*                                       m_pServerWakeEvent = nullptr;
+        SharedMemoryEndpoint                        m_endpoint;
+        uint32_t                                    m_serverSessionID = 0;
+        int32_t                                     m_slotIdx = InvalidIndex;
+        bool                                        m_isServerStalled = false;
+    };
+}
@@ -2,6 +2,8 @@
 #include "RenderGraphResolver.h"
 #include "Base/Types/Arrays.h"
 #include "Base/Logging/Log.h"
+#include "Base/Encoding/Hash.h"
+#include "Base/Profiling.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Render/RenderTarget.h"
 #include "Base/Render/RenderDevice.h"
@@ -196,16 +198,34 @@ namespace EE
                 return false;
             }
 
-            // Graph dependency analysis
+            EE_PROFILE_FUNCTION_RENDER();
+
+            // Graph dependency analysis, skipped if the graph has the same structure as the last compiled graph
             //-------------------------------------------------------------------------
 
-            RenderGraphResolver resolver( m_renderGraph, m_resourceRegistry );
-            RGResolveResult resolvedResult = resolver.Resolve();
+            size_t const structuralHash = CalculateStructuralHash();
+            if ( m_bIsCompileCacheValid && m_compiledStructuralHash == structuralHash && m_cachedAliasingPlan.m_resourceSlots.size() == m_resourceRegistry.GetNumRegisteredResources() )
+            {
+                m_numCompileCacheHits++;
+            }
+            else
+            {
+                RenderGraphResolver resolver( m_renderGraph, m_resourceRegistry );
+                m_cachedResolveResult = resolver.Resolve();
+                m_cachedAliasingPlan = m_resourceRegistry.CreateTransientAliasingPlan( m_cachedResolveResult );
+                m_cachedPresentNodeIndex = -1;
+                m_compiledStructuralHash = structuralHash;
+                m_bIsCompileCacheValid = true;
+                m_numCompileCacheMisses++;
+            }
 
-            // Create actual RHI Resources
+            EE_PROFILE_TAG( "Compile Cache Hits", m_numCompileCacheHits );
+            EE_PROFILE_TAG( "Compile Cache Misses", m_numCompileCacheMisses );
+
+            // Create actual RHI Resources, this binds this frame's resources even if the structure didnt change
             //-------------------------------------------------------------------------
 
-            bool result = m_resourceRegistry.Compile( pDevice, resolvedResult );
+            bool result = m_resourceRegistry.Compile( pDevice, m_cachedResolveResult, m_cachedAliasingPlan );
 
             if ( !result )
             {
@@ -236,7 +256,9 @@ namespace EE
                 // Compile render graph into executable render graph
                 //-------------------------------------------------------------------------
 
-                TVector<RGExecutableNode> executeSequences;
+                // Note: the sequence is built in place, so that its storage is reused across frames
+                TVector<RGExecutableNode>& executeSequences = m_executeNodesSequence;
+                executeSequences.clear();
                 executeSequences.reserve( m_renderGraph.size() );
                 for ( auto& node : m_renderGraph )
                 {
@@ -246,11 +268,17 @@ namespace EE
                 // Split execute nodes and present nodes
                 //-------------------------------------------------------------------------
 
-                int32_t firstPresentNodeIndex = FindPresentNodeIndex( executeSequences );
+                if ( m_cachedPresentNodeIndex < 0 )
+                {
+                    m_cachedPresentNodeIndex = FindPresentNodeIndex( executeSequences );
+                }
+
+                int32_t firstPresentNodeIndex = m_cachedPresentNodeIndex;
 
                 if ( firstPresentNodeIndex < 0 )
                 {
                     //EE_LOG_WARNING( "RenderGraph", "RenderGraph::Compile()", "RenderGraph has no presentable node!" );
+                    executeSequences.clear();
                     return false;
                 }
 
@@ -259,7 +287,6 @@ namespace EE
                 eastl::move( executeSequences.rbegin(), executeSequences.rbegin() + presentNodeCount, m_presentNodesSequence.begin() );
 
                 executeSequences.erase( executeSequences.rbegin(), executeSequences.rbegin() + presentNodeCount );
-                m_executeNodesSequence = eastl::move( executeSequences );
             }
             else
             {
@@ -407,6 +434,33 @@ namespace EE
             return handle;
         }
 
+        size_t RenderGraph::CalculateStructuralHash() const
+        {
+            size_t hash = m_resourceRegistry.CalculateRegisteredResourcesHash();
+            Hash::HashCombine( hash, m_renderGraph.size() );
+
+            auto HashNodeResources = [&hash] ( TVector<RGNodeResource> const& nodeResources )
+            {
+                Hash::HashCombine( hash, nodeResources.size() );
+                for ( RGNodeResource const& nodeResource : nodeResources )
+                {
+                    Hash::HashCombine( hash, nodeResource.m_slotID.m_id );
+                    Hash::HashCombine( hash, nodeResource.m_passAccess.GetCurrentAccess() );
+                    Hash::HashCombine( hash, nodeResource.m_passAccess.GetSkipSyncIfContinuous() );
+                }
+            };
+
+            for ( RGNode const& node : m_renderGraph )
+            {
+                Hash::HashCombine( hash, node.m_bHasPipeline );
+                Hash::HashCombine( hash, node.m_pipelineHandle.RawValue() );
+                HashNodeResources( node.m_inputs );
+                HashNodeResources( node.m_outputs );
+            }
+
+            return hash;
+        }
+
         int32_t RenderGraph::FindPresentNodeIndex( TVector<RGExecutableNode> const& executionSequence ) const
         {
             EE_ASSERT( Threading::IsMainThread() );
@@ -446,7 +500,7 @@ namespace EE
             // TODO: Batched barrier transition.
             //       It is more efficient to transition barrier all at once than one by one.
 
-            if ( access.GetSkipSyncIfContinuous() && access.GetCurrentAccess() == compiledResource.GetCurrentAccessState().GetCurrentAccess() )
+            if ( compiledResource.CanSkipTransition( access ) )
             {
                 return;
             }
@@ -478,7 +532,7 @@ namespace EE
                         0, nullptr
                     );
 
-                    compiledResource.GetCurrentAccessState().TransiteTo( nextBarrier[0] );
+                    compiledResource.TransiteTo( nextBarrier[0] );
                     break;
                 }
                 case RGResourceType::Texture:
@@ -508,7 +562,7 @@ namespace EE
                         1, &barrier
                     );
 
-                    compiledResource.GetCurrentAccessState().TransiteTo( nextBarrier[0] );
+                    compiledResource.TransiteTo( nextBarrier[0] );
                     break;
                 }
                 default:
@@ -530,8 +584,7 @@ namespace EE
             eastl::copy_if( transitionResources.begin(), transitionResources.end(), eastl::back_inserter(filteredTransitionResources), [] ( TPair<RGCompiledResource&, RHI::RenderResourceAccessState>& pair )
             { 
                 auto& [transitionResource, access] = pair;
-                return !( access.GetSkipSyncIfContinuous() &&
-                          access.GetCurrentAccess() == transitionResource.GetCurrentAccessState().GetCurrentAccess() );
+                return !transitionResource.CanSkipTransition( access );
             });
 
             TInlineVector<RHI::BufferBarrier, 32> bufferBarriers;
@@ -569,7 +622,7 @@ namespace EE
 
                         bufferBarriers.push_back( barrier );
 
-                        transitionResource.GetCurrentAccessState().TransiteTo( barrierTransitions[currentTransition].second );
+                        transitionResource.TransiteTo( barrierTransitions[currentTransition].second );
                         break;
                     }
                     case RGResourceType::Texture:
@@ -592,7 +645,7 @@ namespace EE
 
                         textureBarriers.push_back( barrier );
 
-                        transitionResource.GetCurrentAccessState().TransiteTo( barrierTransitions[currentTransition].second );
+                        transitionResource.TransiteTo( barrierTransitions[currentTransition].second );
                         break;
                     }
                     default:
@@ -6,6 +6,7 @@
 #include "RenderGraphNodeBuilder.h"
 #include "RenderGraphContext.h"
 #include "RenderGraphResourceRegistry.h"
+#include "RenderGraphResolver.h"
 #include "Base/Types/Arrays.h"
 #include "Base/Types/Tuple.h"
 #include "Base/Types/String.h"
@@ -76,6 +77,10 @@ namespace EE::RG
 
         bool Compile( Render::RenderDevice* pDevice );
 
+        // Compilations that reused the resolved lifetimes and aliasing plan of the previous compilation
+        inline uint64_t GetNumCompileCacheHits() const { return m_numCompileCacheHits; }
+        inline uint64_t GetNumCompileCacheMisses() const { return m_numCompileCacheMisses; }
+
         // Execution Stage
         //-------------------------------------------------------------------------
 
@@ -103,6 +108,10 @@ namespace EE::RG
         // Return -1 if failed to find the presentable node.
         int32_t FindPresentNodeIndex( TVector<RGExecutableNode> const& executionSequence ) const;
 
+        // Hash of the nodes (pipelines, resources and accesses) and of the registered resources.
+        // Graphs with the same structural hash resolve to the same resource lifetimes and execution sequence split.
+        size_t CalculateStructuralHash() const;
+
         void TransitionResource( RGCompiledResource& compiledResource, RHI::RenderResourceAccessState const& access );
         void TransitionResourceBatched( TSpan<TPair<RGCompiledResource&, RHI::RenderResourceAccessState>> transitionResources );
 
@@ -129,6 +138,15 @@ namespace EE::RG
         // Note: this render command context will match exact the device frame index.
         RGRenderCommandContext                  m_renderCommandContexts[RHI::RHIDevice::NumDeviceFramebufferCount];
         uint32_t                                m_currentDeviceFrameIndex;
+
+        // Compile cache, most frames build a graph with the same structure as the previous frame
+        size_t                                  m_compiledStructuralHash = 0;
+        bool                                    m_bIsCompileCacheValid = false;
+        RGResolveResult                         m_cachedResolveResult;
+        RGTransientAliasingPlan                 m_cachedAliasingPlan;
+        int32_t                                 m_cachedPresentNodeIndex = -1;
+        uint64_t                                m_numCompileCacheHits = 0;
+        uint64_t                                m_numCompileCacheMisses = 0;
 	};
 
 	//-------------------------------------------------------------------------
@@ -125,6 +125,20 @@ namespace EE::RG
         return compiled;
     }
 
+    RGCompiledResource RGResource::CompileAsAlias( RGCompiledResource const& physicalResource ) &&
+    {
+        EE_ASSERT( !IsNamedResource() && !IsImportedResource() );
+        EE_ASSERT( GetResourceType() == physicalResource.GetResourceType() );
+
+        RGCompiledResource compiled;
+        compiled.m_resource = physicalResource.m_resource;
+        compiled.m_currentAccessState = RHI::RenderResourceAccessState{ RHI::RenderResourceBarrierState::Undefined };
+        compiled.m_name = eastl::move( m_name );
+        compiled.m_desc = eastl::exchange( m_desc, {} );
+        compiled.m_bIsNamedResource = false;
+        return compiled;
+    }
+
     //-------------------------------------------------------------------------
 
     void RGCompiledResource::Retire( RGResourceRegistry& resourceRegistry, RGTransientResourceCache& cache )
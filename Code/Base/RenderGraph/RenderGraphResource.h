@@ -363,6 +363,9 @@ namespace EE::RG
         // You must give out the ownership of origin resource to get a compiled resource.
         RGCompiledResource Compile( Render::RenderDevice* pDevice, RGResourceRegistry& registry, RGTransientResourceCache& cache ) &&;
 
+        // Compile a transient resource that reuses the rhi resource of an already compiled transient resource with a non-overlapping lifetime.
+        RGCompiledResource CompileAsAlias( RGCompiledResource const& physicalResource ) &&;
+
         inline bool IsNamedResource() const { return m_bIsNamedResource; }
 
     public:
@@ -424,6 +427,16 @@ namespace EE::RG
         }
     };
 
+    class RGCompiledResource;
+
+    // The access state of an aliased physical resource, shared by all the compiled resources in the same aliasing slot
+    struct RGAliasedResourceState
+    {
+        RHI::RenderResourceAccessState                                  m_accessState = RHI::RenderResourceAccessState{ RHI::RenderResourceBarrierState::Undefined };
+        // The compiled resource that last transitioned the shared access state
+        RGCompiledResource const*                                       m_pLastUser = nullptr;
+    };
+
     class RGCompiledResource
     {
         friend class RGResource;
@@ -469,8 +482,42 @@ namespace EE::RG
         inline bool IsImportedResource() const { return m_importedResource.has_value(); }
         inline bool IsSwapchainImportedResource() const { return m_importedResource.has_value() && m_importedResource->m_pImportedResource == nullptr; }
 
-        inline RHI::RenderResourceAccessState& GetCurrentAccessState() { return m_currentAccessState; }
-        inline RHI::RenderResourceAccessState const& GetCurrentAccessState() const { return m_currentAccessState; }
+        // Aliased resources share the access state of their physical resource, so that the first barrier of a resource waits on the previous user of the same memory
+        inline RHI::RenderResourceAccessState& GetCurrentAccessState() { return ( m_pAliasedState != nullptr ) ? m_pAliasedState->m_accessState : m_currentAccessState; }
+        inline RHI::RenderResourceAccessState const& GetCurrentAccessState() const { return ( m_pAliasedState != nullptr ) ? m_pAliasedState->m_accessState : m_currentAccessState; }
+
+        inline bool IsAliasedResource() const { return m_pAliasedState != nullptr; }
+
+        // Share the access state of an aliased physical resource, only the owner returns the physical resource to the transient cache
+        inline void SetAliasedState( RGAliasedResourceState* pAliasedState, bool ownsAliasedResource )
+        {
+            EE_ASSERT( pAliasedState != nullptr );
+            m_pAliasedState = pAliasedState;
+            m_bOwnsAliasedResource = ownsAliasedResource;
+        }
+
+        // Can the barrier to this access be skipped since the resource is already in the same access state.
+        // The access state of an aliased resource might have been set by a different resource using the same memory, which always needs a barrier.
+        inline bool CanSkipTransition( RHI::RenderResourceAccessState const& access ) const
+        {
+            if ( m_pAliasedState != nullptr && m_pAliasedState->m_pLastUser != this )
+            {
+                return false;
+            }
+
+            return access.GetSkipSyncIfContinuous() && access.GetCurrentAccess() == GetCurrentAccessState().GetCurrentAccess();
+        }
+
+        // Update the current access state once the barrier has been recorded
+        inline void TransiteTo( RHI::RenderResourceBarrierState nextAccess )
+        {
+            GetCurrentAccessState().TransiteTo( nextAccess );
+
+            if ( m_pAliasedState != nullptr )
+            {
+                m_pAliasedState->m_pLastUser = this;
+            }
+        }
 
         //-------------------------------------------------------------------------
 
@@ -498,6 +545,11 @@ namespace EE::RG
 
         RGResourceLifetime                                              m_lifetime;
         bool                                                            m_bIsNamedResource;
+
+        // Set when this transient resource shares its physical resource with other transient resources (owned by the resource registry)
+        RGAliasedResourceState*                                         m_pAliasedState = nullptr;
+        // Only the first user of an aliased physical resource returns it to the transient cache
+        bool                                                            m_bOwnsAliasedResource = false;
     };
 
     template <typename Tag, typename DescType, typename DescConstRefType>
@@ -2,10 +2,11 @@
 #include "RenderGraphResolver.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Render/RenderDevice.h"
+#include "Base/Encoding/Hash.h"
 
 namespace EE::RG
 {
-    bool RGResourceRegistry::Compile( Render::RenderDevice* pDevice, RGResolveResult const& result )
+    bool RGResourceRegistry::Compile( Render::RenderDevice* pDevice, RGResolveResult const& result, RGTransientAliasingPlan const& aliasingPlan )
     {
         EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( m_resourceState == ResourceState::Registering );
@@ -15,6 +16,24 @@ namespace EE::RG
             return false;
         }
 
+        EE_ASSERT( aliasingPlan.m_resourceSlots.size() == m_registeredResources.size() );
+
+        if ( aliasingPlan.m_peakMemoryWithoutAliasing != m_lastPeakMemoryWithoutAliasing || aliasingPlan.m_peakMemoryWithAliasing != m_lastPeakMemoryWithAliasing )
+        {
+            m_lastPeakMemoryWithoutAliasing = aliasingPlan.m_peakMemoryWithoutAliasing;
+            m_lastPeakMemoryWithAliasing = aliasingPlan.m_peakMemoryWithAliasing;
+            EE_LOG_INFO( "RenderGraph", "RGResourceRegistry::Compile()", "Transient resources: %d resources in %d physical resources, peak memory %.2fMB -> %.2fMB", aliasingPlan.m_numPlannedResources, aliasingPlan.m_numSlots, m_lastPeakMemoryWithoutAliasing / ( 1024.0f * 1024.0f ), m_lastPeakMemoryWithAliasing / ( 1024.0f * 1024.0f ) );
+        }
+
+        // Note: compiled resources keep a pointer to these, so they must not be reallocated until the resources are retired
+        m_aliasedStates.clear();
+        m_aliasedStates.resize( aliasingPlan.m_numSlots );
+        TVector<int32_t> aliasedSlotOwners( aliasingPlan.m_numSlots, RGTransientAliasingPlan::s_invalidSlot );
+
+        // Create actual RHI Resources
+        //-------------------------------------------------------------------------
+
+        // Note: aliased states keep a pointer to their last user, so the compiled resources must not be reallocated either
         m_compiledResources.reserve( m_registeredResources.size() );
 
         for ( uint32_t i = 0; i < static_cast<uint32_t>( m_registeredResources.size() ); ++i )
@@ -24,8 +43,31 @@ namespace EE::RG
             auto iterator = result.m_resourceLifetimes.find( i );
             if ( iterator != result.m_resourceLifetimes.end() )
             {
-                auto& compiledResource = m_compiledResources.emplace_back( eastl::move( rgResource ).Compile( pDevice, *this, m_transientResourceCache ) );
-                compiledResource.m_lifetime = iterator->second;
+                int32_t const slotIdx = aliasingPlan.m_resourceSlots[i];
+                if ( slotIdx == RGTransientAliasingPlan::s_invalidSlot )
+                {
+                    auto& compiledResource = m_compiledResources.emplace_back( eastl::move( rgResource ).Compile( pDevice, *this, m_transientResourceCache ) );
+                    compiledResource.m_lifetime = iterator->second;
+                }
+                else if ( aliasedSlotOwners[slotIdx] == RGTransientAliasingPlan::s_invalidSlot )
+                {
+                    aliasedSlotOwners[slotIdx] = (int32_t) i;
+                    auto& compiledResource = m_compiledResources.emplace_back( eastl::move( rgResource ).Compile( pDevice, *this, m_transientResourceCache ) );
+                    compiledResource.m_lifetime = iterator->second;
+                    compiledResource.SetAliasedState( &m_aliasedStates[slotIdx], true );
+                }
+                else if ( !CanShareResource( rgResource, m_compiledResources[aliasedSlotOwners[slotIdx]] ) )
+                {
+                    // A reused plan should never alias resources with different descriptions, but a hash collision can't be ruled out
+                    auto& compiledResource = m_compiledResources.emplace_back( eastl::move( rgResource ).Compile( pDevice, *this, m_transientResourceCache ) );
+                    compiledResource.m_lifetime = iterator->second;
+                }
+                else
+                {
+                    auto& compiledResource = m_compiledResources.emplace_back( eastl::move( rgResource ).CompileAsAlias( m_compiledResources[aliasedSlotOwners[slotIdx]] ) );
+                    compiledResource.m_lifetime = iterator->second;
+                    compiledResource.SetAliasedState( &m_aliasedStates[slotIdx], false );
+                }
             }
             else
             {
@@ -43,6 +85,95 @@ namespace EE::RG
         return true;
     }
 
+    bool RGResourceRegistry::CanShareResource( RGResource const& rgResource, RGCompiledResource const& physicalResource )
+    {
+        if ( rgResource.GetResourceType() != physicalResource.GetResourceType() )
+        {
+            return false;
+        }
+
+        switch ( rgResource.GetResourceType() )
+        {
+            case RGResourceType::Buffer:
+            return rgResource.GetDesc<RGResourceTagBuffer>().m_desc == physicalResource.GetDesc<RGResourceTagBuffer>().m_desc;
+
+            case RGResourceType::Texture:
+            return rgResource.GetDesc<RGResourceTagTexture>().m_desc == physicalResource.GetDesc<RGResourceTagTexture>().m_desc;
+
+            default:
+            return false;
+        }
+    }
+
+    size_t RGResourceRegistry::CalculateRegisteredResourcesHash() const
+    {
+        size_t hash = 0;
+        Hash::HashCombine( hash, m_registeredResources.size() );
+
+        for ( auto const& rgResource : m_registeredResources )
+        {
+            Hash::HashCombine( hash, rgResource.GetResourceType() );
+            Hash::HashCombine( hash, rgResource.IsNamedResource() );
+            Hash::HashCombine( hash, rgResource.IsImportedResource() );
+            Hash::HashCombine( hash, rgResource.IsImportedResource() && rgResource.GetImportedResource().m_pImportedResource == nullptr );
+            Hash::HashCombine( hash, rgResource.m_name );
+
+            switch ( rgResource.GetResourceType() )
+            {
+                case RGResourceType::Buffer:
+                Hash::HashCombine( hash, rgResource.GetDesc<RGResourceTagBuffer>().m_desc.GetHash() );
+                break;
+
+                case RGResourceType::Texture:
+                Hash::HashCombine( hash, rgResource.GetDesc<RGResourceTagTexture>().m_desc.GetHash() );
+                break;
+
+                default:
+                break;
+            }
+        }
+
+        return hash;
+    }
+
+    RGTransientAliasingPlan RGResourceRegistry::CreateTransientAliasingPlan( RGResolveResult const& result ) const
+    {
+        RGTransientAliasingPlanner planner;
+
+        for ( uint32_t i = 0; i < static_cast<uint32_t>( m_registeredResources.size() ); ++i )
+        {
+            auto const& rgResource = m_registeredResources[i];
+
+            // Named resources live across frames and imported resources are not owned by the render graph
+            if ( rgResource.IsNamedResource() || rgResource.IsImportedResource() )
+            {
+                continue;
+            }
+
+            auto iterator = result.m_resourceLifetimes.find( i );
+            if ( iterator == result.m_resourceLifetimes.end() || !iterator->second.HasValidLifetime() )
+            {
+                continue;
+            }
+
+            switch ( rgResource.GetResourceType() )
+            {
+                case RGResourceType::Buffer:
+                planner.AddBuffer( i, rgResource.GetDesc<RGResourceTagBuffer>().m_desc, iterator->second );
+                break;
+
+                case RGResourceType::Texture:
+                planner.AddTexture( i, rgResource.GetDesc<RGResourceTagTexture>().m_desc, iterator->second );
+                break;
+
+                default:
+                break;
+            }
+        }
+
+        return planner.CreatePlan( static_cast<uint32_t>( m_registeredResources.size() ) );
+    }
+
     void RGResourceRegistry::Retire()
     {
         EE_ASSERT( Threading::IsMainThread() );
@@ -50,6 +181,12 @@ namespace EE::RG
 
         for ( auto& resource : m_compiledResources )
         {
+            // Aliased rhi resources are only returned to the cache once
+            if ( resource.IsAliasedResource() && !resource.m_bOwnsAliasedResource )
+            {
+                continue;
+            }
+
             if ( resource.m_lifetime.HasValidLifetime() )
             {
                 resource.Retire( *this, m_transientResourceCache );
@@ -58,6 +195,7 @@ namespace EE::RG
 
         m_registeredResources.clear();
         m_compiledResources.clear();
+        m_aliasedStates.clear();
         m_exportableResources.clear();
         // one frame draw end, render graph go back to origin state
         m_resourceState = ResourceState::Registering;
@@ -4,6 +4,7 @@
 #include "RenderGraphNode.h"
 #include "RenderGraphNodeRef.h"
 #include "RenderGraphTransientResourceCache.h"
+#include "RenderGraphTransientAliasing.h"
 #include "Base/Types/Arrays.h"
 #include "Base/Types/String.h"
 #include "Base/Types/HashMap.h"
@@ -61,10 +62,20 @@ namespace EE::RG
 
         inline ResourceState GetCurrentResourceState() const { return m_resourceState; }
 
+        inline size_t GetNumRegisteredResources() const { return m_registeredResources.size(); }
+
+        // Hash of the description, type and name of all registered resources.
+        // Together with the graph nodes, this identifies graphs that will resolve to the same lifetimes and aliasing plan.
+        size_t CalculateRegisteredResourcesHash() const;
+
+        // Plan which transient resources can share the same rhi resource, only depends on the registered resources and the resolved lifetimes.
+        RGTransientAliasingPlan CreateTransientAliasingPlan( RGResolveResult const& result ) const;
+
         // Compile all registered resources into executable resources.
         // Use RGDescType to fetch internal RHIResourceDesc and create actual RHIResource.
+        // Transient resources with non-overlapping lifetimes share the same rhi resource (see RGTransientAliasingPlanner).
         // Created transient rhi resources will be cached in transient resource cache.
-        bool Compile( Render::RenderDevice* pDevice, RGResolveResult const& result );
+        bool Compile( Render::RenderDevice* pDevice, RGResolveResult const& result, RGTransientAliasingPlan const& aliasingPlan );
 
         void Retire();
 
@@ -159,6 +170,8 @@ namespace EE::RG
 
         TVector<RGResource> const& GetRegisteredResources() const { return m_registeredResources; };
 
+        static bool CanShareResource( RGResource const& rgResource, RGCompiledResource const& physicalResource );
+
         // Named resource is exportable resource.
         inline bool IsExportableResource( _Impl::RGResourceID const& id ) const { return m_registeredResources[id.m_id].IsNamedResource(); }
 
@@ -175,6 +188,11 @@ namespace EE::RG
 
         TVector<RGCompiledResource>                             m_compiledResources;
 
+        // Access state (and last user) per aliased physical resource, shared by all the compiled resources in the same aliasing slot
+        TVector<RGAliasedResourceState>                         m_aliasedStates;
+        uint64_t                                                m_lastPeakMemoryWithoutAliasing = 0;
+        uint64_t                                                m_lastPeakMemoryWithAliasing = 0;
+
         RGTransientResourceCache                                m_transientResourceCache;
     };
 
@@ -268,7 +286,7 @@ namespace EE::RG
     
         if ( m_resourceState == ResourceState::Compiled )
         {
-            return m_compiledResources[nodeResourceRef.m_slotID.m_id].m_currentAccessState.GetCurrentAccess();
+            return m_compiledResources[nodeResourceRef.m_slotID.m_id].GetCurrentAccessState().GetCurrentAccess();
         }
 
         EE_LOG_WARNING( "RenderGraph", "", "Try to fetch compiled resource but resources are not in compiled state!" );
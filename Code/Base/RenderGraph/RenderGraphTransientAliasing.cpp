@@ -0,0 +1,158 @@
+#include "RenderGraphTransientAliasing.h"
+#include "Base/Math/Math.h"
+#include <EASTL/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::RG
+{
+    uint64_t RGTransientAliasingPlanner::EstimateMemorySize( RHI::RHIBufferCreateDesc const& desc )
+    {
+        // Note: the allocated size is only known by the rhi resource, descriptions built by the render graph only contain the requested size
+        return desc.m_desireSize;
+    }
+
+    uint64_t RGTransientAliasingPlanner::EstimateMemorySize( RHI::RHITextureCreateDesc const& desc )
+    {
+        uint64_t size = 0;
+        uint32_t width = Math::Max( desc.m_width, 1u );
+        uint32_t height = Math::Max( desc.m_height, 1u );
+        uint32_t depth = Math::Max( desc.m_depth, 1u );
+
+        uint32_t const numMips = Math::Max( (uint32_t) desc.m_mipmap, 1u );
+        for ( uint32_t i = 0; i < numMips; i++ )
+        {
+            uint32_t numBytes = 0;
+            uint32_t numBytesPerRow = 0;
+            RHI::GetPixelFormatByteSize( width, height, desc.m_format, numBytes, numBytesPerRow );
+            size += uint64_t( numBytes ) * depth;
+
+            width = Math::Max( width / 2, 1u );
+            height = Math::Max( height / 2, 1u );
+            depth = Math::Max( depth / 2, 1u );
+        }
+
+        return size * Math::Max( desc.m_array, 1u );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RGTransientAliasingPlanner::AddBuffer( uint32_t resourceIdx, RHI::RHIBufferCreateDesc const& desc, RGResourceLifetime const& lifetime )
+    {
+        EE_ASSERT( lifetime.HasValidLifetime() );
+
+        auto& request = m_requests.emplace_back();
+        request.m_resourceIdx = resourceIdx;
+        request.m_type = RGResourceType::Buffer;
+        request.m_pBufferDesc = &desc;
+        request.m_lifetime = lifetime;
+        request.m_estimatedSize = EstimateMemorySize( desc );
+    }
+
+    void RGTransientAliasingPlanner::AddTexture( uint32_t resourceIdx, RHI::RHITextureCreateDesc const& desc, RGResourceLifetime const& lifetime )
+    {
+        EE_ASSERT( lifetime.HasValidLifetime() );
+
+        auto& request = m_requests.emplace_back();
+        request.m_resourceIdx = resourceIdx;
+        request.m_type = RGResourceType::Texture;
+        request.m_pTextureDesc = &desc;
+        request.m_lifetime = lifetime;
+        request.m_estimatedSize = EstimateMemorySize( desc );
+    }
+
+    bool RGTransientAliasingPlanner::AreCompatible( Request const& lhs, Request const& rhs ) const
+    {
+        if ( lhs.m_type != rhs.m_type )
+        {
+            return false;
+        }
+
+        if ( lhs.m_type == RGResourceType::Buffer )
+        {
+            return *lhs.m_pBufferDesc == *rhs.m_pBufferDesc;
+        }
+
+        return *lhs.m_pTextureDesc == *rhs.m_pTextureDesc;
+    }
+
+    RGTransientAliasingPlan RGTransientAliasingPlanner::CreatePlan( uint32_t numResources ) const
+    {
+        RGTransientAliasingPlan plan;
+        plan.m_resourceSlots.resize( numResources, RGTransientAliasingPlan::s_invalidSlot );
+        plan.m_numPlannedResources = (int32_t) m_requests.size();
+
+        if ( m_requests.empty() )
+        {
+            return plan;
+        }
+
+        // Visit the requests in order of first use
+        //-------------------------------------------------------------------------
+
+        TVector<uint32_t> sortedRequests;
+        sortedRequests.resize( m_requests.size() );
+        for ( uint32_t i = 0; i < (uint32_t) m_requests.size(); i++ )
+        {
+            sortedRequests[i] = i;
+        }
+
+        auto SortPredicate = [this] ( uint32_t lhs, uint32_t rhs )
+        {
+            Request const& lhsRequest = m_requests[lhs];
+            Request const& rhsRequest = m_requests[rhs];
+            if ( lhsRequest.m_lifetime.m_lifeStartTimePoint != rhsRequest.m_lifetime.m_lifeStartTimePoint )
+            {
+                return lhsRequest.m_lifetime.m_lifeStartTimePoint < rhsRequest.m_lifetime.m_lifeStartTimePoint;
+            }
+
+            return lhsRequest.m_resourceIdx < rhsRequest.m_resourceIdx;
+        };
+
+        eastl::sort( sortedRequests.begin(), sortedRequests.end(), SortPredicate );
+
+        // Greedy interval coloring, reuse the compatible slot that has been free for the shortest time
+        //-------------------------------------------------------------------------
+
+        TVector<Slot> slots;
+
+        for ( uint32_t requestIdx : sortedRequests )
+        {
+            Request const& request = m_requests[requestIdx];
+            plan.m_peakMemoryWithoutAliasing += request.m_estimatedSize;
+
+            int32_t selectedSlotIdx = RGTransientAliasingPlan::s_invalidSlot;
+            for ( int32_t slotIdx = 0; slotIdx < (int32_t) slots.size(); slotIdx++ )
+            {
+                Slot const& slot = slots[slotIdx];
+                if ( slot.m_lifeEndTimePoint >= request.m_lifetime.m_lifeStartTimePoint )
+                {
+                    continue;
+                }
+
+                if ( !AreCompatible( m_requests[slot.m_firstRequestIdx], request ) )
+                {
+                    continue;
+                }
+
+                if ( selectedSlotIdx == RGTransientAliasingPlan::s_invalidSlot || slot.m_lifeEndTimePoint > slots[selectedSlotIdx].m_lifeEndTimePoint )
+                {
+                    selectedSlotIdx = slotIdx;
+                }
+            }
+
+            if ( selectedSlotIdx == RGTransientAliasingPlan::s_invalidSlot )
+            {
+                selectedSlotIdx = (int32_t) slots.size();
+                slots.emplace_back().m_firstRequestIdx = requestIdx;
+                plan.m_peakMemoryWithAliasing += request.m_estimatedSize;
+            }
+
+            slots[selectedSlotIdx].m_lifeEndTimePoint = request.m_lifetime.m_lifeEndTimePoint;
+            plan.m_resourceSlots[request.m_resourceIdx] = selectedSlotIdx;
+        }
+
+        plan.m_numSlots = (int32_t) slots.size();
+        return plan;
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "RenderGraphResource.h"
+#include "Base/Types/Arrays.h"
+#include "Base/RHI/Resource/RHIResourceCreationCommons.h"
+
+//-------------------------------------------------------------------------
+// Transient Resource Aliasing
+//-------------------------------------------------------------------------
+// Temporary render graph resources only need to exist between their first and last use in the graph.
+// The planner colors the interval graph built from these lifetimes, so that resources whose lifetimes dont overlap share a single physical resource.
+// The RHI doesnt expose memory heaps, so only resources with identical create descriptions can share the same physical resource.
+// The planner only works on descriptions and lifetimes, it never touches the device.
+
+namespace EE::RG
+{
+    struct RGTransientAliasingPlan
+    {
+        constexpr static int32_t const s_invalidSlot = -1;
+
+    public:
+
+        inline bool IsAliased( uint32_t resourceIdx ) const { return resourceIdx < m_resourceSlots.size() && m_resourceSlots[resourceIdx] != s_invalidSlot; }
+
+    public:
+
+        // Physical slot per registered resource, invalid for resources that were not added to the planner
+        TVector<int32_t>                    m_resourceSlots;
+        int32_t                             m_numSlots = 0;
+        int32_t                             m_numPlannedResources = 0;
+
+        // Estimated memory needed by all transient resources when each of them gets its own physical resource
+        uint64_t                            m_peakMemoryWithoutAliasing = 0;
+
+        // Estimated memory needed by all the physical slots
+        uint64_t                            m_peakMemoryWithAliasing = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API RGTransientAliasingPlanner
+    {
+        struct Request
+        {
+            uint32_t                                m_resourceIdx = 0;
+            RGResourceType                          m_type = RGResourceType::Unknown;
+            RHI::RHIBufferCreateDesc const*         m_pBufferDesc = nullptr;
+            RHI::RHITextureCreateDesc const*        m_pTextureDesc = nullptr;
+            RGResourceLifetime                      m_lifetime;
+            uint64_t                                m_estimatedSize = 0;
+        };
+
+        struct Slot
+        {
+            uint32_t                                m_firstRequestIdx = 0;
+            int32_t                                 m_lifeEndTimePoint = -1;
+        };
+
+    public:
+
+        static uint64_t EstimateMemorySize( RHI::RHIBufferCreateDesc const& desc );
+        static uint64_t EstimateMemorySize( RHI::RHITextureCreateDesc const& desc );
+
+    public:
+
+        // The descriptions need to stay valid until the plan is created
+        void AddBuffer( uint32_t resourceIdx, RHI::RHIBufferCreateDesc const& desc, RGResourceLifetime const& lifetime );
+        void AddTexture( uint32_t resourceIdx, RHI::RHITextureCreateDesc const& desc, RGResourceLifetime const& lifetime );
+
+        // Assign a physical slot to every added resource, numResources is the total number of registered resources
+        RGTransientAliasingPlan CreatePlan( uint32_t numResources ) const;
+
+        inline void Reset() { m_requests.clear(); }
+
+    private:
+
+        bool AreCompatible( Request const& lhs, Request const& rhs ) const;
+
+    private:
+
+        TVector<Request>                            m_requests;
+    };
+}
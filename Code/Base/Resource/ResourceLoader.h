@@ -56,6 +56,16 @@ namespace EE
             // Can this loader proceed when an install dependency fails to load? Certain resource should still be loaded if some of their dependencies fail (i.e. still load a mesh if a material fails to load)
             virtual bool CanProceedWithFailedInstallDependency() const { return false; }
 
+            #if EE_DEVELOPMENT_TOOLS
+            // Can resources of this type be hot-reloaded in place? The new version is loaded alongside the old one and then swapped behind the existing resource ptrs.
+            // Only enable this if users of the resource can safely pick up the new data by being re-initialized, instead of being fully unloaded and reloaded.
+            virtual bool SupportsInPlaceReload() const { return false; }
+
+            // Called when one of the install dependencies (direct or indirect) of a loaded resource was reloaded in place
+            // This allows the resource to rebuild any data that was derived from the dependency's old data
+            virtual void OnInstallDependencyReloadedInPlace( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const {}
+            #endif
+
             // This function loads is responsible to deserialize the compiled resource data, read the resource header for install dependencies and to create the new runtime resource object
             bool Load( ResourceID const& resourceID, Blob& rawData, ResourceRecord* pResourceRecord ) const;
 
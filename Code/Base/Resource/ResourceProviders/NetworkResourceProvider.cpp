@@ -5,6 +5,7 @@
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/Profiling.h"
 #include "Base/Imgui/ImguiX.h"
+#include "Base/Math/Math.h"
 
 //-------------------------------------------------------------------------
 
@@ -36,26 +37,54 @@ namespace EE::Resource
     void NetworkResourceProvider::RequestRawResource( ResourceRequest* pRequest )
     {
         EE_ASSERT( pRequest != nullptr && pRequest->IsValid() && pRequest->GetLoadingStatus() == LoadingStatus::Loading );
-
-        #if EE_DEVELOPMENT_TOOLS
-        auto predicate = [] ( ResourceRequest* pRequest, ResourceID const& resourceID ) { return pRequest->GetResourceID() == resourceID; };
-        auto foundIter = VectorFind( m_sentRequests, pRequest->GetResourceID(), predicate );
-        EE_ASSERT( foundIter == m_sentRequests.end() );
-        #endif
+        EE_ASSERT( m_sentRequests.find( pRequest->GetResourceID() ) == m_sentRequests.end() );
 
         //-------------------------------------------------------------------------
 
-        m_pendingRequests.emplace_back( pRequest );
+        RequestPriority priority = RequestPriority::Low;
+
+        ResourceRequesterID const& requesterID = pRequest->GetRequesterID();
+        if ( requesterID.IsToolsRequest() )
+        {
+            priority = RequestPriority::High;
+        }
+        else if ( requesterID.IsInstallDependencyRequest() )
+        {
+            priority = RequestPriority::Medium;
+        }
+
+        m_pendingRequests[(int32_t) priority].emplace_back( pRequest );
     }
 
     void NetworkResourceProvider::CancelRequest( ResourceRequest* pRequest )
     {
         EE_ASSERT( pRequest != nullptr && pRequest->IsValid() );
 
-        auto foundIter = VectorFind( m_sentRequests, pRequest );
-        EE_ASSERT( foundIter != m_sentRequests.end() );
+        // Remove from the in-flight table
+        auto foundIter = m_sentRequests.find( pRequest->GetResourceID() );
+        if ( foundIter != m_sentRequests.end() )
+        {
+            EE_ASSERT( foundIter->second.m_pRequest == pRequest );
+            if ( foundIter->second.m_isInFlight )
+            {
+                m_numInFlightRequests--;
+            }
+            m_sentRequests.erase( foundIter );
+            return;
+        }
+
+        // The request might not have been sent yet
+        for ( auto& pendingRequests : m_pendingRequests )
+        {
+            auto pendingIter = VectorFind( pendingRequests, pRequest );
+            if ( pendingIter != pendingRequests.end() )
+            {
+                pendingRequests.erase( pendingIter );
+                return;
+            }
+        }
 
-        m_sentRequests.erase_unsorted( foundIter );
+        EE_UNREACHABLE_CODE();
     }
 
     void NetworkResourceProvider::Update()
@@ -83,11 +112,15 @@ namespace EE::Resource
                 EE_LOG_FATAL_ERROR( "Resource", "Network Resource Provider", "Lost connection to resource server" );
                 m_networkFailureDetected = true;
             }
+
+            // We will never get a response, so dont leave anyone waiting on their requests
+            FailAllRequests( "Lost connection to resource server" );
             return;
         }
 
         // Check for any network messages
         //-------------------------------------------------------------------------
+        // Results are handed back to their requests as soon as we read them, freeing up space in the in-flight window
 
         auto ProcessMessageFunction = [this] ( Network::IPC::Message const& message )
         {
@@ -96,7 +129,10 @@ namespace EE::Resource
                 case NetworkMessageID::ResourceRequestComplete:
                 {
                     NetworkResourceResponse response = message.GetData<NetworkResourceResponse>();
-                    m_serverResults.insert( m_serverResults.end(), response.m_results.begin(), response.m_results.end() );
+                    for ( auto const& result : response.m_results )
+                    {
+                        ProcessServerResult( result );
+                    }
                 }
                 break;
 
@@ -119,74 +155,154 @@ namespace EE::Resource
 
         m_networkClient.ProcessIncomingMessages( ProcessMessageFunction );
 
-        // Send all requests and keep-alive messages
+        // Send requests
         //-------------------------------------------------------------------------
 
-        if ( !m_pendingRequests.empty() )
+        ReleaseTimedOutRequests();
+        SendPendingRequests();
+    }
+
+    void NetworkResourceProvider::ProcessServerResult( NetworkResourceResponse::Result const& result )
+    {
+        auto foundIter = m_sentRequests.find( result.m_resourceID );
+
+        // This might have been a canceled request
+        if ( foundIter == m_sentRequests.end() )
+        {
+            return;
+        }
+
+        ResourceRequest* pFoundRequest = foundIter->second.m_pRequest;
+        EE_ASSERT( pFoundRequest->IsValid() );
+
+        // Remove from in-flight table
+        if ( foundIter->second.m_isInFlight )
+        {
+            m_numInFlightRequests--;
+        }
+        m_sentRequests.erase( foundIter );
+
+        // Ignore any responses for requests that may have been canceled or are unloading
+        if ( pFoundRequest->GetLoadingStatus() != LoadingStatus::Loading )
         {
-            NetworkResourceRequest request;
+            return;
+        }
+
+        // Trigger tools notification on failure
+        if ( result.m_filePath.empty() )
+        {
+            ImGuiX::NotifyError( "%s failed to Compile!\n\nLog: %s", result.m_resourceID.c_str(), result.m_log.c_str() );
+        }
 
-            // Process all pending requests
-            for ( auto pRequest : m_pendingRequests )
+        // If the request has a filepath set, the compilation was a success
+        pFoundRequest->OnRawResourceRequestComplete( result.m_filePath, result.m_log );
+    }
+
+    void NetworkResourceProvider::SendPendingRequests()
+    {
+        int32_t const numAvailableSlots = s_maxInFlightRequests - m_numInFlightRequests;
+        if ( numAvailableSlots <= 0 )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        NetworkResourceRequest request;
+        int32_t numRequestsSent = 0;
+
+        auto SendRequestMessage = [this, &request] ()
+        {
+            Network::IPC::Message requestResourceMessage( (int32_t) NetworkMessageID::RequestResource, request );
+            m_networkClient.SendMessageToServer( eastl::move( requestResourceMessage ) );
+            request.m_resourceIDs.clear();
+        };
+
+        // Fill the available window in priority order, keeping the arrival order within each priority
+        Seconds const currentTime = PlatformClock::GetTimeInSeconds();
+        for ( auto& pendingRequests : m_pendingRequests )
+        {
+            int32_t const numToSend = Math::Min( (int32_t) pendingRequests.size(), numAvailableSlots - numRequestsSent );
+            for ( int32_t i = 0; i < numToSend; i++ )
             {
+                ResourceRequest* pRequest = pendingRequests[i];
                 request.m_resourceIDs.emplace_back( pRequest->GetResourceID() );
-                m_sentRequests.emplace_back( pRequest );
+                m_sentRequests.insert( { pRequest->GetResourceID(), SentRequest{ pRequest, currentTime } } );
 
-                // Try to limit the size of the network messages so we limit each message to 128 request
-                if ( request.m_resourceIDs.size() == 128 )
+                // Try to limit the size of the network messages
+                if ( request.m_resourceIDs.size() == s_maxRequestsPerMessage )
                 {
-                    Network::IPC::Message requestResourceMessage( (int32_t) NetworkMessageID::RequestResource, request );
-                    m_networkClient.SendMessageToServer( eastl::move( requestResourceMessage ) );
-                    request.m_resourceIDs.clear();
+                    SendRequestMessage();
                 }
             }
-            m_pendingRequests.clear();
 
-            // Send any remaining requests
-            if ( request.m_resourceIDs.size() > 0 )
+            pendingRequests.erase( pendingRequests.begin(), pendingRequests.begin() + numToSend );
+            numRequestsSent += numToSend;
+            m_numInFlightRequests += numToSend;
+
+            if ( numRequestsSent == numAvailableSlots )
             {
-                Network::IPC::Message requestResourceMessage( (int32_t) NetworkMessageID::RequestResource, request );
-                m_networkClient.SendMessageToServer( eastl::move( requestResourceMessage ) );
+                break;
             }
         }
 
-        // Process all server results
-        //-------------------------------------------------------------------------
-
-        for ( auto& result : m_serverResults )
+        // Send any remaining requests
+        if ( !request.m_resourceIDs.empty() )
         {
-            auto predicate = [] ( ResourceRequest* pRequest, ResourceID const& resourceID ) { return pRequest->GetResourceID() == resourceID; };
-            auto foundIter = VectorFind( m_sentRequests, result.m_resourceID, predicate );
-
-            // This might have been a canceled request
-            if ( foundIter == m_sentRequests.end() )
-            {
-                continue;
-            }
+            SendRequestMessage();
+        }
+    }
 
-            ResourceRequest* pFoundRequest = static_cast<ResourceRequest*>( *foundIter );
-            EE_ASSERT( pFoundRequest->IsValid() );
+    void NetworkResourceProvider::ReleaseTimedOutRequests()
+    {
+        // Only relevant once the window is full, otherwise new requests can be sent anyway
+        if ( m_numInFlightRequests < s_maxInFlightRequests )
+        {
+            return;
+        }
 
-            // Ignore any responses for requests that may have been canceled or are unloading
-            if ( pFoundRequest->GetLoadingStatus() != LoadingStatus::Loading )
+        Seconds const currentTime = PlatformClock::GetTimeInSeconds();
+        for ( auto& sentRequestPair : m_sentRequests )
+        {
+            SentRequest& sentRequest = sentRequestPair.second;
+            if ( sentRequest.m_isInFlight && ( currentTime - sentRequest.m_sentTime ) > s_inFlightRequestTimeout )
             {
-                continue;
+                sentRequest.m_isInFlight = false;
+                m_numInFlightRequests--;
             }
+        }
+    }
 
-            // Trigger tools notification on failure
-            if( result.m_filePath.empty() )
+    void NetworkResourceProvider::FailAllRequests( char const* pReason )
+    {
+        auto FailRequest = [pReason] ( ResourceRequest* pRequest )
+        {
+            if ( pRequest->GetLoadingStatus() == LoadingStatus::Loading )
             {
-                ImGuiX::NotifyError( "%s failed to Compile!\n\nLog: %s", result.m_resourceID.c_str(), result.m_log.c_str() );
+                pRequest->OnRawResourceRequestComplete( String(), pReason );
             }
+        };
 
-            // If the request has a filepath set, the compilation was a success
-            pFoundRequest->OnRawResourceRequestComplete( result.m_filePath, result.m_log );
+        // Clear our tables before completing the requests, in the same way as when we process a server result
+        THashMap<ResourceID, SentRequest> sentRequests;
+        sentRequests.swap( m_sentRequests );
+        m_numInFlightRequests = 0;
 
-            // Remove from request list
-            m_sentRequests.erase_unsorted( foundIter );
+        for ( auto& sentRequestPair : sentRequests )
+        {
+            FailRequest( sentRequestPair.second.m_pRequest );
         }
 
-        m_serverResults.clear();
+        for ( auto& pendingRequests : m_pendingRequests )
+        {
+            TVector<ResourceRequest*> requestsToFail;
+            requestsToFail.swap( pendingRequests );
+
+            for ( ResourceRequest* pRequest : requestsToFail )
+            {
+                FailRequest( pRequest );
+            }
+        }
     }
 }
 #endif
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "ResourceNetworkMessages.h"
 #include "Base/Resource/ResourceProvider.h"
 #include "Base/Network/IPC/IPCMessageClient.h"
+#include "Base/Types/HashMap.h"
 #include "Base/Time/Timers.h"
 #include "Base/Threading/Threading.h"
 
@@ -17,6 +18,31 @@ namespace EE::Resource
 
     class EE_BASE_API NetworkResourceProvider final : public ResourceProvider
     {
+        // The max number of requests we can have in flight at any given time, the rest will remain pending until results come back
+        constexpr static int32_t const s_maxInFlightRequests = 512;
+
+        // The max number of resource IDs we send per network message
+        constexpr static int32_t const s_maxRequestsPerMessage = 128;
+
+        // How long a sent request occupies the in-flight window, requests that take longer still accept their result but no longer block new requests
+        constexpr static float const s_inFlightRequestTimeout = 30.0f;
+
+        // Pending requests are sent in priority order, based on who requested them
+        enum class RequestPriority : uint8_t
+        {
+            High = 0,   // Tools requests, someone is actively waiting on them
+            Medium,     // Install dependencies, these unblock resources that are already partially loaded
+            Low,        // Everything else
+
+            NumPriorities
+        };
+
+        struct SentRequest
+        {
+            ResourceRequest*                                m_pRequest = nullptr;
+            Seconds                                         m_sentTime = 0.0f;
+            bool                                            m_isInFlight = true;    // Does this request still occupy a slot in the in-flight window
+        };
 
     public:
 
@@ -34,15 +60,24 @@ namespace EE::Resource
 
         virtual TVector<ResourceID> const& GetExternallyUpdatedResources() const override { return m_externallyUpdatedResources; }
 
+        void ProcessServerResult( NetworkResourceResponse::Result const& result );
+        void SendPendingRequests();
+
+        // Release the in-flight window slots of requests that the server hasn't replied to in time
+        void ReleaseTimedOutRequests();
+
+        // Fail all sent and pending requests, since we will never get a response for them
+        void FailAllRequests( char const* pReason );
+
     private:
 
         Network::IPC::Client                                m_networkClient;
         String                                              m_address;
-        TVector<NetworkResourceResponse::Result>            m_serverResults;
         bool                                                m_networkFailureDetected = false;
 
-        TVector<ResourceRequest*>                           m_pendingRequests; // Requests we need to still send
-        TVector<ResourceRequest*>                           m_sentRequests; // Request that were sent but we're still waiting for a response
+        TArray<TVector<ResourceRequest*>, (int32_t) RequestPriority::NumPriorities> m_pendingRequests; // Requests we need to still send, per priority
+        THashMap<ResourceID, SentRequest>                   m_sentRequests; // Request that were sent but we're still waiting for a response
+        int32_t                                             m_numInFlightRequests = 0; // The number of sent requests that still occupy the in-flight window
 
         TVector<ResourceID>                                 m_externallyUpdatedResources;
     };
@@ -73,6 +73,7 @@ namespace EE::Resource
 
         inline Stage GetStage() const { return m_stage; }
 
+        inline ResourceRequesterID const& GetRequesterID() const { return m_requesterID; }
         inline ResourceRecord const* GetResourceRecord() const { return m_pResourceRecord; }
         inline ResourceID const& GetResourceID() const { return m_pResourceRecord->GetResourceID(); }
         inline ResourceTypeID GetResourceTypeID() const { return m_pResourceRecord->GetResourceTypeID(); }
@@ -30,6 +30,21 @@ namespace EE::Resource
 
     void ResourceSystem::Shutdown()
     {
+        #if EE_DEVELOPMENT_TOOLS
+        // There are no more users that could be holding on to the old data, so just complete any outstanding in-place reloads
+        while ( !m_inPlaceReloads.empty() )
+        {
+            for ( auto& inPlaceReload : m_inPlaceReloads )
+            {
+                inPlaceReload.m_isReloadRequestedAgain = false;
+            }
+
+            SwapInPlaceReloadedResources();
+            ClearHotReloadRequests();
+            Update( true );
+        }
+        #endif
+
         WaitForAllRequestsToComplete();
         m_pResourceProvider = nullptr;
     }
@@ -87,6 +102,33 @@ namespace EE::Resource
         }
     }
 
+    #if EE_DEVELOPMENT_TOOLS
+    void ResourceSystem::GetDependentResources( ResourceRecord const* pResourceRecord, TVector<ResourceID>& dependentResourceIDs ) const
+    {
+        EE_ASSERT( pResourceRecord != nullptr );
+        Threading::RecursiveScopeLock lock( m_accessLock );
+
+        for ( auto const& requesterID : pResourceRecord->m_references )
+        {
+            if ( !requesterID.IsInstallDependencyRequest() )
+            {
+                continue;
+            }
+
+            uint32_t const resourcePathID( requesterID.GetInstallDependencyResourcePathID() );
+            auto const recordIter = m_resourceRecords.find_as( resourcePathID );
+            EE_ASSERT( recordIter != m_resourceRecords.end() );
+
+            ResourceRecord* pFoundRecord = recordIter->second;
+            if ( !VectorContains( dependentResourceIDs, pFoundRecord->GetResourceID() ) )
+            {
+                dependentResourceIDs.emplace_back( pFoundRecord->GetResourceID() );
+                GetDependentResources( pFoundRecord, dependentResourceIDs );
+            }
+        }
+    }
+    #endif
+
     //-------------------------------------------------------------------------
 
     void ResourceSystem::RegisterResourceLoader( ResourceLoader* pLoader )
@@ -266,6 +308,10 @@ namespace EE::Resource
         {
             Threading::RecursiveScopeLock lock( m_accessLock );
 
+            #if EE_DEVELOPMENT_TOOLS
+            StartPendingInPlaceReloads();
+            #endif
+
             for ( auto& pendingRequest : m_pendingRequests )
             {
                 // Get existing active request
@@ -334,6 +380,13 @@ namespace EE::Resource
 
                 #if EE_DEVELOPMENT_TOOLS
                 m_history.emplace_back( CompletedRequestLog( pCompletedRequest->IsLoadRequest() ? PendingRequest::Type::Load : PendingRequest::Type::Unload, resourceID ) );
+
+                // Staging records are not in the record map, so they are handled separately
+                if ( ProcessCompletedInPlaceReloadRequest( pCompletedRequest ) )
+                {
+                    EE::Delete( pCompletedRequest );
+                    continue;
+                }
                 #endif
 
                 if ( pCompletedRequest->IsUnloadRequest() )
@@ -429,8 +482,34 @@ namespace EE::Resource
             return;
         }
 
-        // Generate a list of users for this resource
         ResourceRecord* pRecord = recordIter->second;
+
+        // Swappable resources are reloaded in place, the users are only notified once the new version has loaded
+        auto loaderIter = m_resourceLoaders.find( pRecord->GetResourceTypeID() );
+        EE_ASSERT( loaderIter != m_resourceLoaders.end() );
+        if ( loaderIter->second->SupportsInPlaceReload() )
+        {
+            auto predicate = [] ( InPlaceReload const& inPlaceReload, ResourceID const& resourceID ) { return inPlaceReload.m_resourcePtr.GetResourceID() == resourceID; };
+            int32_t const foundIdx = VectorFindIndex( m_inPlaceReloads, resourceID, predicate );
+            if ( foundIdx != InvalidIndex )
+            {
+                // Once the current reload completes we will need to reload again
+                if ( m_inPlaceReloads[foundIdx].m_stage != InPlaceReload::Stage::Pending )
+                {
+                    m_inPlaceReloads[foundIdx].m_isReloadRequestedAgain = true;
+                }
+            }
+            else
+            {
+                InPlaceReload& inPlaceReload = m_inPlaceReloads.emplace_back();
+                inPlaceReload.m_resourcePtr = ResourcePtr( resourceID );
+                LoadResource( inPlaceReload.m_resourcePtr );
+            }
+
+            return;
+        }
+
+        // Generate a list of users for this resource
         GetUsersForResource( pRecord, m_usersThatRequireReload );
 
         // Add to list of resources to be reloaded
@@ -442,6 +521,168 @@ namespace EE::Resource
         Threading::RecursiveScopeLock lock( m_accessLock );
         m_usersThatRequireReload.clear(); 
         m_externallyUpdatedResources.clear();
+        m_usersThatRequireReinitialization.clear();
+        m_resourcesReloadedInPlace.clear();
+    }
+
+    void ResourceSystem::StartPendingInPlaceReloads()
+    {
+        EE_ASSERT( Threading::IsMainThread() && !m_isAsyncTaskRunning );
+        Threading::RecursiveScopeLock lock( m_accessLock );
+
+        for ( int32_t i = (int32_t) m_inPlaceReloads.size() - 1; i >= 0; i-- )
+        {
+            InPlaceReload& inPlaceReload = m_inPlaceReloads[i];
+            if ( inPlaceReload.m_stage != InPlaceReload::Stage::Pending )
+            {
+                continue;
+            }
+
+            ResourceRecord* pRecord = inPlaceReload.m_resourcePtr.m_pResourceRecord;
+            auto loaderIter = m_resourceLoaders.find( pRecord->GetResourceTypeID() );
+            EE_ASSERT( loaderIter != m_resourceLoaders.end() );
+
+            // We can only swap with a loaded resource, anything else falls back to a full reload of all users
+            if ( !pRecord->IsLoaded() || TryFindActiveRequest( pRecord ) != nullptr )
+            {
+                GetUsersForResource( pRecord, m_usersThatRequireReload );
+                VectorEmplaceBackUnique( m_externallyUpdatedResources, pRecord->GetResourceID() );
+                UnloadResource( inPlaceReload.m_resourcePtr );
+                m_inPlaceReloads.erase_unsorted( m_inPlaceReloads.begin() + i );
+                continue;
+            }
+
+            inPlaceReload.m_pStagingRecord = EE::New<ResourceRecord>( pRecord->GetResourceID() );
+            inPlaceReload.m_stage = InPlaceReload::Stage::Loading;
+            inPlaceReload.m_timer.Start();
+            m_activeRequests.emplace_back( EE::New<ResourceRequest>( ResourceRequesterID(), ResourceRequest::Type::Load, inPlaceReload.m_pStagingRecord, loaderIter->second ) );
+        }
+    }
+
+    bool ResourceSystem::ProcessCompletedInPlaceReloadRequest( ResourceRequest* pCompletedRequest )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+        Threading::RecursiveScopeLock lock( m_accessLock );
+
+        auto predicate = [] ( InPlaceReload const& inPlaceReload, ResourceRecord const* pRecord ) { return inPlaceReload.m_pStagingRecord == pRecord; };
+        int32_t const foundIdx = VectorFindIndex( m_inPlaceReloads, pCompletedRequest->GetResourceRecord(), predicate );
+        if ( foundIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        InPlaceReload& inPlaceReload = m_inPlaceReloads[foundIdx];
+        ResourceRecord* pRecord = inPlaceReload.m_resourcePtr.m_pResourceRecord;
+        ResourceRecord* pStagingRecord = inPlaceReload.m_pStagingRecord;
+
+        // Staging load completed
+        //-------------------------------------------------------------------------
+
+        if ( inPlaceReload.m_stage == InPlaceReload::Stage::Loading )
+        {
+            EE_ASSERT( pCompletedRequest->IsLoadRequest() );
+
+            if ( pStagingRecord->IsLoaded() )
+            {
+                GetUsersForResource( pRecord, m_usersThatRequireReinitialization );
+                VectorEmplaceBackUnique( m_externallyUpdatedResources, pRecord->GetResourceID() );
+                VectorEmplaceBackUnique( m_resourcesReloadedInPlace, pRecord->GetResourceID() );
+                GetDependentResources( pRecord, m_resourcesReloadedInPlace );
+                inPlaceReload.m_stage = InPlaceReload::Stage::ReadyToSwap;
+            }
+            else // Keep the old data and clean up the failed load
+            {
+                EE_LOG_ERROR( "Resource", "Hot Reload", "Failed to reload resource in place, keeping previously loaded version (%s)", pRecord->GetResourceID().c_str() );
+
+                auto loaderIter = m_resourceLoaders.find( pStagingRecord->GetResourceTypeID() );
+                EE_ASSERT( loaderIter != m_resourceLoaders.end() );
+                m_activeRequests.emplace_back( EE::New<ResourceRequest>( ResourceRequesterID(), ResourceRequest::Type::Unload, pStagingRecord, loaderIter->second ) );
+                inPlaceReload.m_stage = InPlaceReload::Stage::Unloading;
+            }
+        }
+
+        // Old data has been unloaded
+        //-------------------------------------------------------------------------
+
+        else
+        {
+            EE_ASSERT( inPlaceReload.m_stage == InPlaceReload::Stage::Unloading );
+            EE_ASSERT( pCompletedRequest->IsUnloadRequest() && pStagingRecord->IsUnloaded() );
+
+            ResourceID const resourceID = pRecord->GetResourceID();
+            bool const isReloadRequestedAgain = inPlaceReload.m_isReloadRequestedAgain;
+
+            EE::Delete( inPlaceReload.m_pStagingRecord );
+            UnloadResource( inPlaceReload.m_resourcePtr );
+            m_inPlaceReloads.erase_unsorted( m_inPlaceReloads.begin() + foundIdx );
+
+            if ( isReloadRequestedAgain )
+            {
+                RequestResourceHotReload( resourceID );
+            }
+        }
+
+        return true;
+    }
+
+    void ResourceSystem::SwapInPlaceReloadedResources()
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        // The async task may have been rescheduled by the last update, the records and loaders cannot be touched while it is in flight
+        // Any requests it completed will be processed by the next update
+        if ( m_isAsyncTaskRunning )
+        {
+            m_taskSystem.WaitForTask( &m_asyncProcessingTask );
+            m_isAsyncTaskRunning = false;
+        }
+
+        Threading::RecursiveScopeLock lock( m_accessLock );
+
+        TVector<ResourceID> dependentResourceIDs;
+
+        for ( auto& inPlaceReload : m_inPlaceReloads )
+        {
+            if ( inPlaceReload.m_stage != InPlaceReload::Stage::ReadyToSwap )
+            {
+                continue;
+            }
+
+            ResourceRecord* pRecord = inPlaceReload.m_resourcePtr.m_pResourceRecord;
+            ResourceRecord* pStagingRecord = inPlaceReload.m_pStagingRecord;
+            EE_ASSERT( pRecord->IsLoaded() && pStagingRecord->IsLoaded() );
+
+            // The staging record takes ownership of the old data and the old install dependencies
+            eastl::swap( pRecord->m_pResource, pStagingRecord->m_pResource );
+            eastl::swap( pRecord->m_installDependencyResourceIDs, pStagingRecord->m_installDependencyResourceIDs );
+            eastl::swap( pRecord->m_sourceResourceHash, pStagingRecord->m_sourceResourceHash );
+            eastl::swap( pRecord->m_fileReadTime, pStagingRecord->m_fileReadTime );
+            eastl::swap( pRecord->m_loadTime, pStagingRecord->m_loadTime );
+            eastl::swap( pRecord->m_waitForDependenciesTime, pStagingRecord->m_waitForDependenciesTime );
+            eastl::swap( pRecord->m_installTime, pStagingRecord->m_installTime );
+
+            GetDependentResources( pRecord, dependentResourceIDs );
+
+            EE_LOG_INFO( "Resource", "Hot Reload", "Reloaded in place: %s (%.2fms)", pRecord->GetResourceID().c_str(), inPlaceReload.m_timer.GetElapsedTimeMilliseconds().ToFloat() );
+
+            // Unload the old data
+            auto loaderIter = m_resourceLoaders.find( pStagingRecord->GetResourceTypeID() );
+            EE_ASSERT( loaderIter != m_resourceLoaders.end() );
+            m_activeRequests.emplace_back( EE::New<ResourceRequest>( ResourceRequesterID(), ResourceRequest::Type::Unload, pStagingRecord, loaderIter->second ) );
+            inPlaceReload.m_stage = InPlaceReload::Stage::Unloading;
+        }
+
+        // Let the loaders of dependent resources refresh anything they derived from the reloaded data
+        for ( auto const& dependentResourceID : dependentResourceIDs )
+        {
+            ResourceRecord* pDependentRecord = FindExistingResourceRecord( dependentResourceID );
+            if ( pDependentRecord->IsLoaded() )
+            {
+                auto loaderIter = m_resourceLoaders.find( pDependentRecord->GetResourceTypeID() );
+                EE_ASSERT( loaderIter != m_resourceLoaders.end() );
+                loaderIter->second->OnInstallDependencyReloadedInPlace( dependentResourceID, pDependentRecord );
+            }
+        }
     }
     #endif
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "Base/Systems.h"
 #include "Base/Types/Event.h"
 #include "Base/Time/TimeStamp.h"
+#include "Base/Time/Timers.h"
 #include "Base/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
@@ -58,6 +59,19 @@ namespace EE::Resource
             ResourceID              m_ID;
             TimeStamp               m_time;
         };
+
+        // Resources whose loader supports in-place reloading are loaded into a staging record next to the live one.
+        // Once loaded, the data of the two records is swapped so all existing resource ptrs see the new data and the old data is unloaded from the staging record.
+        struct InPlaceReload
+        {
+            enum class Stage { Pending, Loading, ReadyToSwap, Unloading };
+
+            ResourcePtr             m_resourcePtr;                              // Keeps the live record loaded for the duration of the reload
+            ResourceRecord*         m_pStagingRecord = nullptr;
+            Stage                   m_stage = Stage::Pending;
+            bool                    m_isReloadRequestedAgain = false;           // The resource was updated again while this reload was in progress
+            Timer<PlatformClock>    m_timer;
+        };
         #endif
 
     public:
@@ -109,9 +123,20 @@ namespace EE::Resource
 
         #if EE_DEVELOPMENT_TOOLS
         void RequestResourceHotReload( ResourceID const& resourceID );
-        inline bool RequiresHotReloading() const { return !m_usersThatRequireReload.empty(); }
+        inline bool RequiresHotReloading() const { return !m_usersThatRequireReload.empty() || !m_resourcesReloadedInPlace.empty(); }
         inline TVector<ResourceRequesterID> const& GetUsersToBeReloaded() const { return m_usersThatRequireReload; }
         inline TVector<ResourceID> const& GetResourcesToBeReloaded() const { return m_externallyUpdatedResources; }
+
+        // Users of resources that were reloaded in place, these only need to re-initialize whatever uses the affected resources
+        inline TVector<ResourceRequesterID> const& GetUsersToBeReinitialized() const { return m_usersThatRequireReinitialization; }
+
+        // The resources that were reloaded in place as well as all the resources that depend on them
+        inline TVector<ResourceID> const& GetResourcesReloadedInPlace() const { return m_resourcesReloadedInPlace; }
+
+        // Swap in the new data for all in-place reloads that have completed loading
+        // Users need to release anything they cached from the affected resources before this is called
+        // This will block on any in-flight async request processing
+        void SwapInPlaceReloadedResources();
         void ClearHotReloadRequests();
         #endif
 
@@ -137,6 +162,17 @@ namespace EE::Resource
         // Process all queued resource requests
         void ProcessResourceRequests();
 
+        #if EE_DEVELOPMENT_TOOLS
+        // Returns a list of all resources that (transitively) have the specified resource as an install dependency
+        void GetDependentResources( ResourceRecord const* pResourceRecord, TVector<ResourceID>& dependentResourceIDs ) const;
+
+        // Create the staging requests for any pending in-place reloads
+        void StartPendingInPlaceReloads();
+
+        // Returns true if the request belonged to an in-place reload
+        bool ProcessCompletedInPlaceReloadRequest( ResourceRequest* pCompletedRequest );
+        #endif
+
     private:
 
         TaskSystem&                                             m_taskSystem;
@@ -157,6 +193,9 @@ namespace EE::Resource
         #if EE_DEVELOPMENT_TOOLS
         TVector<ResourceRequesterID>                            m_usersThatRequireReload;
         TVector<ResourceID>                                     m_externallyUpdatedResources;
+        TVector<InPlaceReload>                                  m_inPlaceReloads;
+        TVector<ResourceRequesterID>                            m_usersThatRequireReinitialization;
+        TVector<ResourceID>                                     m_resourcesReloadedInPlace;
         TVector<CompletedRequestLog>                            m_history;
         #endif
     };
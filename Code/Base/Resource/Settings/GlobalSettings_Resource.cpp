@@ -1,6 +1,7 @@
 #include "GlobalSettings_Resource.h"
 #include "Base/Settings/IniFile.h"
 #include "Base/FileSystem/FileSystemUtils.h"
+#include <filesystem>
 
 //-------------------------------------------------------------------------
 
@@ -22,6 +23,8 @@ namespace EE::Resource
             m_rawResourcePathStr = ini.GetStringOrDefault( "Resource:RawResourcePath", s_defaultRawResourcePath );
             m_packagedBuildName = ini.GetStringOrDefault( "Resource:PackagedBuildName", s_defaultPackagedBuildName );
             m_compiledDBName = ini.GetStringOrDefault( "Resource:CompiledResourceDatabaseName", s_defaultCompiledResourceDatabaseName );
+            m_compiledResourceCachePathStr = ini.GetStringOrDefault( "Resource:CompiledResourceCachePath", s_defaultCompiledResourceCachePath );
+            m_compiledResourceCacheMaxSizeMB = ini.GetUIntOrDefault( "Resource:CompiledResourceCacheMaxSizeMB", s_defaultCompiledResourceCacheMaxSizeMB );
             m_resourceCompilerExeName = ini.GetStringOrDefault( "Resource:ResourceCompilerExecutable", s_defaultResourceCompilerExecutableName );
             m_resourceServerExeName = ini.GetStringOrDefault( "Resource:ResourceServerExecutable", s_defaultResourceServerExecutableName );
             m_resourceServerNetworkAddress = ini.GetStringOrDefault( "Resource:ResourceServerAddress", s_defaultResourceServerAddress );
@@ -92,6 +95,26 @@ namespace EE::Resource
                 return false;
             }
 
+            // Compiled Resource Cache
+            //-------------------------------------------------------------------------
+
+            if ( std::filesystem::path( m_compiledResourceCachePathStr.c_str() ).is_absolute() )
+            {
+                m_compiledResourceCachePath = FileSystem::Path( m_compiledResourceCachePathStr );
+            }
+            else
+            {
+                m_compiledResourceCachePath = m_workingDirectoryPath + m_compiledResourceCachePathStr.c_str();
+            }
+
+            if ( !m_compiledResourceCachePath.IsValid() )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid compiled resource cache path: %s", m_compiledResourceCachePath.c_str() );
+                return false;
+            }
+
+            m_compiledResourceCachePath.MakeIntoDirectoryPath();
+
             // Resource Compiler Executable
             //-------------------------------------------------------------------------
 
@@ -128,6 +151,8 @@ namespace EE::Resource
         ini.SetString( "Resource:RawResourcePath", m_rawResourcePathStr );
         ini.SetString( "Resource:PackagedBuildName", m_packagedBuildName );
         ini.SetString( "Resource:CompiledResourceDatabaseName", m_compiledDBName );
+        ini.SetString( "Resource:CompiledResourceCachePath", m_compiledResourceCachePathStr );
+        ini.SetUInt( "Resource:CompiledResourceCacheMaxSizeMB", m_compiledResourceCacheMaxSizeMB );
         ini.SetString( "Resource:ResourceCompilerExecutable", m_resourceCompilerExeName );
         ini.SetString( "Resource:ResourceServerExecutable", m_resourceServerExeName );
         ini.SetString( "Resource:ResourceServerAddress", m_resourceServerNetworkAddress );
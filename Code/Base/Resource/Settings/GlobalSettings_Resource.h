@@ -25,6 +25,8 @@ namespace EE::Resource
         constexpr static char const * const s_defaultResourceCompilerExecutableName = "EsotericaResourceCompiler.exe";
         constexpr static char const * const s_defaultCompiledResourceDirectoryName = "CompiledData";
         constexpr static char const * const s_defaultCompiledResourceDatabaseName = "CompiledData.db";
+        constexpr static char const * const s_defaultCompiledResourceCachePath = "CompiledDataCache";
+        constexpr static uint32_t const s_defaultCompiledResourceCacheMaxSizeMB = 4096;
 
         // Resource Server
         //-------------------------------------------------------------------------
@@ -57,6 +59,8 @@ namespace EE::Resource
         String                  m_rawResourcePathStr = s_defaultRawResourcePath;
         String                  m_packagedBuildName = s_defaultPackagedBuildName;
         String                  m_compiledDBName = s_defaultCompiledResourceDatabaseName;
+        String                  m_compiledResourceCachePathStr = s_defaultCompiledResourceCachePath; // Relative to the working directory unless absolute, can point to a shared location
+        uint32_t                m_compiledResourceCacheMaxSizeMB = s_defaultCompiledResourceCacheMaxSizeMB;
         String                  m_resourceCompilerExeName = s_defaultResourceCompilerExecutableName;
         String                  m_resourceServerExeName = s_defaultResourceServerExecutableName;
         String                  m_resourceServerNetworkAddress = s_defaultResourceServerAddress;
@@ -72,6 +76,7 @@ namespace EE::Resource
         FileSystem::Path        m_rawResourcePath;
         FileSystem::Path        m_packagedBuildCompiledResourcePath;
         FileSystem::Path        m_compiledResourceDatabasePath;
+        FileSystem::Path        m_compiledResourceCachePath;
         FileSystem::Path        m_resourceCompilerExecutablePath;
         FileSystem::Path        m_resourceServerExecutablePath;
         #endif
@@ -1,6 +1,7 @@
 #include "TypeSerialization.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/TypeSystem/TypeInfo.h"
+#include "Base/FileSystem/FileSystem.h"
 
 
 //-------------------------------------------------------------------------
@@ -216,6 +217,69 @@ namespace EE::Serialization
             *( (T*) pAddress ) = value;
         }
 
+        // Integer values are supplied as both signed and unsigned, the property type decides which one is used
+        static bool ReadIntegerValue( PropertyInfo const& propInfo, int64_t signedValue, uint64_t unsignedValue, void* pPropertyDataAddress )
+        {
+            if ( propInfo.m_typeID == CoreTypeID::Uint8 )
+            {
+                SetPropertyValue( pPropertyDataAddress, (uint8_t) unsignedValue );
+            }
+            else if ( propInfo.m_typeID == CoreTypeID::Int8 )
+            {
+                SetPropertyValue( pPropertyDataAddress, (int8_t) signedValue );
+            }
+            else if ( propInfo.m_typeID == CoreTypeID::Uint16 )
+            {
+                SetPropertyValue( pPropertyDataAddress, (uint16_t) unsignedValue );
+            }
+            else if ( propInfo.m_typeID == CoreTypeID::Int16 )
+            {
+                SetPropertyValue( pPropertyDataAddress, (int16_t) signedValue );
+            }
+            else if ( propInfo.m_typeID == CoreTypeID::Uint32 )
+            {
+                SetPropertyValue( pPropertyDataAddress, (uint32_t) unsignedValue );
+            }
+            else if ( propInfo.m_typeID == CoreTypeID::Int32 )
+            {
+                SetPropertyValue( pPropertyDataAddress, (int32_t) signedValue );
+            }
+            else if ( propInfo.m_typeID == CoreTypeID::Uint64 )
+            {
+                SetPropertyValue( pPropertyDataAddress, unsignedValue );
+            }
+            else if ( propInfo.m_typeID == CoreTypeID::Int64 )
+            {
+                SetPropertyValue( pPropertyDataAddress, signedValue );
+            }
+            else // Invalid JSON data encountered
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Invalid JSON file encountered" );
+                return false;
+            }
+
+            return true;
+        }
+
+        static bool ReadFloatingPointValue( PropertyInfo const& propInfo, double value, void* pPropertyDataAddress )
+        {
+            if ( propInfo.m_typeID == CoreTypeID::Float )
+            {
+                SetPropertyValue( pPropertyDataAddress, (float) value );
+            }
+            else if ( propInfo.m_typeID == CoreTypeID::Double )
+            {
+                SetPropertyValue( pPropertyDataAddress, value );
+            }
+            else // Invalid JSON data encountered
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Invalid JSON file encountered" );
+                return false;
+            }
+
+            return true;
+        }
+
         static bool ReadCoreType( TypeRegistry const& typeRegistry, PropertyInfo const& propInfo, Serialization::JsonValue const& typeValue, void* pPropertyDataAddress )
         {
             EE_ASSERT( pPropertyDataAddress != nullptr );
@@ -232,59 +296,13 @@ namespace EE::Serialization
             }
             else if ( typeValue.IsInt64() || typeValue.IsUint64() )
             {
-                if ( propInfo.m_typeID == CoreTypeID::Uint8 )
-                {
-                    SetPropertyValue( pPropertyDataAddress, (uint8_t) typeValue.GetUint64() );
-                }
-                else if ( propInfo.m_typeID == CoreTypeID::Int8 )
-                {
-                    SetPropertyValue( pPropertyDataAddress, (int8_t) typeValue.GetInt64() );
-                }
-                else if ( propInfo.m_typeID == CoreTypeID::Uint16 )
-                {
-                    SetPropertyValue( pPropertyDataAddress, (uint16_t) typeValue.GetUint64() );
-                }
-                else if ( propInfo.m_typeID == CoreTypeID::Int16 )
-                {
-                    SetPropertyValue( pPropertyDataAddress, (int16_t) typeValue.GetInt64() );
-                }
-                else if ( propInfo.m_typeID == CoreTypeID::Uint32 )
-                {
-                    SetPropertyValue( pPropertyDataAddress, (uint32_t) typeValue.GetUint64() );
-                }
-                else if ( propInfo.m_typeID == CoreTypeID::Int32 )
-                {
-                    SetPropertyValue( pPropertyDataAddress, (int32_t) typeValue.GetInt64() );
-                }
-                else if ( propInfo.m_typeID == CoreTypeID::Uint64 )
-                {
-                    SetPropertyValue( pPropertyDataAddress, typeValue.GetUint64() );
-                }
-                else if ( propInfo.m_typeID == CoreTypeID::Int64 )
-                {
-                    SetPropertyValue( pPropertyDataAddress, typeValue.GetInt64() );
-                }
-                else // Invalid JSON data encountered
-                {
-                    EE_LOG_ERROR( "TypeSystem", "Serialization", "Invalid JSON file encountered" );
-                    return false;
-                }
+                int64_t const signedValue = typeValue.IsInt64() ? typeValue.GetInt64() : (int64_t) typeValue.GetUint64();
+                uint64_t const unsignedValue = typeValue.IsUint64() ? typeValue.GetUint64() : (uint64_t) typeValue.GetInt64();
+                return ReadIntegerValue( propInfo, signedValue, unsignedValue, pPropertyDataAddress );
             }
             else if ( typeValue.IsDouble() )
             {
-                if ( propInfo.m_typeID == CoreTypeID::Float )
-                {
-                    SetPropertyValue( pPropertyDataAddress, typeValue.GetFloat() );
-                }
-                else if ( propInfo.m_typeID == CoreTypeID::Double )
-                {
-                    SetPropertyValue( pPropertyDataAddress, typeValue.GetDouble() );
-                }
-                else // Invalid JSON data encountered
-                {
-                    EE_LOG_ERROR( "TypeSystem", "Serialization", "Invalid JSON file encountered" );
-                    return false;
-                }
+                return ReadFloatingPointValue( propInfo, typeValue.GetDouble(), pPropertyDataAddress );
             }
             else // Invalid JSON data encountered
             {
@@ -578,6 +596,521 @@ namespace EE::Serialization
     }
 }
 
+//-------------------------------------------------------------------------
+// Native : Streaming
+//-------------------------------------------------------------------------
+// Reads native types directly from the rapidjson reader events without building a JSON document.
+// The file is parsed in-situ so keys and values point into the file buffer, string values are copied into a single reused scratch buffer for conversion.
+
+namespace EE::Serialization
+{
+    class NativeTypeStreamReader final : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, NativeTypeStreamReader>
+    {
+        struct Scope
+        {
+            TypeInfo const*                                         m_pTypeInfo = nullptr;
+            IReflectedType*                                         m_pTypeInstance = nullptr;
+            PropertyInfo const*                                     m_pPropertyInfo = nullptr;  // Objects: the property for the current key (null if unknown), Arrays: the array property
+            int32_t                                                 m_arrayIdx = 0;
+            bool                                                    m_isArray = false;
+            bool                                                    m_isExpectingTypeID = false;
+        };
+
+    public:
+
+        // If no type instance is supplied, we will create one based on the type ID of the root object
+        NativeTypeStreamReader( TypeRegistry const& typeRegistry, IReflectedType* pTypeInstance )
+            : m_typeRegistry( typeRegistry )
+            , m_pRootTypeInstance( pTypeInstance )
+        {
+            m_scratchBuffer.reserve( 255 );
+        }
+
+        inline bool HasFailed() const { return m_hasFailed; }
+        inline IReflectedType* GetRootTypeInstance() const { return m_pRootTypeInstance; }
+
+        // Objects and Arrays
+        //-------------------------------------------------------------------------
+
+        bool StartObject()
+        {
+            if ( m_skipDepth > 0 )
+            {
+                m_skipDepth++;
+                return true;
+            }
+
+            // Root object
+            if ( m_scopes.empty() )
+            {
+                Scope& rootScope = m_scopes.emplace_back();
+                if ( m_pRootTypeInstance != nullptr )
+                {
+                    rootScope.m_pTypeInfo = m_pRootTypeInstance->GetTypeInfo();
+                    rootScope.m_pTypeInstance = m_pRootTypeInstance;
+                }
+                return true;
+            }
+
+            // Nested types
+            PropertyInfo const* pPropertyInfo = nullptr;
+            void* pPropertyDataAddress = nullptr;
+            if ( !TryGetValueAddress( pPropertyInfo, pPropertyDataAddress ) )
+            {
+                return false;
+            }
+
+            if ( pPropertyDataAddress == nullptr )
+            {
+                m_skipDepth = 1;
+                return true;
+            }
+
+            if ( IsCoreType( pPropertyInfo->m_typeID ) || pPropertyInfo->IsEnumProperty() )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Malformed json detected, object declared for core type property: %s", pPropertyInfo->m_ID.c_str() );
+                return Fail();
+            }
+
+            auto const pTypeInfo = m_typeRegistry.GetTypeInfo( pPropertyInfo->m_typeID );
+            if ( pTypeInfo == nullptr )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Unknown type encountered: %s", pPropertyInfo->m_typeID.c_str() );
+                return Fail();
+            }
+
+            Scope& scope = m_scopes.emplace_back();
+            scope.m_pTypeInfo = pTypeInfo;
+            scope.m_pTypeInstance = (IReflectedType*) pPropertyDataAddress;
+            return true;
+        }
+
+        bool EndObject( rapidjson::SizeType )
+        {
+            if ( m_skipDepth > 0 )
+            {
+                m_skipDepth--;
+                return true;
+            }
+
+            m_scopes.pop_back();
+            return true;
+        }
+
+        bool StartArray()
+        {
+            if ( m_skipDepth > 0 )
+            {
+                m_skipDepth++;
+                return true;
+            }
+
+            if ( m_scopes.empty() )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Only a single serialized type is supported when streaming" );
+                return Fail();
+            }
+
+            Scope& parentScope = m_scopes.back();
+            if ( parentScope.m_isArray )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "We dont support arrays of arrays" );
+                return Fail();
+            }
+
+            if ( parentScope.m_isExpectingTypeID || parentScope.m_pTypeInstance == nullptr )
+            {
+                return FailOnInvalidTypeID();
+            }
+
+            if ( parentScope.m_pPropertyInfo == nullptr )
+            {
+                m_skipDepth = 1;
+                return true;
+            }
+
+            if ( !parentScope.m_pPropertyInfo->IsArrayProperty() )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Invalid JSON file encountered, array declared for non-array property: %s", parentScope.m_pPropertyInfo->m_ID.c_str() );
+                return Fail();
+            }
+
+            Scope arrayScope;
+            arrayScope.m_pTypeInfo = parentScope.m_pTypeInfo;
+            arrayScope.m_pTypeInstance = parentScope.m_pTypeInstance;
+            arrayScope.m_pPropertyInfo = parentScope.m_pPropertyInfo;
+            arrayScope.m_isArray = true;
+            m_scopes.emplace_back( arrayScope );
+            return true;
+        }
+
+        bool EndArray( rapidjson::SizeType )
+        {
+            if ( m_skipDepth > 0 )
+            {
+                m_skipDepth--;
+                return true;
+            }
+
+            // Remove any elements that were not present in the json array
+            Scope const& arrayScope = m_scopes.back();
+            if ( arrayScope.m_pPropertyInfo->IsDynamicArrayProperty() )
+            {
+                uint32_t const arrayID = arrayScope.m_pPropertyInfo->m_ID.ToUint();
+                size_t arraySize = arrayScope.m_pTypeInfo->GetArraySize( arrayScope.m_pTypeInstance, arrayID );
+                while ( arraySize > (size_t) arrayScope.m_arrayIdx )
+                {
+                    arrayScope.m_pTypeInfo->RemoveArrayElement( arrayScope.m_pTypeInstance, arrayID, --arraySize );
+                }
+            }
+
+            m_scopes.pop_back();
+            return true;
+        }
+
+        // Values
+        //-------------------------------------------------------------------------
+
+        bool Key( char const* pString, rapidjson::SizeType, bool )
+        {
+            if ( m_skipDepth > 0 )
+            {
+                return true;
+            }
+
+            Scope& scope = m_scopes.back();
+            if ( strcmp( pString, s_typeIDKey ) == 0 )
+            {
+                scope.m_isExpectingTypeID = true;
+                return true;
+            }
+
+            // We need the type ID before any properties in order to create the type
+            if ( scope.m_pTypeInstance == nullptr )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "The type ID needs to be the first member of a type object in order to stream it" );
+                return Fail();
+            }
+
+            scope.m_pPropertyInfo = scope.m_pTypeInfo->GetPropertyInfo( StringID( pString ) );
+            return true;
+        }
+
+        bool String( char const* pString, rapidjson::SizeType length, bool )
+        {
+            if ( m_skipDepth > 0 )
+            {
+                return true;
+            }
+
+            if ( IsExpectingTypeID() )
+            {
+                return ReadTypeID( pString );
+            }
+
+            PropertyInfo const* pPropertyInfo = nullptr;
+            void* pPropertyDataAddress = nullptr;
+            if ( !TryGetCoreValueAddress( pPropertyInfo, pPropertyDataAddress ) )
+            {
+                return false;
+            }
+
+            if ( pPropertyDataAddress != nullptr )
+            {
+                m_scratchBuffer.assign( pString, length );
+                Conversion::ConvertStringToNativeType( m_typeRegistry, *pPropertyInfo, m_scratchBuffer, pPropertyDataAddress );
+            }
+
+            return true;
+        }
+
+        bool Bool( bool value )
+        {
+            PropertyInfo const* pPropertyInfo = nullptr;
+            void* pPropertyDataAddress = nullptr;
+            if ( !TryGetNonStringValueAddress( pPropertyInfo, pPropertyDataAddress ) )
+            {
+                return false;
+            }
+
+            if ( pPropertyDataAddress != nullptr )
+            {
+                if ( pPropertyInfo->m_typeID != CoreTypeID::Bool )
+                {
+                    EE_LOG_ERROR( "TypeSystem", "Serialization", "Invalid JSON file encountered" );
+                    return Fail();
+                }
+
+                *( (bool*) pPropertyDataAddress ) = value;
+            }
+
+            return true;
+        }
+
+        bool Int( int32_t value ) { return ReadInteger( value, (uint64_t) value ); }
+        bool Uint( uint32_t value ) { return ReadInteger( (int64_t) value, value ); }
+        bool Int64( int64_t value ) { return ReadInteger( value, (uint64_t) value ); }
+        bool Uint64( uint64_t value ) { return ReadInteger( (int64_t) value, value ); }
+
+        bool Double( double value )
+        {
+            PropertyInfo const* pPropertyInfo = nullptr;
+            void* pPropertyDataAddress = nullptr;
+            if ( !TryGetNonStringValueAddress( pPropertyInfo, pPropertyDataAddress ) )
+            {
+                return false;
+            }
+
+            if ( pPropertyDataAddress != nullptr && !NativeTypeReader::ReadFloatingPointValue( *pPropertyInfo, value, pPropertyDataAddress ) )
+            {
+                return Fail();
+            }
+
+            return true;
+        }
+
+        // Null values
+        bool Default()
+        {
+            PropertyInfo const* pPropertyInfo = nullptr;
+            void* pPropertyDataAddress = nullptr;
+            if ( !TryGetNonStringValueAddress( pPropertyInfo, pPropertyDataAddress ) )
+            {
+                return false;
+            }
+
+            if ( pPropertyDataAddress != nullptr )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Invalid JSON file encountered" );
+                return Fail();
+            }
+
+            return true;
+        }
+
+    private:
+
+        inline bool IsExpectingTypeID() const { return !m_scopes.empty() && m_scopes.back().m_isExpectingTypeID; }
+
+        inline bool Fail()
+        {
+            m_hasFailed = true;
+            return false;
+        }
+
+        bool FailOnInvalidTypeID()
+        {
+            EE_LOG_ERROR( "TypeSystem", "Serialization", "Invalid type ID value encountered" );
+            return Fail();
+        }
+
+        bool ReadTypeID( char const* pTypeID )
+        {
+            Scope& scope = m_scopes.back();
+            scope.m_isExpectingTypeID = false;
+
+            TypeID const actualTypeID( pTypeID );
+
+            // Create the root type
+            if ( scope.m_pTypeInstance == nullptr )
+            {
+                EE_ASSERT( m_scopes.size() == 1 && m_pRootTypeInstance == nullptr );
+
+                auto const pTypeInfo = m_typeRegistry.GetTypeInfo( actualTypeID );
+                if ( pTypeInfo == nullptr )
+                {
+                    EE_LOG_ERROR( "TypeSystem", "Serialization", "Unknown type encountered: %s", actualTypeID.c_str() );
+                    return Fail();
+                }
+
+                scope.m_pTypeInfo = pTypeInfo;
+                scope.m_pTypeInstance = pTypeInfo->CreateType();
+                m_pRootTypeInstance = scope.m_pTypeInstance;
+                return true;
+            }
+
+            // If you hit this the type in the JSON file and the type you are trying to deserialize do not match
+            TypeID const expectedTypeID = scope.m_pTypeInfo->m_ID;
+            if ( expectedTypeID != actualTypeID && !m_typeRegistry.IsTypeDerivedFrom( actualTypeID, expectedTypeID ) )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Type mismatch, expected %s, encountered %s", expectedTypeID.c_str(), actualTypeID.c_str() );
+                return Fail();
+            }
+
+            return true;
+        }
+
+        bool ReadInteger( int64_t signedValue, uint64_t unsignedValue )
+        {
+            PropertyInfo const* pPropertyInfo = nullptr;
+            void* pPropertyDataAddress = nullptr;
+            if ( !TryGetNonStringValueAddress( pPropertyInfo, pPropertyDataAddress ) )
+            {
+                return false;
+            }
+
+            if ( pPropertyDataAddress != nullptr && !NativeTypeReader::ReadIntegerValue( *pPropertyInfo, signedValue, unsignedValue, pPropertyDataAddress ) )
+            {
+                return Fail();
+            }
+
+            return true;
+        }
+
+        // Get the address that the current value should be written to, a null address means the value should be skipped
+        // For array scopes this will advance the array index
+        bool TryGetValueAddress( PropertyInfo const*& pOutPropertyInfo, void*& pOutAddress )
+        {
+            pOutPropertyInfo = nullptr;
+            pOutAddress = nullptr;
+
+            if ( m_skipDepth > 0 || m_scopes.empty() )
+            {
+                return true;
+            }
+
+            Scope& scope = m_scopes.back();
+
+            // Array element
+            if ( scope.m_isArray )
+            {
+                PropertyInfo const& arrayPropertyInfo = *scope.m_pPropertyInfo;
+                if ( arrayPropertyInfo.IsStaticArrayProperty() )
+                {
+                    if ( scope.m_arrayIdx >= arrayPropertyInfo.m_arraySize )
+                    {
+                        EE_LOG_ERROR( "TypeSystem", "Serialization", "Static array size mismatch for %s, expected maximum %d elements", arrayPropertyInfo.m_ID.c_str(), arrayPropertyInfo.m_arraySize );
+                        return Fail();
+                    }
+
+                    pOutAddress = reinterpret_cast<uint8_t*>( arrayPropertyInfo.GetPropertyAddress( scope.m_pTypeInstance ) ) + ( scope.m_arrayIdx * arrayPropertyInfo.m_arrayElementSize );
+                }
+                else // Dynamic array, this will grow the array as needed
+                {
+                    pOutAddress = scope.m_pTypeInfo->GetArrayElementDataPtr( scope.m_pTypeInstance, arrayPropertyInfo.m_ID.ToUint(), scope.m_arrayIdx );
+                }
+
+                pOutPropertyInfo = &arrayPropertyInfo;
+                scope.m_arrayIdx++;
+                return true;
+            }
+
+            // Object member
+            if ( scope.m_isExpectingTypeID || scope.m_pTypeInstance == nullptr )
+            {
+                return FailOnInvalidTypeID();
+            }
+
+            if ( scope.m_pPropertyInfo == nullptr )
+            {
+                return true;
+            }
+
+            if ( scope.m_pPropertyInfo->IsArrayProperty() )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Invalid JSON file encountered, expected array for property: %s", scope.m_pPropertyInfo->m_ID.c_str() );
+                return Fail();
+            }
+
+            pOutPropertyInfo = scope.m_pPropertyInfo;
+            pOutAddress = scope.m_pPropertyInfo->GetPropertyAddress( scope.m_pTypeInstance );
+            return true;
+        }
+
+        bool TryGetCoreValueAddress( PropertyInfo const*& pOutPropertyInfo, void*& pOutAddress )
+        {
+            if ( !TryGetValueAddress( pOutPropertyInfo, pOutAddress ) )
+            {
+                return false;
+            }
+
+            if ( pOutAddress != nullptr && !IsCoreType( pOutPropertyInfo->m_typeID ) && !pOutPropertyInfo->IsEnumProperty() )
+            {
+                EE_LOG_ERROR( "TypeSystem", "Serialization", "Malformed json detected, only core type properties are allowed to be directly declared: %s", pOutPropertyInfo->m_ID.c_str() );
+                return Fail();
+            }
+
+            return true;
+        }
+
+        bool TryGetNonStringValueAddress( PropertyInfo const*& pOutPropertyInfo, void*& pOutAddress )
+        {
+            if ( IsExpectingTypeID() && m_skipDepth == 0 )
+            {
+                return FailOnInvalidTypeID();
+            }
+
+            return TryGetCoreValueAddress( pOutPropertyInfo, pOutAddress );
+        }
+
+    private:
+
+        TypeRegistry const&                                         m_typeRegistry;
+        IReflectedType*                                             m_pRootTypeInstance = nullptr;
+        TInlineVector<Scope, 8>                                     m_scopes;
+        EE::String                                                  m_scratchBuffer;
+        int32_t                                                     m_skipDepth = 0;
+        bool                                                        m_hasFailed = false;
+    };
+
+    //-------------------------------------------------------------------------
+
+    static bool StreamNativeTypeFromFile( FileSystem::Path const& filePath, NativeTypeStreamReader& typeReader )
+    {
+        Blob fileBuffer;
+        if ( !FileSystem::LoadFile( filePath, fileBuffer ) )
+        {
+            EE_LOG_ERROR( "TypeSystem", "Serialization", "Failed to read file: %s", filePath.c_str() );
+            return false;
+        }
+
+        fileBuffer.emplace_back( 0 );
+
+        //-------------------------------------------------------------------------
+
+        rapidjson::InsituStringStream stream( (char*) fileBuffer.data() );
+        rapidjson::Reader reader;
+        rapidjson::ParseResult const result = reader.Parse<rapidjson::kParseInsituFlag>( stream, typeReader );
+
+        if ( typeReader.HasFailed() )
+        {
+            return false;
+        }
+
+        if ( result.IsError() )
+        {
+            EE_LOG_ERROR( "TypeSystem", "Serialization", "Failed to parse JSON file (%s): %s", filePath.c_str(), GetJsonErrorMessage( result.Code() ) );
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ReadNativeTypeFromFile( TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, IReflectedType* pTypeInstance )
+    {
+        EE_ASSERT( filePath.IsFilePath() && pTypeInstance != nullptr );
+
+        NativeTypeStreamReader typeReader( typeRegistry, pTypeInstance );
+        return StreamNativeTypeFromFile( filePath, typeReader );
+    }
+
+    IReflectedType* TryCreateAndReadNativeTypeFromFile( TypeRegistry const& typeRegistry, FileSystem::Path const& filePath )
+    {
+        EE_ASSERT( filePath.IsFilePath() );
+
+        NativeTypeStreamReader typeReader( typeRegistry, nullptr );
+        bool const result = StreamNativeTypeFromFile( filePath, typeReader );
+
+        IReflectedType* pTypeInstance = typeReader.GetRootTypeInstance();
+        if ( !result && pTypeInstance != nullptr )
+        {
+            EE::Delete( pTypeInstance );
+        }
+
+        return pTypeInstance;
+    }
+}
+
 //-------------------------------------------------------------------------
 // Reader / Writer
 //-------------------------------------------------------------------------
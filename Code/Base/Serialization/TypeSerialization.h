@@ -51,6 +51,14 @@ namespace EE::Serialization
     // Create a new instance of a type from a supplied JSON version
     EE_BASE_API IReflectedType* TryCreateAndReadNativeType( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& typeObjectValue );
 
+    // Read the data for a native type directly from a JSON file without building a JSON document - expect a fully created type to be supplied and will override the values
+    // Only supports files containing a single serialized type
+    EE_BASE_API bool ReadNativeTypeFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, IReflectedType* pTypeInstance );
+
+    // Create a new instance of a type directly from a JSON file without building a JSON document - the type ID needs to be the first member of the serialized type
+    // Only supports files containing a single serialized type
+    EE_BASE_API IReflectedType* TryCreateAndReadNativeTypeFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath );
+
     // Create a new instance of a type from a supplied JSON version
     template<typename T>
     T* TryCreateAndReadNativeType( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& typeObjectValue )
@@ -0,0 +1,190 @@
+#include "AIScheduler.h"
+#include "Engine/AI/Components/Component_AI.h"
+#include "Engine/Entity/Entity.h"
+#include "Base/Math/ViewVolume.h"
+#include "Base/Profiling.h"
+#include <EASTL/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::AI
+{
+    // The cost we assume for agents in a bucket that has never been updated
+    constexpr static float const g_defaultAgentCostMilliseconds = 0.05f;
+
+    // Weight of the latest measurement in the running average agent cost
+    constexpr static float const g_agentCostSmoothingFactor = 0.1f;
+
+    //-------------------------------------------------------------------------
+
+    void AIScheduler::AddAgent( Entity const* pEntity, AIComponent* pAIComponent )
+    {
+        EE_ASSERT( pEntity != nullptr && pAIComponent != nullptr );
+
+        auto& agent = m_agents.emplace_back();
+        agent.m_pEntity = pEntity;
+        agent.m_pAIComponent = pAIComponent;
+
+        // New agents always run their first decision update
+        pAIComponent->m_timeSinceLastDecisionUpdate = 0.0f;
+        pAIComponent->m_isDecisionUpdateScheduled = true;
+        pAIComponent->m_hasUpdatedDecisions = false;
+    }
+
+    void AIScheduler::RemoveAgent( AIComponent* pAIComponent )
+    {
+        for ( int32_t i = 0; i < (int32_t) m_agents.size(); i++ )
+        {
+            if ( m_agents[i].m_pAIComponent == pAIComponent )
+            {
+                m_agents.erase_unsorted( m_agents.begin() + i );
+                return;
+            }
+        }
+
+        EE_UNREACHABLE_CODE();
+    }
+
+    //-------------------------------------------------------------------------
+
+    AIImportance AIScheduler::CalculateImportance( Agent const& agent, Math::ViewVolume const* pViewVolume ) const
+    {
+        // Without a viewer we have nothing to prioritize against
+        if ( pViewVolume == nullptr )
+        {
+            return AIImportance::High;
+        }
+
+        AIImportance importance = AIImportance::Low;
+        if ( agent.m_pEntity->IsSpatialEntity() )
+        {
+            Vector const& agentPosition = agent.m_pEntity->GetWorldTransform().GetTranslation();
+            float const distanceSq = agentPosition.GetDistanceSquared3( pViewVolume->GetViewPosition() );
+            if ( distanceSq <= Math::Sqr( m_settings.m_highImportanceDistance ) )
+            {
+                importance = AIImportance::High;
+            }
+            else if ( distanceSq <= Math::Sqr( m_settings.m_mediumImportanceDistance ) || pViewVolume->Contains( agentPosition ) )
+            {
+                importance = AIImportance::Medium;
+            }
+        }
+
+        // Combat raises the importance by a single level, far away fights dont need to react as quickly as the ones next to the player
+        if ( agent.m_pAIComponent->IsInCombat() && importance != AIImportance::High )
+        {
+            importance = (AIImportance) ( (uint8_t) importance - 1 );
+        }
+
+        return importance;
+    }
+
+    void AIScheduler::Update( Seconds deltaTime, Math::ViewVolume const* pViewVolume )
+    {
+        EE_PROFILE_FUNCTION_AI();
+
+        // Reset the per-frame stats, the average cost is kept across frames
+        for ( auto& stats : m_bucketStats )
+        {
+            Milliseconds const averageAgentCost = stats.m_averageAgentCost;
+            stats = BucketStats();
+            stats.m_averageAgentCost = averageAgentCost;
+        }
+
+        m_lastFrameCost = 0;
+        m_dueAgents.clear();
+
+        // Gather the results of the last frame and find all the agents that are due
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < (int32_t) m_agents.size(); i++ )
+        {
+            Agent& agent = m_agents[i];
+            AIComponent* pAIComponent = agent.m_pAIComponent;
+
+            // The cost is attributed to the bucket the agent was scheduled from
+            BucketStats& previousBucketStats = m_bucketStats[(int32_t) agent.m_importance];
+            if ( pAIComponent->m_hasUpdatedDecisions )
+            {
+                Milliseconds const cost = pAIComponent->m_lastDecisionUpdateCost;
+                previousBucketStats.m_numUpdated++;
+                previousBucketStats.m_totalTime += cost;
+                previousBucketStats.m_averageAgentCost = ( previousBucketStats.m_averageAgentCost == 0.0f ) ? cost : Milliseconds( Math::Lerp( previousBucketStats.m_averageAgentCost.ToFloat(), cost.ToFloat(), g_agentCostSmoothingFactor ) );
+                m_lastFrameCost += cost;
+
+                pAIComponent->m_timeSinceLastDecisionUpdate = 0.0f;
+                pAIComponent->m_hasUpdatedDecisions = false;
+            }
+            else
+            {
+                pAIComponent->m_timeSinceLastDecisionUpdate += deltaTime;
+            }
+
+            pAIComponent->m_isDecisionUpdateScheduled = false;
+
+            //-------------------------------------------------------------------------
+
+            agent.m_importance = CalculateImportance( agent, pViewVolume );
+            BucketStats& bucketStats = m_bucketStats[(int32_t) agent.m_importance];
+            bucketStats.m_numAgents++;
+            bucketStats.m_maxTimeSinceUpdate = Math::Max( bucketStats.m_maxTimeSinceUpdate.ToFloat(), pAIComponent->m_timeSinceLastDecisionUpdate.ToFloat() );
+
+            // We assume that next frame will be as long as this one
+            Seconds const interval = m_settings.m_updateIntervals[(int32_t) agent.m_importance];
+            if ( pAIComponent->m_timeSinceLastDecisionUpdate + deltaTime >= interval )
+            {
+                m_dueAgents.emplace_back( i );
+            }
+        }
+
+        if ( m_dueAgents.empty() )
+        {
+            return;
+        }
+
+        // Sort by how overdue agents are relative to their interval, this guarantees that carried over agents eventually get their turn
+        //-------------------------------------------------------------------------
+
+        float const frameTime = Math::Max( deltaTime.ToFloat(), Math::Epsilon );
+        auto GetOverdueRatio = [this, frameTime] ( int32_t agentIdx )
+        {
+            Agent const& agent = m_agents[agentIdx];
+            float const interval = Math::Max( m_settings.m_updateIntervals[(int32_t) agent.m_importance].ToFloat(), frameTime );
+            return ( agent.m_pAIComponent->m_timeSinceLastDecisionUpdate.ToFloat() + frameTime ) / interval;
+        };
+
+        auto SortPredicate = [&] ( int32_t lhs, int32_t rhs )
+        {
+            float const lhsRatio = GetOverdueRatio( lhs );
+            float const rhsRatio = GetOverdueRatio( rhs );
+            if ( lhsRatio != rhsRatio )
+            {
+                return lhsRatio > rhsRatio;
+            }
+
+            return m_agents[lhs].m_importance < m_agents[rhs].m_importance;
+        };
+
+        eastl::sort( m_dueAgents.begin(), m_dueAgents.end(), SortPredicate );
+
+        // Schedule as many agents as fit in the budget, we always schedule at least one agent to guarantee progress
+        //-------------------------------------------------------------------------
+
+        float estimatedCost = 0.0f;
+        for ( int32_t i = 0; i < (int32_t) m_dueAgents.size(); i++ )
+        {
+            Agent& agent = m_agents[m_dueAgents[i]];
+            BucketStats& bucketStats = m_bucketStats[(int32_t) agent.m_importance];
+            float const agentCost = ( bucketStats.m_averageAgentCost > 0.0f ) ? bucketStats.m_averageAgentCost.ToFloat() : g_defaultAgentCostMilliseconds;
+
+            if ( i > 0 && ( estimatedCost + agentCost ) > m_settings.m_frameBudget )
+            {
+                bucketStats.m_numCarriedOver++;
+                continue;
+            }
+
+            estimatedCost += agentCost;
+            agent.m_pAIComponent->m_isDecisionUpdateScheduled = true;
+        }
+    }
+}
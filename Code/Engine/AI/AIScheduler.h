@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Time/Time.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class Entity;
+    namespace Math { class ViewVolume; }
+}
+
+//-------------------------------------------------------------------------
+// AI Scheduler
+//-------------------------------------------------------------------------
+// Decides which AI agents get to run their decision update each frame.
+// Only the decision making (behavior selection, goal selection and navmesh queries) is time-sliced, steering and the actions are still updated every frame.
+// Agents are bucketed by importance (agents in combat are moved up a level), each bucket has a target update interval and the whole schedule is limited by a per-frame budget.
+// Due agents are processed in order of how overdue they are (relative to their interval), so agents that miss the budget
+// are carried over to the next frame with a higher priority and no agent is starved.
+// The cost of each agent is only known once it has updated, so the budget is enforced using the measured average cost per bucket.
+
+namespace EE::AI
+{
+    class AIComponent;
+
+    //-------------------------------------------------------------------------
+
+    enum class AIImportance : uint8_t
+    {
+        High = 0,   // Close to the player
+        Medium,     // On-screen or at medium range
+        Low,        // Everything else
+
+        NumLevels
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API AIScheduler
+    {
+    public:
+
+        constexpr static int32_t const s_numBuckets = (int32_t) AIImportance::NumLevels;
+
+        struct Settings
+        {
+            float                           m_highImportanceDistance = 15.0f;
+            float                           m_mediumImportanceDistance = 40.0f;
+            Seconds                         m_updateIntervals[s_numBuckets] = { 0.1f, 0.25f, 0.5f };
+            Milliseconds                    m_frameBudget = 2.0f;
+        };
+
+        struct BucketStats
+        {
+            int32_t                         m_numAgents = 0;
+            int32_t                         m_numUpdated = 0;               // Last frame
+            int32_t                         m_numCarriedOver = 0;           // Due agents that didnt fit in the budget last frame
+            Milliseconds                    m_totalTime = 0;                // Measured cost of last frame's updates
+            Milliseconds                    m_averageAgentCost = 0;         // Running average of the cost of a single agent update
+            Seconds                         m_maxTimeSinceUpdate = 0;       // Worst update latency in the bucket
+        };
+
+    private:
+
+        struct Agent
+        {
+            AIComponent*                    m_pAIComponent = nullptr;
+            Entity const*                   m_pEntity = nullptr;
+            AIImportance                    m_importance = AIImportance::High;
+        };
+
+    public:
+
+        void AddAgent( Entity const* pEntity, AIComponent* pAIComponent );
+        void RemoveAgent( AIComponent* pAIComponent );
+        inline int32_t GetNumAgents() const { return (int32_t) m_agents.size(); }
+
+        // Collect the costs of the last decision updates and choose the agents that update their decisions next
+        // The view volume is the player's view, if there is no view volume all agents are considered important
+        void Update( Seconds deltaTime, Math::ViewVolume const* pViewVolume );
+
+        inline Settings& GetSettings() { return m_settings; }
+        inline Settings const& GetSettings() const { return m_settings; }
+        inline BucketStats const& GetBucketStats( AIImportance importance ) const { return m_bucketStats[(int32_t) importance]; }
+        inline Milliseconds GetLastFrameCost() const { return m_lastFrameCost; }
+
+    private:
+
+        AIImportance CalculateImportance( Agent const& agent, Math::ViewVolume const* pViewVolume ) const;
+
+    private:
+
+        Settings                            m_settings;
+        TVector<Agent>                      m_agents;
+        BucketStats                         m_bucketStats[s_numBuckets];
+        Milliseconds                        m_lastFrameCost = 0;
+
+        // Temporary storage reused every frame
+        TVector<int32_t>                    m_dueAgents;
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Entity/EntitySpatialComponent.h"
+#include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
 // AI Component
@@ -17,5 +18,31 @@ namespace EE::AI
 
         inline AIComponent() = default;
         inline AIComponent( StringID name ) : EntityComponent( name ) {}
+
+        // Combat state, set by the combat behaviors. AI in combat are scheduled one importance level higher than their distance/visibility would give them
+        inline bool IsInCombat() const { return m_isInCombat; }
+        inline void SetInCombat( bool isInCombat ) { m_isInCombat = isInCombat; }
+
+        // Decision Scheduling
+        //-------------------------------------------------------------------------
+        // Set by the AI manager's scheduler, AI should only run their decision update (behavior selection, goal selection, navmesh queries) when it is scheduled
+
+        inline bool IsDecisionUpdateScheduled() const { return m_isDecisionUpdateScheduled; }
+
+        // The time elapsed since the last decision update (excluding the current frame)
+        inline Seconds GetTimeSinceLastDecisionUpdate() const { return m_timeSinceLastDecisionUpdate; }
+
+        // Report that the decision update ran and how long it took
+        inline void OnDecisionsUpdated( Milliseconds cost ) { m_lastDecisionUpdateCost = cost; m_hasUpdatedDecisions = true; }
+
+    private:
+
+        friend class AIScheduler;
+
+        Seconds                 m_timeSinceLastDecisionUpdate = 0.0f;
+        Milliseconds            m_lastDecisionUpdateCost = 0.0f;
+        bool                    m_isDecisionUpdateScheduled = true;
+        bool                    m_hasUpdatedDecisions = false;
+        bool                    m_isInCombat = false;
     };
 }
\ No newline at end of file
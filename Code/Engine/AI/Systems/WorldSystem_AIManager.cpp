@@ -4,6 +4,8 @@
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityMap.h"
+#include "Engine/Player/Systems/WorldSystem_PlayerManager.h"
+#include "Engine/Camera/Components/Component_Camera.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Threading/TaskSystem.h"
 
@@ -26,6 +28,7 @@ namespace EE::AI
         if ( auto pAIComponent = TryCast<AIComponent>( pComponent ) )
         {
             m_AIs.emplace_back( pAIComponent );
+            m_scheduler.AddAgent( pEntity, pAIComponent );
         }
     }
 
@@ -39,6 +42,7 @@ namespace EE::AI
         if ( auto pAIComponent = TryCast<AIComponent>( pComponent ) )
         {
             m_AIs.erase_first( pAIComponent );
+            m_scheduler.RemoveAgent( pAIComponent );
         }
     }
 
@@ -50,6 +54,19 @@ namespace EE::AI
         {
             m_hasSpawnedAI = TrySpawnAI( ctx );
         }
+
+        // Schedule the decision updates for the next frame
+        //-------------------------------------------------------------------------
+        // The AI controllers update before the world systems, so they will consume this schedule next frame
+
+        Math::ViewVolume const* pViewVolume = nullptr;
+        auto pPlayerManager = ctx.GetWorldSystem<PlayerManager>();
+        if ( pPlayerManager->HasPlayer() && pPlayerManager->GetPlayerCamera() != nullptr )
+        {
+            pViewVolume = &pPlayerManager->GetPlayerCamera()->GetViewVolume();
+        }
+
+        m_scheduler.Update( ctx.GetDeltaTime(), pViewVolume );
     }
 
     bool AIManager::TrySpawnAI( EntityWorldUpdateContext const& ctx )
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Engine/AI/AIScheduler.h"
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Base/Types/IDVector.h"
 
@@ -20,6 +21,8 @@ namespace EE::AI
 
         EE_ENTITY_WORLD_SYSTEM( AIManager, RequiresUpdate( UpdateStage::PrePhysics ) );
 
+        inline AIScheduler const& GetScheduler() const { return m_scheduler; }
+
     private:
 
         virtual void ShutdownSystem() override final;
@@ -36,6 +39,7 @@ namespace EE::AI
 
         TVector<AISpawnComponent*>          m_spawnPoints;
         TVector<AIComponent*>               m_AIs;
+        AIScheduler                         m_scheduler;
         bool                                m_hasSpawnedAI = false;
     };
 } 
\ No newline at end of file
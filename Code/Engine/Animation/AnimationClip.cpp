@@ -2,6 +2,7 @@
 #include "Engine/Animation/AnimationPose.h"
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Profiling.h"
+#include <EASTL/sort.h>
 
 //-------------------------------------------------------------------------
 
@@ -109,4 +110,61 @@ namespace EE::Animation
 
         return skeletons;
     }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationClip::InitializeEventSearchData()
+    {
+        int32_t const numEvents = (int32_t) m_events.size();
+
+        m_eventStartTimes.resize( numEvents );
+        m_eventEndTimes.resize( numEvents );
+        m_eventTimeOrder.resize( numEvents );
+        m_eventTypeRanges.clear();
+        m_maxEventDuration = 0.0f;
+
+        for ( int32_t i = 0; i < numEvents; i++ )
+        {
+            Event const* pEvent = m_events[i];
+            FloatRange const timeRange = pEvent->GetTimeRange();
+            m_eventStartTimes[i] = timeRange.m_begin;
+            m_eventEndTimes[i] = timeRange.m_end;
+            m_eventTimeOrder[i] = i;
+            m_maxEventDuration = Math::Max( m_maxEventDuration, pEvent->GetDuration().ToFloat() );
+
+            // Create type ranges, the compiler groups the events by type
+            TypeSystem::TypeInfo const* pTypeInfo = pEvent->GetTypeInfo();
+            if ( m_eventTypeRanges.empty() || m_eventTypeRanges.back().m_pTypeInfo != pTypeInfo )
+            {
+                #if EE_DEVELOPMENT_TOOLS
+                for ( auto const& existingTypeRange : m_eventTypeRanges )
+                {
+                    EE_ASSERT( existingTypeRange.m_pTypeInfo != pTypeInfo );
+                }
+                #endif
+
+                EventTypeRange& newTypeRange = m_eventTypeRanges.emplace_back();
+                newTypeRange.m_pTypeInfo = pTypeInfo;
+                newTypeRange.m_firstEventIdx = i;
+            }
+
+            EventTypeRange& typeRange = m_eventTypeRanges.back();
+            EE_ASSERT( typeRange.m_numEvents == 0 || m_eventStartTimes[i - 1] <= m_eventStartTimes[i] );
+            typeRange.m_numEvents++;
+            typeRange.m_maxDuration = Math::Max( typeRange.m_maxDuration, pEvent->GetDuration().ToFloat() );
+        }
+
+        // Sort the event indices by start time, ties are resolved by index to keep the order deterministic
+        auto SortPredicate = [this] ( int32_t lhs, int32_t rhs )
+        {
+            if ( m_eventStartTimes[lhs] != m_eventStartTimes[rhs] )
+            {
+                return m_eventStartTimes[lhs] < m_eventStartTimes[rhs];
+            }
+
+            return lhs < rhs;
+        };
+
+        eastl::sort( m_eventTimeOrder.begin(), m_eventTimeOrder.end(), SortPredicate );
+    }
 }
\ No newline at end of file
@@ -90,6 +90,15 @@ namespace EE::Animation
         friend class AnimationClipCompiler;
         friend class AnimationClipLoader;
 
+        // A contiguous range of events (in the events array) that all have the same type
+        struct EventTypeRange
+        {
+            TypeSystem::TypeInfo const*         m_pTypeInfo = nullptr;
+            int32_t                             m_firstEventIdx = 0;
+            int32_t                             m_numEvents = 0;
+            float                               m_maxDuration = 0.0f;
+        };
+
     private:
 
         EE_FORCE_INLINE static Quaternion DecodeRotation( uint16_t const* pData )
@@ -171,23 +180,44 @@ namespace EE::Animation
         // Events
         //-------------------------------------------------------------------------
 
-        // Get all the events for this animation
+        // Get all the events for this animation - events are grouped by type and each type is sorted by start time
         inline TVector<Event*> const& GetEvents() const { return m_events; }
 
-        // Get all the events for the specified range. This function will append the results to the output array. Handle's looping but assumes only a single loop occurred!
-        inline void GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const;
+        // Get all the events for the specified range, sorted by start time. This function will append the results to the output array. Handle's looping but assumes only a single loop occurred!
+        // The optional search hint is the search position from the previous query, callers that sample the clip sequentially should keep it around
+        inline void GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents, int32_t* pSearchHint = nullptr ) const;
 
-        // Get all the events for the specified range. This function will append the results to the output array. DOES NOT SUPPORT LOOPING!
-        inline void GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const;
+        // Get all the events for the specified range, sorted by start time. This function will append the results to the output array. DOES NOT SUPPORT LOOPING!
+        inline void GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents, int32_t* pSearchHint = nullptr ) const;
 
         // Helper function that converts percentage times to actual anim times
-        EE_FORCE_INLINE void GetEventsForRange( Percentage fromTime, Percentage toTime, TInlineVector<Event const*, 10>& outEvents ) const
+        EE_FORCE_INLINE void GetEventsForRange( Percentage fromTime, Percentage toTime, TInlineVector<Event const*, 10>& outEvents, int32_t* pSearchHint = nullptr ) const
         {
             EE_ASSERT( fromTime >= 0.0f && fromTime <= 1.0f );
             EE_ASSERT( toTime >= 0.0f && toTime <= 1.0f );
-            GetEventsForRange( m_duration * fromTime, m_duration * toTime, outEvents );
+            GetEventsForRange( m_duration * fromTime, m_duration * toTime, outEvents, pSearchHint );
         }
 
+        // Typed Events
+        //-------------------------------------------------------------------------
+        // These only visit the events of the requested type (and derived types), results are sorted by start time per event type
+
+        // Does this animation have any events of the specified type
+        template<typename T>
+        inline bool HasEventOfType() const { return GetFirstEventOfType<T>() != nullptr; }
+
+        // Get the earliest event of the specified type
+        template<typename T>
+        inline T const* GetFirstEventOfType() const;
+
+        // Get all the events of the specified type. This function will append the results to the output array
+        template<typename T>
+        inline void GetEventsOfType( TInlineVector<T const*, 10>& outEvents ) const;
+
+        // Get the events of the specified type for the specified range. This function will append the results to the output array. Handle's looping but assumes only a single loop occurred!
+        template<typename T>
+        inline void GetEventsOfTypeForRange( Seconds fromTime, Seconds toTime, TInlineVector<T const*, 10>& outEvents ) const;
+
         // Root motion
         //-------------------------------------------------------------------------
 
@@ -221,6 +251,18 @@ namespace EE::Animation
         // Get the rotation delta for this animation
         EE_FORCE_INLINE Quaternion const& GetRotationDelta() const { return m_rootMotion.m_totalDelta.GetRotation(); }
 
+    private:
+
+        // Create the type ranges and sorted search data for the events, the events need to already be grouped by type
+        void InitializeEventSearchData();
+
+        // Find the first entry in the time sorted event order that starts at or after the specified time
+        inline int32_t FindFirstSortedEventIndex( float minStartTime, int32_t const* pSearchHint ) const;
+
+        // Append all the events in the type range that overlap the time range
+        template<typename T>
+        inline void GetEventsOfTypeForRangeNoLooping( EventTypeRange const& typeRange, float fromTime, float toTime, TInlineVector<T const*, 10>& outEvents ) const;
+
     private:
 
         TResourcePtr<Skeleton>                  m_skeleton;
@@ -229,7 +271,12 @@ namespace EE::Animation
         TVector<uint16_t>                       m_compressedPoseData;
         TVector<TrackCompressionSettings>       m_trackCompressionSettings;
         TVector<uint32_t>                       m_compressedPoseOffsets;
-        TVector<Event*>                         m_events;
+        TVector<Event*>                         m_events;                   // Grouped by type, each type sorted by start time
+        TVector<float>                          m_eventStartTimes;          // Same order as the events array
+        TVector<float>                          m_eventEndTimes;            // Same order as the events array
+        TVector<int32_t>                        m_eventTimeOrder;           // Event indices sorted by start time
+        TInlineVector<EventTypeRange, 4>        m_eventTypeRanges;
+        float                                   m_maxEventDuration = 0.0f;
         TInlineVector<AnimationClip const*,1>   m_secondaryAnimations;
         SyncTrack                               m_syncTrack;
         bool                                    m_isAdditive = false;
@@ -244,35 +291,192 @@ namespace EE::Animation
 
 namespace EE::Animation
 {
-    inline void AnimationClip::GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const
+    inline int32_t AnimationClip::FindFirstSortedEventIndex( float minStartTime, int32_t const* pSearchHint ) const
+    {
+        int32_t const numEvents = (int32_t) m_eventTimeOrder.size();
+
+        // Sequential sampling will usually find the same position as the last query
+        if ( pSearchHint != nullptr )
+        {
+            int32_t const hintIdx = *pSearchHint;
+            if ( hintIdx >= 0 && hintIdx <= numEvents )
+            {
+                bool const isAfterPrevious = ( hintIdx == 0 ) || ( m_eventStartTimes[m_eventTimeOrder[hintIdx - 1]] < minStartTime );
+                bool const isAtOrBeforeCurrent = ( hintIdx == numEvents ) || ( m_eventStartTimes[m_eventTimeOrder[hintIdx]] >= minStartTime );
+                if ( isAfterPrevious && isAtOrBeforeCurrent )
+                {
+                    return hintIdx;
+                }
+            }
+        }
+
+        // Binary search
+        int32_t first = 0;
+        int32_t count = numEvents;
+        while ( count > 0 )
+        {
+            int32_t const step = count / 2;
+            int32_t const middle = first + step;
+            if ( m_eventStartTimes[m_eventTimeOrder[middle]] < minStartTime )
+            {
+                first = middle + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    inline void AnimationClip::GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents, int32_t* pSearchHint ) const
     {
         EE_ASSERT( toTime >= fromTime );
 
-        for ( auto const& pEvent : m_events )
+        // No event that starts before the longest event duration prior to the range can overlap it
+        int32_t const firstIdx = FindFirstSortedEventIndex( fromTime.ToFloat() - m_maxEventDuration, pSearchHint );
+        if ( pSearchHint != nullptr )
+        {
+            *pSearchHint = firstIdx;
+        }
+
+        int32_t const numEvents = (int32_t) m_eventTimeOrder.size();
+        for ( int32_t i = firstIdx; i < numEvents; i++ )
         {
-            // Events are stored sorted by time so as soon as we reach an event after the end of the time range, we're done
-            if ( pEvent->GetStartTime() > toTime )
+            // Events are sorted by start time so as soon as we reach an event after the end of the time range, we're done
+            int32_t const eventIdx = m_eventTimeOrder[i];
+            if ( m_eventStartTimes[eventIdx] > toTime )
             {
                 break;
             }
 
-            if ( FloatRange( fromTime, toTime ).Overlaps( pEvent->GetTimeRange() ) )
+            if ( m_eventEndTimes[eventIdx] >= fromTime )
             {
-                outEvents.emplace_back( pEvent );
+                outEvents.emplace_back( m_events[eventIdx] );
             }
         }
     }
 
-    EE_FORCE_INLINE void AnimationClip::GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const
+    EE_FORCE_INLINE void AnimationClip::GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents, int32_t* pSearchHint ) const
     {
         if ( fromTime <= toTime )
         {
-            GetEventsForRangeNoLooping( fromTime, toTime, outEvents );
+            GetEventsForRangeNoLooping( fromTime, toTime, outEvents, pSearchHint );
         }
         else
         {
+            // The hint is only updated by the second query since that is where sampling will continue from
             GetEventsForRangeNoLooping( fromTime, m_duration, outEvents );
-            GetEventsForRangeNoLooping( 0, toTime, outEvents );
+            GetEventsForRangeNoLooping( 0, toTime, outEvents, pSearchHint );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<typename T>
+    inline T const* AnimationClip::GetFirstEventOfType() const
+    {
+        static_assert( std::is_base_of<Event, T>::value, "T must be an animation event" );
+
+        T const* pFirstEvent = nullptr;
+        for ( auto const& typeRange : m_eventTypeRanges )
+        {
+            if ( !typeRange.m_pTypeInfo->IsDerivedFrom<T>() )
+            {
+                continue;
+            }
+
+            Event const* pEvent = m_events[typeRange.m_firstEventIdx];
+            if ( pFirstEvent == nullptr || pEvent->GetStartTime() < pFirstEvent->GetStartTime() )
+            {
+                pFirstEvent = static_cast<T const*>( pEvent );
+            }
+        }
+
+        return pFirstEvent;
+    }
+
+    template<typename T>
+    inline void AnimationClip::GetEventsOfType( TInlineVector<T const*, 10>& outEvents ) const
+    {
+        static_assert( std::is_base_of<Event, T>::value, "T must be an animation event" );
+
+        for ( auto const& typeRange : m_eventTypeRanges )
+        {
+            if ( !typeRange.m_pTypeInfo->IsDerivedFrom<T>() )
+            {
+                continue;
+            }
+
+            for ( int32_t i = typeRange.m_firstEventIdx; i < typeRange.m_firstEventIdx + typeRange.m_numEvents; i++ )
+            {
+                outEvents.emplace_back( static_cast<T const*>( m_events[i] ) );
+            }
+        }
+    }
+
+    template<typename T>
+    inline void AnimationClip::GetEventsOfTypeForRangeNoLooping( EventTypeRange const& typeRange, float fromTime, float toTime, TInlineVector<T const*, 10>& outEvents ) const
+    {
+        EE_ASSERT( toTime >= fromTime );
+
+        // Binary search for the first event that could overlap the range
+        float const minStartTime = fromTime - typeRange.m_maxDuration;
+        int32_t first = typeRange.m_firstEventIdx;
+        int32_t count = typeRange.m_numEvents;
+        while ( count > 0 )
+        {
+            int32_t const step = count / 2;
+            int32_t const middle = first + step;
+            if ( m_eventStartTimes[middle] < minStartTime )
+            {
+                first = middle + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+
+        int32_t const endIdx = typeRange.m_firstEventIdx + typeRange.m_numEvents;
+        for ( int32_t i = first; i < endIdx; i++ )
+        {
+            if ( m_eventStartTimes[i] > toTime )
+            {
+                break;
+            }
+
+            if ( m_eventEndTimes[i] >= fromTime )
+            {
+                outEvents.emplace_back( static_cast<T const*>( m_events[i] ) );
+            }
+        }
+    }
+
+    template<typename T>
+    inline void AnimationClip::GetEventsOfTypeForRange( Seconds fromTime, Seconds toTime, TInlineVector<T const*, 10>& outEvents ) const
+    {
+        static_assert( std::is_base_of<Event, T>::value, "T must be an animation event" );
+
+        for ( auto const& typeRange : m_eventTypeRanges )
+        {
+            if ( !typeRange.m_pTypeInfo->IsDerivedFrom<T>() )
+            {
+                continue;
+            }
+
+            if ( fromTime <= toTime )
+            {
+                GetEventsOfTypeForRangeNoLooping( typeRange, fromTime.ToFloat(), toTime.ToFloat(), outEvents );
+            }
+            else
+            {
+                GetEventsOfTypeForRangeNoLooping( typeRange, fromTime.ToFloat(), m_duration.ToFloat(), outEvents );
+                GetEventsOfTypeForRangeNoLooping( typeRange, 0.0f, toTime.ToFloat(), outEvents );
+            }
         }
     }
 }
\ No newline at end of file
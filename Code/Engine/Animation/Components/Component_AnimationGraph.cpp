@@ -1,6 +1,7 @@
 #include "Component_AnimationGraph.h"
 #include "Engine/Entity/EntityLog.h"
 #include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_InstancePool.h"
 #include "Engine/Animation/AnimationPose.h"
 #include "Engine/UpdateContext.h"
 #include "Engine/Physics/PhysicsWorld.h"
@@ -21,7 +22,7 @@ namespace EE::Animation
         //-------------------------------------------------------------------------
 
         EE_ASSERT( m_pGraphVariation.IsLoaded() );
-        m_pGraphInstance = EE::New<GraphInstance>( m_pGraphVariation.GetPtr(), GetEntityID().m_value );
+        m_pGraphInstance = m_pGraphVariation->GetInstancePool()->AcquireInstance( GetEntityID().m_value );
 
         if ( !m_secondarySkeletons.empty() )
         {
@@ -32,7 +33,13 @@ namespace EE::Animation
     void GraphComponent::Shutdown()
     {
         m_secondarySkeletons.clear();
-        EE::Delete( m_pGraphInstance );
+
+        if ( m_pGraphInstance != nullptr )
+        {
+            m_pGraphVariation->GetInstancePool()->ReleaseInstance( m_pGraphInstance );
+            m_pGraphInstance = nullptr;
+        }
+
         EntityComponent::Shutdown();
     }
 
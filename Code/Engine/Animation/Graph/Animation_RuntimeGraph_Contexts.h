@@ -122,7 +122,7 @@ namespace EE::Animation
         Inactive,
     };
 
-    class GraphContext final
+    class EE_ENGINE_API GraphContext final
     {
         friend class GraphInstance;
 
@@ -153,6 +153,9 @@ namespace EE::Animation
         //-------------------------------------------------------------------------
 
         #if EE_DEVELOPMENT_TOOLS
+        // Set by the graph instance, these need to be supplied when updating nodes outside of a graph instance
+        void SetDebugSystems( RootMotionDebugger* pRootMotionRecorder, TVector<int16_t>* pActiveNodesList, TVector<GraphLogEntry>* pLog );
+
         // Flag a node as active
         inline void TrackActiveNode( int16_t nodeIdx ) { EE_ASSERT( nodeIdx != InvalidIndex ); m_pActiveNodes->emplace_back( nodeIdx ); }
 
@@ -171,10 +174,6 @@ namespace EE::Animation
         GraphContext( GraphContext const& ) = delete;
         GraphContext& operator=( GraphContext& ) = delete;
 
-        #if EE_DEVELOPMENT_TOOLS
-        void SetDebugSystems( RootMotionDebugger* pRootMotionRecorder, TVector<int16_t>* pActiveNodesList, TVector<GraphLogEntry>* pLog );
-        #endif
-
     public:
 
         // Set at construction
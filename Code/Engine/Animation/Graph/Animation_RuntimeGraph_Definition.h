@@ -7,6 +7,10 @@
 
 namespace EE::Animation
 {
+    class GraphInstancePool;
+
+    //-------------------------------------------------------------------------
+
     class EE_ENGINE_API GraphDefinition final : public Resource::IResource
     {
         EE_RESOURCE( 'ag', "Animation Graph" );
@@ -45,6 +49,13 @@ namespace EE::Animation
 
         virtual bool IsValid() const override { return m_rootNodeIdx != InvalidIndex; }
 
+        // Node info, this allows instantiating parts of the graph outside of a graph instance (e.g. for benchmarks)
+        inline int16_t GetNumNodes() const { return (int16_t) m_nodeDefinitions.size(); }
+        inline GraphNode::Definition const* GetNodeDefinition( int16_t nodeIdx ) const { EE_ASSERT( nodeIdx >= 0 && nodeIdx < m_nodeDefinitions.size() ); return m_nodeDefinitions[nodeIdx]; }
+        inline TVector<uint32_t> const& GetInstanceNodeStartOffsets() const { return m_instanceNodeStartOffsets; }
+        inline uint32_t GetInstanceRequiredMemory() const { return m_instanceRequiredMemory; }
+        inline uint32_t GetInstanceRequiredAlignment() const { return m_instanceRequiredAlignment; }
+
         #if EE_DEVELOPMENT_TOOLS
         String const& GetNodePath( int16_t nodeIdx ) const{ return m_nodePaths[nodeIdx]; }
         #endif
@@ -76,7 +87,7 @@ namespace EE::Animation
     class EE_ENGINE_API GraphVariation final : public Resource::IResource
     {
         EE_RESOURCE( 'agv', "Animation Graph Variation" );
-        EE_SERIALIZE( m_pGraphDefinition, m_dataSet );
+        EE_SERIALIZE( m_pGraphDefinition, m_dataSet, m_instancePoolSize );
 
         friend class AnimationGraphCompiler;
         friend class GraphLoader;
@@ -111,9 +122,18 @@ namespace EE::Animation
             return m_dataSet;
         }
 
+        // The pool that instances of this variation should be acquired from, only available once the variation is installed
+        inline GraphInstancePool* GetInstancePool() const
+        {
+            EE_ASSERT( m_pInstancePool != nullptr );
+            return m_pInstancePool;
+        }
+
     protected:
 
         TResourcePtr<GraphDefinition>               m_pGraphDefinition = nullptr;
         GraphDataSet                                m_dataSet;
+        int32_t                                     m_instancePoolSize = 0;     // The number of instances to create at load time and keep for reuse
+        GraphInstancePool*                          m_pInstancePool = nullptr;
     };
 }
\ No newline at end of file
@@ -60,8 +60,15 @@ namespace EE::Animation
         TInlineVector<GraphInstance*, 20> createdChildGraphInstances;
         createdChildGraphInstances.reserve( numChildGraphs );
 
-        for ( auto const& childGraphSlot : pGraphDef->m_childGraphSlots )
+        // All child graph instances are allocated in a single block, each slot has a fixed location in the block
+        if ( numChildGraphs > 0 )
         {
+            m_pChildGraphInstanceMemory = reinterpret_cast<GraphInstance*>( EE::Alloc( sizeof( GraphInstance ) * numChildGraphs, alignof( GraphInstance ) ) );
+        }
+
+        for ( size_t slotIdx = 0; slotIdx < numChildGraphs; slotIdx++ )
+        {
+            auto const& childGraphSlot = pGraphDef->m_childGraphSlots[slotIdx];
             auto pChildGraphVariation = m_pGraphVariation->m_dataSet.GetResource<GraphVariation>( childGraphSlot.m_dataSlotIdx );
             if ( pChildGraphVariation != nullptr )
             {
@@ -69,7 +76,7 @@ namespace EE::Animation
                 {
                     ChildGraph cg;
                     cg.m_nodeIdx = childGraphSlot.m_nodeIdx;
-                    cg.m_pInstance = new ( EE::Alloc( sizeof( GraphInstance ) ) ) GraphInstance( pChildGraphVariation, m_ownerID, pFinalTaskSystem, pFinalSampledEventsBuffer );
+                    cg.m_pInstance = new ( m_pChildGraphInstanceMemory + slotIdx ) GraphInstance( pChildGraphVariation, m_ownerID, pFinalTaskSystem, pFinalSampledEventsBuffer );
                     m_childGraphs.emplace_back( cg );
 
                     createdChildGraphInstances.emplace_back( cg.m_pInstance );
@@ -165,16 +172,85 @@ namespace EE::Animation
             if ( childGraph.m_pInstance != nullptr )
             {
                 childGraph.m_pInstance->~GraphInstance();
-                EE::Free( childGraph.m_pInstance );
             }
         }
         m_childGraphs.clear();
 
+        if ( m_pChildGraphInstanceMemory != nullptr )
+        {
+            EE::Free( m_pChildGraphInstanceMemory );
+        }
+
         EE::Free( m_pAllocatedInstanceMemory );
         EE::Delete( m_pTaskSystem );
         EE::Delete( m_pSampledEventsBuffer );
     }
 
+    void GraphInstance::ResetToInitialState()
+    {
+        // External graphs are owned by the user so they need to be disconnected before the instance is recycled
+        EE_ASSERT( m_externalGraphs.empty() );
+
+        if ( m_pRootNode->IsInitialized() )
+        {
+            m_pRootNode->Shutdown( m_graphContext );
+        }
+
+        // Persistent nodes (i.e. control parameters) keep their state across graph resets so they need to be recreated
+        auto pGraphDef = m_pGraphVariation->m_pGraphDefinition.GetPtr();
+        for ( auto nodeIdx : pGraphDef->m_persistentNodeIndices )
+        {
+            m_nodes[nodeIdx]->Shutdown( m_graphContext );
+        }
+
+        for ( auto nodeIdx : pGraphDef->m_persistentNodeIndices )
+        {
+            m_nodes[nodeIdx]->Initialize( m_graphContext );
+        }
+
+        for ( auto const& childGraph : m_childGraphs )
+        {
+            if ( childGraph.m_pInstance != nullptr )
+            {
+                childGraph.m_pInstance->ResetToInitialState();
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( m_isStandaloneGraph )
+        {
+            m_pTaskSystem->ResetToInitialState();
+            m_pSampledEventsBuffer->Clear();
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        EE_ASSERT( m_pRecorder == nullptr );
+        m_activeNodes.clear();
+        m_debugMode = GraphDebugMode::Off;
+        m_rootMotionDebugger.SetDebugMode( RootMotionDebugMode::Off );
+        m_rootMotionDebugger.ResetRecordedPositions();
+        m_debugFilterNodes.clear();
+        m_log.clear();
+        m_lastOutputtedLogItemIdx = 0;
+        #endif
+    }
+
+    void GraphInstance::SetOwnerID( uint64_t ownerID )
+    {
+        EE_ASSERT( ownerID != 0 );
+        m_ownerID = ownerID;
+        m_graphContext.m_graphUserID = ownerID;
+
+        for ( auto const& childGraph : m_childGraphs )
+        {
+            if ( childGraph.m_pInstance != nullptr )
+            {
+                childGraph.m_pInstance->SetOwnerID( ownerID );
+            }
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     void GraphInstance::GetResourceLookupTables( TInlineVector<ResourceLUT const*, 10>& LUTs ) const
@@ -38,6 +38,7 @@ namespace EE::Animation
     class EE_ENGINE_API GraphInstance
     {
         friend class AnimationDebugView;
+        friend class GraphInstancePool;
 
     public:
 
@@ -397,6 +398,13 @@ namespace EE::Animation
         explicit GraphInstance( GraphVariation const* pGraphVariation, uint64_t ownerID, TaskSystem* pTaskSystem, SampledEventsBuffer* pSampledEventsBuffer );
 
         EE_FORCE_INLINE bool IsControlParameter( int16_t nodeIdx ) const { return nodeIdx < GetNumControlParameters(); }
+
+        // Return the instance to the state it was in when created (including all child graphs), used when recycling pooled instances
+        void ResetToInitialState();
+
+        // Change the owner of this instance and all its child graphs
+        void SetOwnerID( uint64_t ownerID );
+
         int32_t GetExternalGraphSlotIndex( StringID slotID ) const;
         int16_t GetExternalGraphNodeIndex( StringID slotID ) const;
         int32_t GetConnectedExternalGraphIndex( StringID slotID ) const;
@@ -431,6 +439,7 @@ namespace EE::Animation
         SampledEventsBuffer*                    m_pSampledEventsBuffer = nullptr;
         GraphContext                            m_graphContext;
         TVector<ChildGraph>                     m_childGraphs;
+        GraphInstance*                          m_pChildGraphInstanceMemory = nullptr; // Contiguous storage for all child graph instances (indexed by child graph slot)
         TVector<ExternalGraph>                  m_externalGraphs;
 
         #if EE_DEVELOPMENT_TOOLS
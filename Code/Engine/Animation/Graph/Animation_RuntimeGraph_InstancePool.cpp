@@ -0,0 +1,165 @@
+#include "Animation_RuntimeGraph_InstancePool.h"
+#include "Animation_RuntimeGraph_Instance.h"
+#include "Base/Time/Timers.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    // The owner ID used for instances sitting in the pool, the real owner is set when the instance is acquired
+    constexpr static uint64_t const g_pooledInstanceOwnerID = 0xFFFFFFFFFFFFFFFF;
+
+    //-------------------------------------------------------------------------
+
+    GraphInstancePool::GraphInstancePool( GraphVariation const* pGraphVariation, int32_t poolSize )
+        : m_pGraphVariation( pGraphVariation )
+        , m_poolSize( Math::Max( poolSize, 0 ) )
+    {
+        EE_ASSERT( m_pGraphVariation != nullptr );
+        m_freeInstances.reserve( m_poolSize );
+    }
+
+    GraphInstancePool::~GraphInstancePool()
+    {
+        EE_ASSERT( m_numAcquiredInstances == 0 );
+
+        for ( auto pInstance : m_freeInstances )
+        {
+            EE::Delete( pInstance );
+        }
+
+        m_freeInstances.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    GraphInstance* GraphInstancePool::CreateInstance( uint64_t ownerID )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Graph Instance Pool - Create Instance" );
+
+        #if EE_DEVELOPMENT_TOOLS
+        Timer<PlatformClock> timer;
+        #endif
+
+        auto pInstance = EE::New<GraphInstance>( m_pGraphVariation, ownerID );
+
+        #if EE_DEVELOPMENT_TOOLS
+        Threading::ScopeLock lock( m_mutex );
+        m_stats.m_numCreated++;
+        m_stats.m_totalCreationTime += timer.GetElapsedTimeMilliseconds();
+        #endif
+
+        return pInstance;
+    }
+
+    void GraphInstancePool::Prewarm()
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        int32_t numInstancesToCreate = 0;
+        {
+            Threading::ScopeLock lock( m_mutex );
+            numInstancesToCreate = m_poolSize - (int32_t) m_freeInstances.size();
+        }
+
+        for ( int32_t i = 0; i < numInstancesToCreate; i++ )
+        {
+            GraphInstance* pInstance = CreateInstance( g_pooledInstanceOwnerID );
+
+            Threading::ScopeLock lock( m_mutex );
+            m_freeInstances.emplace_back( pInstance );
+        }
+    }
+
+    GraphInstance* GraphInstancePool::AcquireInstance( uint64_t ownerID )
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        GraphInstance* pInstance = nullptr;
+        {
+            Threading::ScopeLock lock( m_mutex );
+            m_numAcquiredInstances++;
+
+            if ( !m_freeInstances.empty() )
+            {
+                pInstance = m_freeInstances.back();
+                m_freeInstances.pop_back();
+
+                #if EE_DEVELOPMENT_TOOLS
+                m_stats.m_numReused++;
+                #endif
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( pInstance == nullptr )
+        {
+            return CreateInstance( ownerID );
+        }
+
+        pInstance->SetOwnerID( ownerID );
+        return pInstance;
+    }
+
+    void GraphInstancePool::ReleaseInstance( GraphInstance* pInstance )
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+        EE_ASSERT( pInstance != nullptr && pInstance->GetGraphVariation() == m_pGraphVariation );
+
+        bool shouldRecycle = false;
+        {
+            Threading::ScopeLock lock( m_mutex );
+            EE_ASSERT( m_numAcquiredInstances > 0 );
+            m_numAcquiredInstances--;
+
+            // Instances being released concurrently can slightly overfill the pool, this is fine
+            shouldRecycle = (int32_t) m_freeInstances.size() < m_poolSize;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( !shouldRecycle )
+        {
+            EE::Delete( pInstance );
+
+            #if EE_DEVELOPMENT_TOOLS
+            Threading::ScopeLock lock( m_mutex );
+            m_stats.m_numDestroyed++;
+            #endif
+
+            return;
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        Timer<PlatformClock> timer;
+        #endif
+
+        pInstance->ResetToInitialState();
+        pInstance->SetOwnerID( g_pooledInstanceOwnerID );
+
+        Threading::ScopeLock lock( m_mutex );
+        m_freeInstances.emplace_back( pInstance );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_stats.m_numRecycled++;
+        m_stats.m_totalRecycleTime += timer.GetElapsedTimeMilliseconds();
+        #endif
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void GraphInstancePool::DestroyFreeInstances()
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        for ( auto pInstance : m_freeInstances )
+        {
+            EE::Delete( pInstance );
+            m_stats.m_numDestroyed++;
+        }
+
+        m_freeInstances.clear();
+    }
+    #endif
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// Graph Instance Pool
+//-------------------------------------------------------------------------
+// Every graph variation owns a pool of graph instances so that spawning characters doesnt need to allocate and instantiate the whole graph.
+// The pool is prewarmed when the variation is installed. Released instances are reset and kept for reuse until the pool is full,
+// any additional instances are destroyed. Acquiring from an empty pool falls back to creating a new instance.
+
+namespace EE::Animation
+{
+    class GraphInstance;
+    class GraphVariation;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API GraphInstancePool
+    {
+    public:
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct Stats
+        {
+            int32_t                         m_numCreated = 0;
+            int32_t                         m_numReused = 0;
+            int32_t                         m_numRecycled = 0;
+            int32_t                         m_numDestroyed = 0;
+            Milliseconds                    m_totalCreationTime = 0;    // Time spent creating new instances (including prewarming)
+            Milliseconds                    m_totalRecycleTime = 0;     // Time spent resetting released instances
+        };
+        #endif
+
+    public:
+
+        GraphInstancePool( GraphVariation const* pGraphVariation, int32_t poolSize );
+        ~GraphInstancePool();
+
+        inline int32_t GetPoolSize() const { return m_poolSize; }
+
+        // Create all the pooled instances up front
+        void Prewarm();
+
+        // Get an instance for the specified owner, the instance is in the same state as a newly created instance
+        GraphInstance* AcquireInstance( uint64_t ownerID );
+
+        // Return an acquired instance, it will either be reset and kept for reuse or destroyed if the pool is full
+        void ReleaseInstance( GraphInstance* pInstance );
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Destroy all the instances currently in the pool, needed when the resources the instances were created from have been hot-reloaded
+        void DestroyFreeInstances();
+
+        inline Stats const& GetStats() const { return m_stats; }
+        #endif
+
+    private:
+
+        GraphInstance* CreateInstance( uint64_t ownerID );
+
+    private:
+
+        GraphVariation const*               m_pGraphVariation = nullptr;
+        int32_t                             m_poolSize = 0;
+        Threading::Mutex                    m_mutex;
+        TVector<GraphInstance*>             m_freeInstances;
+        int32_t                             m_numAcquiredInstances = 0;
+
+        #if EE_DEVELOPMENT_TOOLS
+        Stats                               m_stats;
+        #endif
+    };
+}
@@ -24,7 +24,7 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
-    class RootMotionDebugger
+    class EE_ENGINE_API RootMotionDebugger
     {
         constexpr static int32_t const s_recordingBufferSize = 300;
 
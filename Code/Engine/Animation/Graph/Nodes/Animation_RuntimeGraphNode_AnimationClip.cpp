@@ -61,6 +61,7 @@ namespace EE::Animation::GraphNodes
 
         m_shouldSampleRootMotion = pDefinition->m_sampleRootMotion;
         m_shouldPlayInReverse = false;
+        m_eventSearchHint = 0;
     }
 
     void AnimationClipNode::ShutdownInternal( GraphContext& context )
@@ -193,11 +194,11 @@ namespace EE::Animation::GraphNodes
         {
             actualAnimationSampleEndTime = 1.0f - m_currentTime;
             actualAnimationSampleStartTime = 1.0f - m_previousTime;
-            m_pAnimation->GetEventsForRange( actualAnimationSampleEndTime, actualAnimationSampleStartTime, sampledAnimationEvents );
+            m_pAnimation->GetEventsForRange( actualAnimationSampleEndTime, actualAnimationSampleStartTime, sampledAnimationEvents, &m_eventSearchHint );
         }
         else
         {
-            m_pAnimation->GetEventsForRange( actualAnimationSampleStartTime, actualAnimationSampleEndTime, sampledAnimationEvents );
+            m_pAnimation->GetEventsForRange( actualAnimationSampleStartTime, actualAnimationSampleEndTime, sampledAnimationEvents, &m_eventSearchHint );
         }
 
         // Snap to frame settings
@@ -69,5 +69,6 @@ namespace EE::Animation::GraphNodes
         BoolValueNode*                                  m_pResetTimeValueNode = nullptr;
         bool                                            m_shouldPlayInReverse = false;
         bool                                            m_shouldSampleRootMotion = true;
+        mutable int32_t                                 m_eventSearchHint = 0;      // Search position of the last event query, this is only an optimization so it's safe to update in const functions
     };
 }
\ No newline at end of file
@@ -25,6 +25,24 @@ namespace EE::Animation::GraphNodes
         }
     }
 
+    bool Blend2DNode::Definition::GetTriangleGridCandidates( Float2 const& point, TSpan<uint8_t const>& outTriangles ) const
+    {
+        EE_ASSERT( HasTriangleGrid() );
+
+        int32_t const x = Math::FloorToInt( ( point.m_x - m_gridMin.m_x ) / m_gridCellSize.m_x );
+        int32_t const y = Math::FloorToInt( ( point.m_y - m_gridMin.m_y ) / m_gridCellSize.m_y );
+        if ( x < 0 || x >= m_gridNumCellsX || y < 0 || y >= m_gridNumCellsY )
+        {
+            return false;
+        }
+
+        int32_t const cellIdx = ( y * m_gridNumCellsX ) + x;
+        uint16_t const start = m_gridCellOffsets[cellIdx];
+        uint16_t const end = m_gridCellOffsets[cellIdx + 1];
+        outTriangles = TSpan<uint8_t const>( m_gridTriangles.data() + start, end - start );
+        return true;
+    }
+
     bool Blend2DNode::IsValid() const
     {
         if ( !PoseNode::IsValid() )
@@ -121,47 +139,33 @@ namespace EE::Animation::GraphNodes
         #endif
 
         //-------------------------------------------------------------------------
-        // Check all triangles
+        // Find enclosing triangle
         //-------------------------------------------------------------------------
 
-        bool enclosingTriangleFound = false;
+        Float3 bcc;
+        m_bsr.m_triangleIdx = FindEnclosingTriangle( pDefinition, point, bcc );
+        bool const enclosingTriangleFound = ( m_bsr.m_triangleIdx != InvalidIndex );
 
-        int32_t const numIndices = (int32_t) pDefinition->m_indices.size();
-
-        for ( int32_t i = 0; i < numIndices; i += 3 )
+        if ( enclosingTriangleFound )
         {
-            uint8_t i0 = pDefinition->m_indices[i];
-            uint8_t i1 = pDefinition->m_indices[i + 1];
-            uint8_t i2 = pDefinition->m_indices[i + 2];
-            Vector const& a = pDefinition->m_values[i0];
-            Vector const& b = pDefinition->m_values[i1];
-            Vector const& c = pDefinition->m_values[i2];
-
-            // Check if we are inside this triangle, if we are, then calculate the result and early out
-            Float3 bcc;
-            if ( Math::CalculateBarycentricCoordinates( point, a, b, c, bcc ) )
-            {
-                TInlineVector<TPair<uint8_t, float>, 3> indexWeights = { { i0, bcc[0] }, { i1, bcc[1] }, { i2, bcc[2] } };
-                eastl::sort( indexWeights.begin(), indexWeights.end(), [] ( TPair<uint8_t, float> const& a, TPair<uint8_t, float> const& b ) { return a.second < b.second; } );
+            int32_t const firstIndex = m_bsr.m_triangleIdx * 3;
+            TInlineVector<TPair<uint8_t, float>, 3> indexWeights = { { pDefinition->m_indices[firstIndex], bcc[0] }, { pDefinition->m_indices[firstIndex + 1], bcc[1] }, { pDefinition->m_indices[firstIndex + 2], bcc[2] } };
+            eastl::sort( indexWeights.begin(), indexWeights.end(), [] ( TPair<uint8_t, float> const& a, TPair<uint8_t, float> const& b ) { return a.second < b.second; } );
 
-                // If one weight is nearly one, we dont need to blend
-                if ( Math::IsNearEqual( indexWeights[2].second, 1.0f ) )
-                {
-                    m_bsr.m_pSource0 = m_sourceNodes[indexWeights[2].first];
-                    m_bsr.m_pSource1 = m_bsr.m_pSource2 = nullptr;
-                    m_bsr.m_blendWeightBetween0And1 =  m_bsr.m_blendWeightBetween1And2 = 0.0f;
-                }
-                else // Calculate blend weights
-                {
-                    m_bsr.m_pSource0 = m_sourceNodes[indexWeights[0].first]; // lowest weight
-                    m_bsr.m_pSource1 = m_sourceNodes[indexWeights[1].first];
-                    m_bsr.m_pSource2 = m_sourceNodes[indexWeights[2].first]; // highest weight
-                    m_bsr.m_blendWeightBetween0And1 = indexWeights[1].second / ( indexWeights[0].second + indexWeights[1].second ); // Calculate weight based on ratio of contribution
-                    m_bsr.m_blendWeightBetween1And2 = indexWeights[2].second;
-                }
-
-                enclosingTriangleFound = true;
-                break;
+            // If one weight is nearly one, we dont need to blend
+            if ( Math::IsNearEqual( indexWeights[2].second, 1.0f ) )
+            {
+                m_bsr.m_pSource0 = m_sourceNodes[indexWeights[2].first];
+                m_bsr.m_pSource1 = m_bsr.m_pSource2 = nullptr;
+                m_bsr.m_blendWeightBetween0And1 =  m_bsr.m_blendWeightBetween1And2 = 0.0f;
+            }
+            else // Calculate blend weights
+            {
+                m_bsr.m_pSource0 = m_sourceNodes[indexWeights[0].first]; // lowest weight
+                m_bsr.m_pSource1 = m_sourceNodes[indexWeights[1].first];
+                m_bsr.m_pSource2 = m_sourceNodes[indexWeights[2].first]; // highest weight
+                m_bsr.m_blendWeightBetween0And1 = indexWeights[1].second / ( indexWeights[0].second + indexWeights[1].second ); // Calculate weight based on ratio of contribution
+                m_bsr.m_blendWeightBetween1And2 = indexWeights[2].second;
             }
         }
 
@@ -296,6 +300,55 @@ namespace EE::Animation::GraphNodes
         }
     }
 
+    int32_t Blend2DNode::FindEnclosingTriangle( Definition const* pDefinition, Float2 const& point, Float3& outBarycentricCoords ) const
+    {
+        auto IsInTriangle = [pDefinition, &point, &outBarycentricCoords] ( int32_t triangleIdx )
+        {
+            int32_t const firstIndex = triangleIdx * 3;
+            Vector const& a = pDefinition->m_values[pDefinition->m_indices[firstIndex]];
+            Vector const& b = pDefinition->m_values[pDefinition->m_indices[firstIndex + 1]];
+            Vector const& c = pDefinition->m_values[pDefinition->m_indices[firstIndex + 2]];
+            return Math::CalculateBarycentricCoordinates( point, a, b, c, outBarycentricCoords );
+        };
+
+        // Parameters usually change smoothly so try last frame's triangle first
+        int32_t const hintTriangleIdx = m_bsr.m_triangleIdx;
+        if ( hintTriangleIdx != InvalidIndex && IsInTriangle( hintTriangleIdx ) )
+        {
+            return hintTriangleIdx;
+        }
+
+        // Only test the triangles overlapping the point's grid cell, if the point is outside the grid it is outside the blend space
+        if ( pDefinition->HasTriangleGrid() )
+        {
+            TSpan<uint8_t const> candidates;
+            if ( pDefinition->GetTriangleGridCandidates( point, candidates ) )
+            {
+                for ( uint8_t triangleIdx : candidates )
+                {
+                    if ( triangleIdx != hintTriangleIdx && IsInTriangle( triangleIdx ) )
+                    {
+                        return triangleIdx;
+                    }
+                }
+            }
+
+            return InvalidIndex;
+        }
+
+        // No grid, check all triangles
+        int32_t const numTriangles = pDefinition->GetNumTriangles();
+        for ( int32_t i = 0; i < numTriangles; i++ )
+        {
+            if ( i != hintTriangleIdx && IsInTriangle( i ) )
+            {
+                return i;
+            }
+        }
+
+        return InvalidIndex;
+    }
+
     GraphPoseNodeResult Blend2DNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         EE_ASSERT( context.IsValid() );
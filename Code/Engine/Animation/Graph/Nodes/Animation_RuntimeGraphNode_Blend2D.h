@@ -14,16 +14,31 @@ namespace EE::Animation::GraphNodes
         struct EE_ENGINE_API Definition : public PoseNode::Definition
         {
             EE_REFLECT_TYPE( Definition );
-            EE_SERIALIZE_GRAPHNODEDEFINITION( PoseNode::Definition, m_sourceNodeIndices, m_inputParameterNodeIdx0, m_inputParameterNodeIdx1, m_values, m_indices, m_hullIndices );
+            EE_SERIALIZE_GRAPHNODEDEFINITION( PoseNode::Definition, m_sourceNodeIndices, m_inputParameterNodeIdx0, m_inputParameterNodeIdx1, m_values, m_indices, m_hullIndices, m_gridMin, m_gridCellSize, m_gridNumCellsX, m_gridNumCellsY, m_gridCellOffsets, m_gridTriangles );
 
             virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
 
+            inline int32_t GetNumTriangles() const { return (int32_t) m_indices.size() / 3; }
+            inline bool HasTriangleGrid() const { return m_gridNumCellsX > 0 && m_gridNumCellsY > 0; }
+
+            // Get the list of triangles that overlap the grid cell containing the point, returns false if the point is outside the grid
+            bool GetTriangleGridCandidates( Float2 const& point, TSpan<uint8_t const>& outTriangles ) const;
+
             TInlineVector<int16_t, 5>               m_sourceNodeIndices;
             int16_t                                 m_inputParameterNodeIdx0 = InvalidIndex;
             int16_t                                 m_inputParameterNodeIdx1 = InvalidIndex;
             TInlineVector<Float2, 10>               m_values;
             TInlineVector<uint8_t, 30>              m_indices;
             TInlineVector<uint8_t, 10>              m_hullIndices;
+
+            // Triangle location grid baked by the compiler over the bounds of the blend space
+            // Each cell stores the triangles that overlap it, cell i's triangles are [m_gridCellOffsets[i], m_gridCellOffsets[i+1])
+            Float2                                  m_gridMin = Float2::Zero;
+            Float2                                  m_gridCellSize = Float2::One;
+            uint8_t                                 m_gridNumCellsX = 0;
+            uint8_t                                 m_gridNumCellsY = 0;
+            TInlineVector<uint16_t, 17>             m_gridCellOffsets;
+            TInlineVector<uint8_t, 30>              m_gridTriangles;
         };
 
     private:
@@ -39,6 +54,7 @@ namespace EE::Animation::GraphNodes
             float                                   m_blendWeightBetween0And1 = 0.0f;
             float                                   m_blendWeightBetween1And2 = 0.0f;
             uint32_t                                m_updateID = 0;
+            int32_t                                 m_triangleIdx = InvalidIndex; // The enclosing triangle from the last evaluation, used as the first guess for the next one
         };
 
     public:
@@ -59,6 +75,9 @@ namespace EE::Animation::GraphNodes
 
         void EvaluateBlendSpace( GraphContext& context );
 
+        // Find the triangle enclosing the point, returns InvalidIndex if the point is outside the blend space
+        int32_t FindEnclosingTriangle( Definition const* pDefinition, Float2 const& point, Float3& outBarycentricCoords ) const;
+
         // Debugging
         //-------------------------------------------------------------------------
 
@@ -117,15 +117,10 @@ namespace EE::Animation::GraphNodes
 
                 // Try to find a ragdoll event
                 auto pEntryAnim = m_pEntryNode->GetAnimation();
-                auto const& events = pEntryAnim->GetEvents();
-                for ( auto pEvent : events )
+                if ( pEntryAnim->HasEventOfType<RagdollEvent>() )
                 {
-                    if ( IsOfType<RagdollEvent>( pEvent ) )
-                    {
-                        m_stage = Stage::FullyInEntryAnim;
-                        m_pRagdoll->PutToSleep();
-                        break;
-                    }
+                    m_stage = Stage::FullyInEntryAnim;
+                    m_pRagdoll->PutToSleep();
                 }
             }
         }
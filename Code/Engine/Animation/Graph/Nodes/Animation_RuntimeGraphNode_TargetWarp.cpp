@@ -494,82 +494,81 @@ namespace EE::Animation::GraphNodes
         int32_t const clipStartFrame = clipStartTime.GetFrameIndex();
         int32_t const minimumStartFrameForFirstSection = clipStartFrame + 1;
 
-        for ( auto const pEvent : pAnimation->GetEvents() )
+        TInlineVector<TargetWarpEvent const*, 10> warpEvents;
+        pAnimation->GetEventsOfType( warpEvents );
+
+        for ( auto const pWarpEvent : warpEvents )
         {
             // Skip any events that are before our start time
-            if ( pEvent->GetEndTime() < m_warpStartTime )
+            if ( pWarpEvent->GetEndTime() < m_warpStartTime )
             {
                 continue;
             }
 
             // Create a section per warp event
-            auto pWarpEvent = TryCast<TargetWarpEvent>( pEvent );
-            if ( pWarpEvent != nullptr )
+            WarpSection section;
+            section.m_startFrame = pAnimation->GetFrameTime( pWarpEvent->GetStartTime() ).GetNearestFrameIndex();
+            section.m_endFrame = Math::Min( numFrames, pAnimation->GetFrameTime( pWarpEvent->GetEndTime() ).GetNearestFrameIndex() );
+            section.m_warpRule = pWarpEvent->GetRule();
+            section.m_translationAlgorithm = pWarpEvent->GetTranslationAlgorithm();
+
+            // Adjust start frame to animation start time
+            if ( minimumStartFrameForFirstSection >= section.m_startFrame )
             {
-                WarpSection section;
-                section.m_startFrame = pAnimation->GetFrameTime( pWarpEvent->GetStartTime() ).GetNearestFrameIndex();
-                section.m_endFrame = Math::Min( numFrames, pAnimation->GetFrameTime( pWarpEvent->GetEndTime() ).GetNearestFrameIndex() );
-                section.m_warpRule = pWarpEvent->GetRule();
-                section.m_translationAlgorithm = pWarpEvent->GetTranslationAlgorithm();
-
-                // Adjust start frame to animation start time
-                if ( minimumStartFrameForFirstSection >= section.m_startFrame )
-                {
-                    section.m_startFrame = minimumStartFrameForFirstSection;
+                section.m_startFrame = minimumStartFrameForFirstSection;
 
-                    // Skip 1 frame events
-                    if ( !section.HasValidFrameRange() )
-                    {
-                        continue;
-                    }
+                // Skip 1 frame events
+                if ( !section.HasValidFrameRange() )
+                {
+                    continue;
                 }
+            }
 
-                EE_ASSERT( section.m_startFrame < section.m_endFrame );
+            EE_ASSERT( section.m_startFrame < section.m_endFrame );
 
-                // Should we insert a fixed section?
-                if ( !m_warpSections.empty() )
+            // Should we insert a fixed section?
+            if ( !m_warpSections.empty() )
+            {
+                if ( m_warpSections.back().m_endFrame != section.m_startFrame )
                 {
-                    if ( m_warpSections.back().m_endFrame != section.m_startFrame )
-                    {
-                        WarpSection fixedSection;
-                        fixedSection.m_startFrame = m_warpSections.back().m_endFrame;
-                        fixedSection.m_endFrame = section.m_startFrame;
-                        fixedSection.m_isFixedSection = true;
-                        m_warpSections.emplace_back( fixedSection );
-                    }
+                    WarpSection fixedSection;
+                    fixedSection.m_startFrame = m_warpSections.back().m_endFrame;
+                    fixedSection.m_endFrame = section.m_startFrame;
+                    fixedSection.m_isFixedSection = true;
+                    m_warpSections.emplace_back( fixedSection );
                 }
+            }
 
-                // Add new section
-                m_warpSections.emplace_back( section );
+            // Add new section
+            m_warpSections.emplace_back( section );
 
-                // Track the options for this warp
-                switch ( section.m_warpRule )
+            // Track the options for this warp
+            switch ( section.m_warpRule )
+            {
+                case TargetWarpRule::WarpXY:
                 {
-                    case TargetWarpRule::WarpXY:
-                    {
-                        m_translationXYSectionIdx = (int8_t) m_warpSections.size() - 1;
-                    }
-                    break;
+                    m_translationXYSectionIdx = (int8_t) m_warpSections.size() - 1;
+                }
+                break;
 
-                    case TargetWarpRule::WarpZ:
-                    {
-                        m_isTranslationAllowedZ = true;
-                    }
-                    break;
+                case TargetWarpRule::WarpZ:
+                {
+                    m_isTranslationAllowedZ = true;
+                }
+                break;
 
-                    case TargetWarpRule::WarpXYZ:
-                    {
-                        m_translationXYSectionIdx = (int8_t) m_warpSections.size() - 1;
-                        m_isTranslationAllowedZ = true;
-                    }
-                    break;
+                case TargetWarpRule::WarpXYZ:
+                {
+                    m_translationXYSectionIdx = (int8_t) m_warpSections.size() - 1;
+                    m_isTranslationAllowedZ = true;
+                }
+                break;
 
-                    case TargetWarpRule::RotationOnly:
-                    {
-                        m_rotationSectionIdx = (int8_t) m_warpSections.size() - 1;
-                    }
-                    break;
+                case TargetWarpRule::RotationOnly:
+                {
+                    m_rotationSectionIdx = (int8_t) m_warpSections.size() - 1;
                 }
+                break;
             }
         }
 
@@ -0,0 +1,184 @@
+#include "Animation_RuntimeGraphNode_ValuePrograms.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation::GraphNodes
+{
+    float ValueProgram::Execute( GraphContext& context, ValueNode* const* pInputNodes, int16_t nodeIdx ) const
+    {
+        EE_ASSERT( IsValid() );
+
+        float registers[s_maxRegisters];
+        float const* pConstants = m_constants.data();
+
+        int32_t const numInstructions = (int32_t) m_instructions.size();
+        int32_t instructionIdx = 0;
+        while ( instructionIdx < numInstructions )
+        {
+            Instruction const& instruction = m_instructions[instructionIdx++];
+            switch ( instruction.m_opcode )
+            {
+                case Opcode::LoadConstant:
+                {
+                    registers[instruction.m_result] = pConstants[instruction.m_data];
+                }
+                break;
+
+                case Opcode::LoadFloatInput:
+                {
+                    registers[instruction.m_result] = pInputNodes[instruction.m_data]->GetValue<float>( context );
+                }
+                break;
+
+                case Opcode::LoadBoolInput:
+                {
+                    registers[instruction.m_result] = pInputNodes[instruction.m_data]->GetValue<bool>( context ) ? 1.0f : 0.0f;
+                }
+                break;
+
+                case Opcode::Jump:
+                {
+                    instructionIdx = instruction.m_data;
+                }
+                break;
+
+                case Opcode::JumpIfFalse:
+                {
+                    if ( registers[instruction.m_a] == 0.0f )
+                    {
+                        instructionIdx = instruction.m_data;
+                    }
+                }
+                break;
+
+                case Opcode::JumpIfTrue:
+                {
+                    if ( registers[instruction.m_a] != 0.0f )
+                    {
+                        instructionIdx = instruction.m_data;
+                    }
+                }
+                break;
+
+                default:
+                {
+                    #if EE_DEVELOPMENT_TOOLS
+                    if ( instruction.m_opcode == Opcode::Div && Math::IsNearZero( registers[instruction.m_b] ) )
+                    {
+                        context.LogWarning( nodeIdx, "Dividing by zero in FloatMathNode" );
+                    }
+                    #endif
+
+                    registers[instruction.m_result] = EvaluateOperation( instruction.m_opcode, registers[instruction.m_a], registers[instruction.m_b], pConstants + instruction.m_data );
+                }
+                break;
+            }
+        }
+
+        return registers[0];
+    }
+
+    //-------------------------------------------------------------------------
+
+    void FloatValueProgramNode::Definition::InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const
+    {
+        auto pNode = CreateNode<FloatValueProgramNode>( context, options );
+
+        pNode->m_inputNodes.reserve( m_program.m_inputNodeIndices.size() );
+        for ( auto inputNodeIdx : m_program.m_inputNodeIndices )
+        {
+            context.SetNodePtrFromIndex( inputNodeIdx, pNode->m_inputNodes.emplace_back( nullptr ) );
+        }
+    }
+
+    void FloatValueProgramNode::InitializeInternal( GraphContext& context )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        FloatValueNode::InitializeInternal( context );
+
+        for ( auto pNode : m_inputNodes )
+        {
+            pNode->Initialize( context );
+        }
+
+        m_value = 0.0f;
+    }
+
+    void FloatValueProgramNode::ShutdownInternal( GraphContext& context )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        for ( auto pNode : m_inputNodes )
+        {
+            pNode->Shutdown( context );
+        }
+
+        FloatValueNode::ShutdownInternal( context );
+    }
+
+    void FloatValueProgramNode::GetValueInternal( GraphContext& context, void* pOutValue )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        if ( !WasUpdated( context ) )
+        {
+            MarkNodeActive( context );
+            m_value = GetDefinition<FloatValueProgramNode>()->m_program.Execute( context, m_inputNodes.data(), GetNodeIndex() );
+        }
+
+        *reinterpret_cast<float*>( pOutValue ) = m_value;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void BoolValueProgramNode::Definition::InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const
+    {
+        auto pNode = CreateNode<BoolValueProgramNode>( context, options );
+
+        pNode->m_inputNodes.reserve( m_program.m_inputNodeIndices.size() );
+        for ( auto inputNodeIdx : m_program.m_inputNodeIndices )
+        {
+            context.SetNodePtrFromIndex( inputNodeIdx, pNode->m_inputNodes.emplace_back( nullptr ) );
+        }
+    }
+
+    void BoolValueProgramNode::InitializeInternal( GraphContext& context )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        BoolValueNode::InitializeInternal( context );
+
+        for ( auto pNode : m_inputNodes )
+        {
+            pNode->Initialize( context );
+        }
+
+        m_result = false;
+    }
+
+    void BoolValueProgramNode::ShutdownInternal( GraphContext& context )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        for ( auto pNode : m_inputNodes )
+        {
+            pNode->Shutdown( context );
+        }
+
+        BoolValueNode::ShutdownInternal( context );
+    }
+
+    void BoolValueProgramNode::GetValueInternal( GraphContext& context, void* pOutValue )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        if ( !WasUpdated( context ) )
+        {
+            MarkNodeActive( context );
+            m_result = GetDefinition<BoolValueProgramNode>()->m_program.Execute( context, m_inputNodes.data(), GetNodeIndex() ) != 0.0f;
+        }
+
+        *( (bool*) pOutValue ) = m_result;
+    }
+}
@@ -0,0 +1,160 @@
+#pragma once
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Node.h"
+#include "Base/Math/NumericRange.h"
+
+//-------------------------------------------------------------------------
+// Value Programs
+//-------------------------------------------------------------------------
+// The graph compiler flattens trees of stateless float/bool value nodes (math, comparisons, logic, constants) into a small register based program.
+// The program replaces the root node of the tree so the rest of the graph is unaffected, only the non-flattened inputs (parameters, stateful nodes)
+// are still pulled as nodes. Bools are stored in the registers as 0/1 and the result of the program is always in the first register.
+
+namespace EE::Animation::GraphNodes
+{
+    struct EE_ENGINE_API ValueProgram
+    {
+        EE_SERIALIZE( m_instructions, m_constants, m_inputNodeIndices, m_numRegisters );
+
+        constexpr static int32_t const s_maxRegisters = 32;
+        constexpr static int32_t const s_maxInstructions = 1024;
+
+        enum class Opcode : uint8_t
+        {
+            LoadConstant,           // r = constants[data]
+            LoadFloatInput,         // r = inputs[data]
+            LoadBoolInput,          // r = inputs[data] ? 1 : 0
+            Jump,                   // goto data
+            JumpIfFalse,            // if ( a == 0 ) goto data
+            JumpIfTrue,             // if ( a != 0 ) goto data
+
+            // Operations
+            Add,                    // r = a + b
+            Sub,                    // r = a - b
+            Mul,                    // r = a * b
+            Div,                    // r = a / b (zero if b is near zero)
+            Abs,                    // r = |a|
+            Clamp,                  // r = clamp( a, constants[data], constants[data + 1] )
+            Remap,                  // r = remap( a, from [constants[data], constants[data + 1]] to [constants[data + 2], constants[data + 3]] )
+            GreaterThanEqual,       // r = a >= b
+            LessThanEqual,          // r = a <= b
+            GreaterThan,            // r = a > b
+            LessThan,               // r = a < b
+            NearEqual,              // r = a == b (within epsilon constants[data])
+            InRangeInclusive,       // r = a in [constants[data], constants[data + 1]]
+            InRangeExclusive,       // r = a in (constants[data], constants[data + 1])
+            Not,                    // r = !a
+        };
+
+        struct Instruction
+        {
+            EE_SERIALIZE( m_opcode, m_result, m_a, m_b, m_data );
+
+            Opcode                  m_opcode = Opcode::LoadConstant;
+            uint8_t                 m_result = 0;
+            uint8_t                 m_a = 0;
+            uint8_t                 m_b = 0;
+            uint16_t                m_data = 0;     // Constant index, input index or jump target
+        };
+
+    public:
+
+        inline static bool IsOperation( Opcode opcode ) { return opcode >= Opcode::Add; }
+
+        // Evaluates a single operation, shared by the interpreter and by the constant folding in the compiler
+        inline static float EvaluateOperation( Opcode opcode, float a, float b, float const* pConstants )
+        {
+            switch ( opcode )
+            {
+                case Opcode::Add: return a + b;
+                case Opcode::Sub: return a - b;
+                case Opcode::Mul: return a * b;
+                case Opcode::Div: return Math::IsNearZero( b ) ? 0.0f : a / b;
+                case Opcode::Abs: return Math::Abs( a );
+                case Opcode::Clamp: return Math::Clamp( a, pConstants[0], pConstants[1] );
+                case Opcode::Remap: return Math::RemapRange( a, pConstants[0], pConstants[1], pConstants[2], pConstants[3] );
+                case Opcode::GreaterThanEqual: return ( a >= b ) ? 1.0f : 0.0f;
+                case Opcode::LessThanEqual: return ( a <= b ) ? 1.0f : 0.0f;
+                case Opcode::GreaterThan: return ( a > b ) ? 1.0f : 0.0f;
+                case Opcode::LessThan: return ( a < b ) ? 1.0f : 0.0f;
+                case Opcode::NearEqual: return Math::IsNearEqual( a, b, pConstants[0] ) ? 1.0f : 0.0f;
+                case Opcode::InRangeInclusive: return FloatRange( pConstants[0], pConstants[1] ).ContainsInclusive( a ) ? 1.0f : 0.0f;
+                case Opcode::InRangeExclusive: return FloatRange( pConstants[0], pConstants[1] ).ContainsExclusive( a ) ? 1.0f : 0.0f;
+                case Opcode::Not: return ( a == 0.0f ) ? 1.0f : 0.0f;
+
+                default:
+                {
+                    EE_UNREACHABLE_CODE();
+                    return 0.0f;
+                }
+            }
+        }
+
+        inline bool IsValid() const { return !m_instructions.empty() && m_numRegisters > 0 && m_numRegisters <= s_maxRegisters; }
+
+        // Run the program, the input nodes must match the input node indices
+        float Execute( GraphContext& context, ValueNode* const* pInputNodes, int16_t nodeIdx ) const;
+
+    public:
+
+        TVector<Instruction>        m_instructions;
+        TVector<float>              m_constants;
+        TVector<int16_t>            m_inputNodeIndices;
+        uint8_t                     m_numRegisters = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API FloatValueProgramNode final : public FloatValueNode
+    {
+    public:
+
+        struct EE_ENGINE_API Definition final : public FloatValueNode::Definition
+        {
+            EE_REFLECT_TYPE( Definition );
+            EE_SERIALIZE_GRAPHNODEDEFINITION( FloatValueNode::Definition, m_program );
+
+            virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
+
+            ValueProgram                m_program;
+        };
+
+    private:
+
+        virtual void InitializeInternal( GraphContext& context ) override;
+        virtual void ShutdownInternal( GraphContext& context ) override;
+        virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
+
+    private:
+
+        TInlineVector<ValueNode*, 4>    m_inputNodes;
+        float                           m_value = 0.0f;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API BoolValueProgramNode final : public BoolValueNode
+    {
+    public:
+
+        struct EE_ENGINE_API Definition final : public BoolValueNode::Definition
+        {
+            EE_REFLECT_TYPE( Definition );
+            EE_SERIALIZE_GRAPHNODEDEFINITION( BoolValueNode::Definition, m_program );
+
+            virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
+
+            ValueProgram                m_program;
+        };
+
+    private:
+
+        virtual void InitializeInternal( GraphContext& context ) override;
+        virtual void ShutdownInternal( GraphContext& context ) override;
+        virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
+
+    private:
+
+        TInlineVector<ValueNode*, 4>    m_inputNodes;
+        bool                            m_result = false;
+    };
+}
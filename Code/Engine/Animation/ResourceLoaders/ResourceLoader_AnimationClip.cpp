@@ -41,6 +41,7 @@ namespace EE::Animation
 
         collectionDesc.CalculateCollectionRequirements( *m_pTypeRegistry );
         TypeSystem::TypeDescriptorCollection::InstantiateStaticCollection( *m_pTypeRegistry, collectionDesc, pAnimation->m_events );
+        pAnimation->InitializeEventSearchData();
 
         // Read secondary animations
         //-------------------------------------------------------------------------
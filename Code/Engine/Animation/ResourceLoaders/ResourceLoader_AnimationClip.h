@@ -11,7 +11,7 @@ namespace EE::TypeSystem { class TypeRegistry; }
 
 namespace EE::Animation
 {
-    class AnimationClipLoader final : public Resource::ResourceLoader
+    class EE_ENGINE_API AnimationClipLoader final : public Resource::ResourceLoader
     {
     public:
 
@@ -26,6 +26,11 @@ namespace EE::Animation
         virtual void UnloadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const override;
         virtual Resource::InstallResult Install( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Resource::InstallDependencyList const& installDependencies ) const override;
 
+        #if EE_DEVELOPMENT_TOOLS
+        // Clips are only referenced through resource ptrs or by graph instances, which are recreated when the clip changes
+        virtual bool SupportsInPlaceReload() const override { return true; }
+        #endif
+
     private:
 
         TypeSystem::TypeRegistry const* m_pTypeRegistry = nullptr;
@@ -1,5 +1,6 @@
 #include "ResourceLoader_AnimationGraph.h"
 #include "Engine/Animation/Graph/Animation_RuntimeGraph_Definition.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_InstancePool.h"
 #include "Base/Serialization/BinarySerialization.h"
 #include "Base/TypeSystem/TypeDescriptors.h"
 
@@ -133,6 +134,13 @@ namespace EE::Animation
                     }
                 }
             }
+
+            // Create instance pool
+            //-------------------------------------------------------------------------
+
+            EE_ASSERT( pGraphVariation->m_pInstancePool == nullptr );
+            pGraphVariation->m_pInstancePool = EE::New<GraphInstancePool>( pGraphVariation, pGraphVariation->m_instancePoolSize );
+            pGraphVariation->m_pInstancePool->Prewarm();
         }
 
         //-------------------------------------------------------------------------
@@ -141,6 +149,33 @@ namespace EE::Animation
         return Resource::InstallResult::Succeeded;
     }
 
+    void GraphLoader::Uninstall( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const
+    {
+        // The pooled instances reference the install dependencies so they need to be destroyed first
+        if ( resID.GetResourceTypeID() == GraphVariation::GetStaticResourceTypeID() )
+        {
+            auto pGraphVariation = pResourceRecord->GetResourceData<GraphVariation>();
+            if ( pGraphVariation != nullptr )
+            {
+                EE::Delete( pGraphVariation->m_pInstancePool );
+            }
+        }
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void GraphLoader::OnInstallDependencyReloadedInPlace( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const
+    {
+        // Nodes resolve their resources when they are instantiated, so the pooled instances still point to the old data
+        if ( resID.GetResourceTypeID() == GraphVariation::GetStaticResourceTypeID() )
+        {
+            auto pGraphVariation = pResourceRecord->GetResourceData<GraphVariation>();
+            EE_ASSERT( pGraphVariation->m_pInstancePool != nullptr );
+            pGraphVariation->m_pInstancePool->DestroyFreeInstances();
+            pGraphVariation->m_pInstancePool->Prewarm();
+        }
+    }
+    #endif
+
     void GraphLoader::UnloadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const
     {
         auto const resourceTypeID = resID.GetResourceTypeID();
@@ -11,7 +11,7 @@ namespace EE::TypeSystem { class TypeRegistry; }
 
 namespace EE::Animation
 {
-    class GraphLoader final : public Resource::ResourceLoader
+    class EE_ENGINE_API GraphLoader final : public Resource::ResourceLoader
     {
     public:
 
@@ -27,6 +27,11 @@ namespace EE::Animation
         virtual void UnloadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const override;
 
         virtual Resource::InstallResult Install( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Resource::InstallDependencyList const& installDependencies ) const override;
+        virtual void Uninstall( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const override;
+
+        #if EE_DEVELOPMENT_TOOLS
+        virtual void OnInstallDependencyReloadedInPlace( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const override;
+        #endif
 
     private:
 
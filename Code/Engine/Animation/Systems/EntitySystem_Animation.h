@@ -34,6 +34,9 @@ namespace EE::Animation
 
         virtual ~AnimationSystem();
 
+        // We have the lowest update priority and only operate on our own entity's components
+        virtual bool IsBatchable() const override { return true; }
+
     private:
 
         virtual void RegisterComponent( EntityComponent* pComponent ) override;
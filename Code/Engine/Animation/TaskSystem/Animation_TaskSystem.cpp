@@ -139,6 +139,23 @@ namespace EE::Animation
         m_hasPhysicsDependency = false;
     }
 
+    void TaskSystem::ResetToInitialState()
+    {
+        Reset();
+
+        SetSecondarySkeletons( SecondarySkeletonList() );
+        m_finalPoseBuffer.ResetPose( Pose::Type::ReferencePose, true );
+        m_taskContext.m_skeletonLOD = Skeleton::LOD::High;
+        m_hasCodependentPhysicsTasks = false;
+        m_needsUpdate = false;
+
+        DisableSerialization();
+
+        #if EE_DEVELOPMENT_TOOLS
+        SetDebugMode( TaskSystemDebugMode::Off );
+        #endif
+    }
+
     //-------------------------------------------------------------------------
 
     void TaskSystem::SetSecondarySkeletons( SecondarySkeletonList const& secondarySkeletons )
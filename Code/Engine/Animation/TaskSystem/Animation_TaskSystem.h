@@ -39,6 +39,9 @@ namespace EE::Animation
 
         void Reset();
 
+        // Return the task system to the state it was created in (no tasks, no secondary skeletons, reference pose), used when recycling graph instances
+        void ResetToInitialState();
+
         // Get the actual final character transform for this frame
         Transform const& GetCharacterWorldTransform() const { return m_taskContext.m_worldTransform; }
 
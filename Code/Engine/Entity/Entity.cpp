@@ -142,6 +142,9 @@ namespace EE
             }
         }
 
+        // Any callbacks deferred while we were not initialized will be fired on the first world transform flush
+        m_pWorldTransformUpdateRequests = &initializationContext.m_worldTransformUpdateRequests;
+
         if ( IsSpatialEntity() )
         {
             m_pRootSpatialComponent->CalculateWorldTransform( false );
@@ -235,6 +238,18 @@ namespace EE
             DestroySpatialAttachment( SpatialAttachmentRule::KeepLocalTranform );
         }
 
+        // Any pending transform callbacks are dropped, the world transforms themselves will be updated on access
+        {
+            Threading::ScopeLock lock( m_pWorldTransformUpdateRequests->m_mutex );
+            if ( m_isWorldTransformUpdateRequested )
+            {
+                m_pWorldTransformUpdateRequests->m_entities.erase_first_unsorted( this );
+                m_isWorldTransformUpdateRequested = false;
+            }
+        }
+
+        m_pWorldTransformUpdateRequests = nullptr;
+
         // Systems and Components
         //-------------------------------------------------------------------------
 
@@ -289,6 +304,12 @@ namespace EE
         for( auto pSystem : m_systemUpdateLists[updateStageIdx] )
         {
             EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( (UpdateStage) updateStageIdx ) );
+
+            if ( m_areBatchableSystemsUpdatedByWorld && pSystem->IsBatchable() )
+            {
+                continue;
+            }
+
             pSystem->Update( context );
         }
     }
@@ -696,6 +717,79 @@ namespace EE
         }
     }
 
+    void Entity::RequestWorldTransformUpdate()
+    {
+        if ( m_pWorldTransformUpdateRequests == nullptr )
+        {
+            return;
+        }
+
+        // The flag is only cleared by the world when it removes us from the request list, so we are never added more than once
+        if ( !m_isWorldTransformUpdateRequested.exchange( true ) )
+        {
+            Threading::ScopeLock lock( m_pWorldTransformUpdateRequests->m_mutex );
+            m_pWorldTransformUpdateRequests->m_entities.emplace_back( this );
+        }
+    }
+
+    void Entity::UpdateWorldTransforms()
+    {
+        if ( !IsSpatialEntity() )
+        {
+            return;
+        }
+
+        // Flatten our part of the hierarchy, a breadth first traversal ensures that parents are always before their children
+        //-------------------------------------------------------------------------
+
+        if ( m_isSpatialComponentListDirty )
+        {
+            m_spatialComponentsByDepth.clear();
+            m_spatialComponentsByDepth.emplace_back( m_pRootSpatialComponent );
+
+            for ( int32_t i = 0; i < (int32_t) m_spatialComponentsByDepth.size(); i++ )
+            {
+                for ( auto pChildComponent : m_spatialComponentsByDepth[i]->m_spatialChildren )
+                {
+                    // Components of attached entities are updated by those entities
+                    if ( pChildComponent->m_entityID == m_ID )
+                    {
+                        m_spatialComponentsByDepth.emplace_back( pChildComponent );
+                    }
+                }
+            }
+
+            m_isSpatialComponentListDirty = false;
+        }
+
+        // Update all the transforms before firing any callbacks, so that the callbacks always see an up to date hierarchy
+        //-------------------------------------------------------------------------
+
+        for ( auto pSpatialComponent : m_spatialComponentsByDepth )
+        {
+            pSpatialComponent->UpdateWorldTransformIfDirty();
+        }
+
+        for ( auto pSpatialComponent : m_spatialComponentsByDepth )
+        {
+            if ( pSpatialComponent->m_isWorldTransformCallbackPending )
+            {
+                pSpatialComponent->m_isWorldTransformCallbackPending = false;
+                pSpatialComponent->OnWorldTransformUpdated();
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( auto pAttachedEntity : m_attachedEntities )
+        {
+            if ( pAttachedEntity->m_isSpatialAttachmentCreated )
+            {
+                pAttachedEntity->UpdateWorldTransforms();
+            }
+        }
+    }
+
     bool Entity::IsSpatialChildOf( Entity const* pPotentialParent ) const
     {
         EE_ASSERT( pPotentialParent != nullptr );
@@ -1033,6 +1127,9 @@ namespace EE
                 pParentSpatialComponent = m_pRootSpatialComponent;
             }
 
+            pSpatialEntityComponent->m_pEntity = this;
+            m_isSpatialComponentListDirty = true;
+
             // If we have a parent component, update the hierarchy and transform
             if ( pParentSpatialComponent != nullptr )
             {
@@ -1089,6 +1186,8 @@ namespace EE
         Threading::RecursiveScopeLock lock( m_internalStateMutex );
         EE_ASSERT( pSpatialComponent != nullptr );
 
+        m_isSpatialComponentListDirty = true;
+
         if ( pSpatialComponent == m_pRootSpatialComponent )
         {
             int32_t const numChildrenForRoot = (int32_t) m_pRootSpatialComponent->m_spatialChildren.size();
@@ -5,6 +5,7 @@
 #include "Engine/UpdateStage.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Types/Event.h"
+#include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
 // Entity
@@ -30,11 +31,13 @@ namespace EE
 {
     class SystemRegistry;
     class EntitySystem;
+    class EntityWorld;
     class EntityWorldUpdateContext;
 
     namespace EntityModel
     {
         struct InitializationContext;
+        struct WorldTransformUpdateRequests;
         struct SerializedEntityDescriptor;
         class SerializedEntityCollection;
         struct Serializer;
@@ -52,6 +55,8 @@ namespace EE
 
         friend EntityModel::Serializer;
         friend EntityModel::EntityMap;
+        friend EntityWorld;
+        friend SpatialEntityComponent;
 
         #if EE_DEVELOPMENT_TOOLS
         friend EntityModel::EntityEditor;
@@ -233,7 +238,7 @@ namespace EE
         // Get all systems
         inline TVector<EntitySystem*> const& GetSystems() const { return m_systems; }
 
-        // Run Entity Systems
+        // Run Entity Systems - batchable systems are skipped if they are being updated in batches by the world
         void UpdateSystems( EntityWorldUpdateContext const& context );
 
         // Get a specific system
@@ -320,6 +325,13 @@ namespace EE
         // Removes an internal component from the current hierarchy while awaiting destruction
         void RemoveComponentFromSpatialHierarchy( SpatialEntityComponent* pComponent );
 
+        // Called by our spatial components whenever their world transforms are invalidated, registers this entity for a world transform flush
+        void RequestWorldTransformUpdate();
+
+        // Recalculate all dirty world transforms (in hierarchy order) and then fire all the deferred transform updated callbacks
+        // This will also flush the transforms of all attached entities
+        void UpdateWorldTransforms();
+
         //-------------------------------------------------------------------------
 
         // Generate the per-stage update lists for this entity
@@ -365,12 +377,18 @@ namespace EE
         TVector<EntitySystem*>                              m_systems;
         TVector<EntityComponent*>                           m_components;
         SystemUpdateList                                    m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
+        bool                                                m_areBatchableSystemsUpdatedByWorld = false;                            // Set by the world when it has added our batchable systems to its batched updates
+        Microseconds                                        m_averageUpdateCosts[(int8_t) UpdateStage::NumStages];                  // Moving average of the cost of updating this entity (and its attached entities) per stage, sampled by the world
 
         SpatialEntityComponent*                             m_pRootSpatialComponent = nullptr;                                      // This spatial component defines our world position
         TVector<Entity*>                                    m_attachedEntities;                                                     // The list of entities that are attached to this entity
         Entity*                                             m_pParentSpatialEntity = nullptr;                                       // The parent entity we are attached to
         EE_REFLECT() StringID                               m_parentAttachmentSocketID;                                             // The socket that we are attached to on the parent
         bool                                                m_isSpatialAttachmentCreated = false;                                   // Has the actual component-to-component attachment been created
+        TVector<SpatialEntityComponent*>                    m_spatialComponentsByDepth;                                             // Our spatial components sorted by hierarchy depth, used to flush world transforms
+        bool                                                m_isSpatialComponentListDirty = true;                                   // Does the sorted spatial component list need to be rebuilt
+        EntityModel::WorldTransformUpdateRequests*          m_pWorldTransformUpdateRequests = nullptr;                              // Only set while we are initialized
+        std::atomic<bool>                                   m_isWorldTransformUpdateRequested = false;                              // Are we registered for a world transform flush
 
         TVector<EntityInternalStateAction>                  m_deferredActions;                                                      // The set of internal entity state changes that need to be executed
         Threading::RecursiveMutex                           m_internalStateMutex;                                                   // A mutex that needs to be lock due to internal state changes
@@ -58,6 +58,15 @@ namespace EE::EntityModel
 
     //-------------------------------------------------------------------------
 
+    // The entities that have deferred world transform updates, these are flushed by the world after each update stage
+    struct WorldTransformUpdateRequests
+    {
+        Threading::Mutex                                                m_mutex;
+        TVector<Entity*>                                                m_entities;
+    };
+
+    //-------------------------------------------------------------------------
+
     struct InitializationContext
     {
         friend EntityMap;
@@ -95,6 +104,12 @@ namespace EE::EntityModel
         Threading::LockFreeQueue<Entity*>                           m_registerForEntityUpdate;
         Threading::LockFreeQueue<Entity*>                           m_unregisterForEntityUpdate;
 
+        // Set whenever the entity update list or the state of any entity (systems, attachments) has changed, the world clears it once it has refreshed any cached update data
+        bool                                                        m_entityUpdateStateChanged = false;
+
+        // Initialized entities register here whenever their spatial components have dirty world transforms
+        WorldTransformUpdateRequests                                m_worldTransformUpdateRequests;
+
     private:
 
         TVector<EntityWorldSystem*> const&                         m_worldSystems;
@@ -42,6 +42,7 @@ namespace EE::EntityModel
 
         #if EE_DEVELOPMENT_TOOLS
         EE_ASSERT( m_entitiesToHotReload.empty() );
+        EE_ASSERT( m_componentsToHotReload.empty() );
         EE_ASSERT( m_editedEntities.empty() );
         #endif
 
@@ -587,6 +588,9 @@ namespace EE::EntityModel
             loadingContext.m_pTaskSystem->ScheduleTask( &loadingTask );
             loadingContext.m_pTaskSystem->WaitForTask( &loadingTask );
 
+            // Entity state updates can change the systems and attachments of entities that are registered for updates
+            initializationContext.m_entityUpdateStateChanged = true;
+
             //-------------------------------------------------------------------------
 
             // Track the number of entities that still need loading
@@ -616,6 +620,10 @@ namespace EE::EntityModel
                 EE_ASSERT( pEntity != nullptr && pEntity->m_updateRegistrationStatus == Entity::UpdateRegistrationStatus::QueuedForUnregister );
                 initializationContext.m_entityUpdateList.erase_first_unsorted( pEntity );
                 pEntity->m_updateRegistrationStatus = Entity::UpdateRegistrationStatus::Unregistered;
+                initializationContext.m_entityUpdateStateChanged = true;
+
+                // The world only batches the systems of entities in the update list, an entity that is updated some other way (i.e. by an attachment parent) needs to update all of its systems itself
+                pEntity->m_areBatchableSystemsUpdatedByWorld = false;
             }
 
             //-------------------------------------------------------------------------
@@ -628,6 +636,7 @@ namespace EE::EntityModel
                 EE_ASSERT( !pEntity->HasSpatialParent() ); // Attached entities are not allowed to be directly updated
                 initializationContext.m_entityUpdateList.push_back( pEntity );
                 pEntity->m_updateRegistrationStatus = Entity::UpdateRegistrationStatus::Registered;
+                initializationContext.m_entityUpdateStateChanged = true;
             }
         }
 
@@ -682,6 +691,13 @@ namespace EE::EntityModel
                         EE_ASSERT( pComponent != nullptr && pComponent->IsInitialized() );
                         pSystem->RegisterComponent( pEntity, pComponent );
                     }
+
+                    //-------------------------------------------------------------------------
+
+                    if ( numComponentsToUnregister > 0 || numComponentsToRegister > 0 )
+                    {
+                        pSystem->EndComponentRegistration();
+                    }
                 }
             }
 
@@ -986,6 +1002,83 @@ namespace EE::EntityModel
         }
     }
 
+    void EntityMap::HotReload_ShutdownComponents( LoadingContext const& loadingContext, InitializationContext& initializationContext, TVector<Resource::ResourceRequesterID> const& usersToReinitialize, TVector<ResourceID> const& reloadedResources )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+        EE_ASSERT( !usersToReinitialize.empty() && !reloadedResources.empty() );
+        EE_ASSERT( m_componentsToHotReload.empty() );
+
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        // Run map loading code to ensure that any destroy entity request (that might be unloading resources are executed!)
+        UpdateLoadingAndStateChanges( loadingContext, initializationContext );
+
+        // There should never be any queued registration request at this stage!
+        EE_ASSERT( initializationContext.m_registerForEntityUpdate.size_approx() == 0 && initializationContext.m_unregisterForEntityUpdate.size_approx() == 0 );
+        EE_ASSERT( initializationContext.m_componentsToRegister.size_approx() == 0 && initializationContext.m_componentsToUnregister.size_approx() == 0 );
+
+        // Generate list of components to be re-initialized
+        // Components that are not yet initialized will pick up the new data when they are
+        TVector<ResourceID> referencedResources;
+        for ( auto const& requesterID : usersToReinitialize )
+        {
+            Entity* pFoundEntity = FindEntity( EntityID( requesterID.GetID() ) );
+            if ( pFoundEntity == nullptr )
+            {
+                continue;
+            }
+
+            for ( auto pComponent : pFoundEntity->m_components )
+            {
+                if ( !pComponent->IsInitialized() )
+                {
+                    continue;
+                }
+
+                referencedResources.clear();
+                pComponent->GetTypeInfo()->GetReferencedResources( pComponent, referencedResources );
+                for ( auto const& resourceID : referencedResources )
+                {
+                    if ( VectorContains( reloadedResources, resourceID ) )
+                    {
+                        m_componentsToHotReload.emplace_back( pComponent );
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Unregister components
+        bool someComponentsRequireUnregistration = false;
+        for ( auto pComponent : m_componentsToHotReload )
+        {
+            Entity* pEntity = FindEntity( pComponent->GetEntityID() );
+
+            if ( pComponent->m_isRegisteredWithWorld )
+            {
+                initializationContext.m_componentsToUnregister.enqueue( EntityComponentPair( pEntity, pComponent ) );
+                someComponentsRequireUnregistration = true;
+            }
+
+            if ( pComponent->m_isRegisteredWithEntity )
+            {
+                pEntity->UnregisterComponentFromLocalSystems( pComponent );
+            }
+        }
+
+        if ( someComponentsRequireUnregistration )
+        {
+            ProcessEntityRegistrationRequests( initializationContext );
+        }
+
+        // Shutdown components, they remain loaded so the entity will re-initialize them once the hot-reload completes
+        for ( auto pComponent : m_componentsToHotReload )
+        {
+            EE_ASSERT( !pComponent->m_isRegisteredWithWorld && !pComponent->m_isRegisteredWithEntity );
+            pComponent->Shutdown();
+        }
+    }
+
     void EntityMap::HotReload_ReloadEntities( LoadingContext const& loadingContext )
     {
         EE_ASSERT( Threading::IsMainThread() );
@@ -1000,6 +1093,19 @@ namespace EE::EntityModel
         }
 
         m_entitiesToHotReload.clear();
+
+        // Shutdown components are re-initialized by the regular entity state update
+        // If the entity was also fully reloaded, it is already in the loading list
+        for ( auto pComponent : m_componentsToHotReload )
+        {
+            Entity* pEntity = FindEntity( pComponent->GetEntityID() );
+            if ( !VectorContains( m_entitiesCurrentlyLoading, pEntity ) )
+            {
+                m_entitiesCurrentlyLoading.emplace_back( pEntity );
+            }
+        }
+
+        m_componentsToHotReload.clear();
     }
     #endif
 }
\ No newline at end of file
@@ -20,6 +20,7 @@
 namespace EE
 {
     class Entity;
+    class EntityComponent;
 
     //-------------------------------------------------------------------------
 
@@ -163,7 +164,11 @@ namespace EE
             // Shutdown and unload all entities that are affected by the hot-reload
             void HotReload_UnloadEntities( LoadingContext const& loadingContext, InitializationContext& initializationContext, TVector<Resource::ResourceRequesterID> const& usersToReload );
 
-            // Load all entities unloaded due to the hot-reload
+            // Unregister and shutdown all the initialized components (of the specified users) that reference any of the resources that were reloaded in place
+            // The components stay loaded and the rest of the entity is left untouched
+            void HotReload_ShutdownComponents( LoadingContext const& loadingContext, InitializationContext& initializationContext, TVector<Resource::ResourceRequesterID> const& usersToReinitialize, TVector<ResourceID> const& reloadedResources );
+
+            // Load all entities unloaded due to the hot-reload and re-initialize all components that were shutdown
             void HotReload_ReloadEntities( LoadingContext const& loadingContext );
             #endif
 
@@ -199,6 +204,7 @@ namespace EE
             #if EE_DEVELOPMENT_TOOLS
             THashMap<StringID, Entity*>                 m_entityNameLookupMap; // All entities that have attempted to load
             TVector<Entity*>                            m_entitiesToHotReload;
+            TVector<EntityComponent*>                   m_componentsToHotReload;
             TVector<Entity*>                            m_editedEntities;
             #endif
         };
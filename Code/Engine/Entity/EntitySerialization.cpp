@@ -66,6 +66,7 @@ namespace EE::EntityModel
                 // Set parent socket ID
                 auto pSpatialEntityComponent = reinterpret_cast<SpatialEntityComponent*>( pEntityComponent );
                 pSpatialEntityComponent->m_parentAttachmentSocketID = componentDesc.m_attachmentSocketID;
+                pSpatialEntityComponent->m_pEntity = pEntity;
 
                 // Set as root component
                 if ( componentDesc.IsRootComponent() )
@@ -1,10 +1,32 @@
 #include "EntitySpatialComponent.h"
+#include "Entity.h"
 #include "EntityLog.h"
+#include "Base/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    #if EE_DEVELOPMENT_TOOLS
+    static std::atomic<uint64_t> g_numWorldTransformInvalidations = 0;
+    static std::atomic<uint64_t> g_numWorldTransformCalculations = 0;
+
+    SpatialEntityComponent::WorldTransformStats SpatialEntityComponent::GetWorldTransformStats()
+    {
+        WorldTransformStats stats;
+        stats.m_numInvalidations = g_numWorldTransformInvalidations.load( std::memory_order_relaxed );
+        stats.m_numCalculations = g_numWorldTransformCalculations.load( std::memory_order_relaxed );
+        return stats;
+    }
+
+    void SpatialEntityComponent::RecordWorldTransformCalculation()
+    {
+        g_numWorldTransformCalculations.fetch_add( 1, std::memory_order_relaxed );
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
     int32_t SpatialEntityComponent::GetSpatialHierarchyDepth( bool limitToCurrentEntity ) const
     {
         int32_t hierarchyDepth = 0;
@@ -59,7 +81,7 @@ namespace EE
         // If the socket ID is invalid, just return the current transform
         if ( !socketID.IsValid() )
         {
-            socketTransform = m_worldTransform;
+            socketTransform = GetWorldTransform();
             return socketTransform;
         }
 
@@ -90,7 +112,7 @@ namespace EE
         }
 
         // Fallback to the world transform
-        socketTransform = m_worldTransform;
+        socketTransform = GetWorldTransform();
         return socketTransform;
     }
 
@@ -127,15 +149,118 @@ namespace EE
 
     bool SpatialEntityComponent::TryFindAttachmentSocketTransform( StringID socketID, Transform& outSocketWorldTransform ) const
     {
-        outSocketWorldTransform = m_worldTransform;
+        outSocketWorldTransform = GetWorldTransform();
         return false;
     }
 
     void SpatialEntityComponent::NotifySocketsUpdated()
     {
-        for ( auto& pChildComponent : m_spatialChildren )
+        InvalidateChildWorldTransforms( true );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SpatialEntityComponent::UpdateWorldTransform() const
+    {
+        // Other entities can read our transform during the parallel entity update, so claim the recalculation first
+        while ( true )
+        {
+            WorldTransformState expectedState = WorldTransformState::Dirty;
+            if ( m_worldTransformState.compare_exchange_weak( expectedState, WorldTransformState::Updating, std::memory_order_acquire, std::memory_order_acquire ) )
+            {
+                break;
+            }
+
+            if ( expectedState == WorldTransformState::Clean )
+            {
+                return;
+            }
+
+            // Another thread is recalculating the transform, wait for it to publish the result
+            if ( expectedState != WorldTransformState::Dirty )
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        // Recalculate until we manage to publish a result, if we got invalidated while calculating, the result is already out of date
+        while ( true )
+        {
+            // Only update the transform if we have a parent, if we dont have a parent it means we are the root transform
+            // Getting the socket transform will update our parent first if it is also dirty
+            if ( m_pSpatialParent != nullptr )
+            {
+                auto parentWorldTransform = m_pSpatialParent->GetAttachmentSocketTransform( m_parentAttachmentSocketID );
+                m_worldTransform = m_transform * parentWorldTransform;
+            }
+            else
+            {
+                m_worldTransform = m_transform;
+            }
+
+            // Calculate world bounds
+            m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
+            EE_DEVELOPMENT_TOOLS_ONLY( RecordWorldTransformCalculation() );
+
+            WorldTransformState expectedState = WorldTransformState::Updating;
+            if ( m_worldTransformState.compare_exchange_strong( expectedState, WorldTransformState::Clean, std::memory_order_release, std::memory_order_acquire ) )
+            {
+                break;
+            }
+
+            // Invalidators never change the state once it is 'UpdatingInvalidated', so we still own the recalculation
+            EE_ASSERT( expectedState == WorldTransformState::UpdatingInvalidated );
+            m_worldTransformState.store( WorldTransformState::Updating, std::memory_order_relaxed );
+        }
+    }
+
+    SpatialEntityComponent::WorldTransformState SpatialEntityComponent::MarkWorldTransformDirty() const
+    {
+        // If another thread is recalculating the transform, we cant move it back to dirty since that would allow a second thread to start calculating
+        // Instead we flag it so that the updating thread recalculates before publishing
+        WorldTransformState previousState = m_worldTransformState.load( std::memory_order_relaxed );
+        while ( true )
+        {
+            bool const isBeingUpdated = ( previousState == WorldTransformState::Updating || previousState == WorldTransformState::UpdatingInvalidated );
+            WorldTransformState const newState = isBeingUpdated ? WorldTransformState::UpdatingInvalidated : WorldTransformState::Dirty;
+            if ( previousState == newState || m_worldTransformState.compare_exchange_weak( previousState, newState, std::memory_order_release, std::memory_order_relaxed ) )
+            {
+                return previousState;
+            }
+        }
+    }
+
+    void SpatialEntityComponent::InvalidateChildWorldTransforms( bool triggerCallbacks )
+    {
+        for ( auto pChildComponent : m_spatialChildren )
+        {
+            pChildComponent->InvalidateWorldTransform( triggerCallbacks );
+        }
+
+        // Entities that are not yet initialized will flush their transforms when they are
+        if ( m_pEntity != nullptr )
+        {
+            m_pEntity->RequestWorldTransformUpdate();
+        }
+    }
+
+    void SpatialEntityComponent::InvalidateWorldTransform( bool triggerCallback )
+    {
+        EE_DEVELOPMENT_TOOLS_ONLY( g_numWorldTransformInvalidations.fetch_add( 1, std::memory_order_relaxed ) );
+
+        // A component can only be clean if all its parents are, so the children of a component that wasnt clean are always dirty as well
+        // We only need to continue if there is a callback to add
+        bool const wasWorldTransformClean = MarkWorldTransformDirty() == WorldTransformState::Clean;
+        if ( !wasWorldTransformClean && ( m_isWorldTransformCallbackPending || !triggerCallback ) )
+        {
+            return;
+        }
+
+        m_isWorldTransformCallbackPending |= triggerCallback;
+
+        for ( auto pChildComponent : m_spatialChildren )
         {
-            pChildComponent->CalculateWorldTransform();
+            pChildComponent->InvalidateWorldTransform( triggerCallback );
         }
     }
 
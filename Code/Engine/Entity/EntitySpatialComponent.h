@@ -3,11 +3,14 @@
 #include "EntityComponent.h"
 #include "Base/Math/BoundingVolumes.h"
 #include "Base/Math/Transform.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    class Entity;
+
     #if EE_DEVELOPMENT_TOOLS
     namespace EntityModel
     {
@@ -16,6 +19,10 @@ namespace EE
     #endif
 
     //-------------------------------------------------------------------------
+    // World transforms are calculated lazily: changing a transform only flags the world transforms of the component and its children as dirty.
+    // Dirty world transforms are recalculated on access or when the owning entity flushes its transforms (see Entity::UpdateWorldTransforms).
+    // The transform updated callbacks of children are deferred until that flush, so a child that is moved multiple times in a frame is only updated once.
+    // Lazy recalculation is safe to trigger from other entities during the parallel update, only a single thread will recalculate a dirty transform.
 
     class EE_ENGINE_API SpatialEntityComponent : public EntityComponent
     {
@@ -39,6 +46,21 @@ namespace EE
             bool        m_wasFound = false;
         };
 
+    public:
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct WorldTransformStats
+        {
+            uint64_t        m_numInvalidations = 0;     // The number of times a world transform was flagged as dirty (i.e. the number of calculations an eager update would have performed)
+            uint64_t        m_numCalculations = 0;      // The number of world transforms that were actually calculated
+
+            inline uint64_t GetNumCalculationsSaved() const { return ( m_numInvalidations > m_numCalculations ) ? m_numInvalidations - m_numCalculations : 0; }
+        };
+
+        // Get the accumulated world transform stats for all spatial components
+        static WorldTransformStats GetWorldTransformStats();
+        #endif
+
     public:
 
         // Spatial data
@@ -50,29 +72,31 @@ namespace EE
         inline Transform const& GetLocalTransform() const { return m_transform; }
         inline OBB const& GetLocalBounds() const { return m_bounds; }
 
-        inline Transform const& GetWorldTransform() const { return m_worldTransform; }
-        inline OBB const& GetWorldBounds() const { return m_worldBounds; }
+        inline Transform const& GetWorldTransform() const { UpdateWorldTransformIfDirty(); return m_worldTransform; }
+        inline OBB const& GetWorldBounds() const { UpdateWorldTransformIfDirty(); return m_worldBounds; }
 
         // Get world space position
-        inline Vector const& GetPosition() const { return m_worldTransform.GetTranslation(); }
+        inline Vector const& GetPosition() const { return GetWorldTransform().GetTranslation(); }
 
         // Get world space orientation
-        inline Quaternion const& GetOrientation() const { return m_worldTransform.GetRotation(); }
+        inline Quaternion const& GetOrientation() const { return GetWorldTransform().GetRotation(); }
         
         // Get world space forward vector
-        inline Vector GetForwardVector() const { return m_worldTransform.GetForwardVector(); }
+        inline Vector GetForwardVector() const { return GetWorldTransform().GetForwardVector(); }
 
         // Get world space up vector
-        inline Vector GetUpVector() const { return m_worldTransform.GetUpVector(); }
+        inline Vector GetUpVector() const { return GetWorldTransform().GetUpVector(); }
 
         // Get world space right vector
-        inline Vector GetRightVector() const { return m_worldTransform.GetRightVector(); }
+        inline Vector GetRightVector() const { return GetWorldTransform().GetRightVector(); }
 
-        // Call to update the local transform - this will also update the world transform for this component and all children
+        // Call to update the local transform - this will also invalidate the world transform for this component and all children
         inline void SetLocalTransform( Transform const& newTransform )
         {
             m_transform = newTransform;
-            CalculateWorldTransform();
+            MarkWorldTransformDirty();
+            InvalidateChildWorldTransforms( true );
+            OnWorldTransformUpdated();
         }
 
         // Call to update the world transform - this will also updated the local transform for this component and all children's world transforms
@@ -136,13 +160,13 @@ namespace EE
         //-------------------------------------------------------------------------
 
         // Convert a world transform to a component local transform
-        inline Transform ConvertWorldTransformToLocalTransform( Transform const& worldTransform ) const { return Transform::Delta( m_worldTransform, worldTransform ); }
+        inline Transform ConvertWorldTransformToLocalTransform( Transform const& worldTransform ) const { return Transform::Delta( GetWorldTransform(), worldTransform ); }
 
         // Convert a world point to a component local point 
-        inline Vector ConvertWorldPointToLocalPoint( Vector const& worldPoint ) const { return m_worldTransform.GetInverse().TransformPoint( worldPoint ); }
+        inline Vector ConvertWorldPointToLocalPoint( Vector const& worldPoint ) const { return GetWorldTransform().GetInverse().TransformPoint( worldPoint ); }
 
         // Convert a world direction to a component local direction 
-        inline Vector ConvertWorldVectorToLocalVector( Vector const& worldVector ) const { return m_worldTransform.GetInverse().RotateVector( worldVector ); }
+        inline Vector ConvertWorldVectorToLocalVector( Vector const& worldVector ) const { return GetWorldTransform().GetInverse().RotateVector( worldVector ); }
 
     protected:
 
@@ -165,7 +189,7 @@ namespace EE
         {
             EE_DEVELOPMENT_TOOLS_ONLY( m_boundsValidationGuard = true );
             m_bounds = CalculateLocalBounds();
-            m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
+            m_worldBounds = m_bounds.GetTransformed( GetWorldTransform() );
         }
 
         // Try to find and return the world space transform for the specified socket
@@ -203,12 +227,11 @@ namespace EE
 
             // Calculate world bounds
             m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
+            m_worldTransformState.store( WorldTransformState::Clean, std::memory_order_release );
+            EE_DEVELOPMENT_TOOLS_ONLY( RecordWorldTransformCalculation() );
 
-            // Propagate the world transforms on the children - children will always have their callbacks fired!
-            for ( auto pChild : m_spatialChildren )
-            {
-                pChild->CalculateWorldTransform();
-            }
+            // Invalidate the world transforms of the children - children will always have their callbacks fired!
+            InvalidateChildWorldTransforms( true );
 
             // Should we fire the transform updated callback?
             if ( triggerCallback )
@@ -223,47 +246,69 @@ namespace EE
 
     private:
 
-        // Called whenever the local transform is modified
+        // Called whenever the local transform or the hierarchy is modified, immediately calculates our world transform and invalidates the children's
         inline void CalculateWorldTransform( bool triggerCallback = true )
         {
-            // Only update the transform if we have a parent, if we dont have a parent it means we are the root transform
-            if ( m_pSpatialParent != nullptr )
-            {
-                auto parentWorldTransform = m_pSpatialParent->GetAttachmentSocketTransform( m_parentAttachmentSocketID );
-                m_worldTransform = m_transform * parentWorldTransform;
-            }
-            else
-            {
-                m_worldTransform = m_transform;
-            }
+            MarkWorldTransformDirty();
+            UpdateWorldTransformIfDirty();
+            InvalidateChildWorldTransforms( triggerCallback );
 
-            // Calculate world bounds
-            m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
-
-            // Propagate the world transforms on the children
-            for ( auto pChild : m_spatialChildren )
+            if ( triggerCallback )
             {
-                pChild->CalculateWorldTransform( triggerCallback );
+                OnWorldTransformUpdated();
             }
+        }
 
-            if ( triggerCallback )
+        // Recalculate the world transform and bounds if they are out of date, this will also update any dirty parents
+        inline void UpdateWorldTransformIfDirty() const
+        {
+            if ( m_worldTransformState.load( std::memory_order_acquire ) != WorldTransformState::Clean )
             {
-                OnWorldTransformUpdated();
+                UpdateWorldTransform();
             }
         }
 
+        // Only the thread that claims the dirty transform will recalculate it, any other thread will wait for the result
+        void UpdateWorldTransform() const;
+
+        // Flag the world transforms of all children as dirty and request a transform flush from the owning entity
+        void InvalidateChildWorldTransforms( bool triggerCallbacks );
+
+        // Flag the world transform of this component and all its children as dirty, optionally deferring the transform updated callback to the next flush
+        void InvalidateWorldTransform( bool triggerCallback );
+
+        #if EE_DEVELOPMENT_TOOLS
+        static void RecordWorldTransformCalculation();
+        #endif
+
+    private:
+
+        enum class WorldTransformState : uint8_t
+        {
+            Clean,
+            Dirty,
+            Updating,
+            UpdatingInvalidated,    // Invalidated while being recalculated, the updating thread will recalculate again before publishing
+        };
+
+        // Flag our world transform as out of date, this is safe to call while another thread is recalculating it. Returns the previous state
+        WorldTransformState MarkWorldTransformDirty() const;
+
     private:
 
         EE_REFLECT() Transform                                                 m_transform;                            // Local space transform
         OBB                                                                 m_bounds;                               // Local space bounding box
-        Transform                                                           m_worldTransform;                       // World space transform (left uninitialized to catch initialization errors)
-        OBB                                                                 m_worldBounds;                          // World space bounding box
+        mutable Transform                                                   m_worldTransform;                       // World space transform (left uninitialized to catch initialization errors)
+        mutable OBB                                                         m_worldBounds;                          // World space bounding box
+        mutable std::atomic<WorldTransformState>                            m_worldTransformState = WorldTransformState::Dirty; // Is the world transform (and bounds) out of date with regards to the local transform and our parent
+        bool                                                                m_isWorldTransformCallbackPending = false; // Has our world transform been invalidated by a parent without us having been notified yet
 
         //-------------------------------------------------------------------------
 
         SpatialEntityComponent*                                             m_pSpatialParent = nullptr;             // The component we are attached to (spatial hierarchy is managed by the parent entity!)
         EE_REFLECT() StringID                                                  m_parentAttachmentSocketID;             // The socket we are attached to (can be invalid)
         TInlineVector<SpatialEntityComponent*, 2>                           m_spatialChildren;                      // All components that are attached to us. DO NOT EXPOSE THIS!!!
+        Entity*                                                             m_pEntity = nullptr;                    // The entity that owns us, set by the entity when we are added to it
 
         //-------------------------------------------------------------------------
 
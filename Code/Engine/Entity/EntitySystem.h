@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "Engine/UpdateStage.h"
 #include "Base/TypeSystem/ReflectedType.h"
+#include "Base/Types/Arrays.h"
 
 //-------------------------------------------------------------------------
 
@@ -19,6 +20,7 @@ namespace EE
         EE_REFLECT_TYPE( EntitySystem );
 
         friend class Entity;
+        friend class EntityWorld;
 
     public:
 
@@ -43,6 +45,10 @@ namespace EE
         // Called after all components have been unregistered from the system
         virtual void Shutdown() {}
 
+        // Can all the instances of this system type be updated together (see UpdateBatch)
+        // Batched systems are updated after all the other systems on their entity, so only systems that already update last and only touch their own entity should opt in
+        virtual bool IsBatchable() const { return false; }
+
     protected:
 
         // Get the required update stages and priorities for this component
@@ -54,6 +60,16 @@ namespace EE
 
         // System Update
         virtual void Update( EntityWorldUpdateContext const& ctx ) = 0;
+
+        // Batched system update - only used for batchable systems when the world has batched system updates enabled
+        // Called on the first system of the batch, all the systems in the batch are of the same type and belong to different entities
+        virtual void UpdateBatch( EntityWorldUpdateContext const& ctx, TSpan<EntitySystem* const> systems )
+        {
+            for ( auto pSystem : systems )
+            {
+                pSystem->Update( ctx );
+            }
+        }
     };
 }
 
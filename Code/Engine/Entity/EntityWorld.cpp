@@ -4,12 +4,33 @@
 #include "Base/Resource/ResourceSystem.h"
 #include "Base/Profiling.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Math/Math.h"
 #include <eastl/sort.h>
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    // The max number of systems updated by a single batch, large groups are split so that they can be spread across workers
+    constexpr static int32_t const g_maxSystemsPerUpdateBatch = 128;
+
+    // Each entity's update cost is only measured once every N updates of a stage
+    constexpr static uint32_t const g_entityCostSamplingInterval = 4;
+
+    // Weight of the latest measurement in the running average entity cost
+    constexpr static float const g_entityCostSmoothingFactor = 0.2f;
+
+    // The cost we assume for entities that have not been measured yet
+    constexpr static float const g_defaultEntityCostMicroseconds = 1.0f;
+
+    // How many partitions we aim to create per thread, having more partitions than threads lets the scheduler balance out estimation errors
+    constexpr static int32_t const g_entityUpdatePartitionsPerThread = 4;
+
+    // The schedule is periodically re-sorted since the entity costs change over time
+    constexpr static uint32_t const g_entityUpdateScheduleRefreshInterval = 30;
+
+    //-------------------------------------------------------------------------
+
     EntityWorld::EntityWorld( EntityWorldType worldType )
         : m_initializationContext( m_worldSystems, m_entityUpdateList )
         , m_worldType( worldType )
@@ -24,6 +45,7 @@ namespace EE
         for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
         {
             EE_ASSERT( m_systemUpdateLists[i].empty() );
+            EE_ASSERT( m_batchedSystems[i].empty() );
         }
 
         //-------------------------------------------------------------------------
@@ -131,6 +153,14 @@ namespace EE
             UpdateLoading();
         }
 
+        // All entities have been unloaded so clear all cached update data
+        RebuildSystemUpdateBatches();
+
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            m_entityUpdateSchedules[i] = EntityUpdateSchedule();
+        }
+
         // Destroy all settings
         //-------------------------------------------------------------------------
 
@@ -210,6 +240,178 @@ namespace EE
         }
     }
 
+    void EntityWorld::SetBatchedSystemUpdateEnabled( bool isEnabled )
+    {
+        if ( m_isBatchedSystemUpdateEnabled != isEnabled )
+        {
+            m_isBatchedSystemUpdateEnabled = isEnabled;
+            m_systemUpdateBatchesDirty = true;
+        }
+    }
+
+    void EntityWorld::RebuildSystemUpdateBatches()
+    {
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            m_batchedSystems[i].clear();
+            m_systemUpdateBatches[i].clear();
+        }
+
+        // Gather batchable systems
+        //-------------------------------------------------------------------------
+        // Entities with attached entities are excluded since their systems need to be updated in hierarchy order
+
+        for ( auto pEntity : m_entityUpdateList )
+        {
+            pEntity->m_areBatchableSystemsUpdatedByWorld = m_isBatchedSystemUpdateEnabled && !pEntity->HasAttachedEntities();
+            if ( !pEntity->m_areBatchableSystemsUpdatedByWorld )
+            {
+                continue;
+            }
+
+            for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+            {
+                for ( auto pSystem : pEntity->m_systemUpdateLists[i] )
+                {
+                    if ( pSystem->IsBatchable() )
+                    {
+                        m_batchedSystems[i].emplace_back( pSystem );
+                    }
+                }
+            }
+        }
+
+        // Group by type and split into batches
+        //-------------------------------------------------------------------------
+
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            TVector<EntitySystem*>& batchedSystems = m_batchedSystems[i];
+            eastl::sort( batchedSystems.begin(), batchedSystems.end(), [] ( EntitySystem* const& pSystemA, EntitySystem* const& pSystemB ) { return pSystemA->GetTypeInfo() < pSystemB->GetTypeInfo(); } );
+
+            int32_t const numSystems = (int32_t) batchedSystems.size();
+            for ( int32_t systemIdx = 0; systemIdx < numSystems; systemIdx++ )
+            {
+                bool const startNewBatch = m_systemUpdateBatches[i].empty() || m_systemUpdateBatches[i].back().m_numSystems == g_maxSystemsPerUpdateBatch || batchedSystems[systemIdx - 1]->GetTypeInfo() != batchedSystems[systemIdx]->GetTypeInfo();
+                if ( startNewBatch )
+                {
+                    m_systemUpdateBatches[i].push_back( { systemIdx, 0 } );
+                }
+
+                m_systemUpdateBatches[i].back().m_numSystems++;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_systemUpdateBatchesDirty = false;
+    }
+
+    void EntityWorld::RebuildEntityUpdateSchedule( UpdateStage stage )
+    {
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        int8_t const stageIdx = (int8_t) stage;
+        EntityUpdateSchedule& schedule = m_entityUpdateSchedules[stageIdx];
+        schedule.m_entities.clear();
+        schedule.m_partitionEnds.clear();
+        schedule.m_numUpdatesSinceRebuild = 0;
+        schedule.m_isDirty = false;
+
+        // Sort by cost, the most expensive entities (usually the long attachment chains) are updated first
+        //-------------------------------------------------------------------------
+
+        auto GetEntityCost = [stageIdx] ( Entity const* pEntity ) { return Math::Max( pEntity->m_averageUpdateCosts[stageIdx].ToFloat(), g_defaultEntityCostMicroseconds ); };
+
+        float totalCost = 0.0f;
+        float totalMeasuredCost = 0.0f;
+        schedule.m_entities.reserve( m_entityUpdateList.size() );
+        for ( auto pEntity : m_entityUpdateList )
+        {
+            // Entities with spatial parents are updated by their parents
+            if ( pEntity->HasSpatialParent() )
+            {
+                continue;
+            }
+
+            schedule.m_entities.emplace_back( pEntity );
+            totalCost += GetEntityCost( pEntity );
+            totalMeasuredCost += pEntity->m_averageUpdateCosts[stageIdx].ToFloat();
+        }
+
+        eastl::sort( schedule.m_entities.begin(), schedule.m_entities.end(), [&GetEntityCost] ( Entity* const& pEntityA, Entity* const& pEntityB ) { return GetEntityCost( pEntityA ) > GetEntityCost( pEntityB ); } );
+
+        // Split into contiguous partitions of roughly equal cost
+        //-------------------------------------------------------------------------
+        // Entities that are more expensive than the target cost end up in their own partition
+
+        int32_t const numEntities = (int32_t) schedule.m_entities.size();
+        int32_t const numThreads = (int32_t) m_pTaskSystem->GetNumWorkers() + 1;
+        float const targetPartitionCost = totalCost / ( numThreads * g_entityUpdatePartitionsPerThread );
+
+        float partitionCost = 0.0f;
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            partitionCost += GetEntityCost( schedule.m_entities[i] );
+            if ( partitionCost >= targetPartitionCost || i == numEntities - 1 )
+            {
+                schedule.m_partitionEnds.emplace_back( i + 1 );
+                partitionCost = 0.0f;
+            }
+        }
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        EntityUpdateStats& stats = m_entityUpdateStats[stageIdx];
+        stats.m_numEntities = numEntities;
+        stats.m_numPartitions = (int32_t) schedule.m_partitionEnds.size();
+        stats.m_estimatedCost = Microseconds( totalMeasuredCost ).ToMilliseconds();
+    }
+
+    void EntityWorld::UpdateWorldTransforms()
+    {
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        EntityModel::WorldTransformUpdateRequests& requests = m_initializationContext.m_worldTransformUpdateRequests;
+        int32_t numEntitiesUpdated = 0;
+
+        // Transform callbacks can invalidate further transforms, so keep going until there are no more requests
+        while ( true )
+        {
+            {
+                Threading::ScopeLock lock( requests.m_mutex );
+                m_worldTransformUpdateEntities.swap( requests.m_entities );
+            }
+
+            if ( m_worldTransformUpdateEntities.empty() )
+            {
+                break;
+            }
+
+            // Entities might already be up to date if they were flushed after their update, in which case this is cheap
+            for ( auto pEntity : m_worldTransformUpdateEntities )
+            {
+                pEntity->m_isWorldTransformUpdateRequested = false;
+                pEntity->UpdateWorldTransforms();
+            }
+
+            numEntitiesUpdated += (int32_t) m_worldTransformUpdateEntities.size();
+            m_worldTransformUpdateEntities.clear();
+        }
+
+        //-------------------------------------------------------------------------
+
+        EE_PROFILE_TAG( "Num Entities", (uint32_t) numEntitiesUpdated );
+
+        #if EE_DEVELOPMENT_TOOLS
+        SpatialEntityComponent::WorldTransformStats const stats = SpatialEntityComponent::GetWorldTransformStats();
+        EE_PROFILE_TAG( "Transform Calculations Saved", stats.GetNumCalculationsSaved() );
+        #endif
+    }
+
     void EntityWorld::Update( UpdateContext const& context )
     {
         EE_ASSERT( Threading::IsMainThread() );
@@ -217,11 +419,14 @@ namespace EE
 
         struct EntityUpdateTask final : public ITaskSet
         {
-            EntityUpdateTask( EntityWorldUpdateContext const& context, TVector<Entity*>& updateList )
+            EntityUpdateTask( EntityWorldUpdateContext const& context, EntityUpdateSchedule const& schedule, TVector<uint64_t>& workerFinishTimes )
                 : m_context( context )
-                , m_updateList( updateList )
+                , m_schedule( schedule )
+                , m_workerFinishTimes( workerFinishTimes )
+                , m_stageIdx( (int8_t) context.GetUpdateStage() )
             {
-                m_SetSize = (uint32_t) updateList.size();
+                m_SetSize = (uint32_t) schedule.m_partitionEnds.size();
+                m_MinRange = 1;
             }
 
             // Only used for spatial dependency chain updates
@@ -237,35 +442,94 @@ namespace EE
 
             virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
             {
-                for ( uint64_t i = range.start; i < range.end; ++i )
+                for ( uint64_t partitionIdx = range.start; partitionIdx < range.end; ++partitionIdx )
                 {
-                    auto pEntity = m_updateList[i];
+                    int32_t const partitionStart = ( partitionIdx == 0 ) ? 0 : m_schedule.m_partitionEnds[partitionIdx - 1];
+                    int32_t const partitionEnd = m_schedule.m_partitionEnds[partitionIdx];
 
-                    // Ignore any entities with spatial parents, these will be updated by their parents
-                    if ( pEntity->HasSpatialParent() )
+                    for ( int32_t i = partitionStart; i < partitionEnd; ++i )
                     {
-                        continue;
+                        auto pEntity = m_schedule.m_entities[i];
+
+                        // Ignore any entities with spatial parents, these will be updated by their parents
+                        if ( pEntity->HasSpatialParent() )
+                        {
+                            continue;
+                        }
+
+                        // Only a subset of the entities are measured each update to keep the overhead low
+                        bool const shouldSampleCost = ( ( i + m_schedule.m_numUpdatesSinceRebuild ) % g_entityCostSamplingInterval ) == 0;
+                        uint64_t const startTime = shouldSampleCost ? PlatformClock::GetTime().ToU64() : 0;
+
+                        //-------------------------------------------------------------------------
+
+                        // Transforms are flushed right after the update while the entity is still in the cache, the world will flush any later changes
+                        if ( pEntity->HasAttachedEntities() )
+                        {
+                            EE_PROFILE_SCOPE_ENTITY( "Update Entity Chain" );
+                            RecursiveEntityUpdate( pEntity );
+                            pEntity->UpdateWorldTransforms();
+                        }
+                        else // Direct entity update
+                        {
+                            EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
+                            pEntity->UpdateSystems( m_context );
+
+                            if ( pEntity->m_isWorldTransformUpdateRequested )
+                            {
+                                pEntity->UpdateWorldTransforms();
+                            }
+                        }
+
+                        //-------------------------------------------------------------------------
+
+                        if ( shouldSampleCost )
+                        {
+                            Microseconds const cost = Nanoseconds( PlatformClock::GetTime().ToU64() - startTime ).ToMicroseconds();
+                            Microseconds& averageCost = pEntity->m_averageUpdateCosts[m_stageIdx];
+                            averageCost = ( averageCost == 0.0f ) ? cost : Microseconds( Math::Lerp( averageCost.ToFloat(), cost.ToFloat(), g_entityCostSmoothingFactor ) );
+                        }
                     }
+                }
 
-                    //-------------------------------------------------------------------------
+                EE_ASSERT( threadnum < m_workerFinishTimes.size() );
+                m_workerFinishTimes[threadnum] = PlatformClock::GetTime().ToU64();
+            }
 
-                    if ( pEntity->HasAttachedEntities() )
-                    {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity Chain" );
-                        RecursiveEntityUpdate( pEntity );
-                    }
-                    else // Direct entity update
-                    {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
-                        pEntity->UpdateSystems( m_context );
-                    }
+        private:
+
+            EntityWorldUpdateContext const&              m_context;
+            EntityUpdateSchedule const&                  m_schedule;
+            TVector<uint64_t>&                           m_workerFinishTimes;
+            int8_t                                       m_stageIdx;
+        };
+
+        struct SystemBatchUpdateTask final : public ITaskSet
+        {
+            SystemBatchUpdateTask( EntityWorldUpdateContext const& context, TVector<EntitySystem*> const& batchedSystems, TVector<SystemUpdateBatch> const& batches )
+                : m_context( context )
+                , m_batchedSystems( batchedSystems )
+                , m_batches( batches )
+            {
+                m_SetSize = (uint32_t) m_batches.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    EE_PROFILE_SCOPE_ENTITY( "Update System Batch" );
+                    SystemUpdateBatch const& batch = m_batches[i];
+                    TSpan<EntitySystem* const> systems( m_batchedSystems.data() + batch.m_firstSystemIdx, batch.m_numSystems );
+                    systems[0]->UpdateBatch( m_context, systems );
                 }
             }
 
         private:
 
             EntityWorldUpdateContext const&              m_context;
-            TVector<Entity*>&                            m_updateList;
+            TVector<EntitySystem*> const&                m_batchedSystems;
+            TVector<SystemUpdateBatch> const&            m_batches;
         };
 
         //-------------------------------------------------------------------------
@@ -289,15 +553,87 @@ namespace EE
 
         EntityWorldUpdateContext entityWorldUpdateContext( context, this );
 
+        // Any change to the registered entities invalidates all the cached update data
+        if ( m_initializationContext.m_entityUpdateStateChanged )
+        {
+            m_systemUpdateBatchesDirty = true;
+
+            for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+            {
+                m_entityUpdateSchedules[i].m_isDirty = true;
+            }
+
+            m_initializationContext.m_entityUpdateStateChanged = false;
+        }
+
+        // Refresh system batches, this needs to happen before the entity update since it determines which systems entities update themselves
+        if ( m_systemUpdateBatchesDirty )
+        {
+            RebuildSystemUpdateBatches();
+        }
+
+        EntityUpdateSchedule& entityUpdateSchedule = m_entityUpdateSchedules[(int8_t) updateStage];
+        if ( entityUpdateSchedule.m_isDirty || entityUpdateSchedule.m_numUpdatesSinceRebuild >= g_entityUpdateScheduleRefreshInterval )
+        {
+            RebuildEntityUpdateSchedule( updateStage );
+        }
+
         // Update entities
         //-------------------------------------------------------------------------
 
-        EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, m_entityUpdateList );
-        m_pTaskSystem->ScheduleTask( &entityUpdateTask );
-        m_pTaskSystem->WaitForTask( &entityUpdateTask );
+        {
+            EE_PROFILE_SCOPE_ENTITY( "Update Entities" );
+
+            m_workerFinishTimes.clear();
+            m_workerFinishTimes.resize( m_pTaskSystem->GetNumWorkers() + 1, 0 );
+
+            uint64_t const updateStartTime = PlatformClock::GetTime().ToU64();
+
+            EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, entityUpdateSchedule, m_workerFinishTimes );
+            m_pTaskSystem->ScheduleTask( &entityUpdateTask );
+            m_pTaskSystem->WaitForTask( &entityUpdateTask );
 
-        // Force execution on main thread for debugging purposes
-        //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityUpdateList.size() }, 0 );
+            // Force execution on main thread for debugging purposes
+            //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) entityUpdateSchedule.m_partitionEnds.size() }, 0 );
+
+            entityUpdateSchedule.m_numUpdatesSinceRebuild++;
+
+            // Stats - the tail latency is the time the busiest thread kept running after the first thread ran out of work
+            //-------------------------------------------------------------------------
+
+            uint64_t const updateEndTime = PlatformClock::GetTime().ToU64();
+            uint64_t firstFinishTime = updateEndTime;
+            uint64_t lastFinishTime = updateStartTime;
+            for ( uint64_t finishTime : m_workerFinishTimes )
+            {
+                if ( finishTime != 0 )
+                {
+                    firstFinishTime = Math::Min( firstFinishTime, finishTime );
+                    lastFinishTime = Math::Max( lastFinishTime, finishTime );
+                }
+            }
+
+            EntityUpdateStats& stats = m_entityUpdateStats[(int8_t) updateStage];
+            stats.m_updateTime = Nanoseconds( updateEndTime - updateStartTime ).ToMilliseconds();
+            stats.m_tailLatency = ( lastFinishTime > firstFinishTime ) ? Nanoseconds( lastFinishTime - firstFinishTime ).ToMilliseconds() : Milliseconds( 0.0f );
+
+            EE_PROFILE_TAG( "Num Partitions", (uint32_t) stats.m_numPartitions );
+            EE_PROFILE_TAG( "Tail Latency (ms)", stats.m_tailLatency.ToFloat() );
+        }
+
+        // Update batched entity systems
+        //-------------------------------------------------------------------------
+
+        TVector<SystemUpdateBatch> const& systemUpdateBatches = m_systemUpdateBatches[(int8_t) updateStage];
+        if ( !systemUpdateBatches.empty() )
+        {
+            EE_PROFILE_SCOPE_ENTITY( "Update Batched Systems" );
+            EE_PROFILE_TAG( "Num Systems", (uint32_t) m_batchedSystems[(int8_t) updateStage].size() );
+
+            SystemBatchUpdateTask systemBatchUpdateTask( entityWorldUpdateContext, m_batchedSystems[(int8_t) updateStage], systemUpdateBatches );
+            m_pTaskSystem->ScheduleTask( &systemBatchUpdateTask );
+            m_pTaskSystem->WaitForTask( &systemBatchUpdateTask );
+        }
 
         // Update systems
         //-------------------------------------------------------------------------
@@ -309,6 +645,11 @@ namespace EE
             pSystem->UpdateSystem( entityWorldUpdateContext );
         }
 
+        // Flush world transforms
+        //-------------------------------------------------------------------------
+
+        UpdateWorldTransforms();
+
         //-------------------------------------------------------------------------
 
         if ( updateStage == UpdateStage::FrameEnd )
@@ -502,6 +843,15 @@ namespace EE
         }
     }
 
+    void EntityWorld::HotReload_ShutdownComponents( TVector<Resource::ResourceRequesterID> const& usersToReinitialize, TVector<ResourceID> const& reloadedResources )
+    {
+        EE_ASSERT( !usersToReinitialize.empty() );
+        for ( auto& pMap : m_maps )
+        {
+            pMap->HotReload_ShutdownComponents( m_loadingContext, m_initializationContext, usersToReinitialize, reloadedResources );
+        }
+    }
+
     void EntityWorld::HotReload_ReloadEntities()
     {
         for ( auto& pMap : m_maps )
@@ -26,6 +26,33 @@ namespace EE
         friend class EntityDebugView;
         friend class EntityWorldUpdateContext;
 
+        // A contiguous range of batched systems of the same type
+        struct SystemUpdateBatch
+        {
+            int32_t                                                             m_firstSystemIdx = 0;
+            int32_t                                                             m_numSystems = 0;
+        };
+
+        // The order and partitioning of the entity update for a single stage
+        struct EntityUpdateSchedule
+        {
+            TVector<Entity*>                                                    m_entities;                 // Sorted by cost, most expensive first
+            TVector<int32_t>                                                    m_partitionEnds;            // The (exclusive) end index of each partition
+            uint32_t                                                            m_numUpdatesSinceRebuild = 0;
+            bool                                                                m_isDirty = true;
+        };
+
+    public:
+
+        struct EntityUpdateStats
+        {
+            int32_t                                                             m_numEntities = 0;
+            int32_t                                                             m_numPartitions = 0;
+            Milliseconds                                                        m_estimatedCost = 0;        // The sum of the average entity costs
+            Milliseconds                                                        m_updateTime = 0;           // The time taken by the parallel entity update
+            Milliseconds                                                        m_tailLatency = 0;          // The time between the first worker running out of entities and the last one finishing
+        };
+
     public:
 
         EntityWorld( EntityWorldType worldType = EntityWorldType::Game );
@@ -59,6 +86,18 @@ namespace EE
         // Any queued requests will be handled here as will any requests to the resource system.
         void UpdateLoading();
 
+        // Are batchable entity systems grouped by type and updated in batches rather than per entity
+        inline bool IsBatchedSystemUpdateEnabled() const { return m_isBatchedSystemUpdateEnabled; }
+
+        // Enable/disable batched entity system updates (enabled by default), the change takes effect on the next update
+        void SetBatchedSystemUpdateEnabled( bool isEnabled );
+
+        // Get the number of entity systems that are currently updated in batches for the specified stage
+        inline int32_t GetNumBatchedSystems( UpdateStage stage ) const { return (int32_t) m_batchedSystems[(int8_t) stage].size(); }
+
+        // Get the stats for the last entity update of the specified stage
+        inline EntityUpdateStats const& GetEntityUpdateStats( UpdateStage stage ) const { return m_entityUpdateStats[(int8_t) stage]; }
+
         //-------------------------------------------------------------------------
         // Systems
         //-------------------------------------------------------------------------
@@ -280,10 +319,24 @@ namespace EE
         // Starts the hot-reload process - shuts down and unloads all specified entities
         void HotReload_UnloadEntities( TVector<Resource::ResourceRequesterID> const& usersToReload );
 
+        // Starts the hot-reload process for resources that were reloaded in place - shuts down only the components of the specified users that reference the reloaded resources
+        void HotReload_ShutdownComponents( TVector<Resource::ResourceRequesterID> const& usersToReinitialize, TVector<ResourceID> const& reloadedResources );
+
         // Ends the hot-reload process - starts re-loading of unloaded entities
         void HotReload_ReloadEntities();
         #endif
 
+    private:
+
+        // Regroup all the batchable systems of the registered entities by type
+        void RebuildSystemUpdateBatches();
+
+        // Sort the registered entities by their cost for the specified stage and split them into partitions of similar cost
+        void RebuildEntityUpdateSchedule( UpdateStage stage );
+
+        // Flush the world transforms of all entities that have dirty spatial components and fire their deferred transform callbacks
+        void UpdateWorldTransforms();
+
     private:
 
         EntityWorldID                                                           m_worldID = EntityWorldID::Generate();
@@ -304,6 +357,18 @@ namespace EE
         TVector<Entity*>                                                        m_entityUpdateList;
         TVector<EntityWorldSystem*>                                             m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
 
+        // Batched entity system updates
+        TVector<EntitySystem*>                                                  m_batchedSystems[(int8_t) UpdateStage::NumStages];        // Grouped by system type
+        TVector<SystemUpdateBatch>                                              m_systemUpdateBatches[(int8_t) UpdateStage::NumStages];
+        bool                                                                    m_isBatchedSystemUpdateEnabled = true;
+        bool                                                                    m_systemUpdateBatchesDirty = false;
+
+        // Cost-based entity update partitioning
+        EntityUpdateSchedule                                                    m_entityUpdateSchedules[(int8_t) UpdateStage::NumStages];
+        EntityUpdateStats                                                       m_entityUpdateStats[(int8_t) UpdateStage::NumStages];
+        TVector<uint64_t>                                                       m_workerFinishTimes;
+        TVector<Entity*>                                                        m_worldTransformUpdateEntities;
+
         // Time Scaling + Pause
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
         Seconds                                                                 m_timeStepLength = 1.0f / 30.0f;
@@ -268,6 +268,14 @@ namespace EE
         }
     }
 
+    void EntityWorldManager::HotReload_ShutdownComponents( TVector<Resource::ResourceRequesterID> const& usersToReinitialize, TVector<ResourceID> const& reloadedResources )
+    {
+        for ( auto const& pWorld : m_worlds )
+        {
+            pWorld->HotReload_ShutdownComponents( usersToReinitialize, reloadedResources );
+        }
+    }
+
     void EntityWorldManager::HotReload_ReloadEntities()
     {
         for ( auto const& pWorld : m_worlds )
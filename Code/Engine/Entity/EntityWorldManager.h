@@ -72,6 +72,7 @@ namespace EE
 
         #if EE_DEVELOPMENT_TOOLS
         void HotReload_UnloadEntities( TVector<Resource::ResourceRequesterID> const& usersToReload );
+        void HotReload_ShutdownComponents( TVector<Resource::ResourceRequesterID> const& usersToReinitialize, TVector<ResourceID> const& reloadedResources );
         void HotReload_ReloadEntities();
         #endif
 
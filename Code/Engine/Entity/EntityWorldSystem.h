@@ -61,6 +61,9 @@ namespace EE
         // Called immediately before an component is deactivated
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) = 0;
 
+        // Called once all pending component registrations/unregistrations have been issued to this system, allows systems to apply their changes in bulk
+        virtual void EndComponentRegistration() {}
+
     private:
 
         EntityWorld*     m_pWorld = nullptr;
@@ -5,6 +5,9 @@
 #include "Engine/Physics/Physics.h"
 #include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Time/Timers.h"
 #include "Base/Imgui/ImguiX.h"
 
 //-------------------------------------------------------------------------
@@ -80,15 +83,75 @@ namespace EE::Physics
     {
         DebugView::Initialize( systemRegistry, pWorld );
         m_pPhysicsWorldSystem = pWorld->GetWorldSystem<PhysicsWorldSystem>();
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
         m_windows.emplace_back( "Physics Material Database", [] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawMaterialDatabaseView( context ); } );
     }
 
     void PhysicsDebugView::Shutdown()
     {
         m_pPhysicsWorldSystem = nullptr;
+        m_pTaskSystem = nullptr;
         DebugView::Shutdown();
     }
 
+    void PhysicsDebugView::RunQueryBenchmark()
+    {
+        auto pWorld = m_pPhysicsWorldSystem->GetWorld();
+
+        // Generate random rays around the origin
+        //-------------------------------------------------------------------------
+
+        struct Ray
+        {
+            Vector m_start;
+            Vector m_end;
+        };
+
+        TVector<Ray> rays;
+        rays.resize( m_numBenchmarkQueries );
+        for ( auto& ray : rays )
+        {
+            ray.m_start = Vector( Math::GetRandomFloat( -m_benchmarkQueryRange, m_benchmarkQueryRange ), Math::GetRandomFloat( -m_benchmarkQueryRange, m_benchmarkQueryRange ), Math::GetRandomFloat( 0.0f, m_benchmarkQueryRange ) );
+            ray.m_end = Vector( Math::GetRandomFloat( -m_benchmarkQueryRange, m_benchmarkQueryRange ), Math::GetRandomFloat( -m_benchmarkQueryRange, m_benchmarkQueryRange ), Math::GetRandomFloat( -m_benchmarkQueryRange, 0.0f ) );
+        }
+
+        QueryRules rules;
+
+        // Individual queries, each one acquires the read lock like regular gameplay code does
+        //-------------------------------------------------------------------------
+
+        {
+            ScopedTimer<PlatformClock> timer( m_individualQueriesTime );
+            for ( auto const& ray : rays )
+            {
+                RayCastResults results;
+                pWorld->AcquireReadLock();
+                pWorld->RayCast( ray.m_start, ray.m_end, rules, results );
+                pWorld->ReleaseReadLock();
+            }
+        }
+
+        // Batched queries
+        //-------------------------------------------------------------------------
+
+        QueryBatch batch;
+        for ( auto const& ray : rays )
+        {
+            batch.AddRayCast( ray.m_start, ray.m_end, rules );
+        }
+
+        {
+            ScopedTimer<PlatformClock> timer( m_batchedQueriesTime );
+            pWorld->ExecuteQueryBatch( batch, m_pTaskSystem );
+        }
+
+        m_numBenchmarkHits = 0;
+        for ( int32_t i = 0; i < batch.GetNumQueries(); i++ )
+        {
+            m_numBenchmarkHits += batch.HasHits( i ) ? 1 : 0;
+        }
+    }
+
     void PhysicsDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
         //-------------------------------------------------------------------------
@@ -146,6 +209,46 @@ namespace EE::Physics
         {
             m_windows[0].m_isOpen = true;
         }
+
+        //-------------------------------------------------------------------------
+        // Actors
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+
+        auto const& actorStats = pWorld->GetActorStats();
+        ImGui::Text( "Last Actor Flush: +%d / -%d (%.3fms)", actorStats.m_numActorsAdded, actorStats.m_numActorsRemoved, actorStats.m_flushTime.ToFloat() );
+        ImGui::Text( "Actors Created: %d, Reused: %d, Pooled: %d", actorStats.m_numActorsCreated, actorStats.m_numPooledActorsReused, pWorld->GetNumPooledActors() );
+        ImGui::Text( "Shapes Created: %d, Reused: %d", actorStats.m_numShapesCreated, actorStats.m_numPooledShapesReused );
+
+        //-------------------------------------------------------------------------
+        // Queries
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+
+        if ( ImGui::BeginMenu( "Query Benchmark" ) )
+        {
+            ImGui::SliderInt( "Num Ray Casts", &m_numBenchmarkQueries, 1, 16384 );
+            ImGui::SliderFloat( "Range", &m_benchmarkQueryRange, 1.0f, 500.0f );
+
+            if ( ImGui::Button( "Run Benchmark", ImVec2( -1, 0 ) ) )
+            {
+                RunQueryBenchmark();
+            }
+
+            ImGui::Text( "Individual: %.3fms", m_individualQueriesTime.ToFloat() );
+            ImGui::Text( "Batched: %.3fms", m_batchedQueriesTime.ToFloat() );
+            ImGui::Text( "Num Hits: %d", m_numBenchmarkHits );
+            ImGui::EndMenu();
+        }
+
+        //-------------------------------------------------------------------------
+        // Deferred Queries
+        //-------------------------------------------------------------------------
+
+        QueryBatch const& deferredResults = pWorld->GetDeferredQueryResults();
+        ImGui::Text( "Deferred Queries: %d (%.3fms)", deferredResults.GetNumQueries(), deferredResults.GetExecutionTime().ToFloat() );
     }
 }
 #endif
\ No newline at end of file
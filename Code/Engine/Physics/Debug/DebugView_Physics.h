@@ -2,10 +2,15 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/DebugViews/DebugView.h"
+#include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
-namespace EE { class UpdateContext; }
+namespace EE
+{
+    class UpdateContext;
+    class TaskSystem;
+}
 
 //-------------------------------------------------------------------------
 
@@ -35,9 +40,18 @@ namespace EE::Physics
         virtual void Shutdown() override;
         virtual void DrawMenu( EntityWorldUpdateContext const& context ) override;
 
+        // Compare individually issued ray casts against a single batch of the same ray casts
+        void RunQueryBenchmark();
+
     private:
 
         PhysicsWorldSystem*     m_pPhysicsWorldSystem = nullptr;
+        TaskSystem*             m_pTaskSystem = nullptr;
+        int32_t                 m_numBenchmarkQueries = 2048;
+        float                   m_benchmarkQueryRange = 50.0f;
+        Milliseconds            m_individualQueriesTime = 0;
+        Milliseconds            m_batchedQueriesTime = 0;
+        int32_t                 m_numBenchmarkHits = 0;
     };
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,256 @@
+#include "PhysicsQueryBatch.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    void QueryBatch::Reset()
+    {
+        Threading::ScopeLock lock( m_mutex );
+        m_queries.clear();
+        m_rayCastResults.clear();
+        m_sweepResults.clear();
+        m_overlapResults.clear();
+        m_isExecuted = false;
+        EE_DEVELOPMENT_TOOLS_ONLY( m_executionTime = 0 );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddQuery( Query&& query )
+    {
+        Threading::ScopeLock lock( m_mutex );
+        EE_ASSERT( !m_isExecuted );
+
+        // Results are allocated up front so that the batch can be executed in parallel without touching the result arrays
+        if ( query.m_type == QueryType::RayCast )
+        {
+            query.m_resultIdx = (int32_t) m_rayCastResults.size();
+            m_rayCastResults.emplace_back();
+        }
+        else if ( query.IsSweep() )
+        {
+            query.m_resultIdx = (int32_t) m_sweepResults.size();
+            m_sweepResults.emplace_back();
+        }
+        else
+        {
+            EE_ASSERT( query.IsOverlap() );
+            query.m_resultIdx = (int32_t) m_overlapResults.size();
+            m_overlapResults.emplace_back();
+        }
+
+        QueryID const queryID = (QueryID) m_queries.size();
+        m_queries.emplace_back( eastl::move( query ) );
+        return queryID;
+    }
+
+    QueryBatch::QueryID QueryBatch::AddSweep( QueryType type, Vector const& start, Vector const& end, Query&& query )
+    {
+        Vector const dirAndDistance = end - start;
+        Vector direction;
+        float distance;
+        dirAndDistance.ToDirectionAndLength3( direction, distance );
+        return AddSweep( type, start, direction, distance, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddSweep( QueryType type, Vector const& start, Vector const& unitDirection, float distance, Query&& query )
+    {
+        query.m_type = type;
+        query.m_position = start;
+        query.m_direction = unitDirection;
+        query.m_distance = distance;
+        return AddQuery( eastl::move( query ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    QueryBatch::QueryID QueryBatch::AddRayCast( Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        Query query;
+        query.m_rules = rules;
+        return AddSweep( QueryType::RayCast, start, end, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddRayCast( Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() );
+        EE_ASSERT( distance > 0 );
+
+        Query query;
+        query.m_rules = rules;
+        return AddSweep( QueryType::RayCast, start, unitDirection, distance, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddSphereSweep( float radius, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        Query query;
+        query.m_rules = rules;
+        query.m_radius = radius;
+        return AddSweep( QueryType::SphereSweep, start, end, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddSphereSweep( float radius, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() );
+        EE_ASSERT( distance > 0 );
+
+        Query query;
+        query.m_rules = rules;
+        query.m_radius = radius;
+        return AddSweep( QueryType::SphereSweep, start, unitDirection, distance, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddCapsuleSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        Query query;
+        query.m_rules = rules;
+        query.m_radius = radius;
+        query.m_cylinderPortionHalfHeight = cylinderPortionHalfHeight;
+        query.m_orientation = orientation;
+        return AddSweep( QueryType::CapsuleSweep, start, end, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddCapsuleSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() );
+        EE_ASSERT( distance > 0 );
+
+        Query query;
+        query.m_rules = rules;
+        query.m_radius = radius;
+        query.m_cylinderPortionHalfHeight = cylinderPortionHalfHeight;
+        query.m_orientation = orientation;
+        return AddSweep( QueryType::CapsuleSweep, start, unitDirection, distance, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddCylinderSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        Query query;
+        query.m_rules = rules;
+        query.m_radius = radius;
+        query.m_cylinderPortionHalfHeight = cylinderPortionHalfHeight;
+        query.m_orientation = orientation;
+        return AddSweep( QueryType::CylinderSweep, start, end, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddCylinderSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() );
+        EE_ASSERT( distance > 0 );
+
+        Query query;
+        query.m_rules = rules;
+        query.m_radius = radius;
+        query.m_cylinderPortionHalfHeight = cylinderPortionHalfHeight;
+        query.m_orientation = orientation;
+        return AddSweep( QueryType::CylinderSweep, start, unitDirection, distance, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddBoxSweep( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        Query query;
+        query.m_rules = rules;
+        query.m_halfExtents = halfExtents;
+        query.m_orientation = orientation;
+        return AddSweep( QueryType::BoxSweep, start, end, eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddBoxSweep( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() );
+        EE_ASSERT( distance > 0 );
+
+        Query query;
+        query.m_rules = rules;
+        query.m_halfExtents = halfExtents;
+        query.m_orientation = orientation;
+        return AddSweep( QueryType::BoxSweep, start, unitDirection, distance, eastl::move( query ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    QueryBatch::QueryID QueryBatch::AddSphereOverlap( float radius, Vector const& position, QueryRules const& rules )
+    {
+        Query query;
+        query.m_type = QueryType::SphereOverlap;
+        query.m_rules = rules;
+        query.m_radius = radius;
+        query.m_position = position;
+        return AddQuery( eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddCapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+    {
+        Query query;
+        query.m_type = QueryType::CapsuleOverlap;
+        query.m_rules = rules;
+        query.m_radius = radius;
+        query.m_cylinderPortionHalfHeight = cylinderPortionHalfHeight;
+        query.m_orientation = orientation;
+        query.m_position = position;
+        return AddQuery( eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddCylinderOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+    {
+        Query query;
+        query.m_type = QueryType::CylinderOverlap;
+        query.m_rules = rules;
+        query.m_radius = radius;
+        query.m_cylinderPortionHalfHeight = cylinderPortionHalfHeight;
+        query.m_orientation = orientation;
+        query.m_position = position;
+        return AddQuery( eastl::move( query ) );
+    }
+
+    QueryBatch::QueryID QueryBatch::AddBoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+    {
+        Query query;
+        query.m_type = QueryType::BoxOverlap;
+        query.m_rules = rules;
+        query.m_halfExtents = halfExtents;
+        query.m_orientation = orientation;
+        query.m_position = position;
+        return AddQuery( eastl::move( query ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    RayCastResults const& QueryBatch::GetRayCastResults( QueryID queryID ) const
+    {
+        static RayCastResults const emptyResults;
+        if ( !HasResults( queryID ) )
+        {
+            return emptyResults;
+        }
+
+        Query const& query = m_queries[queryID];
+        EE_ASSERT( query.m_type == QueryType::RayCast );
+        return m_rayCastResults[query.m_resultIdx];
+    }
+
+    SweepResults const& QueryBatch::GetSweepResults( QueryID queryID ) const
+    {
+        static SweepResults const emptyResults;
+        if ( !HasResults( queryID ) )
+        {
+            return emptyResults;
+        }
+
+        Query const& query = m_queries[queryID];
+        EE_ASSERT( query.IsSweep() );
+        return m_sweepResults[query.m_resultIdx];
+    }
+
+    OverlapResults const& QueryBatch::GetOverlapResults( QueryID queryID ) const
+    {
+        static OverlapResults const emptyResults;
+        if ( !HasResults( queryID ) )
+        {
+            return emptyResults;
+        }
+
+        Query const& query = m_queries[queryID];
+        EE_ASSERT( query.IsOverlap() );
+        return m_overlapResults[query.m_resultIdx];
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Engine/Physics/PhysicsQuery.h"
+#include "Base/Math/Transform.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// Query Batch
+//-------------------------------------------------------------------------
+// A set of scene queries that are executed together by the physics world (see PhysicsWorld::ExecuteQueryBatch)
+// Queries can be added from multiple threads, and the batch is executed in parallel chunks on the task system
+// Results stay valid until the batch is reset, so they can be read later in the frame or in the next frame
+
+namespace EE::Physics
+{
+    class EE_ENGINE_API QueryBatch
+    {
+        friend class PhysicsWorld;
+
+    public:
+
+        using QueryID = int32_t;
+        constexpr static QueryID const s_invalidQueryID = -1;
+
+        enum class QueryType : uint8_t
+        {
+            RayCast,
+            SphereSweep,
+            CapsuleSweep,
+            CylinderSweep,
+            BoxSweep,
+            SphereOverlap,
+            CapsuleOverlap,
+            CylinderOverlap,
+            BoxOverlap,
+        };
+
+    private:
+
+        struct Query
+        {
+            inline bool IsSweep() const { return m_type >= QueryType::SphereSweep && m_type <= QueryType::BoxSweep; }
+            inline bool IsOverlap() const { return m_type >= QueryType::SphereOverlap; }
+
+            QueryRules                      m_rules;
+            Quaternion                      m_orientation = Quaternion::Identity;
+            Vector                          m_position = Vector::Zero; // The start position for ray casts and sweeps
+            Vector                          m_direction = Vector::Zero;
+            Vector                          m_halfExtents = Vector::Zero;
+            float                           m_distance = 0.0f;
+            float                           m_radius = 0.0f;
+            float                           m_cylinderPortionHalfHeight = 0.0f;
+            int32_t                         m_resultIdx = InvalidIndex;
+            QueryType                       m_type = QueryType::RayCast;
+            bool                            m_hasHits = false;
+        };
+
+    public:
+
+        QueryBatch() = default;
+        QueryBatch( QueryBatch const& ) = delete;
+        QueryBatch& operator=( QueryBatch const& ) = delete;
+
+        // Remove all queries and results, keeps the allocated memory
+        void Reset();
+
+        inline int32_t GetNumQueries() const { return (int32_t) m_queries.size(); }
+        inline bool IsEmpty() const { return m_queries.empty(); }
+        inline bool IsExecuted() const { return m_isExecuted; }
+
+        // Add Queries
+        //-------------------------------------------------------------------------
+        // The rules are copied so they dont need to outlive the call
+
+        QueryID AddRayCast( Vector const& start, Vector const& end, QueryRules const& rules );
+        QueryID AddRayCast( Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+
+        QueryID AddSphereSweep( float radius, Vector const& start, Vector const& end, QueryRules const& rules );
+        QueryID AddSphereSweep( float radius, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+
+        QueryID AddCapsuleSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules );
+        QueryID AddCapsuleSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+
+        QueryID AddCylinderSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules );
+        QueryID AddCylinderSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+
+        QueryID AddBoxSweep( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules );
+        QueryID AddBoxSweep( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+
+        QueryID AddSphereOverlap( float radius, Vector const& position, QueryRules const& rules );
+        QueryID AddCapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules );
+        QueryID AddCylinderOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules );
+        QueryID AddBoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, QueryRules const& rules );
+
+        // Results
+        //-------------------------------------------------------------------------
+        // Until the batch has been executed (or for queries that are not part of this batch) the results are empty
+        // This allows reading deferred results with a query ID before the first post-physics update has executed it
+
+        inline QueryType GetQueryType( QueryID queryID ) const { EE_ASSERT( IsValidQueryID( queryID ) ); return m_queries[queryID].m_type; }
+
+        // Has this query been executed, i.e. are its results valid
+        inline bool HasResults( QueryID queryID ) const { return m_isExecuted && IsValidQueryID( queryID ); }
+
+        inline bool HasHits( QueryID queryID ) const { return HasResults( queryID ) && m_queries[queryID].m_hasHits; }
+
+        RayCastResults const& GetRayCastResults( QueryID queryID ) const;
+        SweepResults const& GetSweepResults( QueryID queryID ) const;
+        OverlapResults const& GetOverlapResults( QueryID queryID ) const;
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline Milliseconds GetExecutionTime() const { return m_executionTime; }
+        #endif
+
+    private:
+
+        inline bool IsValidQueryID( QueryID queryID ) const { return queryID >= 0 && queryID < (QueryID) m_queries.size(); }
+
+        QueryID AddQuery( Query&& query );
+        QueryID AddSweep( QueryType type, Vector const& start, Vector const& end, Query&& query );
+        QueryID AddSweep( QueryType type, Vector const& start, Vector const& unitDirection, float distance, Query&& query );
+
+    private:
+
+        Threading::Mutex                    m_mutex;
+        TVector<Query>                      m_queries;
+        TVector<RayCastResults>             m_rayCastResults;
+        TVector<SweepResults>               m_sweepResults;
+        TVector<OverlapResults>             m_overlapResults;
+        bool                                m_isExecuted = false;
+
+        #if EE_DEVELOPMENT_TOOLS
+        Milliseconds                        m_executionTime = 0;
+        #endif
+    };
+}
@@ -9,6 +9,8 @@
 #include "Components/Component_PhysicsCollisionMesh.h"
 #include "Components/Component_PhysicsCharacter.h"
 #include "Engine/Entity/EntityLog.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
 #include "Base/Profiling.h"
 #include "EASTL/sort.h"
 
@@ -214,6 +216,9 @@ namespace EE::Physics
 
     PhysicsWorld::~PhysicsWorld()
     {
+        EE_ASSERT( m_pendingActorsToAdd.empty() && m_pendingActorsToRemove.empty() );
+        ReleasePooledActorsAndShapes();
+
         m_pControllerManager->purgeControllers();
         m_pControllerManager->release();
         m_pControllerManager = nullptr;
@@ -548,13 +553,348 @@ namespace EE::Physics
         return OverlapInternal( boxGeo, Transform( orientation, position ), rules, outResults );
     }
 
+    //-------------------------------------------------------------------------
+    // Batched Queries
+    //-------------------------------------------------------------------------
+
+    void PhysicsWorld::ExecuteBatchedQuery( QueryBatch& batch, int32_t queryIdx )
+    {
+        QueryBatch::Query& query = batch.m_queries[queryIdx];
+
+        switch ( query.m_type )
+        {
+            case QueryBatch::QueryType::RayCast:
+            query.m_hasHits = RayCastInternal( query.m_position, query.m_direction, query.m_distance, query.m_rules, batch.m_rayCastResults[query.m_resultIdx] );
+            break;
+
+            case QueryBatch::QueryType::SphereSweep:
+            query.m_hasHits = SphereSweepInternal( query.m_radius, query.m_position, query.m_direction, query.m_distance, query.m_rules, batch.m_sweepResults[query.m_resultIdx] );
+            break;
+
+            case QueryBatch::QueryType::CapsuleSweep:
+            query.m_hasHits = CapsuleSweepInternal( query.m_radius, query.m_cylinderPortionHalfHeight, query.m_orientation, query.m_position, query.m_direction, query.m_distance, query.m_rules, batch.m_sweepResults[query.m_resultIdx] );
+            break;
+
+            case QueryBatch::QueryType::CylinderSweep:
+            query.m_hasHits = CylinderSweepInternal( query.m_radius, query.m_cylinderPortionHalfHeight, query.m_orientation, query.m_position, query.m_direction, query.m_distance, query.m_rules, batch.m_sweepResults[query.m_resultIdx] );
+            break;
+
+            case QueryBatch::QueryType::BoxSweep:
+            query.m_hasHits = BoxSweepInternal( query.m_halfExtents, query.m_orientation, query.m_position, query.m_direction, query.m_distance, query.m_rules, batch.m_sweepResults[query.m_resultIdx] );
+            break;
+
+            case QueryBatch::QueryType::SphereOverlap:
+            query.m_hasHits = SphereOverlap( query.m_radius, query.m_position, query.m_rules, batch.m_overlapResults[query.m_resultIdx] );
+            break;
+
+            case QueryBatch::QueryType::CapsuleOverlap:
+            query.m_hasHits = CapsuleOverlap( query.m_radius, query.m_cylinderPortionHalfHeight, query.m_orientation, query.m_position, query.m_rules, batch.m_overlapResults[query.m_resultIdx] );
+            break;
+
+            case QueryBatch::QueryType::CylinderOverlap:
+            query.m_hasHits = CylinderOverlap( query.m_radius, query.m_cylinderPortionHalfHeight, query.m_orientation, query.m_position, query.m_rules, batch.m_overlapResults[query.m_resultIdx] );
+            break;
+
+            case QueryBatch::QueryType::BoxOverlap:
+            query.m_hasHits = BoxOverlap( query.m_halfExtents, query.m_orientation, query.m_position, query.m_rules, batch.m_overlapResults[query.m_resultIdx] );
+            break;
+        }
+    }
+
+    void PhysicsWorld::ExecuteQueryBatch( QueryBatch& batch, TaskSystem* pTaskSystem )
+    {
+        EE_PROFILE_FUNCTION_PHYSICS();
+        EE_ASSERT( !batch.m_isExecuted );
+
+        Threading::ScopeLock lock( batch.m_mutex );
+        EE_DEVELOPMENT_TOOLS_ONLY( ScopedTimer<PlatformClock> timer( batch.m_executionTime ) );
+
+        int32_t const numQueries = (int32_t) batch.m_queries.size();
+        if ( numQueries > 0 )
+        {
+            // Small batches are not worth the scheduling overhead
+            constexpr static uint32_t const s_queriesPerChunk = 16;
+
+            if ( pTaskSystem == nullptr || numQueries <= s_queriesPerChunk )
+            {
+                AcquireReadLock();
+                for ( int32_t i = 0; i < numQueries; i++ )
+                {
+                    ExecuteBatchedQuery( batch, i );
+                }
+                ReleaseReadLock();
+            }
+            else
+            {
+                // Each chunk acquires the (shared) read lock on the worker that runs it, since PhysX tracks the lock per thread
+                struct QueryTask final : public ITaskSet
+                {
+                    QueryTask( PhysicsWorld* pWorld, QueryBatch& batch )
+                        : m_pWorld( pWorld )
+                        , m_batch( batch )
+                    {
+                        m_SetSize = (uint32_t) batch.m_queries.size();
+                        m_MinRange = s_queriesPerChunk;
+                    }
+
+                    virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                    {
+                        EE_PROFILE_SCOPE_PHYSICS( "Execute Batched Queries" );
+
+                        m_pWorld->AcquireReadLock();
+                        for ( uint32_t i = range.start; i < range.end; ++i )
+                        {
+                            m_pWorld->ExecuteBatchedQuery( m_batch, (int32_t) i );
+                        }
+                        m_pWorld->ReleaseReadLock();
+                    }
+
+                private:
+
+                    PhysicsWorld*   m_pWorld = nullptr;
+                    QueryBatch&     m_batch;
+                };
+
+                QueryTask task( this, batch );
+                pTaskSystem->ScheduleTask( &task );
+                pTaskSystem->WaitForTask( &task );
+            }
+        }
+
+        batch.m_isExecuted = true;
+    }
+
+    void PhysicsWorld::ExecuteDeferredQueries( TaskSystem* pTaskSystem )
+    {
+        QueryBatch& batchToExecute = m_deferredQueryBatches[m_deferredQueryBatchIdx];
+        ExecuteQueryBatch( batchToExecute, pTaskSystem );
+
+        // Swap batches, the executed batch now holds the readable results and the other batch receives the new queries
+        m_deferredQueryBatchIdx = 1 - m_deferredQueryBatchIdx;
+        m_deferredQueryBatches[m_deferredQueryBatchIdx].Reset();
+    }
+
     //-------------------------------------------------------------------------
     // Actors and Shapes
     //-------------------------------------------------------------------------
 
-    bool PhysicsWorld::CreateActor( PhysicsShapeComponent* pComponent ) const
+    namespace
+    {
+        constexpr static int32_t const g_maxPooledActors = 4096;
+        constexpr static int32_t const g_maxPooledShapesPerType = 4096;
+
+        static int32_t GetPooledShapeTypeIndex( PxGeometryType::Enum geometryType )
+        {
+            switch ( geometryType )
+            {
+                case PxGeometryType::eBOX: return 0;
+                case PxGeometryType::eSPHERE: return 1;
+                case PxGeometryType::eCAPSULE: return 2;
+                default: return InvalidIndex;
+            }
+        }
+    }
+
+    PxRigidStatic* PhysicsWorld::AcquireStaticActor( PxTransform const& transform )
+    {
+        if ( !m_pooledStaticActors.empty() )
+        {
+            PxRigidStatic* pActor = m_pooledStaticActors.back();
+            m_pooledStaticActors.pop_back();
+            pActor->setGlobalPose( transform );
+            EE_DEVELOPMENT_TOOLS_ONLY( m_actorStats.m_numPooledActorsReused++ );
+            return pActor;
+        }
+
+        EE_DEVELOPMENT_TOOLS_ONLY( m_actorStats.m_numActorsCreated++ );
+        return m_pScene->getPhysics().createRigidStatic( transform );
+    }
+
+    PxRigidDynamic* PhysicsWorld::AcquireDynamicActor( PxTransform const& transform )
+    {
+        if ( !m_pooledDynamicActors.empty() )
+        {
+            PxRigidDynamic* pActor = m_pooledDynamicActors.back();
+            m_pooledDynamicActors.pop_back();
+
+            // Reset any state set by the previous owner
+            pActor->setRigidBodyFlag( PxRigidBodyFlag::eKINEMATIC, false );
+            pActor->setRigidBodyFlag( PxRigidBodyFlag::eUSE_KINEMATIC_TARGET_FOR_SCENE_QUERIES, false );
+            pActor->setActorFlag( PxActorFlag::eDISABLE_SIMULATION, false );
+            pActor->setLinearVelocity( PxVec3( PxZero ) );
+            pActor->setAngularVelocity( PxVec3( PxZero ) );
+
+            // Actors released while asleep keep a zero wake counter and would re-enter the scene asleep
+            pActor->setWakeCounter( m_pScene->getWakeCounterResetValue() );
+            pActor->setGlobalPose( transform );
+            EE_DEVELOPMENT_TOOLS_ONLY( m_actorStats.m_numPooledActorsReused++ );
+            return pActor;
+        }
+
+        EE_DEVELOPMENT_TOOLS_ONLY( m_actorStats.m_numActorsCreated++ );
+        return m_pScene->getPhysics().createRigidDynamic( transform );
+    }
+
+    PxShape* PhysicsWorld::AcquireShape( PxGeometry const& geometry, PxMaterial* pMaterial )
+    {
+        PxShapeFlags const shapeFlags( PxShapeFlag::eVISUALIZATION | PxShapeFlag::eSCENE_QUERY_SHAPE | PxShapeFlag::eSIMULATION_SHAPE );
+
+        int32_t const poolIdx = GetPooledShapeTypeIndex( geometry.getType() );
+        EE_ASSERT( poolIdx != InvalidIndex );
+
+        auto& pool = m_pooledShapes[poolIdx];
+        if ( !pool.empty() )
+        {
+            PxShape* pShape = pool.back();
+            pool.pop_back();
+            pShape->setGeometry( geometry );
+            pShape->setMaterials( &pMaterial, 1 );
+            pShape->setFlags( shapeFlags );
+            pShape->setLocalPose( PxTransform( PxIdentity ) );
+            EE_DEVELOPMENT_TOOLS_ONLY( m_actorStats.m_numPooledShapesReused++ );
+            return pShape;
+        }
+
+        EE_DEVELOPMENT_TOOLS_ONLY( m_actorStats.m_numShapesCreated++ );
+        PxMaterial* const materials[1] = { pMaterial };
+        return m_pScene->getPhysics().createShape( geometry, materials, 1, true, shapeFlags );
+    }
+
+    void PhysicsWorld::RecycleActor( PxRigidActor* pActor )
+    {
+        EE_ASSERT( pActor != nullptr && pActor->getScene() == nullptr );
+
+        // Detach the shape, primitive shapes are kept for reuse while mesh shapes are released
+        //-------------------------------------------------------------------------
+
+        PxShape* pShape = nullptr;
+        while ( pActor->getShapes( &pShape, 1 ) > 0 )
+        {
+            int32_t const poolIdx = GetPooledShapeTypeIndex( pShape->getGeometryType() );
+            if ( poolIdx != InvalidIndex && m_pooledShapes[poolIdx].size() < g_maxPooledShapesPerType )
+            {
+                pShape->acquireReference();
+                pShape->userData = nullptr;
+                #if EE_DEVELOPMENT_TOOLS
+                pShape->setName( nullptr );
+                #endif
+                m_pooledShapes[poolIdx].emplace_back( pShape );
+            }
+
+            pActor->detachShape( *pShape );
+        }
+
+        // Pool the actor
+        //-------------------------------------------------------------------------
+
+        pActor->userData = nullptr;
+        #if EE_DEVELOPMENT_TOOLS
+        pActor->setName( nullptr );
+        #endif
+
+        if ( auto pStaticActor = pActor->is<PxRigidStatic>() )
+        {
+            if ( m_pooledStaticActors.size() < g_maxPooledActors )
+            {
+                m_pooledStaticActors.emplace_back( pStaticActor );
+                return;
+            }
+        }
+        else if ( auto pDynamicActor = pActor->is<PxRigidDynamic>() )
+        {
+            if ( m_pooledDynamicActors.size() < g_maxPooledActors )
+            {
+                m_pooledDynamicActors.emplace_back( pDynamicActor );
+                return;
+            }
+        }
+
+        pActor->release();
+    }
+
+    void PhysicsWorld::ReleasePooledActorsAndShapes()
+    {
+        for ( auto pActor : m_pooledStaticActors )
+        {
+            pActor->release();
+        }
+        m_pooledStaticActors.clear();
+
+        for ( auto pActor : m_pooledDynamicActors )
+        {
+            pActor->release();
+        }
+        m_pooledDynamicActors.clear();
+
+        for ( auto& pool : m_pooledShapes )
+        {
+            for ( auto pShape : pool )
+            {
+                pShape->release();
+            }
+            pool.clear();
+        }
+    }
+
+    void PhysicsWorld::FlushPendingActorChanges()
+    {
+        Threading::ScopeLock const lock( m_pendingActorsMutex );
+
+        if ( m_pendingActorsToAdd.empty() && m_pendingActorsToRemove.empty() )
+        {
+            return;
+        }
+
+        EE_PROFILE_FUNCTION_PHYSICS();
+        EE_PROFILE_TAG( "Actors Added", (uint32_t) m_pendingActorsToAdd.size() );
+        EE_PROFILE_TAG( "Actors Removed", (uint32_t) m_pendingActorsToRemove.size() );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_actorStats.m_numActorsAdded = (int32_t) m_pendingActorsToAdd.size();
+        m_actorStats.m_numActorsRemoved = (int32_t) m_pendingActorsToRemove.size();
+        ScopedTimer<PlatformClock> timer( m_actorStats.m_flushTime );
+        #endif
+
+        // Modify the scene
+        //-------------------------------------------------------------------------
+
+        AcquireWriteLock();
+        {
+            if ( !m_pendingActorsToRemove.empty() )
+            {
+                EE_PROFILE_SCOPE_PHYSICS( "Remove Actors" );
+                m_pScene->removeActors( reinterpret_cast<PxActor* const*>( m_pendingActorsToRemove.data() ), (PxU32) m_pendingActorsToRemove.size() );
+            }
+
+            if ( !m_pendingActorsToAdd.empty() )
+            {
+                EE_PROFILE_SCOPE_PHYSICS( "Add Actors" );
+                m_pScene->addActors( reinterpret_cast<PxActor* const*>( m_pendingActorsToAdd.data() ), (PxU32) m_pendingActorsToAdd.size() );
+            }
+        }
+        ReleaseWriteLock();
+
+        // Recycle removed actors
+        //-------------------------------------------------------------------------
+
+        {
+            EE_PROFILE_SCOPE_PHYSICS( "Recycle Actors" );
+            for ( auto pActor : m_pendingActorsToRemove )
+            {
+                RecycleActor( pActor );
+            }
+        }
+
+        m_pendingActorsToAdd.clear();
+        m_pendingActorsToRemove.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool PhysicsWorld::CreateActor( PhysicsShapeComponent* pComponent )
     {
         EE_ASSERT( pComponent != nullptr );
+        Threading::ScopeLock const lock( m_pendingActorsMutex );
         PxPhysics* pPhysics = &m_pScene->getPhysics();
 
         if ( !pComponent->HasValidPhysicsSetup() )
@@ -579,13 +919,13 @@ namespace EE::Physics
         {
             case Mobility::Static:
             {
-                pPhysicsActor = pPhysics->createRigidStatic( pxTransform );
+                pPhysicsActor = AcquireStaticActor( pxTransform );
             }
             break;
 
             case Mobility::Dynamic:
             {
-                PxRigidDynamic * pRigidDynamicActor = pPhysics->createRigidDynamic( pxTransform );
+                PxRigidDynamic * pRigidDynamicActor = AcquireDynamicActor( pxTransform );
                 PxRigidBodyExt::setMassAndUpdateInertia( *pRigidDynamicActor, settings.m_mass );
                 pPhysicsActor = pRigidDynamicActor;
 
@@ -599,7 +939,7 @@ namespace EE::Physics
 
             case Mobility::Kinematic:
             {
-                PxRigidDynamic* pRigidDynamicActor = pPhysics->createRigidDynamic( pxTransform );
+                PxRigidDynamic* pRigidDynamicActor = AcquireDynamicActor( pxTransform );
                 pRigidDynamicActor->setRigidBodyFlag( PxRigidBodyFlag::eKINEMATIC, true );
                 pRigidDynamicActor->setRigidBodyFlag( PxRigidBodyFlag::eUSE_KINEMATIC_TARGET_FOR_SCENE_QUERIES, true );
                 pPhysicsActor = pRigidDynamicActor;
@@ -634,6 +974,7 @@ namespace EE::Physics
                 if ( pPhysicsMaterial == nullptr )
                 {
                     EE_LOG_ENTITY_ERROR( pComponent, "Physics", "Invalid physics materials for collision mesh (%s) on component %s (%u). No shapes will be created!", pMeshComponent->m_collisionMesh.GetResourceID().c_str(), pComponent->GetNameID().c_str(), pComponent->GetID() );
+                    RecycleActor( pPhysicsActor );
                     return false;
                 }
 
@@ -643,6 +984,7 @@ namespace EE::Physics
             if ( physicsMaterials.empty() )
             {
                 EE_LOG_ENTITY_ERROR( pComponent, "Physics", "No physics materials set for collision mesh (%s) on component %s (%u). No shapes will be created!", pMeshComponent->m_collisionMesh.GetResourceID().c_str(), pComponent->GetNameID().c_str(), pComponent->GetID() );
+                RecycleActor( pPhysicsActor );
                 return false;
             }
 
@@ -654,41 +996,40 @@ namespace EE::Physics
                 PxTriangleMesh const* pTriMesh = pMeshComponent->m_collisionMesh->GetMesh()->is<PxTriangleMesh>();
                 PxTriangleMeshGeometry const meshGeo( const_cast<PxTriangleMesh*>( pTriMesh ), ToPx( finalScale ) );
                 pPhysicsShape = pPhysics->createShape( meshGeo, physicsMaterials.data(), (uint16_t) physicsMaterials.size(), true, shapeFlags );
+                EE_DEVELOPMENT_TOOLS_ONLY( m_actorStats.m_numShapesCreated++ );
             }
             else // Convex Mesh
             {
                 PxConvexMesh const* pConvexMesh = pMeshComponent->m_collisionMesh->GetMesh()->is<PxConvexMesh>();
                 PxConvexMeshGeometry const meshGeo( const_cast<PxConvexMesh*>( pConvexMesh ), ToPx( finalScale ) );
                 pPhysicsShape = pPhysics->createShape( meshGeo, physicsMaterials.data(), (uint16_t) physicsMaterials.size(), true, shapeFlags );
+                EE_DEVELOPMENT_TOOLS_ONLY( m_actorStats.m_numShapesCreated++ );
             }
         }
         else if ( auto pBoxComponent = TryCast<BoxComponent>( pComponent ) )
         {
-            PxMaterial* const material[1] = { m_pMaterialRegistry->GetMaterial( pBoxComponent->m_materialID ) };
             Vector const scaledExtents = pBoxComponent->m_boxHalfExtents * scale;
             PxBoxGeometry const boxGeo( ToPx( scaledExtents ) );
-            pPhysicsShape = pPhysics->createShape( boxGeo, material, 1, true, shapeFlags );
+            pPhysicsShape = AcquireShape( boxGeo, m_pMaterialRegistry->GetMaterial( pBoxComponent->m_materialID ) );
         }
         else if ( auto pSphereComponent = TryCast<SphereComponent>( pComponent ) )
         {
-            PxMaterial* const material[1] = { m_pMaterialRegistry->GetMaterial( pSphereComponent->m_materialID ) };
             float const scaledRadius = pSphereComponent->m_radius * scale;
             PxSphereGeometry const sphereGeo( scaledRadius );
-            pPhysicsShape = pPhysics->createShape( sphereGeo, material, 1, true, shapeFlags );
+            pPhysicsShape = AcquireShape( sphereGeo, m_pMaterialRegistry->GetMaterial( pSphereComponent->m_materialID ) );
         }
         else if ( auto pCapsuleComponent = TryCast<CapsuleComponent>( pComponent ) )
         {
-            PxMaterial* const material[1] = { m_pMaterialRegistry->GetMaterial( pCapsuleComponent->m_materialID ) };
             float const scaledRadius = pCapsuleComponent->m_radius * scale;
             float const scaledHalfHeight = pCapsuleComponent->m_cylinderPortionHalfHeight * scale;
             PxCapsuleGeometry const capsuleGeo( scaledRadius, scaledHalfHeight );
-            pPhysicsShape = pPhysics->createShape( capsuleGeo, material, 1, true, shapeFlags );
+            pPhysicsShape = AcquireShape( capsuleGeo, m_pMaterialRegistry->GetMaterial( pCapsuleComponent->m_materialID ) );
         }
 
         if ( pPhysicsShape == nullptr )
         {
             EE_LOG_ENTITY_ERROR( pComponent, "Physics", "Failed to create physics shape for component %s (%u)!", pComponent->GetNameID().c_str(), pComponent->GetID() );
-            pPhysicsActor->release();
+            RecycleActor( pPhysicsActor );
             return false;
         }
 
@@ -719,25 +1060,30 @@ namespace EE::Physics
 
         // Add to scene
         //-------------------------------------------------------------------------
+        // The actor is only added to the scene on the next flush of the pending actor changes
 
-        m_pScene->lockWrite();
-        m_pScene->addActor( *pPhysicsActor );
-        m_pScene->unlockWrite();
+        m_pendingActorsToAdd.emplace_back( pPhysicsActor );
 
         return true;
     }
 
-    void PhysicsWorld::DestroyActor( PhysicsShapeComponent* pComponent ) const
+    void PhysicsWorld::DestroyActor( PhysicsShapeComponent* pComponent )
     {
-        PxScene* pPxScene = m_pScene;
         if ( pComponent->m_pPhysicsActor != nullptr )
         {
-            EE_ASSERT( pComponent->m_pPhysicsActor->getScene() != nullptr );
+            Threading::ScopeLock const lock( m_pendingActorsMutex );
 
-            pPxScene->lockWrite();
-            pPxScene->removeActor( *pComponent->m_pPhysicsActor );
-            pPxScene->unlockWrite();
-            pComponent->m_pPhysicsActor->release();
+            // If the actor was never added to the scene, we can recycle it immediately
+            if ( pComponent->m_pPhysicsActor->getScene() == nullptr )
+            {
+                EE_ASSERT( VectorContains( m_pendingActorsToAdd, pComponent->m_pPhysicsActor ) );
+                m_pendingActorsToAdd.erase_first_unsorted( pComponent->m_pPhysicsActor );
+                RecycleActor( pComponent->m_pPhysicsActor );
+            }
+            else
+            {
+                m_pendingActorsToRemove.emplace_back( pComponent->m_pPhysicsActor );
+            }
         }
 
         //-------------------------------------------------------------------------
@@ -1,20 +1,31 @@
 #pragma once
 
 #include "Engine/Physics/PhysicsQuery.h"
+#include "Engine/Physics/PhysicsQueryBatch.h"
 #include "Base/Time/Time.h"
 #include "Base/Math/Transform.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
 #include <atomic>
 
 //-------------------------------------------------------------------------
 
-namespace EE { struct AABB; }
+namespace EE 
+{
+    struct AABB;
+    class TaskSystem;
+}
 
 namespace physx 
 {
     class PxScene;
     class PxGeometry;
     class PxRigidActor;
+    class PxRigidStatic;
+    class PxRigidDynamic;
     class PxShape;
+    class PxMaterial;
+    class PxTransform;
     class PxRenderBuffer;
     class PxControllerManager;
 }
@@ -36,6 +47,31 @@ namespace EE::Physics
     {
         friend class PhysicsWorldSystem;
 
+        // Recycled shapes are bucketed by geometry type, since a shape's geometry can only be changed to one of the same type
+        enum PooledShapeType
+        {
+            Box = 0,
+            Sphere,
+            Capsule,
+
+            NumPooledShapeTypes
+        };
+
+    public:
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct ActorStats
+        {
+            int32_t                                             m_numActorsAdded = 0;           // In the last flush
+            int32_t                                             m_numActorsRemoved = 0;         // In the last flush
+            Milliseconds                                        m_flushTime = 0;                // Of the last flush
+            int32_t                                             m_numPooledActorsReused = 0;
+            int32_t                                             m_numPooledShapesReused = 0;
+            int32_t                                             m_numActorsCreated = 0;
+            int32_t                                             m_numShapesCreated = 0;
+        };
+        #endif
+
     public:
 
         // The distance that the shape is pushed away from a detected collision after a sweep - currently set to 5mm as that is a relatively standard value
@@ -194,6 +230,20 @@ namespace EE::Physics
             return BoxOverlap( halfExtents, shapeTransform.GetRotation(), shapeTransform.GetTranslation(), rules, outResults );
         }
 
+        // Batched Queries
+        //-------------------------------------------------------------------------
+
+        // Execute all queries in the batch, the queries are split into chunks that each acquire the read lock once
+        // If no task system is provided, the batch is executed on the calling thread. The read lock must NOT be held by the caller.
+        void ExecuteQueryBatch( QueryBatch& batch, TaskSystem* pTaskSystem = nullptr );
+
+        // Queries added to this batch are executed after the simulation (post-physics), add them before the post-physics update
+        inline QueryBatch& GetDeferredQueryBatch() { return m_deferredQueryBatches[m_deferredQueryBatchIdx]; }
+
+        // The results of the deferred queries executed during the last post-physics update, valid until the next post-physics update
+        // Before the first post-physics update this batch is not executed and all results are empty
+        inline QueryBatch const& GetDeferredQueryResults() const { return m_deferredQueryBatches[1 - m_deferredQueryBatchIdx]; }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -208,6 +258,9 @@ namespace EE::Physics
 
         void SetDebugCullingBox( AABB const& cullingBox );
         physx::PxRenderBuffer const& GetRenderBuffer() const;
+
+        inline ActorStats const& GetActorStats() const { return m_actorStats; }
+        inline int32_t GetNumPooledActors() const { return (int32_t) ( m_pooledStaticActors.size() + m_pooledDynamicActors.size() ); }
         #endif
 
     private:
@@ -233,11 +286,23 @@ namespace EE::Physics
         bool SweepInternal( physx::PxGeometry const& geo, Transform const& startTransform, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults );
         bool OverlapInternal( physx::PxGeometry const& geo, Transform const& transform, QueryRules const& rules, OverlapResults& outResults );
 
+        void ExecuteBatchedQuery( QueryBatch& batch, int32_t queryIdx );
+        void ExecuteDeferredQueries( TaskSystem* pTaskSystem );
+
         // Actors and Shapes
         //-------------------------------------------------------------------------
+        // Adding actors to and removing actors from the scene is deferred until the pending changes are flushed, 
+        // this allows us to modify the scene in bulk under a single write lock. Removed actors and shapes are pooled for reuse.
+
+        bool CreateActor( PhysicsShapeComponent* pComponent );
+        void DestroyActor( PhysicsShapeComponent* pComponent );
+        void FlushPendingActorChanges();
 
-        bool CreateActor( PhysicsShapeComponent* pComponent ) const;
-        void DestroyActor( PhysicsShapeComponent* pComponent ) const;
+        physx::PxRigidStatic* AcquireStaticActor( physx::PxTransform const& transform );
+        physx::PxRigidDynamic* AcquireDynamicActor( physx::PxTransform const& transform );
+        physx::PxShape* AcquireShape( physx::PxGeometry const& geometry, physx::PxMaterial* pMaterial );
+        void RecycleActor( physx::PxRigidActor* pActor );
+        void ReleasePooledActorsAndShapes();
 
         bool CreateCharacterController( CharacterComponent* pComponent ) const;
         void DestroyCharacterController( CharacterComponent* pComponent ) const;
@@ -249,9 +314,20 @@ namespace EE::Physics
         physx::PxControllerManager*                             m_pControllerManager = nullptr;
         bool                                                    m_isGameWorld = false;
 
+        QueryBatch                                              m_deferredQueryBatches[2];
+        int32_t                                                 m_deferredQueryBatchIdx = 0;
+
+        Threading::Mutex                                        m_pendingActorsMutex;
+        TVector<physx::PxRigidActor*>                           m_pendingActorsToAdd;
+        TVector<physx::PxRigidActor*>                           m_pendingActorsToRemove;
+        TVector<physx::PxRigidStatic*>                          m_pooledStaticActors;
+        TVector<physx::PxRigidDynamic*>                         m_pooledDynamicActors;
+        TVector<physx::PxShape*>                                m_pooledShapes[NumPooledShapeTypes];
+
         #if EE_DEVELOPMENT_TOOLS
         uint32_t                                                m_sceneDebugFlags = 0;
         float                                                   m_debugDrawDistance = 10.0f;
+        ActorStats                                              m_actorStats;
         
         std::atomic<int32_t>                                    m_readLockCount = false;        // Assertion helper
         std::atomic<bool>                                       m_writeLockAcquired = false;    // Assertion helper
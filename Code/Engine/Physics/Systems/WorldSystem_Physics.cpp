@@ -10,6 +10,7 @@
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityLog.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Profiling.h"
 #include "Base/Drawing/DebugDrawing.h"
 
@@ -130,6 +131,12 @@ namespace EE::Physics
         }
     }
 
+    void PhysicsWorldSystem::EndComponentRegistration()
+    {
+        // Add/remove all the actors for this batch of (un)registrations in one go
+        m_pWorld->FlushPendingActorChanges();
+    }
+
     void PhysicsWorldSystem::RegisterDynamicComponent( PhysicsShapeComponent* pComponent )
     {
         EE_ASSERT( pComponent != nullptr && pComponent->IsActorCreated() && pComponent->IsDynamic() );
@@ -151,6 +158,7 @@ namespace EE::Physics
         //-------------------------------------------------------------------------
 
         Threading::ScopeLock const lock( m_mutex );
+        EE_PROFILE_TAG( "Num Rebuild Requests", (uint32_t) m_actorRebuildRequests.size() );
 
         for ( auto const& pShapeComponent : m_actorRebuildRequests )
         {
@@ -177,6 +185,10 @@ namespace EE::Physics
             }
         }
         m_actorRebuildRequests.clear();
+
+        //-------------------------------------------------------------------------
+
+        m_pWorld->FlushPendingActorChanges();
     }
 
     //-------------------------------------------------------------------------
@@ -330,5 +342,10 @@ namespace EE::Physics
 
             m_pWorld->ReleaseWriteLock();
         }
+
+        // Execute deferred queries against the post-simulation state
+        //-------------------------------------------------------------------------
+
+        m_pWorld->ExecuteDeferredQueries( ctx.GetSystem<TaskSystem>() );
     }
 }
\ No newline at end of file
@@ -56,6 +56,7 @@ namespace EE::Physics
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void EndComponentRegistration() override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
 
         void RegisterDynamicComponent( PhysicsShapeComponent* pComponent );
@@ -72,7 +73,7 @@ namespace EE::Physics
 
         TIDVector<ComponentID, CharacterComponent*>             m_characterComponents;
         TIDVector<ComponentID, PhysicsShapeComponent*>          m_physicsShapeComponents;
-        TIDVector<ComponentID, PhysicsShapeComponent*>          m_dynamicShapeComponents; // TODO: profile and see if we need to use a dynamic pool
+        TIDVector<ComponentID, PhysicsShapeComponent*>          m_dynamicShapeComponents;
 
         EventBindingID                                          m_actorRebuildBindingID;
         Threading::Mutex                                        m_mutex;
@@ -54,11 +54,6 @@ namespace EE::Render
 
             m_boneTransforms.resize( m_mesh->GetNumBones() );
             ResetPose();
-
-            //-------------------------------------------------------------------------
-
-            // Allocate skinning transforms and calculate initial values
-            m_skinningTransforms.resize( m_boneTransforms.size() );
             FinalizePose();
         }
     }
@@ -66,7 +61,6 @@ namespace EE::Render
     void SkeletalMeshComponent::Shutdown()
     {
         m_boneTransforms.clear();
-        m_skinningTransforms.clear();
         m_animToMeshBoneMap.clear();
         MeshComponent::Shutdown();
     }
@@ -169,26 +163,10 @@ namespace EE::Render
 
         NotifySocketsUpdated();
         UpdateBounds();
-        UpdateSkinningTransforms();
     }
 
     //-------------------------------------------------------------------------
 
-    void SkeletalMeshComponent::UpdateSkinningTransforms()
-    {
-        EE_ASSERT( m_mesh.IsSet() && m_mesh.IsLoaded() );
-
-        auto const numBones = m_boneTransforms.size();
-        EE_ASSERT( m_skinningTransforms.size() == numBones );
-
-        auto const& inverseBindPose = m_mesh->GetInverseBindPose();
-        for ( auto i = 0; i < numBones; i++ )
-        {
-            Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
-            m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
-        }
-    }
-
     void SkeletalMeshComponent::GenerateAnimationBoneMap()
     {
         EE_ASSERT( m_mesh != nullptr && m_skeleton != nullptr );
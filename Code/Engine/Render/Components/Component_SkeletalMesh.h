@@ -51,13 +51,11 @@ namespace EE::Render
             m_boneTransforms[boneIdx] = transform;
         }
 
-        // This function will finalize the pose, run any procedural bone solvers and generate the skinning transforms
+        // This function will finalize the pose, run any procedural bone solvers and update the bounds and sockets
         // Only run this function once per frame once you have set the final global pose
+        // Note: skinning transforms are not generated here, they are batch generated for all visible meshes by the renderer world system
         void FinalizePose();
 
-        // Get the skinning transforms for this mesh - these are the global transforms relative to the bind pose
-        inline TVector<Matrix> const& GetSkinningTransforms() const { return m_skinningTransforms; }
-
         // Animation Pose
         //-------------------------------------------------------------------------
 
@@ -80,7 +78,6 @@ namespace EE::Render
 
         virtual TVector<TResourcePtr<Render::Material>> const& GetDefaultMaterials() const override final;
 
-        void UpdateSkinningTransforms();
         void GenerateAnimationBoneMap();
 
         virtual OBB CalculateLocalBounds() const override final;
@@ -97,7 +94,6 @@ namespace EE::Render
         EE_REFLECT() TResourcePtr<Animation::Skeleton>     m_skeleton = nullptr;
         TVector<int32_t>                                m_animToMeshBoneMap;
         TVector<Transform>                              m_boneTransforms;
-        TVector<Matrix>                                 m_skinningTransforms;
     };
 
     //-------------------------------------------------------------------------
@@ -28,6 +28,9 @@ namespace EE::Render
         inline TVector<Transform> const& GetBindPose() const { return m_bindPose; }
         inline TVector<Transform> const& GetInverseBindPose() const { return m_inverseBindPose; }
 
+        // The inverse bind pose converted to matrices at load time, allows skinning matrices to be generated with a single SIMD multiply per bone
+        inline TVector<Matrix> const& GetInverseBindPoseMatrices() const { return m_inverseBindPoseMatrices; }
+
         // Debug
         #if EE_DEVELOPMENT_TOOLS
         void DrawBindPose( Drawing::DrawContext& drawingContext, Transform const& worldTransform ) const;
@@ -39,5 +42,6 @@ namespace EE::Render
         TVector<int32_t>                    m_parentBoneIndices;
         TVector<Transform>                  m_bindPose;             // Note: bind pose is in global space
         TVector<Transform>                  m_inverseBindPose;
+        TVector<Matrix>                     m_inverseBindPoseMatrices; // Runtime only, generated by the loader
     };
 }
\ No newline at end of file
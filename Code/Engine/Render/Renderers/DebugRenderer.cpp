@@ -1,6 +1,7 @@
 #include "DebugRenderer.h"
 #include "Base/Profiling.h"
 #include "Base/Types/Function.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Engine/Entity/EntityWorld.h"
 
 //-------------------------------------------------------------------------
@@ -12,10 +13,42 @@ using namespace EE::Drawing;
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Render
 {
-    bool DebugRenderer::Initialize( RenderDevice* pRenderDevice )
+    // Copies are split into chunks of at most this size, so a single busy thread buffer is still copied in parallel
+    constexpr static size_t const g_maxGatherJobSize = 64 * 1024;
+
+    //-------------------------------------------------------------------------
+
+    struct DebugRenderer::GatherTask final : public ITaskSet
+    {
+        GatherTask( TVector<GatherJob> const& jobs )
+            : ITaskSet( (uint32_t) jobs.size() )
+            , m_jobs( jobs )
+        {}
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            EE_PROFILE_SCOPE_RENDER( "Gather Debug Drawing Vertices" );
+
+            for ( uint32_t i = range.start; i < range.end; ++i )
+            {
+                GatherJob const& job = m_jobs[i];
+                memcpy( job.m_pDestination, job.m_pSource, job.m_size );
+            }
+        }
+
+    private:
+
+        TVector<GatherJob> const&       m_jobs;
+    };
+
+    //-------------------------------------------------------------------------
+
+    bool DebugRenderer::Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem )
     {
         EE_ASSERT( m_pRenderDevice == nullptr && pRenderDevice != nullptr );
+        EE_ASSERT( pTaskSystem != nullptr );
         m_pRenderDevice = pRenderDevice;
+        m_pTaskSystem = pTaskSystem;
 
         //-------------------------------------------------------------------------
 
@@ -65,25 +98,106 @@ namespace EE::Render
         }
 
         m_pRenderDevice = nullptr;
+        m_pTaskSystem = nullptr;
         m_initialized = false;
     }
 
     //-------------------------------------------------------------------------
 
-    void DebugRenderer::DrawPoints( RenderContext const& renderContext, Viewport const& viewport, TVector<PointCommand> const& commands )
+    template<typename T>
+    void DebugRenderer::PrepareGatherJobs( FrameCommandBuffer const& frameCommands, TVector<T> CommandBuffer::* pCommandList, GatheredCommands<T>& outGatheredCommands, TVector<GatherJob>& outJobs )
+    {
+        int32_t const numCommandSets = frameCommands.GetNumCommandSets();
+
+        // Calculate the range of each command buffer type
+        //-------------------------------------------------------------------------
+
+        uint32_t numCommands = 0;
+        for ( int32_t bufferIdx = 0; bufferIdx < CommandBufferSet::s_numBuffers; bufferIdx++ )
+        {
+            outGatheredCommands.m_offsets[bufferIdx] = numCommands;
+            for ( int32_t setIdx = 0; setIdx < numCommandSets; setIdx++ )
+            {
+                numCommands += (uint32_t) ( frameCommands.GetCommandSet( setIdx ).m_buffers[bufferIdx].*pCommandList ).size();
+            }
+        }
+        outGatheredCommands.m_offsets[CommandBufferSet::s_numBuffers] = numCommands;
+
+        // Resizing never releases capacity so in steady state this will not allocate
+        outGatheredCommands.m_commands.resize( numCommands );
+
+        // Create the copy jobs, the sets are visited in the same order as the offsets were calculated
+        //-------------------------------------------------------------------------
+
+        uint8_t* pDestination = reinterpret_cast<uint8_t*>( outGatheredCommands.m_commands.data() );
+        for ( int32_t bufferIdx = 0; bufferIdx < CommandBufferSet::s_numBuffers; bufferIdx++ )
+        {
+            for ( int32_t setIdx = 0; setIdx < numCommandSets; setIdx++ )
+            {
+                TVector<T> const& commands = frameCommands.GetCommandSet( setIdx ).m_buffers[bufferIdx].*pCommandList;
+                uint8_t const* pSource = reinterpret_cast<uint8_t const*>( commands.data() );
+                size_t remainingSize = commands.size() * sizeof( T );
+                while ( remainingSize > 0 )
+                {
+                    size_t const jobSize = Math::Min( remainingSize, g_maxGatherJobSize );
+                    outJobs.push_back( { pSource, pDestination, jobSize } );
+                    pSource += jobSize;
+                    pDestination += jobSize;
+                    remainingSize -= jobSize;
+                }
+            }
+        }
+    }
+
+    void DebugRenderer::GatherCommands()
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        m_gatherJobs.clear();
+        PrepareGatherJobs( m_drawCommands, &CommandBuffer::m_pointCommands, m_gatheredPoints, m_gatherJobs );
+        PrepareGatherJobs( m_drawCommands, &CommandBuffer::m_lineCommands, m_gatheredLines, m_gatherJobs );
+        PrepareGatherJobs( m_drawCommands, &CommandBuffer::m_triangleCommands, m_gatheredTriangles, m_gatherJobs );
+
+        if ( m_gatherJobs.size() == 1 )
+        {
+            GatherTask gatherTask( m_gatherJobs );
+            gatherTask.ExecuteRange( { 0u, 1u }, 0 );
+        }
+        else if ( m_gatherJobs.size() > 1 )
+        {
+            GatherTask gatherTask( m_gatherJobs );
+            m_pTaskSystem->ScheduleTask( &gatherTask );
+            m_pTaskSystem->WaitForTask( &gatherTask );
+        }
+
+        // Text is batched by font and converted to glyphs when drawn, so we only need to merge the lists
+        //-------------------------------------------------------------------------
+
+        int32_t const numCommandSets = m_drawCommands.GetNumCommandSets();
+        for ( int32_t bufferIdx = 0; bufferIdx < CommandBufferSet::s_numBuffers; bufferIdx++ )
+        {
+            m_gatheredText[bufferIdx].clear();
+            for ( int32_t setIdx = 0; setIdx < numCommandSets; setIdx++ )
+            {
+                auto const& textCommands = m_drawCommands.GetCommandSet( setIdx ).m_buffers[bufferIdx].m_textCommands;
+                m_gatheredText[bufferIdx].insert( m_gatheredText[bufferIdx].end(), textCommands.begin(), textCommands.end() );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void DebugRenderer::DrawPoints( RenderContext const& renderContext, Viewport const& viewport, TSpan<PointCommand const> commands )
     {
         // Set render state
         renderContext.SetPrimitiveTopology( Topology::PointList );
 
         //-------------------------------------------------------------------------
 
-        auto pData = reinterpret_cast<Float4*>( m_pointRS.m_stagingVertexData.data() );
-        auto const dataSize = (uint32_t) m_pointRS.m_stagingVertexData.size();
-
         int32_t const numPoints = (int32_t) commands.size();
         if ( numPoints > 0 )
         {
-            // Fill the points vertex buffer
+            // The gathered commands are already laid out as vertices so we upload directly from them
             uint32_t const numDrawCalls = (uint32_t) Math::Ceiling( (float) numPoints / DebugPointRenderState::MaxPointsPerDrawCall );
             for ( auto i = 0u; i < numDrawCalls; i++ )
             {
@@ -91,28 +205,24 @@ namespace EE::Render
                 uint32_t const drawRangeEnd = drawRangeStart + Math::Min( uint32_t( numPoints - ( i * DebugPointRenderState::MaxPointsPerDrawCall ) ), (uint32_t) DebugPointRenderState::MaxPointsPerDrawCall );
                 uint32_t const drawRangeLength = ( drawRangeEnd - drawRangeStart );
                 uint32_t const drawCommandMemorySize = drawRangeLength * sizeof( PointCommand );
-                memcpy( pData, &commands[drawRangeStart], drawCommandMemorySize );
 
-                renderContext.WriteToBuffer( m_pointRS.m_vertexBuffer, pData, dataSize );
+                renderContext.WriteToBuffer( m_pointRS.m_vertexBuffer, &commands[drawRangeStart], drawCommandMemorySize );
                 renderContext.Draw( drawRangeLength, 0 );
             }
         }
     }
 
-    void DebugRenderer::DrawLines( RenderContext const& renderContext, Viewport const& viewport, TVector<LineCommand> const& commands )
+    void DebugRenderer::DrawLines( RenderContext const& renderContext, Viewport const& viewport, TSpan<LineCommand const> commands )
     {
         // Set render state
         renderContext.SetPrimitiveTopology( Topology::LineList );
 
         //-------------------------------------------------------------------------
 
-        auto pData = reinterpret_cast<Float4*>( m_lineRS.m_stagingVertexData.data() );
-        auto const dataSize = (uint32_t) m_lineRS.m_stagingVertexData.size();
-
         int32_t const numLines = (int32_t) commands.size();
         if ( numLines > 0 )
         {
-            // Fill the lines vertex buffer
+            // The gathered commands are already laid out as vertices so we upload directly from them
             uint32_t const numDrawCalls = (uint32_t) Math::Ceiling( (float) numLines / DebugLineRenderState::MaxLinesPerDrawCall );
             for ( auto i = 0u; i < numDrawCalls; i++ )
             {
@@ -120,28 +230,24 @@ namespace EE::Render
                 uint32_t const drawRangeEnd = drawRangeStart + Math::Min( uint32_t( numLines - ( i * DebugLineRenderState::MaxLinesPerDrawCall ) ), (uint32_t) DebugLineRenderState::MaxLinesPerDrawCall );
                 uint32_t const drawRangeLength = ( drawRangeEnd - drawRangeStart );
                 uint32_t const drawCommandMemorySize = drawRangeLength * sizeof( LineCommand );
-                memcpy( pData, &commands[drawRangeStart], drawCommandMemorySize );
 
-                renderContext.WriteToBuffer( m_lineRS.m_vertexBuffer, pData, dataSize );
+                renderContext.WriteToBuffer( m_lineRS.m_vertexBuffer, &commands[drawRangeStart], drawCommandMemorySize );
                 renderContext.Draw( drawRangeLength * 2, 0 );
             }
         }
     }
 
-    void DebugRenderer::DrawTriangles( RenderContext const& renderContext, Viewport const& viewport, TVector<TriangleCommand> const& commands )
+    void DebugRenderer::DrawTriangles( RenderContext const& renderContext, Viewport const& viewport, TSpan<TriangleCommand const> commands )
     {
         // Set render state
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
         //-------------------------------------------------------------------------
 
-        auto pData = reinterpret_cast<Float4*>( m_primitiveRS.m_stagingVertexData.data() );
-        auto const dataSize = (uint32_t) m_primitiveRS.m_stagingVertexData.size();
-
         int32_t const numTriangles = (int32_t) commands.size();
         if ( numTriangles > 0 )
         {
-            // Fill the triangles vertex buffer
+            // The gathered commands are already laid out as vertices so we upload directly from them
             uint32_t const numDrawCalls = (uint32_t) Math::Ceiling( (float) numTriangles / DebugPrimitiveRenderState::MaxTrianglesPerDrawCall );
             for ( auto i = 0u; i < numDrawCalls; i++ )
             {
@@ -149,9 +255,8 @@ namespace EE::Render
                 uint32_t const drawRangeEnd = drawRangeStart + Math::Min( numTriangles - ( i * DebugPrimitiveRenderState::MaxTrianglesPerDrawCall ), DebugPrimitiveRenderState::MaxTrianglesPerDrawCall );
                 uint32_t const drawRangeLength = ( drawRangeEnd - drawRangeStart );
                 uint32_t const drawCommandMemorySize = drawRangeLength * sizeof( TriangleCommand );
-                memcpy( pData, &commands[drawRangeStart], drawCommandMemorySize );
 
-                renderContext.WriteToBuffer( m_primitiveRS.m_vertexBuffer, pData, dataSize );
+                renderContext.WriteToBuffer( m_primitiveRS.m_vertexBuffer, &commands[drawRangeStart], drawCommandMemorySize );
                 renderContext.Draw( drawRangeLength * 3, 0 );
             }
         }
@@ -403,6 +508,7 @@ namespace EE::Render
         auto pDebugDrawingSystem = pWorld->GetDebugDrawingSystem();
         EE_ASSERT( pDebugDrawingSystem != nullptr );
         pDebugDrawingSystem->ReflectFrameCommandBuffer( deltaTime, m_drawCommands );
+        GatherCommands();
 
         //-------------------------------------------------------------------------
 
@@ -419,18 +525,18 @@ namespace EE::Render
             m_pointRS.SetState( renderContext, viewport );
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_pointCommands );
+            DebugRenderer::DrawPoints( renderContext, viewport, m_gatheredPoints.GetCommands( CommandBufferType::OpaqueDepthOn ) );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_pointCommands );
+            DebugRenderer::DrawPoints( renderContext, viewport, m_gatheredPoints.GetCommands( CommandBufferType::OpaqueDepthOff ) );
 
             //-------------------------------------------------------------------------
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_pointCommands );
+            DebugRenderer::DrawPoints( renderContext, viewport, m_gatheredPoints.GetCommands( CommandBufferType::TransparentDepthOn ) );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_pointCommands );
+            DebugRenderer::DrawPoints( renderContext, viewport, m_gatheredPoints.GetCommands( CommandBufferType::TransparentDepthOff ) );
         }
 
         //-------------------------------------------------------------------------
@@ -442,18 +548,18 @@ namespace EE::Render
             m_lineRS.SetState( renderContext, viewport );
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_lineCommands );
+            DebugRenderer::DrawLines( renderContext, viewport, m_gatheredLines.GetCommands( CommandBufferType::OpaqueDepthOn ) );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_lineCommands );
+            DebugRenderer::DrawLines( renderContext, viewport, m_gatheredLines.GetCommands( CommandBufferType::OpaqueDepthOff ) );
 
             //-------------------------------------------------------------------------
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_lineCommands );
+            DebugRenderer::DrawLines( renderContext, viewport, m_gatheredLines.GetCommands( CommandBufferType::TransparentDepthOn ) );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_lineCommands );
+            DebugRenderer::DrawLines( renderContext, viewport, m_gatheredLines.GetCommands( CommandBufferType::TransparentDepthOff ) );
         }
 
         //-------------------------------------------------------------------------
@@ -465,18 +571,18 @@ namespace EE::Render
             m_primitiveRS.SetState( renderContext, viewport );
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_triangleCommands );
+            DebugRenderer::DrawTriangles( renderContext, viewport, m_gatheredTriangles.GetCommands( CommandBufferType::OpaqueDepthOn ) );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_triangleCommands );
+            DebugRenderer::DrawTriangles( renderContext, viewport, m_gatheredTriangles.GetCommands( CommandBufferType::OpaqueDepthOff ) );
 
             //-------------------------------------------------------------------------
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_triangleCommands );
+            DebugRenderer::DrawTriangles( renderContext, viewport, m_gatheredTriangles.GetCommands( CommandBufferType::TransparentDepthOn ) );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_triangleCommands );
+            DebugRenderer::DrawTriangles( renderContext, viewport, m_gatheredTriangles.GetCommands( CommandBufferType::TransparentDepthOff ) );
         }
 
         //-------------------------------------------------------------------------
@@ -490,12 +596,12 @@ namespace EE::Render
             auto textRenderfunc = [this] ( RenderContext const& renderContext, Viewport const& viewport, TVector<TextCommand> const& commands, IntRange cmdRange ) { DebugRenderer::DrawText( renderContext, viewport, commands, cmdRange ); };
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DrawTextCommands( m_drawCommands.m_opaqueDepthOn.m_textCommands, renderContext, viewport, textRenderfunc );
-            DrawTextCommands( m_drawCommands.m_transparentDepthOn.m_textCommands, renderContext, viewport, textRenderfunc );
+            DrawTextCommands( m_gatheredText[(int32_t) CommandBufferType::OpaqueDepthOn], renderContext, viewport, textRenderfunc );
+            DrawTextCommands( m_gatheredText[(int32_t) CommandBufferType::TransparentDepthOn], renderContext, viewport, textRenderfunc );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DrawTextCommands( m_drawCommands.m_opaqueDepthOff.m_textCommands, renderContext, viewport, textRenderfunc );
-            DrawTextCommands( m_drawCommands.m_transparentDepthOff.m_textCommands, renderContext, viewport, textRenderfunc );
+            DrawTextCommands( m_gatheredText[(int32_t) CommandBufferType::OpaqueDepthOff], renderContext, viewport, textRenderfunc );
+            DrawTextCommands( m_gatheredText[(int32_t) CommandBufferType::TransparentDepthOff], renderContext, viewport, textRenderfunc );
         }
     }
 }
@@ -7,6 +7,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Render
 {
@@ -19,20 +23,53 @@ namespace EE::Render
     public:
 
         bool IsInitialized() const { return m_initialized; }
-        bool Initialize( RenderDevice* pRenderDevice );
+        bool Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem );
         void Shutdown();
         void RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld ) override final;
 
     private:
 
-        void DrawPoints( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::PointCommand> const& commands );
-        void DrawLines( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::LineCommand> const& commands );
-        void DrawTriangles( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::TriangleCommand> const& commands );
+        // The vertex data for all commands of a single primitive type, this is contiguous per command buffer type
+        template<typename T>
+        struct GatheredCommands
+        {
+            inline TSpan<T const> GetCommands( Drawing::CommandBufferType type ) const
+            {
+                uint32_t const startIdx = m_offsets[(int32_t) type];
+                return TSpan<T const>( m_commands.data() + startIdx, m_offsets[(int32_t) type + 1] - startIdx );
+            }
+
+            TVector<T>                              m_commands;
+            uint32_t                                m_offsets[Drawing::CommandBufferSet::s_numBuffers + 1] = {};
+        };
+
+        // A single copy from a command list into the gathered vertex data
+        struct GatherJob
+        {
+            void const*                             m_pSource = nullptr;
+            void*                                   m_pDestination = nullptr;
+            size_t                                  m_size = 0;
+        };
+
+        struct GatherTask;
+
+    private:
+
+        // Copies the vertex data of all the command sets into contiguous arrays, this is done in parallel
+        void GatherCommands();
+
+        template<typename T>
+        static void PrepareGatherJobs( Drawing::FrameCommandBuffer const& frameCommands, TVector<T> Drawing::CommandBuffer::* pCommandList, GatheredCommands<T>& outGatheredCommands, TVector<GatherJob>& outJobs );
+
+        void DrawPoints( RenderContext const& renderContext, Viewport const& viewport, TSpan<Drawing::PointCommand const> commands );
+        void DrawLines( RenderContext const& renderContext, Viewport const& viewport, TSpan<Drawing::LineCommand const> commands );
+        void DrawTriangles( RenderContext const& renderContext, Viewport const& viewport, TSpan<Drawing::TriangleCommand const> commands );
         void DrawText( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::TextCommand> const& commands, IntRange cmdRange );
 
     private:
 
         RenderDevice*                               m_pRenderDevice = nullptr;
+        TaskSystem*                                 m_pTaskSystem = nullptr;
 
         DebugLineRenderState                        m_lineRS;
         DebugPointRenderState                       m_pointRS;
@@ -40,6 +77,11 @@ namespace EE::Render
         DebugTextRenderState                        m_textRS;
 
         Drawing::FrameCommandBuffer                 m_drawCommands;
+        GatheredCommands<Drawing::PointCommand>     m_gatheredPoints;
+        GatheredCommands<Drawing::LineCommand>      m_gatheredLines;
+        GatheredCommands<Drawing::TriangleCommand>  m_gatheredTriangles;
+        TVector<Drawing::TextCommand>               m_gatheredText[Drawing::CommandBufferSet::s_numBuffers];
+        TVector<GatherJob>                          m_gatherJobs;
         bool                                        m_initialized = false;
 
         // Text rendering
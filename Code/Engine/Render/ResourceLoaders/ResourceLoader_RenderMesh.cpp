@@ -34,6 +34,13 @@ namespace EE::Render
             SkeletalMesh* pSkeletalMesh = EE::New<SkeletalMesh>();
             archive << *pSkeletalMesh;
             pMeshResource = pSkeletalMesh;
+
+            // Pre-convert the inverse bind pose so that skinning matrix generation doesnt need to do it every frame
+            pSkeletalMesh->m_inverseBindPoseMatrices.reserve( pSkeletalMesh->m_inverseBindPose.size() );
+            for ( auto const& inverseBindTransform : pSkeletalMesh->m_inverseBindPose )
+            {
+                pSkeletalMesh->m_inverseBindPoseMatrices.emplace_back( inverseBindTransform.ToMatrix() );
+            }
         }
 
         EE_ASSERT( !pMeshResource->m_vertices.empty() );
@@ -11,14 +11,70 @@
 #include "Base/Render/RenderCoreResources.h"
 #include "Base/Render/RenderViewport.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Render
 {
+    namespace
+    {
+        // Skinning transform = inverse bind pose * model space bone transform
+        // The inverse bind pose is pre-converted to matrices so this is a single SIMD 4x4 multiply per bone
+        EE_FORCE_INLINE void CalculateSkinningTransforms( Matrix const* pInverseBindPose, Transform const* pBoneTransforms, uint32_t numBones, Matrix* pOutSkinningTransforms )
+        {
+            for ( uint32_t i = 0; i < numBones; i++ )
+            {
+                pOutSkinningTransforms[i] = pInverseBindPose[i] * pBoneTransforms[i].ToMatrix();
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct SkinningTask final : public ITaskSet
+        {
+            // Minimum number of meshes processed per partition, prevents us from splitting small crowds into tiny work items
+            constexpr static uint32_t const s_minMeshesPerPartition = 8;
+
+            SkinningTask( TVector<SkeletalMeshComponent const*> const& meshComponents, TVector<uint32_t> const& offsets, TVector<Matrix>& skinningTransforms )
+                : ITaskSet( (uint32_t) meshComponents.size(), s_minMeshesPerPartition )
+                , m_meshComponents( meshComponents )
+                , m_offsets( offsets )
+                , m_skinningTransforms( skinningTransforms )
+            {}
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_RENDER( "Generate Skinning Transforms" );
+
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    auto pMeshComponent = m_meshComponents[i];
+                    auto const& boneTransforms = pMeshComponent->GetBoneTransforms();
+                    auto const& inverseBindPose = pMeshComponent->GetMesh()->GetInverseBindPoseMatrices();
+                    EE_ASSERT( inverseBindPose.size() == boneTransforms.size() );
+
+                    uint32_t const numBones = m_offsets[i + 1] - m_offsets[i];
+                    CalculateSkinningTransforms( inverseBindPose.data(), boneTransforms.data(), numBones, m_skinningTransforms.data() + m_offsets[i] );
+                }
+            }
+
+        private:
+
+            TVector<SkeletalMeshComponent const*> const&    m_meshComponents;
+            TVector<uint32_t> const&                        m_offsets;
+            TVector<Matrix>&                                m_skinningTransforms;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+
     void RendererWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
-    {}
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+    }
 
     void RendererWorldSystem::ShutdownSystem()
     {
@@ -174,6 +230,8 @@ namespace EE::Render
         // Unregistrations occur at the start of the frame
         // The world might be paused so we might leave an invalid component in this array
         m_visibleSkeletalMeshComponents.clear();
+        m_skinningTransformOffsets.clear();
+        m_skinningTransforms.clear();
 
         // Remove component from mesh group
         if ( pMeshComponent->HasMeshResourceSet() )
@@ -193,6 +251,47 @@ namespace EE::Render
         m_registeredSkeletalMeshComponents.Remove( pMeshComponent->GetID() );
     }
 
+    void RendererWorldSystem::UpdateSkinningTransforms()
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        // Calculate the offsets of each mesh into the shared skinning buffer
+        //-------------------------------------------------------------------------
+
+        int32_t const numVisibleMeshes = (int32_t) m_visibleSkeletalMeshComponents.size();
+        m_skinningTransformOffsets.resize( numVisibleMeshes + 1 );
+
+        uint32_t numTotalBones = 0;
+        for ( int32_t i = 0; i < numVisibleMeshes; i++ )
+        {
+            m_skinningTransformOffsets[i] = numTotalBones;
+            numTotalBones += (uint32_t) m_visibleSkeletalMeshComponents[i]->GetBoneTransforms().size();
+        }
+        m_skinningTransformOffsets[numVisibleMeshes] = numTotalBones;
+
+        // Generate skinning transforms
+        //-------------------------------------------------------------------------
+
+        // Resizing never releases capacity so in steady state this will not allocate
+        m_skinningTransforms.resize( numTotalBones, Matrix( NoInit ) );
+
+        if ( numVisibleMeshes == 0 )
+        {
+            return;
+        }
+
+        SkinningTask skinningTask( m_visibleSkeletalMeshComponents, m_skinningTransformOffsets, m_skinningTransforms );
+        if ( numVisibleMeshes <= SkinningTask::s_minMeshesPerPartition )
+        {
+            skinningTask.ExecuteRange( { 0u, (uint32_t) numVisibleMeshes }, 0 );
+        }
+        else
+        {
+            m_pTaskSystem->ScheduleTask( &skinningTask );
+            m_pTaskSystem->WaitForTask( &skinningTask );
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     void RendererWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
@@ -239,6 +338,12 @@ namespace EE::Render
             }
         }
 
+        //-------------------------------------------------------------------------
+        // Skinning
+        //-------------------------------------------------------------------------
+
+        UpdateSkinningTransforms();
+
         //-------------------------------------------------------------------------
         // Debug
         //-------------------------------------------------------------------------
@@ -12,6 +12,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Render
 {
     class SkeletalMeshComponent;
@@ -32,6 +36,19 @@ namespace EE::Render
 
         EE_ENTITY_WORLD_SYSTEM( RendererWorldSystem, RequiresUpdate( UpdateStage::FrameEnd ), RequiresUpdate( UpdateStage::Paused ) );
 
+        // Get the skinning transforms for a visible skeletal mesh component (index into the visible skeletal mesh list)
+        // All skinning transforms for the frame are stored contiguously so the whole range can be uploaded in a single copy
+        inline TSpan<Matrix const> GetSkinningTransforms( int32_t visibleSkeletalMeshIdx ) const
+        {
+            EE_ASSERT( visibleSkeletalMeshIdx >= 0 && visibleSkeletalMeshIdx < m_visibleSkeletalMeshComponents.size() );
+            uint32_t const startIdx = m_skinningTransformOffsets[visibleSkeletalMeshIdx];
+            uint32_t const endIdx = m_skinningTransformOffsets[visibleSkeletalMeshIdx + 1];
+            return TSpan<Matrix const>( m_skinningTransforms.data() + startIdx, endIdx - startIdx );
+        }
+
+        // Get the skinning transforms for all visible skeletal meshes
+        inline TVector<Matrix> const& GetSkinningTransformBuffer() const { return m_skinningTransforms; }
+
     private:
 
         // Track all instances of a given mesh together - to limit the number of vertex buffer changes
@@ -70,8 +87,13 @@ namespace EE::Render
         void RegisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
         void UnregisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
 
+        // Generate the skinning transforms for all visible skeletal meshes in parallel
+        void UpdateSkinningTransforms();
+
     private:
 
+        TaskSystem*                                                     m_pTaskSystem = nullptr;
+
         // Static meshes
         TIDVector<ComponentID, StaticMeshComponent*>                    m_registeredStaticMeshComponents;
         TIDVector<ComponentID, StaticMeshComponent*>                    m_staticMeshComponents;
@@ -81,6 +103,8 @@ namespace EE::Render
         TIDVector<ComponentID, SkeletalMeshComponent*>                  m_registeredSkeletalMeshComponents;
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
         TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
+        TVector<uint32_t>                                               m_skinningTransformOffsets; // Per visible mesh start offset into the skinning buffer (has one extra end entry)
+        TVector<Matrix>                                                 m_skinningTransforms;
 
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
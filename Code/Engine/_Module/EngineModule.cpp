@@ -59,7 +59,7 @@ namespace EE
         }
 
         #if EE_DEVELOPMENT_TOOLS
-        //if ( m_debugRenderer.Initialize( m_pRenderDevice ) )
+        //if ( m_debugRenderer.Initialize( context.m_pRenderDevice, context.m_pTaskSystem ) )
         //{
         //    m_rendererRegistry.RegisterRenderer( &m_debugRenderer );
         //}
@@ -846,9 +846,17 @@ namespace EE::Animation
 
         // Transfer sorted events
         //-------------------------------------------------------------------------
+        // Events are grouped by type and then sorted by start time, so that each event type is a contiguous range in the runtime event data
 
         auto sortPredicate = [] ( Event* const& pEventA, Event* const& pEventB )
         {
+            uint32_t const typeA = pEventA->GetTypeID().ToUint();
+            uint32_t const typeB = pEventB->GetTypeID().ToUint();
+            if ( typeA != typeB )
+            {
+                return typeA < typeB;
+            }
+
             return pEventA->GetStartTime() < pEventB->GetStartTime();
         };
 
@@ -866,6 +874,81 @@ namespace EE::Animation
         return result;
     }
 
+    bool AnimationClipCompiler::GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const
+    {
+        AnimationClipResourceDescriptor resourceDescriptor;
+        if ( !TryLoadResourceDescriptor( resourceID.GetResourcePath(), resourceDescriptor ) )
+        {
+            return false;
+        }
+
+        // The skeleton and the animation source file are compile dependencies, the skeleton's own inputs are tracked by its dependency node
+        if ( !AddReferencedSourceFiles( resourceDescriptor.m_animationPath, outInputFilePaths ) )
+        {
+            return false;
+        }
+
+        // Secondary animations and the additive base animation are read directly, so we need to track all of their files
+        for ( auto const& secondaryAnimation : resourceDescriptor.m_secondaryAnimations )
+        {
+            if ( !AddImportedAnimationInputs( secondaryAnimation.m_skeleton.GetResourcePath(), secondaryAnimation.m_animationPath, outInputFilePaths ) )
+            {
+                return false;
+            }
+        }
+
+        if ( resourceDescriptor.m_additiveType == AnimationClipResourceDescriptor::AdditiveType::RelativeToAnimationClip && resourceDescriptor.m_additiveBaseAnimation.IsSet() )
+        {
+            ResourcePath const& baseAnimationPath = resourceDescriptor.m_additiveBaseAnimation.GetResourcePath();
+
+            AnimationClipResourceDescriptor baseAnimResourceDescriptor;
+            if ( !TryLoadResourceDescriptor( baseAnimationPath, baseAnimResourceDescriptor ) )
+            {
+                return false;
+            }
+
+            outInputFilePaths.emplace_back( baseAnimationPath.ToFileSystemPath( m_rawResourceDirectoryPath ) );
+            if ( !AddImportedAnimationInputs( baseAnimResourceDescriptor.m_skeleton.GetResourcePath(), baseAnimResourceDescriptor.m_animationPath, outInputFilePaths ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool AnimationClipCompiler::AddImportedAnimationInputs( ResourcePath const& skeletonPath, ResourcePath const& animationPath, TVector<FileSystem::Path>& outInputFilePaths ) const
+    {
+        // Mirrors the files read by 'ReadImportedAnimation'
+        SkeletonResourceDescriptor skeletonResourceDescriptor;
+        if ( !TryLoadResourceDescriptor( skeletonPath, skeletonResourceDescriptor ) )
+        {
+            return false;
+        }
+
+        outInputFilePaths.emplace_back( skeletonPath.ToFileSystemPath( m_rawResourceDirectoryPath ) );
+
+        if ( skeletonResourceDescriptor.m_skeletonPath.IsValid() )
+        {
+            outInputFilePaths.emplace_back( skeletonResourceDescriptor.m_skeletonPath.ToFileSystemPath( m_rawResourceDirectoryPath ) );
+            if ( !AddReferencedSourceFiles( skeletonResourceDescriptor.m_skeletonPath, outInputFilePaths ) )
+            {
+                return false;
+            }
+        }
+
+        if ( animationPath.IsValid() )
+        {
+            outInputFilePaths.emplace_back( animationPath.ToFileSystemPath( m_rawResourceDirectoryPath ) );
+            if ( !AddReferencedSourceFiles( animationPath, outInputFilePaths ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     bool AnimationClipCompiler::GetInstallDependencies( ResourceID const& resourceID, TVector<ResourceID>& outReferencedResources ) const
     {
         // Try read descriptor
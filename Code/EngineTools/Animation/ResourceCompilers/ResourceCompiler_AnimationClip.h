@@ -21,7 +21,7 @@ namespace EE::Animation
     class AnimationClipCompiler : public Resource::Compiler
     {
         EE_REFLECT_TYPE( AnimationClipCompiler );
-        static const int32_t s_version = 56;
+        static const int32_t s_version = 57;
 
     public:
 
@@ -33,6 +33,11 @@ namespace EE::Animation
 
         virtual bool GetInstallDependencies( ResourceID const& resourceID, TVector<ResourceID>& outReferencedResources ) const override;
 
+        virtual bool GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const override;
+
+        // Adds the skeleton and animation files read by 'ReadImportedAnimation' to the list of compile inputs
+        bool AddImportedAnimationInputs( ResourcePath const& skeletonPath, ResourcePath const& animationPath, TVector<FileSystem::Path>& outInputFilePaths ) const;
+
         Resource::CompilationResult ReadImportedAnimation( ResourcePath const& skeletonPath, ResourcePath const& animationPath, TUniquePtr<Import::ImportedAnimation>& outAnimation, String const& animationName = String() ) const;
 
         Resource::CompilationResult MakeAdditive( Resource::CompileContext const& ctx, AnimationClipResourceDescriptor const& resourceDescriptor, Import::ImportedAnimation& rawAnimData, bool isSecondaryAnimation ) const;
@@ -161,6 +161,7 @@ namespace EE::Animation
         GraphVariation variation;
         variation.m_pGraphDefinition = graphResourceID;
         variation.m_dataSet.m_variationID = variationID;
+        variation.m_instancePoolSize = Math::Max( editorGraph.GetVariation( variationID )->m_instancePoolSize, 0 );
 
         if ( !GenerateDataSet( ctx, editorGraph, definitionCompiler.GetRegisteredDataSlots(), variation.m_dataSet ) )
         {
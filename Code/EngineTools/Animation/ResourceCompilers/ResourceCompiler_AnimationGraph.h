@@ -16,7 +16,7 @@ namespace EE::Animation
     class AnimationGraphCompiler final : public Resource::Compiler
     {
         EE_REFLECT_TYPE( AnimationGraphCompiler );
-        constexpr static const int32_t s_version = 67;
+        constexpr static const int32_t s_version = 71;
 
     public:
 
@@ -77,4 +77,15 @@ namespace EE::Animation
             return CompilationFailed( ctx );
         }
     }
+
+    bool SkeletonCompiler::GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const
+    {
+        SkeletonResourceDescriptor resourceDescriptor;
+        if ( !TryLoadResourceDescriptor( resourceID.GetResourcePath(), resourceDescriptor ) )
+        {
+            return false;
+        }
+
+        return AddReferencedSourceFiles( resourceDescriptor.m_skeletonPath, outInputFilePaths );
+    }
 }
\ No newline at end of file
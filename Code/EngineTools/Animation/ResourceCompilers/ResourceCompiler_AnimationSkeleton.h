@@ -16,5 +16,6 @@ namespace EE::Animation
 
         SkeletonCompiler();
         virtual Resource::CompilationResult Compile( Resource::CompileContext const& ctx ) const final;
+        virtual bool GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const override;
     };
 }
\ No newline at end of file
@@ -5020,10 +5020,12 @@ namespace EE::Animation
 
         constexpr static char const* const variationLabel = "Variation: ";
         constexpr static char const* const skeletonLabel = "Skeleton: ";
+        constexpr static char const* const instancePoolLabel = "Instance Pool: ";
 
         ImVec2 const variationLabelSize = ImGui::CalcTextSize( variationLabel );
         ImVec2 const skeletonLabelSize = ImGui::CalcTextSize( skeletonLabel );
-        float const offset = Math::Max( skeletonLabelSize.x, variationLabelSize.x ) + ( ImGui::GetStyle().ItemSpacing.x * 2 );
+        ImVec2 const instancePoolLabelSize = ImGui::CalcTextSize( instancePoolLabel );
+        float const offset = Math::Max( Math::Max( skeletonLabelSize.x, variationLabelSize.x ), instancePoolLabelSize.x ) + ( ImGui::GetStyle().ItemSpacing.x * 2 );
 
         ImGui::AlignTextToFramePadding();
         ImGui::Text( variationLabel );
@@ -5042,6 +5044,20 @@ namespace EE::Animation
             pVariation->m_skeleton = m_variationSkeletonPicker.GetResourceID();
         }
 
+        ImGui::BeginDisabled( IsInReadOnlyState() );
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text( instancePoolLabel );
+        ImGui::SameLine( offset );
+        int32_t instancePoolSize = pVariation->m_instancePoolSize;
+        ImGui::SetNextItemWidth( -1 );
+        if ( ImGui::InputInt( "##InstancePoolSize", &instancePoolSize ) )
+        {
+            VisualGraph::ScopedGraphModification sgm( pRootGraph );
+            pVariation->m_instancePoolSize = Math::Max( instancePoolSize, 0 );
+        }
+        ImGuiX::ItemTooltip( "The number of graph instances created when this variation is loaded, these are reused when characters are spawned and despawned" );
+        ImGui::EndDisabled();
+
         //-------------------------------------------------------------------------
         // Overrides
         //-------------------------------------------------------------------------
@@ -1,5 +1,6 @@
 #include "Animation_ToolsGraph_Compilation.h"
 #include "Animation_ToolsGraph_Definition.h"
+#include "Animation_ToolsGraph_ValuePrograms.h"
 #include "Nodes/Animation_ToolsGraphNode_Parameters.h"
 #include "Nodes/Animation_ToolsGraphNode_Result.h"
 
@@ -25,6 +26,15 @@ namespace EE::Animation
 
         m_nodeDefinitions.clear();
 
+        for ( auto pDefinition : m_flattenedNodeDefinitions )
+        {
+            EE::Delete( pDefinition );
+        }
+
+        m_flattenedNodeDefinitions.clear();
+        m_flattenedNodeIDToIndexMap.clear();
+        m_unusedFlattenedNodeIDs.clear();
+
         //-------------------------------------------------------------------------
 
         m_log.clear();
@@ -42,6 +52,9 @@ namespace EE::Animation
         m_transitionDurationOverrideIdx = InvalidIndex;
 
         m_nodeMemoryOffsets.clear();
+        m_nodeMemorySizes.clear();
+        m_nodeMemoryAlignments.clear();
+        m_nodeReferenceCounts.clear();
     }
 
     void GraphCompilationContext::TryAddPersistentNode( VisualGraph::BaseNode const* pNode, GraphNode::Definition* pDefinition )
@@ -53,9 +66,264 @@ namespace EE::Animation
         }
     }
 
+    int16_t GraphCompilationContext::AddFlattenedNodeDefinition( GraphNode::Definition* pDefinition )
+    {
+        EE_ASSERT( m_flattenedNodeDefinitions.size() < 0x7FFF );
+        pDefinition->m_nodeIdx = ValueProgramCompiler::GetFlattenedNodeIndex( (int32_t) m_flattenedNodeDefinitions.size() );
+        m_flattenedNodeDefinitions.emplace_back( pDefinition );
+        return pDefinition->m_nodeIdx;
+    }
+
+    GraphNode::Definition* GraphCompilationContext::GetFlattenedNodeDefinition( int16_t nodeIdx ) const
+    {
+        return m_flattenedNodeDefinitions[ValueProgramCompiler::GetFlattenedDefinitionIndex( nodeIdx )];
+    }
+
+    bool GraphCompilationContext::CompileValuePrograms()
+    {
+        int32_t const numNodes = (int32_t) m_nodeDefinitions.size();
+
+        // Only the roots of the flattenable trees are replaced, i.e. nodes that are not used by any other flattenable node
+        // Interior nodes are only removed if nothing else references them, this requires a recompile (see 'm_unusedFlattenedNodeIDs')
+        //-------------------------------------------------------------------------
+
+        TVector<bool> isRootNode( numNodes, false );
+        TInlineVector<int16_t, 4> inputNodeIndices;
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            if ( ValueProgramCompiler::IsFlattenableNode( m_nodeDefinitions[i] ) )
+            {
+                isRootNode[i] = true;
+            }
+        }
+
+        auto ClearInputRootFlags = [&] ( GraphNode::Definition const* pDefinition )
+        {
+            ValueProgramCompiler::GetNodeInputs( pDefinition, inputNodeIndices );
+            for ( auto inputNodeIdx : inputNodeIndices )
+            {
+                if ( !ValueProgramCompiler::IsFlattenedNodeIndex( inputNodeIdx ) )
+                {
+                    isRootNode[inputNodeIdx] = false;
+                }
+            }
+        };
+
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            if ( ValueProgramCompiler::IsFlattenableNode( m_nodeDefinitions[i] ) )
+            {
+                ClearInputRootFlags( m_nodeDefinitions[i] );
+            }
+        }
+
+        for ( auto pDefinition : m_flattenedNodeDefinitions )
+        {
+            ClearInputRootFlags( pDefinition );
+        }
+
+        // Compile programs
+        //-------------------------------------------------------------------------
+
+        // When the flattened nodes have already been removed, there is nothing left to record
+        bool const shouldRecordUnusedNodes = m_flattenedNodeIDToIndexMap.empty();
+        TVector<bool> isUnusedNode( numNodes, false );
+        TVector<int32_t> numRemainingReferences = m_nodeReferenceCounts;
+        TInlineVector<int16_t, 16> nodesToVisit;
+
+        ValueProgramCompiler compiler( m_nodeDefinitions, m_flattenedNodeDefinitions );
+        ValueProgram program;
+        int32_t numPrograms = 0, numFlattenedNodes = 0, numFoldedNodes = 0;
+
+        for ( int16_t i = 0; i < (int16_t) numNodes; i++ )
+        {
+            if ( !isRootNode[i] || !compiler.TryCompile( i, program ) )
+            {
+                continue;
+            }
+
+            // A program for a single node gains nothing over the node itself
+            if ( compiler.GetNumFlattenedNodes() < 2 )
+            {
+                continue;
+            }
+
+            // All flattenable nodes in this tree are candidates for removal, the references from the replaced root no longer exist
+            if ( shouldRecordUnusedNodes )
+            {
+                ValueProgramCompiler::GetNodeInputs( m_nodeDefinitions[i], inputNodeIndices );
+                nodesToVisit.insert( nodesToVisit.end(), inputNodeIndices.begin(), inputNodeIndices.end() );
+                for ( auto inputNodeIdx : inputNodeIndices )
+                {
+                    numRemainingReferences[inputNodeIdx]--;
+                }
+
+                while ( !nodesToVisit.empty() )
+                {
+                    int16_t const nodeIdx = nodesToVisit.back();
+                    nodesToVisit.pop_back();
+
+                    if ( isUnusedNode[nodeIdx] || !ValueProgramCompiler::IsFlattenableNode( m_nodeDefinitions[nodeIdx] ) )
+                    {
+                        continue;
+                    }
+
+                    isUnusedNode[nodeIdx] = true;
+                    ValueProgramCompiler::GetNodeInputs( m_nodeDefinitions[nodeIdx], inputNodeIndices );
+                    nodesToVisit.insert( nodesToVisit.end(), inputNodeIndices.begin(), inputNodeIndices.end() );
+                }
+            }
+
+            GraphNode::Definition* pProgramDefinition = nullptr;
+            if ( ValueProgramCompiler::IsBoolNode( m_nodeDefinitions[i] ) )
+            {
+                auto pBoolProgramDefinition = EE::New<BoolValueProgramNode::Definition>();
+                pBoolProgramDefinition->m_program = eastl::move( program );
+                pProgramDefinition = pBoolProgramDefinition;
+                m_nodeMemorySizes[i] = (uint32_t) sizeof( BoolValueProgramNode );
+                m_nodeMemoryAlignments[i] = (uint32_t) alignof( BoolValueProgramNode );
+            }
+            else
+            {
+                auto pFloatProgramDefinition = EE::New<FloatValueProgramNode::Definition>();
+                pFloatProgramDefinition->m_program = eastl::move( program );
+                pProgramDefinition = pFloatProgramDefinition;
+                m_nodeMemorySizes[i] = (uint32_t) sizeof( FloatValueProgramNode );
+                m_nodeMemoryAlignments[i] = (uint32_t) alignof( FloatValueProgramNode );
+            }
+
+            pProgramDefinition->m_nodeIdx = i;
+            EE::Delete( m_nodeDefinitions[i] );
+            m_nodeDefinitions[i] = pProgramDefinition;
+
+            numPrograms++;
+            numFlattenedNodes += compiler.GetNumFlattenedNodes();
+            numFoldedNodes += compiler.GetNumFoldedNodes();
+        }
+
+        // Find the flattened nodes that are not referenced by anything other than the replaced trees
+        //-------------------------------------------------------------------------
+
+        if ( shouldRecordUnusedNodes )
+        {
+            auto UpdateInputReferenceCounts = [&] ( int32_t nodeIdx, int32_t delta )
+            {
+                ValueProgramCompiler::GetNodeInputs( m_nodeDefinitions[nodeIdx], inputNodeIndices );
+                for ( auto inputNodeIdx : inputNodeIndices )
+                {
+                    numRemainingReferences[inputNodeIdx] += delta;
+                }
+            };
+
+            for ( int32_t i = 0; i < numNodes; i++ )
+            {
+                if ( isUnusedNode[i] )
+                {
+                    UpdateInputReferenceCounts( i, -1 );
+                }
+            }
+
+            // Any candidate that is still referenced has to be kept, which in turn keeps its inputs referenced
+            bool hasKeptNodes = true;
+            while ( hasKeptNodes )
+            {
+                hasKeptNodes = false;
+                for ( int32_t i = 0; i < numNodes; i++ )
+                {
+                    if ( isUnusedNode[i] && numRemainingReferences[i] > 0 )
+                    {
+                        isUnusedNode[i] = false;
+                        UpdateInputReferenceCounts( i, 1 );
+                        hasKeptNodes = true;
+                    }
+                }
+            }
+
+            for ( int16_t i = 0; i < (int16_t) numNodes; i++ )
+            {
+                if ( isUnusedNode[i] )
+                {
+                    m_unusedFlattenedNodeIDs.emplace_back( m_nodeIndexToIDMap[i] );
+                }
+            }
+        }
+
+        // Any remaining flattenable node that references a removed node would be left with a dangling index
+        //-------------------------------------------------------------------------
+
+        if ( !shouldRecordUnusedNodes )
+        {
+            for ( int32_t i = 0; i < numNodes; i++ )
+            {
+                if ( !ValueProgramCompiler::IsFlattenableNode( m_nodeDefinitions[i] ) )
+                {
+                    continue;
+                }
+
+                ValueProgramCompiler::GetNodeInputs( m_nodeDefinitions[i], inputNodeIndices );
+                for ( auto inputNodeIdx : inputNodeIndices )
+                {
+                    if ( ValueProgramCompiler::IsFlattenedNodeIndex( inputNodeIdx ) )
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( numPrograms > 0 )
+        {
+            UpdateNodeMemoryOffsets();
+            LogMessage( String( String::CtorSprintf(), "Compiled %d value programs (%d nodes flattened, %d nodes constant folded, %d nodes removed)", numPrograms, numFlattenedNodes, numFoldedNodes, (int32_t) m_flattenedNodeDefinitions.size() ) );
+        }
+
+        return true;
+    }
+
+    void GraphCompilationContext::UpdateNodeMemoryOffsets()
+    {
+        EE_ASSERT( m_nodeMemorySizes.size() == m_nodeDefinitions.size() && m_nodeMemoryAlignments.size() == m_nodeDefinitions.size() );
+
+        m_currentNodeMemoryOffset = 0;
+        m_graphInstanceRequiredAlignment = alignof( bool );
+
+        for ( int32_t i = 0; i < (int32_t) m_nodeDefinitions.size(); i++ )
+        {
+            m_graphInstanceRequiredAlignment = Math::Max( m_graphInstanceRequiredAlignment, m_nodeMemoryAlignments[i] );
+            uint32_t const requiredNodePadding = (uint32_t) Memory::CalculatePaddingForAlignment( m_currentNodeMemoryOffset, m_nodeMemoryAlignments[i] );
+            m_nodeMemoryOffsets[i] = m_currentNodeMemoryOffset + requiredNodePadding;
+            m_currentNodeMemoryOffset += m_nodeMemorySizes[i] + requiredNodePadding;
+        }
+    }
+
     //-------------------------------------------------------------------------
 
-    bool GraphDefinitionCompiler::CompileGraph( ToolsGraphDefinition const& toolsGraph )
+    bool GraphDefinitionCompiler::CompileGraph( ToolsGraphDefinition const& toolsGraph, bool compileValuePrograms )
+    {
+        if ( !TryCompileGraph( toolsGraph, {}, compileValuePrograms ) )
+        {
+            return false;
+        }
+
+        // The value nodes that are only used within value programs are only known once the whole graph has been compiled
+        // Recompile without them so that they are neither instantiated nor allocated at runtime
+        //-------------------------------------------------------------------------
+
+        TVector<UUID> const unusedFlattenedNodeIDs = m_context.m_unusedFlattenedNodeIDs;
+        if ( unusedFlattenedNodeIDs.empty() || TryCompileGraph( toolsGraph, unusedFlattenedNodeIDs, true ) )
+        {
+            return true;
+        }
+
+        // Keep the flattened nodes rather than fail the compilation
+        bool const result = TryCompileGraph( toolsGraph, {}, true );
+        m_context.LogWarning( "Failed to remove the value nodes flattened into value programs, these will still be instantiated!" );
+        return result;
+    }
+
+    bool GraphDefinitionCompiler::TryCompileGraph( ToolsGraphDefinition const& toolsGraph, TVector<UUID> const& flattenedNodeIDs, bool compileValuePrograms )
     {
         EE_ASSERT( toolsGraph.IsValid() );
         auto pRootGraph = toolsGraph.GetRootGraph();
@@ -63,6 +331,11 @@ namespace EE::Animation
         m_context.Reset();
         m_runtimeGraph = GraphDefinition();
 
+        for ( auto const& nodeID : flattenedNodeIDs )
+        {
+            m_context.m_flattenedNodeIDToIndexMap.insert( TPair<UUID, int16_t>( nodeID, InvalidIndex ) );
+        }
+
         // Ensure that all variations have skeletons set
         //-------------------------------------------------------------------------
 
@@ -115,6 +388,14 @@ namespace EE::Animation
         EE_ASSERT( resultNodes.size() == 1 );
         int16_t const rootNodeIdx = resultNodes[0]->Compile( m_context );
 
+        // Flatten value node trees
+        //-------------------------------------------------------------------------
+
+        if ( compileValuePrograms && rootNodeIdx != InvalidIndex && !m_context.CompileValuePrograms() )
+        {
+            return false;
+        }
+
         // Fill runtime definition
         //-------------------------------------------------------------------------
 
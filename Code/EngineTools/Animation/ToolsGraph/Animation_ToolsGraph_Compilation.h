@@ -70,15 +70,32 @@ namespace EE::Animation
             auto foundIter = m_nodeIDToIndexMap.find( pNode->GetID() );
             if ( foundIter != m_nodeIDToIndexMap.end() )
             {
+                m_nodeReferenceCounts[foundIter->second]++;
                 pOutDefinition = (typename T::Definition*) m_nodeDefinitions[foundIter->second];
                 return NodeCompilationState::AlreadyCompiled;
             }
 
+            // Value nodes that only exist within value programs are not added to the runtime graph
+            auto foundFlattenedIter = m_flattenedNodeIDToIndexMap.find( pNode->GetID() );
+            if ( foundFlattenedIter != m_flattenedNodeIDToIndexMap.end() )
+            {
+                if ( foundFlattenedIter->second != InvalidIndex )
+                {
+                    pOutDefinition = (typename T::Definition*) GetFlattenedNodeDefinition( foundFlattenedIter->second );
+                    return NodeCompilationState::AlreadyCompiled;
+                }
+
+                pOutDefinition = EE::New<typename T::Definition>();
+                foundFlattenedIter->second = AddFlattenedNodeDefinition( pOutDefinition );
+                return NodeCompilationState::NeedCompilation;
+            }
+
             //-------------------------------------------------------------------------
 
             EE_ASSERT( m_nodeDefinitions.size() < 0xFFFF );
             pOutDefinition = EE::New<typename T::Definition>();
             m_nodeDefinitions.emplace_back( pOutDefinition );
+            m_nodeReferenceCounts.emplace_back( 1 );
             m_compiledNodePaths.emplace_back( pNode->GetStringPathFromRoot() );
             pOutDefinition->m_nodeIdx = int16_t( m_nodeDefinitions.size() ) - 1;
 
@@ -95,6 +112,8 @@ namespace EE::Animation
 
             // Set current node offset
             m_nodeMemoryOffsets.emplace_back( m_currentNodeMemoryOffset + requiredNodePadding );
+            m_nodeMemorySizes.emplace_back( (uint32_t) sizeof( T ) );
+            m_nodeMemoryAlignments.emplace_back( (uint32_t) alignof( T ) );
             
             // Shift memory offset to take into account the current node size
             m_currentNodeMemoryOffset += uint32_t( sizeof( T ) + requiredNodePadding );
@@ -202,6 +221,18 @@ namespace EE::Animation
 
         void TryAddPersistentNode( VisualGraph::BaseNode const* pNode, GraphNode::Definition* pDefinition );
 
+        // Returns the (negative) node index of the added definition
+        int16_t AddFlattenedNodeDefinition( GraphNode::Definition* pDefinition );
+        GraphNode::Definition* GetFlattenedNodeDefinition( int16_t nodeIdx ) const;
+
+        // Replace all trees of stateless value nodes with value programs, this is done once the whole graph has been compiled
+        // Records the value nodes that are only used within the compiled programs, the graph needs to be recompiled to remove them
+        // Returns false if a tree that references a removed node could not be replaced
+        bool CompileValuePrograms();
+
+        // Recalculate the instance memory layout from the node sizes, needed whenever a node definition is replaced
+        void UpdateNodeMemoryOffsets();
+
     private:
 
         TVector<NodeCompilationLogEntry>                m_log;
@@ -211,6 +242,9 @@ namespace EE::Animation
         TVector<String>                                 m_compiledNodePaths;
         TVector<GraphNode::Definition*>                   m_nodeDefinitions;
         TVector<uint32_t>                               m_nodeMemoryOffsets;
+        TVector<uint32_t>                               m_nodeMemorySizes;
+        TVector<uint32_t>                               m_nodeMemoryAlignments;
+        TVector<int32_t>                                m_nodeReferenceCounts;
         uint32_t                                        m_currentNodeMemoryOffset = 0;
         uint32_t                                        m_graphInstanceRequiredAlignment = alignof( bool );
 
@@ -220,6 +254,11 @@ namespace EE::Animation
         int16_t                                         m_conduitSourceStateCompiledNodeIdx = InvalidIndex;
         Seconds                                         m_transitionDuration = 0;
         int16_t                                         m_transitionDurationOverrideIdx = InvalidIndex;
+
+        // Value nodes that are only used within value programs, these are set before compilation and are never instantiated
+        THashMap<UUID, int16_t>                         m_flattenedNodeIDToIndexMap;
+        TVector<GraphNode::Definition*>                 m_flattenedNodeDefinitions;
+        TVector<UUID>                                   m_unusedFlattenedNodeIDs;
     };
 }
 
@@ -237,7 +276,8 @@ namespace EE::Animation
 
     public:
 
-        bool CompileGraph( ToolsGraphDefinition const& editorGraph );
+        // Disabling the value programs leaves all value nodes as is, this is only useful for comparisons against the value programs
+        bool CompileGraph( ToolsGraphDefinition const& editorGraph, bool compileValuePrograms = true );
 
         inline GraphDefinition const* GetCompiledGraph() const { return &m_runtimeGraph; }
         inline TVector<NodeCompilationLogEntry> const& GetLog() const { return m_context.m_log; }
@@ -245,6 +285,11 @@ namespace EE::Animation
         inline THashMap<UUID, int16_t> const& GetUUIDToRuntimeIndexMap() const { return m_context.m_nodeIDToIndexMap; }
         inline THashMap<int16_t, UUID> const& GetRuntimeIndexToUUIDMap() const { return m_context.m_nodeIndexToIDMap; }
 
+    private:
+
+        // Compile the graph, leaving out the supplied flattened value nodes
+        bool TryCompileGraph( ToolsGraphDefinition const& toolsGraph, TVector<UUID> const& flattenedNodeIDs, bool compileValuePrograms );
+
     private:
 
         GraphDefinition             m_runtimeGraph;
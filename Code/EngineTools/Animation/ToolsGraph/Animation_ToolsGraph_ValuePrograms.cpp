@@ -0,0 +1,473 @@
+#include "Animation_ToolsGraph_ValuePrograms.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Floats.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Bools.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_ConstValues.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    using namespace GraphNodes;
+    using Opcode = ValueProgram::Opcode;
+
+    //-------------------------------------------------------------------------
+
+    bool ValueProgramCompiler::IsFlattenableNode( GraphNode::Definition const* pDefinition )
+    {
+        return TryCast<FloatMathNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<FloatClampNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<FloatAbsNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<FloatRemapNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<FloatSwitchNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<ConstFloatNode::Definition>( pDefinition ) != nullptr ||
+               IsBoolNode( pDefinition );
+    }
+
+    bool ValueProgramCompiler::IsBoolNode( GraphNode::Definition const* pDefinition )
+    {
+        return TryCast<FloatComparisonNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<FloatRangeComparisonNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<AndNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<OrNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<NotNode::Definition>( pDefinition ) != nullptr ||
+               TryCast<ConstBoolNode::Definition>( pDefinition ) != nullptr;
+    }
+
+    void ValueProgramCompiler::GetNodeInputs( GraphNode::Definition const* pDefinition, TInlineVector<int16_t, 4>& outInputNodeIndices )
+    {
+        outInputNodeIndices.clear();
+
+        // Optional inputs are left unset
+        auto AddInput = [&outInputNodeIndices] ( int16_t nodeIdx )
+        {
+            if ( nodeIdx != InvalidIndex )
+            {
+                outInputNodeIndices.emplace_back( nodeIdx );
+            }
+        };
+
+        if ( auto pMathDefinition = TryCast<FloatMathNode::Definition>( pDefinition ) )
+        {
+            AddInput( pMathDefinition->m_inputValueNodeIdxA );
+            AddInput( pMathDefinition->m_inputValueNodeIdxB );
+        }
+        else if ( auto pClampDefinition = TryCast<FloatClampNode::Definition>( pDefinition ) )
+        {
+            AddInput( pClampDefinition->m_inputValueNodeIdx );
+        }
+        else if ( auto pAbsDefinition = TryCast<FloatAbsNode::Definition>( pDefinition ) )
+        {
+            AddInput( pAbsDefinition->m_inputValueNodeIdx );
+        }
+        else if ( auto pRemapDefinition = TryCast<FloatRemapNode::Definition>( pDefinition ) )
+        {
+            AddInput( pRemapDefinition->m_inputValueNodeIdx );
+        }
+        else if ( auto pSwitchDefinition = TryCast<FloatSwitchNode::Definition>( pDefinition ) )
+        {
+            AddInput( pSwitchDefinition->m_switchValueNodeIdx );
+            AddInput( pSwitchDefinition->m_trueValueNodeIdx );
+            AddInput( pSwitchDefinition->m_falseValueNodeIdx );
+        }
+        else if ( auto pComparisonDefinition = TryCast<FloatComparisonNode::Definition>( pDefinition ) )
+        {
+            AddInput( pComparisonDefinition->m_inputValueNodeIdx );
+            AddInput( pComparisonDefinition->m_comparandValueNodeIdx );
+        }
+        else if ( auto pRangeComparisonDefinition = TryCast<FloatRangeComparisonNode::Definition>( pDefinition ) )
+        {
+            AddInput( pRangeComparisonDefinition->m_inputValueNodeIdx );
+        }
+        else if ( auto pAndDefinition = TryCast<AndNode::Definition>( pDefinition ) )
+        {
+            outInputNodeIndices = pAndDefinition->m_conditionNodeIndices;
+        }
+        else if ( auto pOrDefinition = TryCast<OrNode::Definition>( pDefinition ) )
+        {
+            outInputNodeIndices = pOrDefinition->m_conditionNodeIndices;
+        }
+        else if ( auto pNotDefinition = TryCast<NotNode::Definition>( pDefinition ) )
+        {
+            AddInput( pNotDefinition->m_inputValueNodeIdx );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    GraphNode::Definition const* ValueProgramCompiler::GetDefinition( int16_t nodeIdx ) const
+    {
+        if ( IsFlattenedNodeIndex( nodeIdx ) )
+        {
+            int32_t const flattenedDefinitionIdx = GetFlattenedDefinitionIndex( nodeIdx );
+            EE_ASSERT( flattenedDefinitionIdx < (int32_t) m_flattenedNodeDefinitions.size() );
+            return m_flattenedNodeDefinitions[flattenedDefinitionIdx];
+        }
+
+        EE_ASSERT( nodeIdx >= 0 && nodeIdx < (int16_t) m_nodeDefinitions.size() );
+        return m_nodeDefinitions[nodeIdx];
+    }
+
+    bool ValueProgramCompiler::TryCompile( int16_t rootNodeIdx, ValueProgram& outProgram )
+    {
+        EE_ASSERT( rootNodeIdx >= 0 && IsFlattenableNode( m_nodeDefinitions[rootNodeIdx] ) );
+
+        outProgram = ValueProgram();
+        m_pProgram = &outProgram;
+        m_numFlattenedNodes = 0;
+        m_numFoldedNodes = 0;
+        m_hasFailed = false;
+
+        Result const result = Emit( rootNodeIdx, 0, IsBoolNode( m_nodeDefinitions[rootNodeIdx] ) );
+        LoadIfConstant( result, 0 );
+        m_pProgram = nullptr;
+
+        return !m_hasFailed && outProgram.IsValid();
+    }
+
+    //-------------------------------------------------------------------------
+
+    ValueProgramCompiler::Result ValueProgramCompiler::Emit( int16_t nodeIdx, int32_t resultRegister, bool isBoolValue )
+    {
+        if ( m_hasFailed || !UseRegister( resultRegister ) )
+        {
+            return Result();
+        }
+
+        GraphNode::Definition const* pDefinition = GetDefinition( nodeIdx );
+
+        // Inputs
+        //-------------------------------------------------------------------------
+
+        if ( !IsFlattenableNode( pDefinition ) )
+        {
+            // Program inputs are pulled at runtime so they always need to be instantiated
+            EE_ASSERT( !IsFlattenedNodeIndex( nodeIdx ) );
+
+            int32_t inputIdx = VectorFindIndex( m_pProgram->m_inputNodeIndices, nodeIdx );
+            if ( inputIdx == InvalidIndex )
+            {
+                inputIdx = (int32_t) m_pProgram->m_inputNodeIndices.size();
+                m_pProgram->m_inputNodeIndices.emplace_back( nodeIdx );
+            }
+
+            EmitInstruction( isBoolValue ? Opcode::LoadBoolInput : Opcode::LoadFloatInput, resultRegister, 0, 0, inputIdx );
+            return Result();
+        }
+
+        EE_ASSERT( IsBoolNode( pDefinition ) == isBoolValue );
+        m_numFlattenedNodes++;
+
+        // Constants
+        //-------------------------------------------------------------------------
+
+        if ( auto pConstFloatDefinition = TryCast<ConstFloatNode::Definition>( pDefinition ) )
+        {
+            m_numFoldedNodes++;
+            return { true, pConstFloatDefinition->m_value };
+        }
+
+        if ( auto pConstBoolDefinition = TryCast<ConstBoolNode::Definition>( pDefinition ) )
+        {
+            m_numFoldedNodes++;
+            return { true, pConstBoolDefinition->m_value ? 1.0f : 0.0f };
+        }
+
+        // Operations
+        //-------------------------------------------------------------------------
+
+        if ( TryCast<FloatMathNode::Definition>( pDefinition ) != nullptr )
+        {
+            return EmitMath( pDefinition, resultRegister );
+        }
+
+        if ( auto pClampDefinition = TryCast<FloatClampNode::Definition>( pDefinition ) )
+        {
+            float const constants[2] = { pClampDefinition->m_clampRange.m_begin, pClampDefinition->m_clampRange.m_end };
+            return EmitUnaryOperation( Opcode::Clamp, pClampDefinition->m_inputValueNodeIdx, false, constants, 2, resultRegister );
+        }
+
+        if ( auto pAbsDefinition = TryCast<FloatAbsNode::Definition>( pDefinition ) )
+        {
+            return EmitUnaryOperation( Opcode::Abs, pAbsDefinition->m_inputValueNodeIdx, false, nullptr, 0, resultRegister );
+        }
+
+        if ( auto pRemapDefinition = TryCast<FloatRemapNode::Definition>( pDefinition ) )
+        {
+            float const constants[4] = { pRemapDefinition->m_inputRange.m_begin, pRemapDefinition->m_inputRange.m_end, pRemapDefinition->m_outputRange.m_begin, pRemapDefinition->m_outputRange.m_end };
+            return EmitUnaryOperation( Opcode::Remap, pRemapDefinition->m_inputValueNodeIdx, false, constants, 4, resultRegister );
+        }
+
+        if ( TryCast<FloatSwitchNode::Definition>( pDefinition ) != nullptr )
+        {
+            return EmitSwitch( pDefinition, resultRegister );
+        }
+
+        if ( TryCast<FloatComparisonNode::Definition>( pDefinition ) != nullptr )
+        {
+            return EmitComparison( pDefinition, resultRegister );
+        }
+
+        if ( auto pRangeComparisonDefinition = TryCast<FloatRangeComparisonNode::Definition>( pDefinition ) )
+        {
+            float const constants[2] = { pRangeComparisonDefinition->m_range.m_begin, pRangeComparisonDefinition->m_range.m_end };
+            Opcode const opcode = pRangeComparisonDefinition->m_isInclusiveCheck ? Opcode::InRangeInclusive : Opcode::InRangeExclusive;
+            return EmitUnaryOperation( opcode, pRangeComparisonDefinition->m_inputValueNodeIdx, false, constants, 2, resultRegister );
+        }
+
+        if ( auto pAndDefinition = TryCast<AndNode::Definition>( pDefinition ) )
+        {
+            return EmitLogic( pAndDefinition->m_conditionNodeIndices, true, resultRegister );
+        }
+
+        if ( auto pOrDefinition = TryCast<OrNode::Definition>( pDefinition ) )
+        {
+            return EmitLogic( pOrDefinition->m_conditionNodeIndices, false, resultRegister );
+        }
+
+        if ( auto pNotDefinition = TryCast<NotNode::Definition>( pDefinition ) )
+        {
+            return EmitUnaryOperation( Opcode::Not, pNotDefinition->m_inputValueNodeIdx, true, nullptr, 0, resultRegister );
+        }
+
+        EE_UNREACHABLE_CODE();
+        return Result();
+    }
+
+    ValueProgramCompiler::Result ValueProgramCompiler::EmitMath( GraphNode::Definition const* pDefinition, int32_t resultRegister )
+    {
+        auto pMathDefinition = Cast<FloatMathNode::Definition>( pDefinition );
+
+        Opcode opcode = Opcode::Add;
+        switch ( pMathDefinition->m_operator )
+        {
+            case FloatMathNode::Operator::Add: opcode = Opcode::Add; break;
+            case FloatMathNode::Operator::Sub: opcode = Opcode::Sub; break;
+            case FloatMathNode::Operator::Mul: opcode = Opcode::Mul; break;
+            case FloatMathNode::Operator::Div: opcode = Opcode::Div; break;
+        }
+
+        Result const a = Emit( pMathDefinition->m_inputValueNodeIdxA, resultRegister, false );
+        Result const b = ( pMathDefinition->m_inputValueNodeIdxB != InvalidIndex ) ? Emit( pMathDefinition->m_inputValueNodeIdxB, resultRegister + 1, false ) : Result{ true, pMathDefinition->m_valueB };
+
+        if ( a.m_isConstant && b.m_isConstant )
+        {
+            m_numFoldedNodes++;
+            float const value = ValueProgram::EvaluateOperation( opcode, a.m_value, b.m_value, nullptr );
+            return { true, pMathDefinition->m_returnAbsoluteResult ? Math::Abs( value ) : value };
+        }
+
+        LoadIfConstant( a, resultRegister );
+        LoadIfConstant( b, resultRegister + 1 );
+        EmitInstruction( opcode, resultRegister, resultRegister, resultRegister + 1 );
+
+        if ( pMathDefinition->m_returnAbsoluteResult )
+        {
+            EmitInstruction( Opcode::Abs, resultRegister, resultRegister, resultRegister );
+        }
+
+        return Result();
+    }
+
+    ValueProgramCompiler::Result ValueProgramCompiler::EmitComparison( GraphNode::Definition const* pDefinition, int32_t resultRegister )
+    {
+        auto pComparisonDefinition = Cast<FloatComparisonNode::Definition>( pDefinition );
+
+        Opcode opcode = Opcode::GreaterThanEqual;
+        switch ( pComparisonDefinition->m_comparison )
+        {
+            case FloatComparisonNode::Comparison::GreaterThanEqual: opcode = Opcode::GreaterThanEqual; break;
+            case FloatComparisonNode::Comparison::LessThanEqual: opcode = Opcode::LessThanEqual; break;
+            case FloatComparisonNode::Comparison::NearEqual: opcode = Opcode::NearEqual; break;
+            case FloatComparisonNode::Comparison::GreaterThan: opcode = Opcode::GreaterThan; break;
+            case FloatComparisonNode::Comparison::LessThan: opcode = Opcode::LessThan; break;
+        }
+
+        Result const a = Emit( pComparisonDefinition->m_inputValueNodeIdx, resultRegister, false );
+        Result const b = ( pComparisonDefinition->m_comparandValueNodeIdx != InvalidIndex ) ? Emit( pComparisonDefinition->m_comparandValueNodeIdx, resultRegister + 1, false ) : Result{ true, pComparisonDefinition->m_comparisonValue };
+
+        if ( a.m_isConstant && b.m_isConstant )
+        {
+            m_numFoldedNodes++;
+            return { true, ValueProgram::EvaluateOperation( opcode, a.m_value, b.m_value, &pComparisonDefinition->m_epsilon ) };
+        }
+
+        LoadIfConstant( a, resultRegister );
+        LoadIfConstant( b, resultRegister + 1 );
+        uint16_t const epsilonIdx = ( opcode == Opcode::NearEqual ) ? AddConstants( &pComparisonDefinition->m_epsilon, 1 ) : 0;
+        EmitInstruction( opcode, resultRegister, resultRegister, resultRegister + 1, epsilonIdx );
+        return Result();
+    }
+
+    ValueProgramCompiler::Result ValueProgramCompiler::EmitSwitch( GraphNode::Definition const* pDefinition, int32_t resultRegister )
+    {
+        auto pSwitchDefinition = Cast<FloatSwitchNode::Definition>( pDefinition );
+
+        Result const condition = Emit( pSwitchDefinition->m_switchValueNodeIdx, resultRegister, true );
+        if ( condition.m_isConstant )
+        {
+            m_numFoldedNodes++;
+            return Emit( ( condition.m_value != 0.0f ) ? pSwitchDefinition->m_trueValueNodeIdx : pSwitchDefinition->m_falseValueNodeIdx, resultRegister, false );
+        }
+
+        // Only the selected branch is evaluated
+        int32_t const falseJumpIdx = EmitJump( Opcode::JumpIfFalse, resultRegister );
+        LoadIfConstant( Emit( pSwitchDefinition->m_trueValueNodeIdx, resultRegister, false ), resultRegister );
+        int32_t const endJumpIdx = EmitJump( Opcode::Jump, 0 );
+        PatchJump( falseJumpIdx );
+        LoadIfConstant( Emit( pSwitchDefinition->m_falseValueNodeIdx, resultRegister, false ), resultRegister );
+        PatchJump( endJumpIdx );
+        return Result();
+    }
+
+    ValueProgramCompiler::Result ValueProgramCompiler::EmitLogic( TInlineVector<int16_t, 4> const& conditionNodeIndices, bool isAnd, int32_t resultRegister )
+    {
+        // And: constant true conditions are dropped and a constant false condition ends the evaluation, the reverse for Or
+        float const shortCircuitValue = isAnd ? 0.0f : 1.0f;
+        Opcode const shortCircuitJump = isAnd ? Opcode::JumpIfFalse : Opcode::JumpIfTrue;
+
+        TInlineVector<int32_t, 4> jumpsToEnd;
+        for ( auto conditionNodeIdx : conditionNodeIndices )
+        {
+            Result const condition = Emit( conditionNodeIdx, resultRegister, true );
+            if ( condition.m_isConstant )
+            {
+                if ( ( condition.m_value != 0.0f ) == isAnd )
+                {
+                    continue;
+                }
+
+                if ( jumpsToEnd.empty() )
+                {
+                    m_numFoldedNodes++;
+                    return { true, shortCircuitValue };
+                }
+
+                LoadIfConstant( condition, resultRegister );
+                break;
+            }
+
+            jumpsToEnd.emplace_back( EmitJump( shortCircuitJump, resultRegister ) );
+        }
+
+        if ( jumpsToEnd.empty() )
+        {
+            m_numFoldedNodes++;
+            return { true, 1.0f - shortCircuitValue };
+        }
+
+        // If we didnt short circuit, the register holds the value of the last evaluated condition which is the result
+        for ( auto jumpIdx : jumpsToEnd )
+        {
+            PatchJump( jumpIdx );
+        }
+
+        return Result();
+    }
+
+    ValueProgramCompiler::Result ValueProgramCompiler::EmitUnaryOperation( Opcode opcode, int16_t inputNodeIdx, bool isBoolInput, float const* pConstants, int32_t numConstants, int32_t resultRegister )
+    {
+        Result const input = Emit( inputNodeIdx, resultRegister, isBoolInput );
+        if ( input.m_isConstant )
+        {
+            m_numFoldedNodes++;
+            return { true, ValueProgram::EvaluateOperation( opcode, input.m_value, input.m_value, pConstants ) };
+        }
+
+        uint16_t const constantsIdx = ( numConstants > 0 ) ? AddConstants( pConstants, numConstants ) : 0;
+        EmitInstruction( opcode, resultRegister, resultRegister, resultRegister, constantsIdx );
+        return Result();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ValueProgramCompiler::EmitInstruction( Opcode opcode, int32_t resultRegister, int32_t registerA, int32_t registerB, int32_t data )
+    {
+        if ( m_hasFailed )
+        {
+            return;
+        }
+
+        // Large trees (or heavily shared sub-trees) are left as nodes
+        if ( m_pProgram->m_instructions.size() >= ValueProgram::s_maxInstructions )
+        {
+            m_hasFailed = true;
+            return;
+        }
+
+        EE_ASSERT( data >= 0 && data <= 0xFFFF );
+        auto& instruction = m_pProgram->m_instructions.emplace_back();
+        instruction.m_opcode = opcode;
+        instruction.m_result = (uint8_t) resultRegister;
+        instruction.m_a = (uint8_t) registerA;
+        instruction.m_b = (uint8_t) registerB;
+        instruction.m_data = (uint16_t) data;
+    }
+
+    int32_t ValueProgramCompiler::EmitJump( Opcode opcode, int32_t conditionRegister )
+    {
+        EmitInstruction( opcode, 0, conditionRegister, conditionRegister );
+        return (int32_t) m_pProgram->m_instructions.size() - 1;
+    }
+
+    void ValueProgramCompiler::PatchJump( int32_t jumpInstructionIdx )
+    {
+        if ( m_hasFailed )
+        {
+            return;
+        }
+
+        EE_ASSERT( jumpInstructionIdx >= 0 && jumpInstructionIdx < (int32_t) m_pProgram->m_instructions.size() );
+        m_pProgram->m_instructions[jumpInstructionIdx].m_data = (uint16_t) m_pProgram->m_instructions.size();
+    }
+
+    void ValueProgramCompiler::LoadIfConstant( Result const& result, int32_t resultRegister )
+    {
+        if ( result.m_isConstant && UseRegister( resultRegister ) )
+        {
+            EmitInstruction( Opcode::LoadConstant, resultRegister, 0, 0, AddConstants( &result.m_value, 1 ) );
+        }
+    }
+
+    bool ValueProgramCompiler::UseRegister( int32_t registerIdx )
+    {
+        if ( registerIdx >= ValueProgram::s_maxRegisters )
+        {
+            m_hasFailed = true;
+            return false;
+        }
+
+        m_pProgram->m_numRegisters = (uint8_t) Math::Max( (int32_t) m_pProgram->m_numRegisters, registerIdx + 1 );
+        return true;
+    }
+
+    uint16_t ValueProgramCompiler::AddConstants( float const* pConstants, int32_t numConstants )
+    {
+        EE_ASSERT( pConstants != nullptr && numConstants > 0 );
+
+        // Reuse existing constants
+        auto& constants = m_pProgram->m_constants;
+        for ( int32_t i = 0; i + numConstants <= (int32_t) constants.size(); i++ )
+        {
+            int32_t numMatching = 0;
+            while ( numMatching < numConstants && constants[i + numMatching] == pConstants[numMatching] )
+            {
+                numMatching++;
+            }
+
+            if ( numMatching == numConstants )
+            {
+                return (uint16_t) i;
+            }
+        }
+
+        int32_t const constantsIdx = (int32_t) constants.size();
+        if ( constantsIdx + numConstants > 0xFFFF )
+        {
+            m_hasFailed = true;
+            return 0;
+        }
+
+        constants.insert( constants.end(), pConstants, pConstants + numConstants );
+        return (uint16_t) constantsIdx;
+    }
+}
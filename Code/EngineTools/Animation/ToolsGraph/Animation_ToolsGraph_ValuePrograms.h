@@ -0,0 +1,79 @@
+#pragma once
+#include "EngineTools/_Module/API.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_ValuePrograms.h"
+
+//-------------------------------------------------------------------------
+// Value Program Compiler
+//-------------------------------------------------------------------------
+// Flattens a tree of stateless value node definitions into a value program.
+// Constant sub-trees are folded, switches and logic nodes keep their lazy evaluation through jumps.
+// Any non-flattenable node (parameters, stateful nodes, etc.) is treated as an input and pulled as a node at runtime.
+
+namespace EE::Animation
+{
+    class EE_ENGINETOOLS_API ValueProgramCompiler
+    {
+        struct Result
+        {
+            bool                                    m_isConstant = false;
+            float                                   m_value = 0.0f;
+        };
+
+    public:
+
+        // Can this node definition be flattened into a value program
+        static bool IsFlattenableNode( GraphNode::Definition const* pDefinition );
+
+        // Does this flattenable node produce a bool value
+        static bool IsBoolNode( GraphNode::Definition const* pDefinition );
+
+        // Get all the node indices referenced by a flattenable node
+        static void GetNodeInputs( GraphNode::Definition const* pDefinition, TInlineVector<int16_t, 4>& outInputNodeIndices );
+
+        // Nodes that only exist within value programs are never instantiated, their definitions are kept in a separate list and referenced through negative indices
+        static bool IsFlattenedNodeIndex( int16_t nodeIdx ) { return nodeIdx < InvalidIndex; }
+        static int16_t GetFlattenedNodeIndex( int32_t flattenedDefinitionIdx ) { return int16_t( InvalidIndex - 1 - flattenedDefinitionIdx ); }
+        static int32_t GetFlattenedDefinitionIndex( int16_t nodeIdx ) { EE_ASSERT( IsFlattenedNodeIndex( nodeIdx ) ); return InvalidIndex - 1 - nodeIdx; }
+
+    public:
+
+        ValueProgramCompiler( TVector<GraphNode::Definition*> const& nodeDefinitions, TVector<GraphNode::Definition*> const& flattenedNodeDefinitions )
+            : m_nodeDefinitions( nodeDefinitions )
+            , m_flattenedNodeDefinitions( flattenedNodeDefinitions )
+        {}
+
+        // Try to compile a program for the tree starting at the supplied node, this can fail if the tree is too big
+        bool TryCompile( int16_t rootNodeIdx, GraphNodes::ValueProgram& outProgram );
+
+        // Stats for the last compiled program
+        inline int32_t GetNumFlattenedNodes() const { return m_numFlattenedNodes; }
+        inline int32_t GetNumFoldedNodes() const { return m_numFoldedNodes; }
+
+    private:
+
+        GraphNode::Definition const* GetDefinition( int16_t nodeIdx ) const;
+
+        Result Emit( int16_t nodeIdx, int32_t resultRegister, bool isBoolValue );
+        Result EmitMath( GraphNode::Definition const* pDefinition, int32_t resultRegister );
+        Result EmitComparison( GraphNode::Definition const* pDefinition, int32_t resultRegister );
+        Result EmitSwitch( GraphNode::Definition const* pDefinition, int32_t resultRegister );
+        Result EmitLogic( TInlineVector<int16_t, 4> const& conditionNodeIndices, bool isAnd, int32_t resultRegister );
+        Result EmitUnaryOperation( GraphNodes::ValueProgram::Opcode opcode, int16_t inputNodeIdx, bool isBoolInput, float const* pConstants, int32_t numConstants, int32_t resultRegister );
+
+        void EmitInstruction( GraphNodes::ValueProgram::Opcode opcode, int32_t resultRegister, int32_t registerA = 0, int32_t registerB = 0, int32_t data = 0 );
+        int32_t EmitJump( GraphNodes::ValueProgram::Opcode opcode, int32_t conditionRegister );
+        void PatchJump( int32_t jumpInstructionIdx );
+        void LoadIfConstant( Result const& result, int32_t resultRegister );
+        bool UseRegister( int32_t registerIdx );
+        uint16_t AddConstants( float const* pConstants, int32_t numConstants );
+
+    private:
+
+        TVector<GraphNode::Definition*> const&      m_nodeDefinitions;
+        TVector<GraphNode::Definition*> const&      m_flattenedNodeDefinitions;
+        GraphNodes::ValueProgram*                   m_pProgram = nullptr;
+        int32_t                                     m_numFlattenedNodes = 0;
+        int32_t                                     m_numFoldedNodes = 0;
+        bool                                        m_hasFailed = false;
+    };
+}
@@ -46,6 +46,10 @@ namespace EE::Animation
 
         EE_REFLECT()
         TResourcePtr<Skeleton>  m_skeleton;
+
+        // The number of graph instances created when the variation is loaded, these are reused when characters are spawned and despawned
+        EE_REFLECT()
+        int32_t                 m_instancePoolSize = 0;
     };
 
     //-------------------------------------------------------------------------
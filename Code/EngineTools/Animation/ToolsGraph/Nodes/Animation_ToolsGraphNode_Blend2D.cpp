@@ -240,6 +240,118 @@ namespace EE::Animation::GraphNodes
         m_blendSpace.GenerateTriangulation();
     }
 
+    // Does the triangle overlap the axis aligned rectangle (separating axis test)
+    static bool DoesTriangleOverlapRect( Float2 const triangle[3], Float2 const& rectMin, Float2 const& rectMax )
+    {
+        // Rect axes
+        for ( int32_t axis = 0; axis < 2; axis++ )
+        {
+            float const triangleMin = Math::Min( triangle[0][axis], Math::Min( triangle[1][axis], triangle[2][axis] ) );
+            float const triangleMax = Math::Max( triangle[0][axis], Math::Max( triangle[1][axis], triangle[2][axis] ) );
+            if ( triangleMax < rectMin[axis] || triangleMin > rectMax[axis] )
+            {
+                return false;
+            }
+        }
+
+        // Triangle edge axes
+        Float2 const rectCorners[4] = { rectMin, Float2( rectMax.m_x, rectMin.m_y ), rectMax, Float2( rectMin.m_x, rectMax.m_y ) };
+        for ( int32_t i = 0; i < 3; i++ )
+        {
+            Float2 const& edgeStart = triangle[i];
+            Float2 const& edgeEnd = triangle[( i + 1 ) % 3];
+            Float2 const& oppositeVertex = triangle[( i + 2 ) % 3];
+            Float2 const normal( edgeStart.m_y - edgeEnd.m_y, edgeEnd.m_x - edgeStart.m_x );
+
+            auto GetSide = [&] ( Float2 const& p ) { return ( ( p.m_x - edgeStart.m_x ) * normal.m_x ) + ( ( p.m_y - edgeStart.m_y ) * normal.m_y ); };
+            float const triangleSide = GetSide( oppositeVertex );
+
+            bool isSeparated = true;
+            for ( auto const& corner : rectCorners )
+            {
+                if ( GetSide( corner ) * triangleSide >= 0.0f )
+                {
+                    isSeparated = false;
+                    break;
+                }
+            }
+
+            if ( isSeparated )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Bake a uniform grid over the bounds of the blend space so that the runtime node only needs to test a few triangles to locate the parameter
+    static void BakeTriangleGrid( Blend2DNode::Definition* pDefinition )
+    {
+        int32_t const numTriangles = pDefinition->GetNumTriangles();
+        EE_ASSERT( numTriangles > 0 && numTriangles < 255 );
+
+        // Bounds
+        //-------------------------------------------------------------------------
+
+        Float2 boundsMin( FLT_MAX );
+        Float2 boundsMax( -FLT_MAX );
+        for ( auto const& value : pDefinition->m_values )
+        {
+            boundsMin = Float2( Math::Min( boundsMin.m_x, value.m_x ), Math::Min( boundsMin.m_y, value.m_y ) );
+            boundsMax = Float2( Math::Max( boundsMax.m_x, value.m_x ), Math::Max( boundsMax.m_y, value.m_y ) );
+        }
+
+        // Pad the bounds so that points on the hull never fall outside the grid
+        constexpr static float const boundsPadding = 0.001f;
+        boundsMin = boundsMin - Float2( boundsPadding );
+        boundsMax = boundsMax + Float2( boundsPadding );
+
+        // Aim for roughly one triangle per cell
+        int32_t const numCellsPerAxis = Math::Clamp( Math::CeilingToInt( Math::Sqrt( (float) numTriangles ) ), 1, 16 );
+        pDefinition->m_gridMin = boundsMin;
+        pDefinition->m_gridCellSize = Float2( ( boundsMax.m_x - boundsMin.m_x ) / numCellsPerAxis, ( boundsMax.m_y - boundsMin.m_y ) / numCellsPerAxis );
+        pDefinition->m_gridNumCellsX = (uint8_t) numCellsPerAxis;
+        pDefinition->m_gridNumCellsY = (uint8_t) numCellsPerAxis;
+
+        // Fill cells
+        //-------------------------------------------------------------------------
+
+        pDefinition->m_gridCellOffsets.clear();
+        pDefinition->m_gridTriangles.clear();
+
+        for ( int32_t y = 0; y < numCellsPerAxis; y++ )
+        {
+            for ( int32_t x = 0; x < numCellsPerAxis; x++ )
+            {
+                // Expand the cells slightly to be conservative with regards to triangle edges
+                Float2 const cellMin( boundsMin.m_x + ( x * pDefinition->m_gridCellSize.m_x ) - boundsPadding, boundsMin.m_y + ( y * pDefinition->m_gridCellSize.m_y ) - boundsPadding );
+                Float2 const cellMax = cellMin + pDefinition->m_gridCellSize + Float2( 2 * boundsPadding );
+
+                pDefinition->m_gridCellOffsets.emplace_back( (uint16_t) pDefinition->m_gridTriangles.size() );
+
+                for ( int32_t triangleIdx = 0; triangleIdx < numTriangles; triangleIdx++ )
+                {
+                    Float2 const triangle[3] =
+                    {
+                        pDefinition->m_values[pDefinition->m_indices[triangleIdx * 3]],
+                        pDefinition->m_values[pDefinition->m_indices[triangleIdx * 3 + 1]],
+                        pDefinition->m_values[pDefinition->m_indices[triangleIdx * 3 + 2]]
+                    };
+
+                    if ( DoesTriangleOverlapRect( triangle, cellMin, cellMax ) )
+                    {
+                        pDefinition->m_gridTriangles.emplace_back( (uint8_t) triangleIdx );
+                    }
+                }
+            }
+        }
+
+        pDefinition->m_gridCellOffsets.emplace_back( (uint16_t) pDefinition->m_gridTriangles.size() );
+    }
+
+    //-------------------------------------------------------------------------
+
     int16_t Blend2DToolsNode::Compile( GraphCompilationContext & context ) const
     {
         Blend2DNode::Definition* pDefinition = nullptr;
@@ -346,6 +458,8 @@ namespace EE::Animation::GraphNodes
             {
                 pDefinition->m_hullIndices.emplace_back( index );
             }
+
+            BakeTriangleGrid( pDefinition );
         }
 
         return pDefinition->m_nodeIdx;
@@ -38,6 +38,9 @@ namespace EE::EntityModel
     //-------------------------------------------------------------------------
     // Reading
     //-------------------------------------------------------------------------
+    // Collections are read with a streaming (SAX) parser directly into the entity descriptors, we never build a JSON document for the whole file.
+    // The file is parsed in-situ so all parsed strings point into the file buffer, the raw entity data below only stores these pointers and
+    // is reused for every entity. Each entity is validated and converted as soon as its JSON object ends.
 
     namespace
     {
@@ -74,17 +77,166 @@ namespace EE::EntityModel
 
         //-------------------------------------------------------------------------
 
-        static bool ReadAndConvertPropertyValue( ParsingContext& ctx, TypeSystem::TypeInfo const* pTypeInfo, Serialization::JsonValue::ConstMemberIterator memberIter, TypeSystem::PropertyDescriptor& outPropertyDesc )
+        // Unvalidated entity data as found in the file, all strings point into the in-situ parsed file buffer
+        struct RawComponentData
         {
-            if ( !memberIter->value.IsString() )
+            inline void Reset()
             {
-                return Warning( "Property value for (%s) must be a string value.", memberIter->name.GetString() );
+                m_pName = m_pTypeID = m_pSpatialParent = m_pAttachmentSocketID = nullptr;
+                m_hasTypeData = false;
+                m_properties.clear();
+            }
+
+        public:
+
+            char const*                                 m_pName = nullptr;
+            char const*                                 m_pTypeID = nullptr;
+            char const*                                 m_pSpatialParent = nullptr;
+            char const*                                 m_pAttachmentSocketID = nullptr;
+            bool                                        m_hasTypeData = false;
+
+            // Property path and value, the value is null if it was not a string
+            TVector<TPair<char const*, char const*>>    m_properties;
+        };
+
+        struct RawEntityData
+        {
+            inline void Reset()
+            {
+                m_pName = m_pSpatialParent = m_pAttachmentSocketID = nullptr;
+                m_numComponents = 0;
+                m_systemTypeIDs.clear();
+            }
+
+            // Components are never removed so that their property storage is reused for the next entities
+            inline RawComponentData& AddComponent()
+            {
+                if ( m_numComponents == (int32_t) m_components.size() )
+                {
+                    m_components.emplace_back();
+                }
+
+                RawComponentData& component = m_components[m_numComponents++];
+                component.Reset();
+                return component;
+            }
+
+        public:
+
+            char const*                                 m_pName = nullptr;
+            char const*                                 m_pSpatialParent = nullptr;
+            char const*                                 m_pAttachmentSocketID = nullptr;
+            TVector<RawComponentData>                   m_components;
+            int32_t                                     m_numComponents = 0;
+            TVector<char const*>                        m_systemTypeIDs; // Null if the type ID was not a string
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Json parser allocator that tracks the current and peak memory allocated through it
+        // Rapidjson frees memory through a static function so each allocation stores its owner and size in a header
+        class CountingJsonAllocator
+        {
+            struct alignas( 16 ) Header
+            {
+                CountingJsonAllocator*                  m_pOwner;
+                size_t                                  m_size;
+            };
+
+        public:
+
+            static bool const kNeedFree = true;
+
+            inline size_t GetPeakMemory() const { return m_peakMemory; }
+
+            void* Malloc( size_t size )
+            {
+                if ( size == 0 )
+                {
+                    return nullptr;
+                }
+
+                auto pHeader = (Header*) EE::Alloc( sizeof( Header ) + size, alignof( Header ) );
+                pHeader->m_pOwner = this;
+                pHeader->m_size = size;
+                TrackAllocation( size );
+                return pHeader + 1;
+            }
+
+            void* Realloc( void* pOriginalMemory, size_t originalSize, size_t newSize )
+            {
+                if ( pOriginalMemory == nullptr )
+                {
+                    return Malloc( newSize );
+                }
+
+                if ( newSize == 0 )
+                {
+                    Free( pOriginalMemory );
+                    return nullptr;
+                }
+
+                auto pHeader = ( (Header*) pOriginalMemory ) - 1;
+                EE_ASSERT( pHeader->m_pOwner == this );
+                m_currentMemory -= pHeader->m_size;
+
+                pHeader = (Header*) EE::Realloc( pHeader, sizeof( Header ) + newSize, alignof( Header ) );
+                pHeader->m_size = newSize;
+                TrackAllocation( newSize );
+                return pHeader + 1;
+            }
+
+            static void Free( void* pMemory )
+            {
+                if ( pMemory == nullptr )
+                {
+                    return;
+                }
+
+                auto pHeader = ( (Header*) pMemory ) - 1;
+                pHeader->m_pOwner->m_currentMemory -= pHeader->m_size;
+
+                void* pAllocation = pHeader;
+                EE::Free( pAllocation );
+            }
+
+            inline bool operator==( CountingJsonAllocator const& rhs ) const { return this == &rhs; }
+            inline bool operator!=( CountingJsonAllocator const& rhs ) const { return this != &rhs; }
+
+        private:
+
+            inline void TrackAllocation( size_t size )
+            {
+                m_currentMemory += size;
+                m_peakMemory = Math::Max( m_peakMemory, m_currentMemory );
+            }
+
+        private:
+
+            size_t                                      m_currentMemory = 0;
+            size_t                                      m_peakMemory = 0;
+        };
+
+        using CountingJsonDocument = rapidjson::GenericDocument<rapidjson::UTF8<>, rapidjson::MemoryPoolAllocator<CountingJsonAllocator>, CountingJsonAllocator>;
+        using CountingJsonValue = CountingJsonDocument::ValueType;
+
+        //-------------------------------------------------------------------------
+
+        static bool IsValidString( char const* pString )
+        {
+            return pString != nullptr && pString[0] != 0;
+        }
+
+        static bool ReadAndConvertPropertyValue( ParsingContext& ctx, TypeSystem::TypeInfo const* pTypeInfo, char const* pPropertyPath, char const* pPropertyValue, TypeSystem::PropertyDescriptor& outPropertyDesc )
+        {
+            if ( pPropertyValue == nullptr )
+            {
+                return Warning( "Property value for (%s) must be a string value.", pPropertyPath );
             }
 
             //-------------------------------------------------------------------------
 
-            EE_ASSERT( !memberIter->value.IsArray() ); // TODO: arrays not supported yet
-            outPropertyDesc = TypeSystem::PropertyDescriptor( TypeSystem::PropertyPath( memberIter->name.GetString() ), memberIter->value.GetString(), TypeSystem::TypeID() );
+            outPropertyDesc = TypeSystem::PropertyDescriptor( TypeSystem::PropertyPath( pPropertyPath ), pPropertyValue, TypeSystem::TypeID() );
 
             //-------------------------------------------------------------------------
 
@@ -108,37 +260,32 @@ namespace EE::EntityModel
             return true;
         }
 
-        static bool ReadComponent( ParsingContext& ctx, Serialization::JsonValue const& componentObject, SerializedComponentDescriptor& outComponentDesc )
+        static bool ReadComponent( ParsingContext& ctx, RawComponentData const& rawComponent, SerializedComponentDescriptor& outComponentDesc )
         {
             // Read name and ID
             //-------------------------------------------------------------------------
 
-            auto nameIter = componentObject.FindMember( "Name" );
-            if ( nameIter == componentObject.MemberEnd() || !nameIter->value.IsString() || nameIter->value.GetStringLength() == 0 )
+            if ( !IsValidString( rawComponent.m_pName ) )
             {
                 return Error( "Invalid entity component format detected for entity (%s): components must have ID, Name and TypeID string values set", ctx.m_parsingContextName.c_str() );
             }
 
-            outComponentDesc.m_name = StringID( nameIter->value.GetString() );
+            outComponentDesc.m_name = StringID( rawComponent.m_pName );
 
             // Validate type ID
             //-------------------------------------------------------------------------
 
-            auto typeDataIter = componentObject.FindMember( "TypeData" );
-            if ( typeDataIter == componentObject.MemberEnd() || !typeDataIter->value.IsObject() )
+            if ( !rawComponent.m_hasTypeData )
             {
                 return Error( "Invalid entity component format detected for entity (%s): components must have ID, Name and Type Data values set", ctx.m_parsingContextName.c_str() );
             }
 
-            Serialization::JsonValue const& componentTypeDataObject = typeDataIter->value;
-
-            auto typeIDIter = componentTypeDataObject.FindMember( Serialization::s_typeIDKey );
-            if ( typeIDIter == componentTypeDataObject.MemberEnd() || !typeIDIter->value.IsString() )
+            if ( rawComponent.m_pTypeID == nullptr )
             {
-                return Error( "Invalid type data found for component: '%s' on entity %s!", nameIter->value.GetString(), ctx.m_parsingContextName.c_str() );
+                return Error( "Invalid type data found for component: '%s' on entity %s!", rawComponent.m_pName, ctx.m_parsingContextName.c_str() );
             }
 
-            outComponentDesc.m_typeID = StringID( typeIDIter->value.GetString() );
+            outComponentDesc.m_typeID = StringID( rawComponent.m_pTypeID );
 
             // Spatial component info
             //-------------------------------------------------------------------------
@@ -153,16 +300,14 @@ namespace EE::EntityModel
 
             if ( outComponentDesc.m_isSpatialComponent )
             {
-                auto spatialParentIter = componentObject.FindMember( "SpatialParent" );
-                if ( spatialParentIter != componentObject.MemberEnd() && spatialParentIter->value.IsString() )
+                if ( rawComponent.m_pSpatialParent != nullptr )
                 {
-                    outComponentDesc.m_spatialParentName = StringID( spatialParentIter->value.GetString() );
+                    outComponentDesc.m_spatialParentName = StringID( rawComponent.m_pSpatialParent );
                 }
 
-                auto attachmentSocketIter = componentObject.FindMember( "AttachmentSocketID" );
-                if ( attachmentSocketIter != componentObject.MemberEnd() && attachmentSocketIter->value.IsString() )
+                if ( rawComponent.m_pAttachmentSocketID != nullptr )
                 {
-                    outComponentDesc.m_attachmentSocketID = StringID( attachmentSocketIter->value.GetString() );
+                    outComponentDesc.m_attachmentSocketID = StringID( rawComponent.m_pAttachmentSocketID );
                 }
             }
 
@@ -170,21 +315,15 @@ namespace EE::EntityModel
             //-------------------------------------------------------------------------
 
             // Reserve memory for all property (+1 extra slot) and create an empty desc
-            outComponentDesc.m_properties.reserve( componentTypeDataObject.Size() );
+            outComponentDesc.m_properties.reserve( rawComponent.m_properties.size() + 1 );
             outComponentDesc.m_properties.push_back( TypeSystem::PropertyDescriptor() );
 
             // Read all properties
-            for ( auto itr = componentTypeDataObject.MemberBegin(); itr != componentTypeDataObject.MemberEnd(); ++itr )
+            for ( auto const& rawProperty : rawComponent.m_properties )
             {
-                // Skip Type ID
-                if ( strcmp( itr->name.GetString(), Serialization::s_typeIDKey ) == 0 )
-                {
-                    continue;
-                }
-
                 // If we successfully read the property value add a new property value
                 // Reading of properties is allowed to fail
-                if ( ReadAndConvertPropertyValue( ctx, pTypeInfo, itr, outComponentDesc.m_properties.back() ) )
+                if ( ReadAndConvertPropertyValue( ctx, pTypeInfo, rawProperty.first, rawProperty.second, outComponentDesc.m_properties.back() ) )
                 {
                     outComponentDesc.m_properties.push_back( TypeSystem::PropertyDescriptor() );
                 }
@@ -208,51 +347,42 @@ namespace EE::EntityModel
 
         //-------------------------------------------------------------------------
 
-        static bool ReadSystemData( ParsingContext& ctx, Serialization::JsonValue const& systemObject, SerializedSystemDescriptor& outSystemDesc )
+        static bool ReadSystemData( ParsingContext& ctx, char const* pSystemTypeID, SerializedSystemDescriptor& outSystemDesc )
         {
-            auto typeIDIter = systemObject.FindMember( Serialization::s_typeIDKey );
-            if ( typeIDIter == systemObject.MemberEnd() || !typeIDIter->value.IsString() )
-            {
-                return Error( "Invalid entity system format (systems must have a TypeID string value set) on entity %s", ctx.m_parsingContextName.c_str() );
-            }
-
-            if ( typeIDIter->value.GetStringLength() == 0 )
+            if ( !IsValidString( pSystemTypeID ) )
             {
                 return Error( "Invalid entity system format (systems must have a TypeID string value set) on entity %s", ctx.m_parsingContextName.c_str() );
             }
 
-            outSystemDesc.m_typeID = StringID( typeIDIter->value.GetString() );
+            outSystemDesc.m_typeID = StringID( pSystemTypeID );
             return true;
         }
 
         //-------------------------------------------------------------------------
 
-        static bool ReadEntityData( ParsingContext& ctx, Serialization::JsonValue const& entityObject, SerializedEntityDescriptor& outEntityDesc )
+        static bool ReadEntityData( ParsingContext& ctx, RawEntityData const& rawEntity, SerializedEntityDescriptor& outEntityDesc )
         {
             // Read name and ID
             //-------------------------------------------------------------------------
 
-            auto nameIter = entityObject.FindMember( "Name" );
-            if ( nameIter == entityObject.MemberEnd() || !nameIter->value.IsString() || nameIter->value.GetStringLength() == 0 )
+            if ( !IsValidString( rawEntity.m_pName ) )
             {
                 return Error( "Invalid entity component format detected for entity (%s): components must have ID, Name and TypeID string values set", ctx.m_parsingContextName.c_str() );
             }
 
-            outEntityDesc.m_name = StringID( nameIter->value.GetString() );
+            outEntityDesc.m_name = StringID( rawEntity.m_pName );
 
             // Read spatial info
             //-------------------------------------------------------------------------
 
-            auto spatialParentIter = entityObject.FindMember( "SpatialParent" );
-            if ( spatialParentIter != entityObject.MemberEnd() && spatialParentIter->value.IsString() )
+            if ( rawEntity.m_pSpatialParent != nullptr )
             {
-                outEntityDesc.m_spatialParentName = StringID( spatialParentIter->value.GetString() );
+                outEntityDesc.m_spatialParentName = StringID( rawEntity.m_pSpatialParent );
             }
 
-            auto attachmentSocketIter = entityObject.FindMember( "AttachmentSocketID" );
-            if ( attachmentSocketIter != entityObject.MemberEnd() && attachmentSocketIter->value.IsString() )
+            if ( rawEntity.m_pAttachmentSocketID != nullptr )
             {
-                outEntityDesc.m_attachmentSocketID = StringID( attachmentSocketIter->value.GetString() );
+                outEntityDesc.m_attachmentSocketID = StringID( rawEntity.m_pAttachmentSocketID );
             }
 
             // Set parsing ctx ID
@@ -266,13 +396,12 @@ namespace EE::EntityModel
 
             ctx.ClearComponentNames();
 
-            auto componentsArrayIter = entityObject.FindMember( "Components" );
-            if ( componentsArrayIter != entityObject.MemberEnd() && componentsArrayIter->value.IsArray() )
+            if ( rawEntity.m_numComponents > 0 )
             {
                 // Read component data
                 //-------------------------------------------------------------------------
 
-                int32_t const numComponents = (int32_t) componentsArrayIter->value.Size();
+                int32_t const numComponents = rawEntity.m_numComponents;
                 EE_ASSERT( outEntityDesc.m_components.empty() && outEntityDesc.m_numSpatialComponents == 0 );
                 outEntityDesc.m_components.resize( numComponents );
 
@@ -280,7 +409,7 @@ namespace EE::EntityModel
 
                 for ( int32_t i = 0; i < numComponents; i++ )
                 {
-                    if ( !ReadComponent( ctx, componentsArrayIter->value[i], outEntityDesc.m_components[i] ) )
+                    if ( !ReadComponent( ctx, rawEntity.m_components[i], outEntityDesc.m_components[i] ) )
                     {
                         return Error( "Failed to read component definition %u for entity (%s)", i, outEntityDesc.m_name.c_str() );
                     }
@@ -389,16 +518,15 @@ namespace EE::EntityModel
             // Read systems
             //-------------------------------------------------------------------------
 
-            auto systemsArrayIter = entityObject.FindMember( "Systems" );
-            if ( systemsArrayIter != entityObject.MemberEnd() && systemsArrayIter->value.IsArray() )
+            if ( !rawEntity.m_systemTypeIDs.empty() )
             {
                 EE_ASSERT( outEntityDesc.m_systems.empty() );
 
-                outEntityDesc.m_systems.resize( systemsArrayIter->value.Size() );
+                outEntityDesc.m_systems.resize( rawEntity.m_systemTypeIDs.size() );
 
-                for ( rapidjson::SizeType i = 0; i < systemsArrayIter->value.Size(); i++ )
+                for ( int32_t i = 0; i < (int32_t) rawEntity.m_systemTypeIDs.size(); i++ )
                 {
-                    if ( !ReadSystemData( ctx, systemsArrayIter->value[i], outEntityDesc.m_systems[i] ) )
+                    if ( !ReadSystemData( ctx, rawEntity.m_systemTypeIDs[i], outEntityDesc.m_systems[i] ) )
                     {
                         return Error( "Failed to read system definition %u on entity (%s)", i, outEntityDesc.m_name.c_str() );
                     }
@@ -422,108 +550,511 @@ namespace EE::EntityModel
             }
         }
 
-        static bool ReadEntityCollection( ParsingContext& ctx, Serialization::JsonValue const& entitiesArrayValue, SerializedEntityCollection& outCollection )
+        //-------------------------------------------------------------------------
+
+        // SAX handler for the collection file, tracks where we are in the file and fills the raw entity data
+        // Any values we dont care about (including whole objects/arrays) are skipped
+        class EntityCollectionReader final : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, EntityCollectionReader>
         {
-            int32_t const numEntities = (int32_t) entitiesArrayValue.Size();
+            enum class Scope : uint8_t
+            {
+                Root,
+                EntitiesArray,
+                Entity,
+                ComponentsArray,
+                Component,
+                TypeData,
+                SystemsArray,
+                System,
+            };
+
+        public:
+
+            EntityCollectionReader( ParsingContext& ctx ) : m_ctx( ctx ) {}
 
-            TVector<SerializedEntityDescriptor> entityDescs;
-            entityDescs.reserve( numEntities );
+            inline bool HasFailed() const { return m_hasFailed; }
+            inline bool WasEntitiesArrayFound() const { return m_wasEntitiesArrayFound; }
+            inline TVector<SerializedEntityDescriptor>& GetEntityDescriptors() { return m_entityDescs; }
 
-            for ( int32_t i = 0; i < numEntities; i++ )
+            // Objects and Arrays
+            //-------------------------------------------------------------------------
+
+            bool StartObject()
             {
-                if ( !entitiesArrayValue[i].IsObject() )
+                if ( m_skipDepth > 0 )
                 {
-                    return Error( "Malformed collection file, entities array can only contain objects" );
+                    m_skipDepth++;
+                    return true;
                 }
 
-                SerializedEntityDescriptor entityDesc;
-                if ( !ReadEntityData( ctx, entitiesArrayValue[i], entityDesc ) )
+                if ( m_scopes.empty() )
                 {
-                    return false;
+                    m_scopes.emplace_back( Scope::Root );
+                    return true;
                 }
 
-                entityDescs.emplace_back( entityDesc );
+                switch ( m_scopes.back() )
+                {
+                    case Scope::EntitiesArray:
+                    {
+                        m_rawEntity.Reset();
+                        m_scopes.emplace_back( Scope::Entity );
+                    }
+                    break;
+
+                    case Scope::ComponentsArray:
+                    {
+                        m_rawEntity.AddComponent();
+                        m_scopes.emplace_back( Scope::Component );
+                    }
+                    break;
+
+                    case Scope::SystemsArray:
+                    {
+                        m_rawEntity.m_systemTypeIDs.emplace_back( nullptr );
+                        m_scopes.emplace_back( Scope::System );
+                    }
+                    break;
+
+                    case Scope::Component:
+                    {
+                        if ( IsCurrentKey( "TypeData" ) )
+                        {
+                            GetCurrentComponent().m_hasTypeData = true;
+                            m_scopes.emplace_back( Scope::TypeData );
+                        }
+                        else
+                        {
+                            m_skipDepth = 1;
+                        }
+                    }
+                    break;
+
+                    case Scope::TypeData:
+                    {
+                        GetCurrentComponent().m_properties.emplace_back( m_pCurrentKey, nullptr );
+                        m_skipDepth = 1;
+                    }
+                    break;
+
+                    default:
+                    {
+                        m_skipDepth = 1;
+                    }
+                    break;
+                }
+
+                return true;
+            }
+
+            bool EndObject( rapidjson::SizeType )
+            {
+                if ( m_skipDepth > 0 )
+                {
+                    m_skipDepth--;
+                    return true;
+                }
+
+                Scope const scope = m_scopes.back();
+                m_scopes.pop_back();
+
+                if ( scope == Scope::Entity )
+                {
+                    SerializedEntityDescriptor& entityDesc = m_entityDescs.emplace_back();
+                    if ( !ReadEntityData( m_ctx, m_rawEntity, entityDesc ) )
+                    {
+                        m_hasFailed = true;
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            bool StartArray()
+            {
+                if ( m_skipDepth > 0 )
+                {
+                    m_skipDepth++;
+                    return true;
+                }
+
+                if ( m_scopes.empty() )
+                {
+                    return Fail( "Invalid format for entity collection file, missing root entities array" );
+                }
+
+                switch ( m_scopes.back() )
+                {
+                    case Scope::Root:
+                    {
+                        if ( IsCurrentKey( "Entities" ) )
+                        {
+                            m_wasEntitiesArrayFound = true;
+                            m_scopes.emplace_back( Scope::EntitiesArray );
+                            return true;
+                        }
+                    }
+                    break;
+
+                    case Scope::Entity:
+                    {
+                        if ( IsCurrentKey( "Components" ) )
+                        {
+                            m_scopes.emplace_back( Scope::ComponentsArray );
+                            return true;
+                        }
+                        else if ( IsCurrentKey( "Systems" ) )
+                        {
+                            m_scopes.emplace_back( Scope::SystemsArray );
+                            return true;
+                        }
+                    }
+                    break;
+
+                    case Scope::TypeData:
+                    {
+                        GetCurrentComponent().m_properties.emplace_back( m_pCurrentKey, nullptr );
+                    }
+                    break;
+
+                    case Scope::EntitiesArray:
+                    case Scope::ComponentsArray:
+                    case Scope::SystemsArray:
+                    {
+                        return FailOnInvalidArrayElement();
+                    }
+                    break;
+
+                    default:
+                    break;
+                }
+
+                m_skipDepth = 1;
+                return true;
+            }
+
+            bool EndArray( rapidjson::SizeType )
+            {
+                if ( m_skipDepth > 0 )
+                {
+                    m_skipDepth--;
+                    return true;
+                }
+
+                m_scopes.pop_back();
+                return true;
             }
 
+            // Values
             //-------------------------------------------------------------------------
 
-            outCollection.SetCollectionData( eastl::move( entityDescs ) );
-            return true;
-        }
-    }
+            bool Key( char const* pString, rapidjson::SizeType, bool )
+            {
+                if ( m_skipDepth == 0 )
+                {
+                    m_pCurrentKey = pString;
+                }
 
-    //-------------------------------------------------------------------------
+                return true;
+            }
 
-    bool ReadEntityDescriptor( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesObjectValue, SerializedEntityDescriptor& outEntityDesc )
-    {
-        if ( !entitiesObjectValue.IsObject() )
-        {
-            return Error( "Supplied entity json value is not an object" );
-        }
+            bool String( char const* pString, rapidjson::SizeType, bool )
+            {
+                if ( m_skipDepth > 0 || m_scopes.empty() )
+                {
+                    return true;
+                }
 
-        ParsingContext ctx( typeRegistry );
-        return ReadEntityData( ctx, entitiesObjectValue, outEntityDesc );
-    }
+                switch ( m_scopes.back() )
+                {
+                    case Scope::Entity:
+                    {
+                        ReadCommonValue( pString, m_rawEntity.m_pName, m_rawEntity.m_pSpatialParent, m_rawEntity.m_pAttachmentSocketID );
+                    }
+                    break;
 
-    bool ReadEntityCollectionFromJson( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, SerializedEntityCollection& outCollection )
-    {
-        if ( !entitiesArrayValue.IsArray() )
+                    case Scope::Component:
+                    {
+                        RawComponentData& component = GetCurrentComponent();
+                        ReadCommonValue( pString, component.m_pName, component.m_pSpatialParent, component.m_pAttachmentSocketID );
+                    }
+                    break;
+
+                    case Scope::TypeData:
+                    {
+                        RawComponentData& component = GetCurrentComponent();
+                        if ( IsCurrentKey( Serialization::s_typeIDKey ) )
+                        {
+                            component.m_pTypeID = pString;
+                        }
+                        else
+                        {
+                            component.m_properties.emplace_back( m_pCurrentKey, pString );
+                        }
+                    }
+                    break;
+
+                    case Scope::System:
+                    {
+                        if ( IsCurrentKey( Serialization::s_typeIDKey ) )
+                        {
+                            m_rawEntity.m_systemTypeIDs.back() = pString;
+                        }
+                    }
+                    break;
+
+                    case Scope::EntitiesArray:
+                    case Scope::ComponentsArray:
+                    case Scope::SystemsArray:
+                    {
+                        return FailOnInvalidArrayElement();
+                    }
+                    break;
+
+                    default:
+                    break;
+                }
+
+                return true;
+            }
+
+            // All non-string values
+            bool Default()
+            {
+                if ( m_skipDepth > 0 || m_scopes.empty() )
+                {
+                    return true;
+                }
+
+                switch ( m_scopes.back() )
+                {
+                    case Scope::TypeData:
+                    {
+                        GetCurrentComponent().m_properties.emplace_back( m_pCurrentKey, nullptr );
+                    }
+                    break;
+
+                    case Scope::EntitiesArray:
+                    case Scope::ComponentsArray:
+                    case Scope::SystemsArray:
+                    {
+                        return FailOnInvalidArrayElement();
+                    }
+                    break;
+
+                    default:
+                    break;
+                }
+
+                return true;
+            }
+
+        private:
+
+            inline bool IsCurrentKey( char const* pKey ) const { return m_pCurrentKey != nullptr && strcmp( m_pCurrentKey, pKey ) == 0; }
+            inline RawComponentData& GetCurrentComponent() { return m_rawEntity.m_components[m_rawEntity.m_numComponents - 1]; }
+
+            void ReadCommonValue( char const* pString, char const*& pOutName, char const*& pOutSpatialParent, char const*& pOutAttachmentSocketID )
+            {
+                if ( IsCurrentKey( "Name" ) )
+                {
+                    pOutName = pString;
+                }
+                else if ( IsCurrentKey( "SpatialParent" ) )
+                {
+                    pOutSpatialParent = pString;
+                }
+                else if ( IsCurrentKey( "AttachmentSocketID" ) )
+                {
+                    pOutAttachmentSocketID = pString;
+                }
+            }
+
+            bool FailOnInvalidArrayElement()
+            {
+                if ( m_scopes.back() == Scope::EntitiesArray )
+                {
+                    return Fail( "Malformed collection file, entities array can only contain objects" );
+                }
+
+                return Fail( "Malformed collection file, component and system arrays can only contain objects" );
+            }
+
+            bool Fail( char const* pErrorMessage )
+            {
+                Error( pErrorMessage );
+                m_hasFailed = true;
+                return false;
+            }
+
+        private:
+
+            ParsingContext&                             m_ctx;
+            TInlineVector<Scope, 8>                     m_scopes;
+            char const*                                 m_pCurrentKey = nullptr;
+            int32_t                                     m_skipDepth = 0;
+            RawEntityData                               m_rawEntity;
+            TVector<SerializedEntityDescriptor>         m_entityDescs;
+            bool                                        m_wasEntitiesArrayFound = false;
+            bool                                        m_hasFailed = false;
+        };
+
+        //-------------------------------------------------------------------------
+
+        static char const* GetStringMember( CountingJsonValue const& object, char const* pMemberName )
         {
-            return Error( "Failed to read entity collection, json value is not an array" );
+            auto memberIter = object.FindMember( pMemberName );
+            if ( memberIter == object.MemberEnd() || !memberIter->value.IsString() )
+            {
+                return nullptr;
+            }
+
+            return memberIter->value.GetString();
         }
 
-        ParsingContext ctx( typeRegistry );
-        return ReadEntityCollection( ctx, entitiesArrayValue, outCollection );
-    }
+        // Fill the raw entity data from an entity json object, this gathers exactly what the streaming reader does so both readers share the same validation and conversion
+        static bool ReadRawEntityData( CountingJsonValue const& entityObject, RawEntityData& outRawEntity )
+        {
+            outRawEntity.Reset();
+            outRawEntity.m_pName = GetStringMember( entityObject, "Name" );
+            outRawEntity.m_pSpatialParent = GetStringMember( entityObject, "SpatialParent" );
+            outRawEntity.m_pAttachmentSocketID = GetStringMember( entityObject, "AttachmentSocketID" );
 
-    bool ReadSerializedEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection )
-    {
-        EE_ASSERT( filePath.IsValid() );
+            // Components
+            //-------------------------------------------------------------------------
+
+            auto componentsArrayIter = entityObject.FindMember( "Components" );
+            if ( componentsArrayIter != entityObject.MemberEnd() && componentsArrayIter->value.IsArray() )
+            {
+                for ( auto const& componentObject : componentsArrayIter->value.GetArray() )
+                {
+                    if ( !componentObject.IsObject() )
+                    {
+                        return Error( "Malformed collection file, component and system arrays can only contain objects" );
+                    }
+
+                    RawComponentData& rawComponent = outRawEntity.AddComponent();
+                    rawComponent.m_pName = GetStringMember( componentObject, "Name" );
+                    rawComponent.m_pSpatialParent = GetStringMember( componentObject, "SpatialParent" );
+                    rawComponent.m_pAttachmentSocketID = GetStringMember( componentObject, "AttachmentSocketID" );
+
+                    auto typeDataIter = componentObject.FindMember( "TypeData" );
+                    if ( typeDataIter == componentObject.MemberEnd() || !typeDataIter->value.IsObject() )
+                    {
+                        continue;
+                    }
+
+                    rawComponent.m_hasTypeData = true;
+
+                    for ( auto itr = typeDataIter->value.MemberBegin(); itr != typeDataIter->value.MemberEnd(); ++itr )
+                    {
+                        char const* pValue = itr->value.IsString() ? itr->value.GetString() : nullptr;
+                        if ( pValue != nullptr && strcmp( itr->name.GetString(), Serialization::s_typeIDKey ) == 0 )
+                        {
+                            rawComponent.m_pTypeID = pValue;
+                        }
+                        else
+                        {
+                            rawComponent.m_properties.emplace_back( itr->name.GetString(), pValue );
+                        }
+                    }
+                }
+            }
+
+            // Systems
+            //-------------------------------------------------------------------------
+
+            auto systemsArrayIter = entityObject.FindMember( "Systems" );
+            if ( systemsArrayIter != entityObject.MemberEnd() && systemsArrayIter->value.IsArray() )
+            {
+                for ( auto const& systemObject : systemsArrayIter->value.GetArray() )
+                {
+                    if ( !systemObject.IsObject() )
+                    {
+                        return Error( "Malformed collection file, component and system arrays can only contain objects" );
+                    }
+
+                    outRawEntity.m_systemTypeIDs.emplace_back( GetStringMember( systemObject, Serialization::s_typeIDKey ) );
+                }
+            }
+
+            return true;
+        }
 
         //-------------------------------------------------------------------------
 
-        if ( !FileSystem::Exists( filePath ) )
+        static bool LoadCollectionFile( FileSystem::Path const& filePath, Blob& outFileBuffer )
         {
-            return Error( "Cant read source file %s", filePath.GetFullPath().c_str() );
+            EE_ASSERT( filePath.IsValid() );
+
+            if ( !FileSystem::Exists( filePath ) )
+            {
+                return Error( "Cant read source file %s", filePath.GetFullPath().c_str() );
+            }
+
+            // Load file into memory buffer
+            FILE* fp = fopen( filePath.c_str(), "r" );
+            fseek( fp, 0, SEEK_END );
+            size_t filesize = (size_t) ftell( fp );
+            fseek( fp, 0, SEEK_SET );
+
+            outFileBuffer.resize( filesize + 1 );
+            size_t readLength = fread( outFileBuffer.data(), 1, filesize, fp );
+            outFileBuffer[readLength] = '\0';
+            fclose( fp );
+
+            return true;
         }
+    }
 
-        //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
 
+    bool ReadSerializedEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection, size_t* pOutPeakParserMemory )
+    {
         outCollection.Clear();
 
+        Blob fileBuffer;
+        if ( !LoadCollectionFile( filePath, fileBuffer ) )
+        {
+            return false;
+        }
+
+        // Parse JSON and read entities
         //-------------------------------------------------------------------------
 
-        // Load file into memory buffer
-        FILE* fp = fopen( filePath.c_str(), "r" );
-        fseek( fp, 0, SEEK_END );
-        size_t filesize = (size_t) ftell( fp );
-        fseek( fp, 0, SEEK_SET );
+        ParsingContext ctx( typeRegistry );
+        EntityCollectionReader collectionReader( ctx );
 
-        Blob fileBuffer;
-        fileBuffer.resize( filesize + 1 );
-        size_t readLength = fread( fileBuffer.data(), 1, filesize, fp );
-        fileBuffer[readLength] = '\0';
-        fclose( fp );
+        CountingJsonAllocator parserAllocator;
+        rapidjson::InsituStringStream stream( (char*) fileBuffer.data() );
+        rapidjson::GenericReader<rapidjson::UTF8<>, rapidjson::UTF8<>, CountingJsonAllocator> reader( &parserAllocator );
+        rapidjson::ParseResult result = reader.Parse<rapidjson::kParseInsituFlag>( stream, collectionReader );
 
-        // Parse JSON
-        //-------------------------------------------------------------------------
+        if ( pOutPeakParserMemory != nullptr )
+        {
+            *pOutPeakParserMemory = parserAllocator.GetPeakMemory();
+        }
+
+        if ( collectionReader.HasFailed() )
+        {
+            return false;
+        }
 
-        rapidjson::Document entityCollectionDocument;
-        rapidjson::ParseResult result = entityCollectionDocument.ParseInsitu( (char*) fileBuffer.data() );
         if ( result.IsError() )
         {
             return Error( "Failed to parse JSON: %s", GetJsonErrorMessage( result.Code() ) );
         }
 
-        if ( !entityCollectionDocument.HasMember( "Entities" ) || !entityCollectionDocument["Entities"].IsArray() )
+        if ( !collectionReader.WasEntitiesArrayFound() )
         {
             return Error( "Invalid format for entity collection file, missing root entities array" );
         }
 
-        // Read Entities
         //-------------------------------------------------------------------------
 
-        return ReadEntityCollectionFromJson( typeRegistry, entityCollectionDocument["Entities"], outCollection );
+        outCollection.SetCollectionData( eastl::move( collectionReader.GetEntityDescriptors() ) );
+        return true;
     }
 
     bool ReadSerializedEntityMapFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityMap& outMap )
@@ -531,6 +1062,74 @@ namespace EE::EntityModel
         return ReadSerializedEntityCollectionFromFile( typeRegistry, filePath, outMap );
     }
 
+    bool ReadSerializedEntityCollectionFromFileUsingDocument( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection, size_t* pOutPeakParserMemory )
+    {
+        outCollection.Clear();
+
+        Blob fileBuffer;
+        if ( !LoadCollectionFile( filePath, fileBuffer ) )
+        {
+            return false;
+        }
+
+        // The allocator needs to outlive the document
+        CountingJsonAllocator parserAllocator;
+        TVector<SerializedEntityDescriptor> entityDescs;
+
+        {
+            // Parse JSON
+            //-------------------------------------------------------------------------
+
+            rapidjson::MemoryPoolAllocator<CountingJsonAllocator> documentAllocator( rapidjson::MemoryPoolAllocator<CountingJsonAllocator>::kDefaultChunkCapacity, &parserAllocator );
+            CountingJsonDocument document( &documentAllocator, CountingJsonDocument::kDefaultStackCapacity, &parserAllocator );
+            document.ParseInsitu( (char*) fileBuffer.data() );
+
+            if ( document.HasParseError() )
+            {
+                return Error( "Failed to parse JSON: %s", GetJsonErrorMessage( document.GetParseError() ) );
+            }
+
+            if ( !document.IsObject() )
+            {
+                return Error( "Invalid format for entity collection file, missing root entities array" );
+            }
+
+            auto entitiesArrayIter = document.FindMember( "Entities" );
+            if ( entitiesArrayIter == document.MemberEnd() || !entitiesArrayIter->value.IsArray() )
+            {
+                return Error( "Invalid format for entity collection file, missing root entities array" );
+            }
+
+            // Read Entities
+            //-------------------------------------------------------------------------
+
+            ParsingContext ctx( typeRegistry );
+            RawEntityData rawEntity;
+
+            entityDescs.reserve( entitiesArrayIter->value.Size() );
+            for ( auto const& entityObject : entitiesArrayIter->value.GetArray() )
+            {
+                if ( !entityObject.IsObject() )
+                {
+                    return Error( "Malformed collection file, entities array can only contain objects" );
+                }
+
+                if ( !ReadRawEntityData( entityObject, rawEntity ) || !ReadEntityData( ctx, rawEntity, entityDescs.emplace_back() ) )
+                {
+                    return false;
+                }
+            }
+        }
+
+        if ( pOutPeakParserMemory != nullptr )
+        {
+            *pOutPeakParserMemory = parserAllocator.GetPeakMemory();
+        }
+
+        outCollection.SetCollectionData( eastl::move( entityDescs ) );
+        return true;
+    }
+
     //-------------------------------------------------------------------------
     // Writing
     //-------------------------------------------------------------------------
@@ -22,12 +22,16 @@ namespace EE::EntityModel
 
     //-------------------------------------------------------------------------
 
-    EE_ENGINETOOLS_API bool ReadSerializedEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection );
+    // The optional peak parser memory is the most memory the json parser had allocated at once while reading, this excludes the file buffer and the output descriptors
+    EE_ENGINETOOLS_API bool ReadSerializedEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection, size_t* pOutPeakParserMemory = nullptr );
     EE_ENGINETOOLS_API bool ReadSerializedEntityMapFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityMap& outMap );
     EE_ENGINETOOLS_API bool WriteSerializedEntityCollectionToFile( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& collection, FileSystem::Path const& outFilePath );
     EE_ENGINETOOLS_API bool WriteMapToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityMap const& map, FileSystem::Path const& outFilePath );
 
     //-------------------------------------------------------------------------
 
+    // Reads a collection by building a json document for the whole file first and then reading the entities from it
+    // This is much slower and uses a lot more memory than the streaming reader above, it only exists as a baseline for benchmarking
+    EE_ENGINETOOLS_API bool ReadSerializedEntityCollectionFromFileUsingDocument( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection, size_t* pOutPeakParserMemory = nullptr );
 
 }
\ No newline at end of file
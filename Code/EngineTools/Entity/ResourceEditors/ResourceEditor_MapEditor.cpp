@@ -1,5 +1,6 @@
 #include "ResourceEditor_MapEditor.h"
 #include "EngineTools/Navmesh/NavmeshGeneratorDialog.h"
+#include "EngineTools/Navmesh/NavmeshGenerator.h"
 #include "EngineTools/ThirdParty/pfd/portable-file-dialogs.h"
 #include "EngineTools/Core/CommonDialogs.h"
 #include "EngineTools/Entity/EntitySerializationTools.h"
@@ -21,6 +22,10 @@ namespace EE::EntityModel
     EntityMapEditor::~EntityMapEditor()
     {
         EE_ASSERT( m_pNavmeshGeneratorDialog == nullptr );
+
+        #if EE_ENABLE_NAVPOWER
+        EE::Delete( m_pNavmeshGeometryCache );
+        #endif
     }
 
     void EntityMapEditor::Initialize( UpdateContext const& context )
@@ -382,7 +387,14 @@ namespace EE::EntityModel
 
         SerializedEntityMap map;
         Serializer::SerializeEntityMap( *m_pToolsContext->m_pTypeRegistry, GetEditedMap(), map );
-        m_pNavmeshGeneratorDialog = EE::New<Navmesh::NavmeshGeneratorDialog>( m_pToolsContext, pNavmeshComponent->GetBuildSettings(), map, navmeshFilePath);
+        #if EE_ENABLE_NAVPOWER
+        if ( m_pNavmeshGeometryCache == nullptr )
+        {
+            m_pNavmeshGeometryCache = EE::New<Navmesh::NavmeshGeometryCache>();
+        }
+        #endif
+
+        m_pNavmeshGeneratorDialog = EE::New<Navmesh::NavmeshGeneratorDialog>( m_pToolsContext, pNavmeshComponent->GetBuildSettings(), map, navmeshFilePath, m_pNavmeshGeometryCache );
     }
 
     void EntityMapEditor::UpdateNavmeshGeneration( UpdateContext const& context )
@@ -8,6 +8,7 @@
 namespace EE::Navmesh
 {
     class NavmeshGeneratorDialog;
+    class NavmeshGeometryCache;
 }
 
 //-------------------------------------------------------------------------
@@ -74,5 +75,6 @@ namespace EE::EntityModel
         TEvent<UpdateContext const&>                    m_requestStopGamePreview;
 
         Navmesh::NavmeshGeneratorDialog*                m_pNavmeshGeneratorDialog = nullptr;
+        Navmesh::NavmeshGeometryCache*                  m_pNavmeshGeometryCache = nullptr; // Kept between navmesh builds so rebuilds only re-collect changed geometry
     };
 }
\ No newline at end of file
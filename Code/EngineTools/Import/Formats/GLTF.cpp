@@ -85,6 +85,46 @@ namespace EE::Import::gltf
 
         m_scaleConversionMultiplier = 1.0f;
     }
+
+    //-------------------------------------------------------------------------
+
+    bool GetReferencedFiles( FileSystem::Path const& sourceFilePath, TVector<FileSystem::Path>& outReferencedFiles )
+    {
+        // We only need the json part of the file, the buffers themselves are never loaded
+        cgltf_options options = { cgltf_file_type_invalid, 0 };
+        cgltf_data* pSceneData = nullptr;
+        if ( cgltf_parse_file( &options, sourceFilePath.c_str(), &pSceneData ) != cgltf_result_success )
+        {
+            return false;
+        }
+
+        // Only buffers are read by the importers, images are imported separately
+        FileSystem::Path const parentDirectory = sourceFilePath.GetParentDirectory();
+        for ( cgltf_size i = 0; i < pSceneData->buffers_count; i++ )
+        {
+            char const* pURI = pSceneData->buffers[i].uri;
+
+            // Embedded (glb) and data URI buffers are part of the source file
+            if ( pURI == nullptr || strncmp( pURI, "data:", 5 ) == 0 )
+            {
+                continue;
+            }
+
+            // Absolute and remote URIs cant be tracked
+            if ( strstr( pURI, "://" ) != nullptr || pURI[0] == '/' )
+            {
+                cgltf_free( pSceneData );
+                return false;
+            }
+
+            String decodedURI( pURI );
+            decodedURI.resize( cgltf_decode_uri( decodedURI.data() ) );
+            outReferencedFiles.emplace_back( parentDirectory + decodedURI );
+        }
+
+        cgltf_free( pSceneData );
+        return true;
+    }
 }
 
 //-------------------------------------------------------------------------
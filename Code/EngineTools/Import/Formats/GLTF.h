@@ -143,6 +143,9 @@ namespace EE::Import::gltf
     // Import Functions
     //-------------------------------------------------------------------------
 
+    // Get the external files (i.e. buffers) that are read when importing from the specified file, returns false if these cant be determined
+    EE_ENGINETOOLS_API bool GetReferencedFiles( FileSystem::Path const& sourceFilePath, TVector<FileSystem::Path>& outReferencedFiles );
+
     EE_ENGINETOOLS_API TUniquePtr<ImportedSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName );
     EE_ENGINETOOLS_API TUniquePtr<ImportedAnimation> ReadAnimation( FileSystem::Path const& animationFilePath, ImportedSkeleton const& ImportedSkeleton, String const& animationName = String() );
     EE_ENGINETOOLS_API TUniquePtr<ImportedMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude );
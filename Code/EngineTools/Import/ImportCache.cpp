@@ -0,0 +1,395 @@
+#include "ImportCache.h"
+#include "ImportedMesh.h"
+#include "ImportedSkeleton.h"
+#include "ImportedAnimation.h"
+#include "Importer.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Encoding/Hash.h"
+#include "Base/Types/UUID.h"
+#include <filesystem>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Import
+{
+    static FileSystem::Path g_importCacheDirectoryPath;
+
+    //-------------------------------------------------------------------------
+
+    bool ImportCache::Initialize( FileSystem::Path const& cacheDirectoryPath )
+    {
+        EE_ASSERT( !IsInitialized() );
+        EE_ASSERT( cacheDirectoryPath.IsValid() && cacheDirectoryPath.IsDirectoryPath() );
+
+        if ( !cacheDirectoryPath.EnsureDirectoryExists() )
+        {
+            EE_LOG_WARNING( "Import", "Import Cache", "Failed to create cache directory: %s", cacheDirectoryPath.c_str() );
+            return false;
+        }
+
+        g_importCacheDirectoryPath = cacheDirectoryPath;
+        return true;
+    }
+
+    void ImportCache::Shutdown()
+    {
+        g_importCacheDirectoryPath.Clear();
+    }
+
+    bool ImportCache::IsInitialized()
+    {
+        return g_importCacheDirectoryPath.IsValid();
+    }
+
+    FileSystem::Path ImportCache::GetEntryPath( uint64_t key )
+    {
+        InlineString const entryPath( InlineString::CtorSprintf(), "%02x/%016llx.cache", uint32_t( key >> 56 ), key );
+        return g_importCacheDirectoryPath + entryPath.c_str();
+    }
+
+    //-------------------------------------------------------------------------
+    // Keys
+    //-------------------------------------------------------------------------
+
+    uint64_t ImportCache::CalculateKey( FileSystem::Path const& sourceFilePath, EntryType entryType, TVector<uint64_t>& parameterHashes )
+    {
+        Blob fileData;
+        if ( !FileSystem::LoadFile( sourceFilePath, fileData ) )
+        {
+            return 0;
+        }
+
+        // The source path is deliberately not part of the key, identical files in different locations share entries
+        parameterHashes.emplace_back( Hash::GetHash64( fileData ) );
+
+        // Multi-file formats (i.e. gltf with external buffers) also need the contents of every other file the importer reads
+        // If we cant determine or read these files, we dont cache anything for this source file
+        TVector<FileSystem::Path> referencedFiles;
+        if ( !GetReferencedSourceFiles( sourceFilePath, referencedFiles ) )
+        {
+            return 0;
+        }
+
+        for ( FileSystem::Path const& referencedFilePath : referencedFiles )
+        {
+            if ( !FileSystem::LoadFile( referencedFilePath, fileData ) )
+            {
+                return 0;
+            }
+
+            parameterHashes.emplace_back( Hash::GetHash64( fileData ) );
+        }
+        parameterHashes.emplace_back( s_version );
+        parameterHashes.emplace_back( (uint64_t) Serialization::GetBinarySerializationVersion() );
+        parameterHashes.emplace_back( (uint64_t) entryType );
+
+        uint64_t const key = Hash::GetHash64( parameterHashes.data(), parameterHashes.size() * sizeof( uint64_t ) );
+        return ( key == 0 ) ? 1 : key;
+    }
+
+    uint64_t ImportCache::CalculateSkeletonKey( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName, TVector<StringID> const& listOfHighLODBones )
+    {
+        TVector<uint64_t> parameterHashes;
+        parameterHashes.emplace_back( Hash::GetHash64( skeletonRootBoneName ) );
+        for ( StringID const& boneID : listOfHighLODBones )
+        {
+            parameterHashes.emplace_back( boneID.ToUint() );
+        }
+
+        return CalculateKey( sourceFilePath, EntryType::Skeleton, parameterHashes );
+    }
+
+    uint64_t ImportCache::CalculateAnimationKey( FileSystem::Path const& sourceFilePath, ImportedSkeleton const& importedSkeleton, String const& animationName )
+    {
+        TVector<uint64_t> parameterHashes;
+        parameterHashes.emplace_back( Hash::GetHash64( animationName ) );
+
+        // The sampled tracks depend on the skeleton hierarchy and its bind pose
+        for ( ImportedSkeleton::Bone const& bone : importedSkeleton.GetBoneData() )
+        {
+            parameterHashes.emplace_back( bone.m_name.ToUint() );
+            parameterHashes.emplace_back( (uint64_t) bone.m_parentBoneIdx );
+            parameterHashes.emplace_back( Hash::GetHash64( &bone.m_localTransform, sizeof( Transform ) ) );
+        }
+
+        return CalculateKey( sourceFilePath, EntryType::Animation, parameterHashes );
+    }
+
+    uint64_t ImportCache::CalculateMeshKey( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, bool isSkeletalMesh, int32_t maxBoneInfluences )
+    {
+        TVector<uint64_t> parameterHashes;
+        parameterHashes.emplace_back( isSkeletalMesh ? 1 : 0 );
+        parameterHashes.emplace_back( (uint64_t) maxBoneInfluences );
+        for ( String const& meshName : meshesToInclude )
+        {
+            parameterHashes.emplace_back( Hash::GetHash64( meshName ) );
+        }
+
+        return CalculateKey( sourceFilePath, EntryType::Mesh, parameterHashes );
+    }
+
+    //-------------------------------------------------------------------------
+    // Entries
+    //-------------------------------------------------------------------------
+
+    bool ImportCache::TryOpenEntry( uint64_t key, EntryType entryType, Serialization::BinaryInputArchive& archive )
+    {
+        if ( !IsInitialized() || key == 0 )
+        {
+            return false;
+        }
+
+        FileSystem::Path const entryPath = GetEntryPath( key );
+        if ( !FileSystem::Exists( entryPath ) )
+        {
+            return false;
+        }
+
+        // The entry might have been evicted between the checks, treat this as a miss
+        if ( !archive.ReadFromFile( entryPath ) )
+        {
+            return false;
+        }
+
+        // Guard against hash collisions between entry types
+        uint32_t version = 0;
+        uint8_t type = 0;
+        archive << version << type;
+        if ( version != s_version || type != (uint8_t) entryType )
+        {
+            return false;
+        }
+
+        // Touch the entry for LRU eviction, failures here are not important
+        std::error_code ec;
+        std::filesystem::last_write_time( entryPath.c_str(), std::filesystem::file_time_type::clock::now(), ec );
+        return true;
+    }
+
+    bool ImportCache::WriteEntry( uint64_t key, Serialization::BinaryOutputArchive& archive )
+    {
+        FileSystem::Path const entryPath = GetEntryPath( key );
+        if ( !entryPath.EnsureDirectoryExists() )
+        {
+            return false;
+        }
+
+        // Write to a unique temporary file and then rename it into place, so that readers never see partially written entries
+        FileSystem::Path tempFilePath = entryPath;
+        tempFilePath.ReplaceExtension( UUID::GenerateID().ToString().c_str() );
+
+        if ( !archive.WriteToFile( tempFilePath ) )
+        {
+            EE_LOG_WARNING( "Import", "Import Cache", "Failed to write cache entry: %s", tempFilePath.c_str() );
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename( tempFilePath.c_str(), entryPath.c_str(), ec );
+        if ( ec )
+        {
+            std::filesystem::remove( tempFilePath.c_str(), ec );
+            return false;
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ImportCache::WriteImportedData( Serialization::BinaryOutputArchive& archive, ImportedData const& importedData )
+    {
+        EE_ASSERT( !importedData.HasErrors() );
+        archive << importedData.m_warnings;
+    }
+
+    void ImportCache::ReadImportedData( Serialization::BinaryInputArchive& archive, ImportedData& importedData, FileSystem::Path const& sourceFilePath )
+    {
+        importedData.m_sourcePath = sourceFilePath;
+        archive << importedData.m_warnings;
+    }
+
+    void ImportCache::WriteSkeleton( Serialization::BinaryOutputArchive& archive, ImportedSkeleton const& importedSkeleton )
+    {
+        archive << importedSkeleton.m_name << importedSkeleton.m_numBonesToSampleAtLowLOD;
+
+        // Bones are not default constructible so we cant use the array serialization
+        archive << (uint32_t) importedSkeleton.m_bones.size();
+        for ( ImportedSkeleton::Bone const& bone : importedSkeleton.m_bones )
+        {
+            archive << bone.m_name << bone.m_parentBoneName << bone.m_parentBoneIdx << bone.m_localTransform << bone.m_globalTransform;
+        }
+    }
+
+    void ImportCache::ReadSkeleton( Serialization::BinaryInputArchive& archive, ImportedSkeleton& importedSkeleton )
+    {
+        archive << importedSkeleton.m_name << importedSkeleton.m_numBonesToSampleAtLowLOD;
+
+        uint32_t numBones = 0;
+        archive << numBones;
+
+        importedSkeleton.m_bones.clear();
+        importedSkeleton.m_bones.reserve( numBones );
+
+        StringID boneName;
+        for ( auto i = 0u; i < numBones; i++ )
+        {
+            archive << boneName;
+            ImportedSkeleton::Bone& bone = importedSkeleton.m_bones.emplace_back( boneName.c_str() );
+            archive << bone.m_parentBoneName << bone.m_parentBoneIdx << bone.m_localTransform << bone.m_globalTransform;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    TUniquePtr<ImportedSkeleton> ImportCache::TryRestoreSkeleton( uint64_t key, FileSystem::Path const& sourceFilePath )
+    {
+        Serialization::BinaryInputArchive archive;
+        if ( !TryOpenEntry( key, EntryType::Skeleton, archive ) )
+        {
+            return nullptr;
+        }
+
+        TUniquePtr<ImportedSkeleton> pImportedSkeleton( EE::New<ImportedSkeleton>() );
+        ReadImportedData( archive, *pImportedSkeleton, sourceFilePath );
+        ReadSkeleton( archive, *pImportedSkeleton );
+        return pImportedSkeleton;
+    }
+
+    bool ImportCache::Store( uint64_t key, ImportedSkeleton const& importedSkeleton )
+    {
+        if ( !IsInitialized() || key == 0 )
+        {
+            return false;
+        }
+
+        Serialization::BinaryOutputArchive archive;
+        archive << s_version << (uint8_t) EntryType::Skeleton;
+        WriteImportedData( archive, importedSkeleton );
+        WriteSkeleton( archive, importedSkeleton );
+        return WriteEntry( key, archive );
+    }
+
+    //-------------------------------------------------------------------------
+
+    TUniquePtr<ImportedAnimation> ImportCache::TryRestoreAnimation( uint64_t key, FileSystem::Path const& sourceFilePath, ImportedSkeleton const& importedSkeleton )
+    {
+        Serialization::BinaryInputArchive archive;
+        if ( !TryOpenEntry( key, EntryType::Animation, archive ) )
+        {
+            return nullptr;
+        }
+
+        TUniquePtr<ImportedAnimation> pImportedAnimation( EE::New<ImportedAnimation>( importedSkeleton ) );
+        ReadImportedData( archive, *pImportedAnimation, sourceFilePath );
+        archive << pImportedAnimation->m_samplingFrameRate << pImportedAnimation->m_duration << pImportedAnimation->m_numFrames << pImportedAnimation->m_isAdditive;
+        archive << pImportedAnimation->m_rootTransforms;
+
+        uint32_t numTracks = 0;
+        archive << numTracks;
+        pImportedAnimation->m_tracks.resize( numTracks );
+        for ( ImportedAnimation::TrackData& track : pImportedAnimation->m_tracks )
+        {
+            archive << track.m_localTransforms << track.m_globalTransforms;
+        }
+
+        return pImportedAnimation;
+    }
+
+    bool ImportCache::Store( uint64_t key, ImportedAnimation const& importedAnimation )
+    {
+        if ( !IsInitialized() || key == 0 )
+        {
+            return false;
+        }
+
+        Serialization::BinaryOutputArchive archive;
+        archive << s_version << (uint8_t) EntryType::Animation;
+        WriteImportedData( archive, importedAnimation );
+        archive << importedAnimation.m_samplingFrameRate << importedAnimation.m_duration << importedAnimation.m_numFrames << importedAnimation.m_isAdditive;
+        archive << importedAnimation.m_rootTransforms;
+
+        archive << (uint32_t) importedAnimation.m_tracks.size();
+        for ( ImportedAnimation::TrackData const& track : importedAnimation.m_tracks )
+        {
+            archive << track.m_localTransforms << track.m_globalTransforms;
+        }
+
+        return WriteEntry( key, archive );
+    }
+
+    //-------------------------------------------------------------------------
+
+    TUniquePtr<ImportedMesh> ImportCache::TryRestoreMesh( uint64_t key, FileSystem::Path const& sourceFilePath )
+    {
+        Serialization::BinaryInputArchive archive;
+        if ( !TryOpenEntry( key, EntryType::Mesh, archive ) )
+        {
+            return nullptr;
+        }
+
+        TUniquePtr<ImportedMesh> pImportedMesh( EE::New<ImportedMesh>() );
+        ReadImportedData( archive, *pImportedMesh, sourceFilePath );
+        archive << pImportedMesh->m_isSkeletalMesh << pImportedMesh->m_maxNumberOfBoneInfluences;
+
+        if ( pImportedMesh->m_isSkeletalMesh )
+        {
+            ReadImportedData( archive, pImportedMesh->m_skeleton, sourceFilePath );
+            ReadSkeleton( archive, pImportedMesh->m_skeleton );
+        }
+
+        uint32_t numSections = 0;
+        archive << numSections;
+        pImportedMesh->m_geometrySections.resize( numSections );
+        for ( ImportedMesh::GeometrySection& section : pImportedMesh->m_geometrySections )
+        {
+            archive << section.m_name << section.m_materialNameID << section.m_numUVChannels << section.m_clockwiseWinding << section.m_indices;
+
+            uint32_t numVertices = 0;
+            archive << numVertices;
+            section.m_vertices.resize( numVertices );
+            for ( ImportedMesh::VertexData& vertex : section.m_vertices )
+            {
+                archive << vertex.m_position << vertex.m_color << vertex.m_normal << vertex.m_tangent << vertex.m_binormal;
+                archive << vertex.m_texCoords << vertex.m_boneIndices << vertex.m_boneWeights;
+            }
+        }
+
+        return pImportedMesh;
+    }
+
+    bool ImportCache::Store( uint64_t key, ImportedMesh const& importedMesh )
+    {
+        if ( !IsInitialized() || key == 0 )
+        {
+            return false;
+        }
+
+        Serialization::BinaryOutputArchive archive;
+        archive << s_version << (uint8_t) EntryType::Mesh;
+        WriteImportedData( archive, importedMesh );
+        archive << importedMesh.m_isSkeletalMesh << importedMesh.m_maxNumberOfBoneInfluences;
+
+        if ( importedMesh.m_isSkeletalMesh )
+        {
+            WriteImportedData( archive, importedMesh.m_skeleton );
+            WriteSkeleton( archive, importedMesh.m_skeleton );
+        }
+
+        archive << (uint32_t) importedMesh.m_geometrySections.size();
+        for ( ImportedMesh::GeometrySection const& section : importedMesh.m_geometrySections )
+        {
+            archive << section.m_name << section.m_materialNameID << section.m_numUVChannels << section.m_clockwiseWinding << section.m_indices;
+
+            archive << (uint32_t) section.m_vertices.size();
+            for ( ImportedMesh::VertexData const& vertex : section.m_vertices )
+            {
+                archive << vertex.m_position << vertex.m_color << vertex.m_normal << vertex.m_tangent << vertex.m_binormal;
+                archive << vertex.m_texCoords << vertex.m_boneIndices << vertex.m_boneWeights;
+            }
+        }
+
+        return WriteEntry( key, archive );
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Memory/Pointers.h"
+#include "Base/Types/StringID.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Serialization
+{
+    class BinaryInputArchive;
+    class BinaryOutputArchive;
+}
+
+namespace EE::Import
+{
+    class ImportedData;
+    class ImportedMesh;
+    class ImportedSkeleton;
+    class ImportedAnimation;
+}
+
+//-------------------------------------------------------------------------
+// Import Cache
+//-------------------------------------------------------------------------
+// Parsing FBX/glTF files is by far the most expensive step when compiling meshes, skeletons and animations and the same source file is often read many times
+// The cache stores the result of each read as a compact binary intermediate, keyed on the contents of the source file and any files it references (i.e. external gltf buffers), the importer version and the read parameters
+// Entries share the compiled resource cache layout and extension, so they are evicted together with the compiled resources
+// This is a process wide cache since the importer is a set of free functions, it is disabled until initialized
+
+namespace EE::Import
+{
+    class EE_ENGINETOOLS_API ImportCache
+    {
+    public:
+
+        // Update this value whenever the FBX/glTF readers or the imported data change, to invalidate all cached entries
+        constexpr static uint32_t const s_version = 1;
+
+    public:
+
+        static bool Initialize( FileSystem::Path const& cacheDirectoryPath );
+        static void Shutdown();
+        static bool IsInitialized();
+
+        // Keys
+        //-------------------------------------------------------------------------
+        // Keys are 0 (i.e. not cached) if the source file or any of the files it references could not be read
+
+        static uint64_t CalculateSkeletonKey( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName, TVector<StringID> const& listOfHighLODBones );
+        static uint64_t CalculateAnimationKey( FileSystem::Path const& sourceFilePath, ImportedSkeleton const& importedSkeleton, String const& animationName );
+        static uint64_t CalculateMeshKey( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, bool isSkeletalMesh, int32_t maxBoneInfluences );
+
+        // Entries
+        //-------------------------------------------------------------------------
+        // Only successfully imported data should be stored, restored data has its source path set to the requested path
+
+        static TUniquePtr<ImportedSkeleton> TryRestoreSkeleton( uint64_t key, FileSystem::Path const& sourceFilePath );
+        static TUniquePtr<ImportedAnimation> TryRestoreAnimation( uint64_t key, FileSystem::Path const& sourceFilePath, ImportedSkeleton const& importedSkeleton );
+        static TUniquePtr<ImportedMesh> TryRestoreMesh( uint64_t key, FileSystem::Path const& sourceFilePath );
+
+        static bool Store( uint64_t key, ImportedSkeleton const& importedSkeleton );
+        static bool Store( uint64_t key, ImportedAnimation const& importedAnimation );
+        static bool Store( uint64_t key, ImportedMesh const& importedMesh );
+
+    private:
+
+        enum class EntryType : uint8_t
+        {
+            Skeleton = 0,
+            Animation,
+            Mesh,
+        };
+
+        static uint64_t CalculateKey( FileSystem::Path const& sourceFilePath, EntryType entryType, TVector<uint64_t>& parameterHashes );
+        static FileSystem::Path GetEntryPath( uint64_t key );
+
+        static bool TryOpenEntry( uint64_t key, EntryType entryType, Serialization::BinaryInputArchive& archive );
+        static bool WriteEntry( uint64_t key, Serialization::BinaryOutputArchive& archive );
+
+        static void WriteImportedData( Serialization::BinaryOutputArchive& archive, ImportedData const& importedData );
+        static void ReadImportedData( Serialization::BinaryInputArchive& archive, ImportedData& importedData, FileSystem::Path const& sourceFilePath );
+        static void WriteSkeleton( Serialization::BinaryOutputArchive& archive, ImportedSkeleton const& importedSkeleton );
+        static void ReadSkeleton( Serialization::BinaryInputArchive& archive, ImportedSkeleton& importedSkeleton );
+    };
+}
@@ -14,6 +14,7 @@ namespace EE::Import
 {
     class EE_ENGINETOOLS_API ImportedAnimation : public ImportedData
     {
+        friend class ImportCache;
 
     public:
 
@@ -11,6 +11,7 @@ namespace EE::Import
 {
     class EE_ENGINETOOLS_API ImportedData
     {
+        friend class ImportCache;
 
     public:
 
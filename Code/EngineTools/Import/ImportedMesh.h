@@ -12,6 +12,7 @@ namespace EE::Import
 {
     class EE_ENGINETOOLS_API ImportedMesh : public ImportedData
     {
+        friend class ImportCache;
 
     public:
 
@@ -10,6 +10,7 @@ namespace EE::Import
 {
     class EE_ENGINETOOLS_API ImportedSkeleton : public ImportedData
     {
+        friend class ImportCache;
 
     public:
 
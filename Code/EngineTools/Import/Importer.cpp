@@ -3,6 +3,7 @@
 #include "ImportedSkeleton.h"
 #include "ImportedAnimation.h"
 #include "ImportedImage.h"
+#include "ImportCache.h"
 #include "Formats/FBX.h"
 #include "Formats/GLTF.h"
 #include "Base/ThirdParty/stb/stb_image.h"
@@ -33,11 +34,35 @@ namespace EE::Import
 
     //-------------------------------------------------------------------------
 
+    bool GetReferencedSourceFiles( FileSystem::Path const& sourceFilePath, TVector<FileSystem::Path>& outReferencedFiles )
+    {
+        EE_ASSERT( sourceFilePath.IsValid() );
+
+        // FBX files and images are always imported from a single file
+        auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+        if ( extension == "gltf" || extension == "glb" )
+        {
+            return gltf::GetReferencedFiles( sourceFilePath, outReferencedFiles );
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
     TUniquePtr<ImportedMesh> ReadStaticMesh( ReaderContext const& ctx, FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude )
     {
         EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
 
-        TUniquePtr<ImportedMesh> pImportedMesh = nullptr;
+        uint64_t const cacheKey = ImportCache::IsInitialized() ? ImportCache::CalculateMeshKey( sourceFilePath, meshesToInclude, false, 0 ) : 0;
+        TUniquePtr<ImportedMesh> pImportedMesh = ImportCache::TryRestoreMesh( cacheKey, sourceFilePath );
+        if ( pImportedMesh != nullptr )
+        {
+            ValidateRawAsset( ctx, pImportedMesh.get() );
+            return pImportedMesh;
+        }
+
+        //-------------------------------------------------------------------------
 
         auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
         if ( extension == "fbx" )
@@ -57,7 +82,11 @@ namespace EE::Import
 
         //-------------------------------------------------------------------------
 
-        if ( !ValidateRawAsset( ctx, pImportedMesh.get() ) )
+        if ( ValidateRawAsset( ctx, pImportedMesh.get() ) )
+        {
+            ImportCache::Store( cacheKey, *pImportedMesh );
+        }
+        else
         {
             pImportedMesh = nullptr;
         }
@@ -73,7 +102,15 @@ namespace EE::Import
     {
         EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
 
-        TUniquePtr<ImportedMesh> pImportedMesh = nullptr;
+        uint64_t const cacheKey = ImportCache::IsInitialized() ? ImportCache::CalculateMeshKey( sourceFilePath, meshesToInclude, true, maxBoneInfluences ) : 0;
+        TUniquePtr<ImportedMesh> pImportedMesh = ImportCache::TryRestoreMesh( cacheKey, sourceFilePath );
+        if ( pImportedMesh != nullptr )
+        {
+            ValidateRawAsset( ctx, pImportedMesh.get() );
+            return pImportedMesh;
+        }
+
+        //-------------------------------------------------------------------------
 
         auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
         if ( extension == "fbx" )
@@ -93,7 +130,11 @@ namespace EE::Import
 
         //-------------------------------------------------------------------------
 
-        if ( !ValidateRawAsset( ctx, pImportedMesh.get() ) )
+        if ( ValidateRawAsset( ctx, pImportedMesh.get() ) )
+        {
+            ImportCache::Store( cacheKey, *pImportedMesh );
+        }
+        else
         {
             pImportedMesh = nullptr;
         }
@@ -109,7 +150,15 @@ namespace EE::Import
     {
         EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
 
-        TUniquePtr<ImportedSkeleton> pImportedSkeleton = nullptr;
+        uint64_t const cacheKey = ImportCache::IsInitialized() ? ImportCache::CalculateSkeletonKey( sourceFilePath, skeletonRootBoneName, listOfHighLODBones ) : 0;
+        TUniquePtr<ImportedSkeleton> pImportedSkeleton = ImportCache::TryRestoreSkeleton( cacheKey, sourceFilePath );
+        if ( pImportedSkeleton != nullptr )
+        {
+            ValidateRawAsset( ctx, pImportedSkeleton.get() );
+            return pImportedSkeleton;
+        }
+
+        //-------------------------------------------------------------------------
 
         auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
         if ( extension == "fbx" )
@@ -127,11 +176,18 @@ namespace EE::Import
             ctx.m_errorDelegate( buffer );
         }
 
-        pImportedSkeleton->Finalize( listOfHighLODBones );
+        if ( pImportedSkeleton != nullptr )
+        {
+            pImportedSkeleton->Finalize( listOfHighLODBones );
+        }
 
         //-------------------------------------------------------------------------
 
-        if ( !ValidateRawAsset( ctx, pImportedSkeleton.get() ) )
+        if ( ValidateRawAsset( ctx, pImportedSkeleton.get() ) )
+        {
+            ImportCache::Store( cacheKey, *pImportedSkeleton );
+        }
+        else
         {
             pImportedSkeleton = nullptr;
         }
@@ -147,7 +203,15 @@ namespace EE::Import
     {
         EE_ASSERT( ctx.IsValid() && sourceFilePath.IsValid() && importedSkeleton.IsValid() );
 
-        TUniquePtr<ImportedAnimation> pImportedAnimation = nullptr;
+        uint64_t const cacheKey = ImportCache::IsInitialized() ? ImportCache::CalculateAnimationKey( sourceFilePath, importedSkeleton, animationName ) : 0;
+        TUniquePtr<ImportedAnimation> pImportedAnimation = ImportCache::TryRestoreAnimation( cacheKey, sourceFilePath, importedSkeleton );
+        if ( pImportedAnimation != nullptr )
+        {
+            ValidateRawAsset( ctx, pImportedAnimation.get() );
+            return pImportedAnimation;
+        }
+
+        //-------------------------------------------------------------------------
 
         auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
         if ( extension == "fbx" )
@@ -176,7 +240,11 @@ namespace EE::Import
 
             //-------------------------------------------------------------------------
 
-            if ( !ValidateRawAsset( ctx, pImportedAnimation.get() ) )
+            if ( ValidateRawAsset( ctx, pImportedAnimation.get() ) )
+            {
+                ImportCache::Store( cacheKey, *pImportedAnimation );
+            }
+            else
             {
                 pImportedAnimation = nullptr;
             }
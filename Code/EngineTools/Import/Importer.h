@@ -27,6 +27,10 @@ namespace EE::Import
 
     //-------------------------------------------------------------------------
 
+    // Get all the files, other than the source file itself, that are read when importing from the specified source file (e.g. external gltf buffers)
+    // Returns false if these cant be determined, in which case any data derived from this source file cant be content addressed
+    EE_ENGINETOOLS_API bool GetReferencedSourceFiles( FileSystem::Path const& sourceFilePath, TVector<FileSystem::Path>& outReferencedFiles );
+
     EE_ENGINETOOLS_API TUniquePtr<ImportedSkeleton> ReadSkeleton( ReaderContext const& ctx, FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName = String(), TVector<StringID> const& listOfHighLODBones = TVector<StringID>() );
     EE_ENGINETOOLS_API TUniquePtr<ImportedAnimation> ReadAnimation( ReaderContext const& ctx, FileSystem::Path const& sourceFilePath, Import::ImportedSkeleton const& importedSkeleton, String const& animationName = String() );
     EE_ENGINETOOLS_API TUniquePtr<ImportedMesh> ReadStaticMesh( ReaderContext const& ctx, FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude = TVector<String>() );
@@ -15,18 +15,49 @@
 #include "Base/Resource/ResourceHeader.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Serialization/BinarySerialization.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Encoding/Hash.h"
 #include <bfxSystem.h>
 
 //-------------------------------------------------------------------------
 
 namespace EE::Navmesh
 {
-    NavmeshGenerator::NavmeshGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& outputPath, EntityModel::SerializedEntityCollection const& entityCollection, NavmeshBuildSettings const& buildSettings )
+    static bool LogGenerationError( char const* pFormat, ... )
+    {
+        va_list args;
+        va_start( args, pFormat );
+        Log::AddEntryVarArgs( Log::Severity::Error, "Navmesh", "Generation", __FILE__, __LINE__, pFormat, args );
+        va_end( args );
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void NavmeshGeometryCache::Clear()
+    {
+        for ( auto& meshPair : m_meshes )
+        {
+            EE::Delete( meshPair.second );
+        }
+        m_meshes.clear();
+
+        for ( auto& geometryPair : m_transformedGeometry )
+        {
+            EE::Delete( geometryPair.second );
+        }
+        m_transformedGeometry.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    NavmeshGenerator::NavmeshGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& outputPath, EntityModel::SerializedEntityCollection const& entityCollection, NavmeshBuildSettings const& buildSettings, NavmeshGeometryCache* pGeometryCache )
         : m_rawResourceDirectoryPath( rawResourceDirectoryPath )
         , m_outputPath( outputPath )
         , m_typeRegistry( typeRegistry )
         , m_entityCollection( entityCollection )
         , m_buildSettings( buildSettings )
+        , m_pGeometryCache( ( pGeometryCache != nullptr ) ? pGeometryCache : &m_transientGeometryCache )
         , m_asyncTask( [this] ( TaskSetPartition range, uint32_t threadnum ) { GenerateSync(); } )
     {
         EE_ASSERT( rawResourceDirectoryPath.IsValid() );
@@ -45,6 +76,7 @@ namespace EE::Navmesh
     void NavmeshGenerator::GenerateAsync( TaskSystem& taskSystem )
     {
         m_isGeneratingAsync = true;
+        m_pTaskSystem = &taskSystem;
         taskSystem.ScheduleTask( &m_asyncTask );
     }
 
@@ -168,137 +200,364 @@ namespace EE::Navmesh
 
     bool NavmeshGenerator::CollectTriangles()
     {
-        auto LogError = [] ( char const* pFormat, ... )
+        Printf( m_progressMessage, 256, "Step 2/4: Collecting Triangles" );
+        m_progress = 0.0f;
+
+        // Sync generation (i.e. from the resource compiler) doesnt have a task system available so create one for the duration of the collection
+        TaskSystem* pLocalTaskSystem = nullptr;
+        if ( m_pTaskSystem == nullptr )
+        {
+            pLocalTaskSystem = EE::New<TaskSystem>( Threading::GetProcessorInfo().m_numLogicalCores );
+            pLocalTaskSystem->Initialize();
+        }
+
+        TaskSystem& taskSystem = ( pLocalTaskSystem != nullptr ) ? *pLocalTaskSystem : *m_pTaskSystem;
+
+        //-------------------------------------------------------------------------
+
+        m_pGeometryCache->m_buildIdx++;
+
+        bool const result = CollectMeshGeometry( taskSystem );
+        if ( result )
+        {
+            CollectBuildFaces( taskSystem );
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( pLocalTaskSystem != nullptr )
+        {
+            pLocalTaskSystem->Shutdown();
+            EE::Delete( pLocalTaskSystem );
+        }
+
+        return result;
+    }
+
+    bool NavmeshGenerator::CollectMeshGeometry( TaskSystem& taskSystem )
+    {
+        using MeshGeometry = NavmeshGeometryCache::MeshGeometry;
+
+        struct MeshToLoad
         {
-            va_list args;
-            va_start( args, pFormat );
-            Log::AddEntryVarArgs( Log::Severity::Error, "Navmesh", "Generation", __FILE__, __LINE__, pFormat, args );
-            va_end( args );
-            return false;
+            ResourcePath                        m_descriptorPath;
+            FileSystem::Path                    m_descriptorFilePath;
+            MeshGeometry*                       m_pGeometry = nullptr;
         };
 
+        // Find all meshes that are either new or have changed since the last build
         //-------------------------------------------------------------------------
 
-        Printf( m_progressMessage, 256, "Step 2/4: Collecting Triangles" );
-        m_progress = 0.0f;
+        uint32_t const buildIdx = m_pGeometryCache->m_buildIdx;
+        TVector<MeshToLoad> meshesToLoad;
 
-        float cnt = 0;
         for ( auto const& primitiveDesc : m_collisionPrimitives )
         {
-            // Load descriptor
-            //-------------------------------------------------------------------------
-
-            FileSystem::Path meshDescriptorFilePath;
-            if ( primitiveDesc.first.IsValid() )
+            if ( !primitiveDesc.first.IsValid() )
             {
-                meshDescriptorFilePath = ResourcePath::ToFileSystemPath( m_rawResourceDirectoryPath, primitiveDesc.first );
+                return LogGenerationError( "Invalid source data path (%s) for physics mesh descriptor", primitiveDesc.first.c_str() );
             }
-            else
+
+            FileSystem::Path const descriptorFilePath = ResourcePath::ToFileSystemPath( m_rawResourceDirectoryPath, primitiveDesc.first );
+            uint64_t const descriptorTimestamp = FileSystem::GetFileModifiedTime( descriptorFilePath );
+
+            MeshGeometry*& pGeometry = m_pGeometryCache->m_meshes[primitiveDesc.first];
+            if ( pGeometry == nullptr )
             {
-                return LogError( "Invalid source data path (%s) for physics mesh descriptor", primitiveDesc.first.c_str() );
+                pGeometry = EE::New<MeshGeometry>();
             }
 
-            Physics::PhysicsCollisionMeshResourceDescriptor resourceDescriptor;
-            if ( !Resource::ResourceDescriptor::TryReadFromFile( m_typeRegistry, meshDescriptorFilePath, resourceDescriptor ) )
+            pGeometry->m_lastUsedBuildIdx = buildIdx;
+
+            bool const isUpToDate = pGeometry->m_isValid && pGeometry->m_descriptorTimestamp == descriptorTimestamp && pGeometry->m_sourceTimestamp == FileSystem::GetFileModifiedTime( pGeometry->m_sourceFilePath );
+            if ( !isUpToDate )
             {
-                return LogError( "Failed to read physics mesh resource descriptor from file: %s", meshDescriptorFilePath.c_str() );
+                pGeometry->m_descriptorTimestamp = descriptorTimestamp;
+                meshesToLoad.push_back( { primitiveDesc.first, descriptorFilePath, pGeometry } );
             }
+        }
 
-            // Load mesh
-            //-------------------------------------------------------------------------
-
-            FileSystem::Path meshFilePath;
-            if ( primitiveDesc.first.IsValid() )
+        // Evict all meshes that are no longer used
+        for ( auto iter = m_pGeometryCache->m_meshes.begin(); iter != m_pGeometryCache->m_meshes.end(); )
+        {
+            if ( iter->second->m_lastUsedBuildIdx != buildIdx )
             {
-                meshFilePath = ResourcePath::ToFileSystemPath( m_rawResourceDirectoryPath, resourceDescriptor.m_sourcePath );
+                EE::Delete( iter->second );
+                iter = m_pGeometryCache->m_meshes.erase( iter );
             }
             else
             {
-                return LogError( "Invalid source data path (%) in physics collision descriptor: %s", resourceDescriptor.m_sourcePath.c_str(), meshDescriptorFilePath.c_str() );
+                ++iter;
             }
+        }
 
-            Import::ReaderContext readerCtx = 
-            { 
-                [this] ( char const* pString ) { EE_LOG_WARNING( "Navmesh", "Generation", pString ); },
-                [this] ( char const* pString ) { EE_LOG_ERROR( "Navmesh", "Generation", pString ); }
-            };
+        // Load all changed meshes in parallel
+        //-------------------------------------------------------------------------
+        // We use the same import request as the collision mesh compiler so the importer can reuse the cached intermediate from the collision mesh compilation
 
-            TVector<String> meshesToInclude;
-            if ( !resourceDescriptor.m_sourceItemName.empty() )
+        struct MeshLoadTask : public ITaskSet
+        {
+            MeshLoadTask( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, TVector<MeshToLoad>& meshesToLoad )
+                : m_typeRegistry( typeRegistry )
+                , m_rawResourceDirectoryPath( rawResourceDirectoryPath )
+                , m_meshesToLoad( meshesToLoad )
             {
-                meshesToInclude.emplace_back( resourceDescriptor.m_sourceItemName );
+                m_SetSize = (uint32_t) m_meshesToLoad.size();
             }
 
-            TUniquePtr<Import::ImportedMesh> pImportedMesh = Import::ReadStaticMesh( readerCtx, meshFilePath, meshesToInclude );
-            if ( pImportedMesh == nullptr )
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
             {
-                return LogError( "Failed to read mesh from source file: %s" );
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    MeshToLoad& meshToLoad = m_meshesToLoad[i];
+                    meshToLoad.m_pGeometry->m_isValid = LoadMesh( meshToLoad );
+                    meshToLoad.m_pGeometry->m_version++;
+                }
             }
 
-            EE_ASSERT( pImportedMesh->IsValid() );
+            bool LoadMesh( MeshToLoad& meshToLoad ) const
+            {
+                MeshGeometry* pGeometry = meshToLoad.m_pGeometry;
+                pGeometry->m_triangleVertices.clear();
 
-            // Add triangles
-            //-------------------------------------------------------------------------
+                // Load descriptor
+                //-------------------------------------------------------------------------
 
-            for ( CollisionMesh const& cm : primitiveDesc.second )
-            {
-                Float3 const finalScale = ( cm.m_localScale * cm.m_worldTransform.GetScale() ).ToFloat3();
- 
-                int32_t numNegativelyScaledAxes = ( finalScale.m_x < 0 ) ? 1 : 0;
-                numNegativelyScaledAxes += ( finalScale.m_y < 0 ) ? 1 : 0;
-                numNegativelyScaledAxes += ( finalScale.m_z < 0 ) ? 1 : 0;
+                Physics::PhysicsCollisionMeshResourceDescriptor resourceDescriptor;
+                if ( !Resource::ResourceDescriptor::TryReadFromFile( m_typeRegistry, meshToLoad.m_descriptorFilePath, resourceDescriptor ) )
+                {
+                    return LogGenerationError( "Failed to read physics mesh resource descriptor from file: %s", meshToLoad.m_descriptorFilePath.c_str() );
+                }
+
+                if ( !resourceDescriptor.m_sourcePath.IsValid() )
+                {
+                    return LogGenerationError( "Invalid source data path (%s) in physics collision descriptor: %s", resourceDescriptor.m_sourcePath.c_str(), meshToLoad.m_descriptorFilePath.c_str() );
+                }
 
-                bool const flipWindingDueToScale = Math::IsOdd( numNegativelyScaledAxes );
+                pGeometry->m_sourceFilePath = ResourcePath::ToFileSystemPath( m_rawResourceDirectoryPath, resourceDescriptor.m_sourcePath );
+                pGeometry->m_sourceTimestamp = FileSystem::GetFileModifiedTime( pGeometry->m_sourceFilePath );
 
+                // Load mesh
                 //-------------------------------------------------------------------------
 
-                Matrix meshTransform = cm.m_worldTransform.ToMatrixNoScale();
-                meshTransform.SetScale( finalScale );
+                Import::ReaderContext readerCtx =
+                {
+                    [] ( char const* pString ) { EE_LOG_WARNING( "Navmesh", "Generation", pString ); },
+                    [] ( char const* pString ) { EE_LOG_ERROR( "Navmesh", "Generation", pString ); }
+                };
+
+                TUniquePtr<Import::ImportedMesh> pImportedMesh = Import::ReadStaticMesh( readerCtx, pGeometry->m_sourceFilePath, resourceDescriptor.m_meshesToInclude );
+                if ( pImportedMesh == nullptr )
+                {
+                    return LogGenerationError( "Failed to read mesh from source file: %s", pGeometry->m_sourceFilePath.c_str() );
+                }
+
+                EE_ASSERT( pImportedMesh->IsValid() );
+                pImportedMesh->ApplyScale( resourceDescriptor.m_scale );
 
+                // Flatten triangles
                 //-------------------------------------------------------------------------
 
                 for ( auto const& geometrySection : pImportedMesh->GetGeometrySections() )
                 {
                     // NavPower expects counterclockwise winding
-                    bool flipWinding = geometrySection.m_clockwiseWinding ? true : false;
-                    if ( flipWindingDueToScale )
-                    {
-                        flipWinding = !flipWinding;
-                    }
-
-                    //-------------------------------------------------------------------------
+                    bool const flipWinding = geometrySection.m_clockwiseWinding;
 
                     int32_t const numTriangles = geometrySection.GetNumTriangles();
-                    int32_t const numIndices = (int32_t) geometrySection.m_indices.size();
                     for ( auto t = 0; t < numTriangles; t++ )
                     {
                         int32_t const i = t * 3;
-                        EE_ASSERT( i <= numIndices - 3 );
+                        pGeometry->m_triangleVertices.emplace_back( geometrySection.m_vertices[geometrySection.m_indices[flipWinding ? i + 2 : i]].m_position );
+                        pGeometry->m_triangleVertices.emplace_back( geometrySection.m_vertices[geometrySection.m_indices[i + 1]].m_position );
+                        pGeometry->m_triangleVertices.emplace_back( geometrySection.m_vertices[geometrySection.m_indices[flipWinding ? i : i + 2]].m_position );
+                    }
+                }
 
-                        // NavPower expects counterclockwise winding
-                        int32_t const index0 = geometrySection.m_indices[flipWinding ? i + 2 : i];
-                        int32_t const index1 = geometrySection.m_indices[i + 1];
-                        int32_t const index2 = geometrySection.m_indices[flipWinding ? i : i + 2];
+                return true;
+            }
 
-                        // Add triangle
-                        auto& buildFace = m_buildFaces.emplace_back( bfx::BuildFace() );
-                        buildFace.m_type = bfx::WALKABLE_FACE;
+        private:
 
-                        buildFace.m_verts[0] = ToBfx( meshTransform.TransformPoint( geometrySection.m_vertices[index0].m_position ) );
-                        buildFace.m_verts[1] = ToBfx( meshTransform.TransformPoint( geometrySection.m_vertices[index1].m_position ) );
-                        buildFace.m_verts[2] = ToBfx( meshTransform.TransformPoint( geometrySection.m_vertices[index2].m_position ) );
-                    }
-                }
+            TypeSystem::TypeRegistry const&     m_typeRegistry;
+            FileSystem::Path const&             m_rawResourceDirectoryPath;
+            TVector<MeshToLoad>&                m_meshesToLoad;
+        };
+
+        //-------------------------------------------------------------------------
 
-                // Update progress
-                cnt++;
-                m_progress = cnt / m_numCollisionPrimitivesToProcess;
+        if ( !meshesToLoad.empty() )
+        {
+            MeshLoadTask loadTask( m_typeRegistry, m_rawResourceDirectoryPath, meshesToLoad );
+            taskSystem.ScheduleTask( &loadTask );
+            taskSystem.WaitForTask( &loadTask );
+        }
+
+        m_progress = 0.5f;
+
+        //-------------------------------------------------------------------------
+
+        for ( MeshToLoad const& meshToLoad : meshesToLoad )
+        {
+            if ( !meshToLoad.m_pGeometry->m_isValid )
+            {
+                return LogGenerationError( "Failed to collect geometry for physics mesh: %s", meshToLoad.m_descriptorPath.c_str() );
             }
         }
 
         return true;
     }
 
+    void NavmeshGenerator::CollectBuildFaces( TaskSystem& taskSystem )
+    {
+        using MeshGeometry = NavmeshGeometryCache::MeshGeometry;
+        using TransformedGeometry = NavmeshGeometryCache::TransformedGeometry;
+
+        struct GeometryToTransform
+        {
+            MeshGeometry const*                 m_pMeshGeometry = nullptr;
+            CollisionMesh const*                m_pCollisionMesh = nullptr;
+            TransformedGeometry*                m_pTransformedGeometry = nullptr;
+        };
+
+        // Find all transformed geometry that needs to be regenerated
+        //-------------------------------------------------------------------------
+
+        uint32_t const buildIdx = m_pGeometryCache->m_buildIdx;
+        TVector<GeometryToTransform> geometryToTransform;
+        TVector<TransformedGeometry const*> usedGeometry;
+        usedGeometry.reserve( m_numCollisionPrimitivesToProcess );
+
+        for ( auto const& primitiveDesc : m_collisionPrimitives )
+        {
+            MeshGeometry const* pMeshGeometry = m_pGeometryCache->m_meshes[primitiveDesc.first];
+            EE_ASSERT( pMeshGeometry != nullptr && pMeshGeometry->m_isValid );
+
+            for ( CollisionMesh const& cm : primitiveDesc.second )
+            {
+                uint64_t const keyHashes[3] =
+                {
+                    (uint64_t) primitiveDesc.first.GetID(),
+                    Hash::GetHash64( &cm.m_worldTransform, sizeof( Transform ) ),
+                    Hash::GetHash64( &cm.m_localScale, sizeof( Vector ) )
+                };
+
+                uint64_t const key = Hash::GetHash64( keyHashes, sizeof( keyHashes ) );
+
+                TransformedGeometry*& pTransformedGeometry = m_pGeometryCache->m_transformedGeometry[key];
+                if ( pTransformedGeometry == nullptr )
+                {
+                    pTransformedGeometry = EE::New<TransformedGeometry>();
+                }
+
+                // Multiple components can share the same mesh and transform, so only transform each entry once
+                if ( pTransformedGeometry->m_meshVersion != pMeshGeometry->m_version )
+                {
+                    pTransformedGeometry->m_meshVersion = pMeshGeometry->m_version;
+                    geometryToTransform.push_back( { pMeshGeometry, &cm, pTransformedGeometry } );
+                }
+
+                pTransformedGeometry->m_lastUsedBuildIdx = buildIdx;
+                usedGeometry.emplace_back( pTransformedGeometry );
+            }
+        }
+
+        // Evict all transformed geometry that is no longer used
+        for ( auto iter = m_pGeometryCache->m_transformedGeometry.begin(); iter != m_pGeometryCache->m_transformedGeometry.end(); )
+        {
+            if ( iter->second->m_lastUsedBuildIdx != buildIdx )
+            {
+                EE::Delete( iter->second );
+                iter = m_pGeometryCache->m_transformedGeometry.erase( iter );
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        // Transform all changed geometry in parallel
+        //-------------------------------------------------------------------------
+
+        struct TransformTask : public ITaskSet
+        {
+            TransformTask( TVector<GeometryToTransform>& geometryToTransform )
+                : m_geometryToTransform( geometryToTransform )
+            {
+                m_SetSize = (uint32_t) m_geometryToTransform.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    GeometryToTransform& geometry = m_geometryToTransform[i];
+                    CollisionMesh const& cm = *geometry.m_pCollisionMesh;
+
+                    Float3 const finalScale = ( cm.m_localScale * cm.m_worldTransform.GetScale() ).ToFloat3();
+
+                    int32_t numNegativelyScaledAxes = ( finalScale.m_x < 0 ) ? 1 : 0;
+                    numNegativelyScaledAxes += ( finalScale.m_y < 0 ) ? 1 : 0;
+                    numNegativelyScaledAxes += ( finalScale.m_z < 0 ) ? 1 : 0;
+
+                    // The mesh geometry is already counterclockwise so we only need to flip for mirroring
+                    bool const flipWinding = Math::IsOdd( numNegativelyScaledAxes );
+
+                    Matrix meshTransform = cm.m_worldTransform.ToMatrixNoScale();
+                    meshTransform.SetScale( finalScale );
+
+                    //-------------------------------------------------------------------------
+
+                    TVector<Float3> const& vertices = geometry.m_pMeshGeometry->m_triangleVertices;
+                    TVector<bfx::BuildFace>& buildFaces = geometry.m_pTransformedGeometry->m_buildFaces;
+
+                    size_t const numTriangles = vertices.size() / 3;
+                    buildFaces.resize( numTriangles );
+
+                    for ( size_t t = 0; t < numTriangles; t++ )
+                    {
+                        size_t const v = t * 3;
+
+                        bfx::BuildFace& buildFace = buildFaces[t];
+                        buildFace.m_type = bfx::WALKABLE_FACE;
+                        buildFace.m_verts[0] = ToBfx( meshTransform.TransformPoint( vertices[flipWinding ? v + 2 : v] ) );
+                        buildFace.m_verts[1] = ToBfx( meshTransform.TransformPoint( vertices[v + 1] ) );
+                        buildFace.m_verts[2] = ToBfx( meshTransform.TransformPoint( vertices[flipWinding ? v : v + 2] ) );
+                    }
+                }
+            }
+
+        private:
+
+            TVector<GeometryToTransform>&       m_geometryToTransform;
+        };
+
+        //-------------------------------------------------------------------------
+
+        if ( !geometryToTransform.empty() )
+        {
+            TransformTask transformTask( geometryToTransform );
+            taskSystem.ScheduleTask( &transformTask );
+            taskSystem.WaitForTask( &transformTask );
+        }
+
+        // Gather all build faces
+        //-------------------------------------------------------------------------
+
+        size_t numBuildFaces = 0;
+        for ( TransformedGeometry const* pTransformedGeometry : usedGeometry )
+        {
+            numBuildFaces += pTransformedGeometry->m_buildFaces.size();
+        }
+
+        m_buildFaces.reserve( numBuildFaces );
+        for ( TransformedGeometry const* pTransformedGeometry : usedGeometry )
+        {
+            m_buildFaces.insert( m_buildFaces.end(), pTransformedGeometry->m_buildFaces.begin(), pTransformedGeometry->m_buildFaces.end() );
+        }
+
+        m_progress = 1.0f;
+    }
+
     bool NavmeshGenerator::BuildNavmesh( NavmeshData& navmeshData )
     {
         Printf( m_progressMessage, 256, "Step 3/4: Building Navmesh" );
@@ -21,6 +21,52 @@ namespace EE::Navmesh
     struct NavmeshBuildSettings;
     class NavmeshData;
 
+    //-------------------------------------------------------------------------
+    // Navmesh Geometry Cache
+    //-------------------------------------------------------------------------
+    // Keeps the collected input geometry around between navmesh builds so that rebuilds only re-collect what changed
+    // Mesh geometry is stored in local space and is invalidated when the collision mesh descriptor or its source file change
+    // Build faces are stored per (mesh, transform), entries that werent used by the last build are evicted
+
+    class NavmeshGeometryCache
+    {
+        friend class NavmeshGenerator;
+
+        struct MeshGeometry
+        {
+            FileSystem::Path                            m_sourceFilePath;
+            uint64_t                                    m_descriptorTimestamp = 0;
+            uint64_t                                    m_sourceTimestamp = 0;
+            TVector<Float3>                             m_triangleVertices; // Counterclockwise wound triangles with the descriptor scale applied
+            uint32_t                                    m_version = 0; // Incremented every time the geometry is reloaded
+            uint32_t                                    m_lastUsedBuildIdx = 0;
+            bool                                        m_isValid = false;
+        };
+
+        struct TransformedGeometry
+        {
+            TVector<bfx::BuildFace>                     m_buildFaces;
+            uint32_t                                    m_meshVersion = 0;
+            uint32_t                                    m_lastUsedBuildIdx = 0;
+        };
+
+    public:
+
+        NavmeshGeometryCache() = default;
+        NavmeshGeometryCache( NavmeshGeometryCache const& ) = delete;
+        ~NavmeshGeometryCache() { Clear(); }
+
+        NavmeshGeometryCache& operator=( NavmeshGeometryCache const& ) = delete;
+
+        void Clear();
+
+    private:
+
+        THashMap<ResourcePath, MeshGeometry*>           m_meshes;
+        THashMap<uint64_t, TransformedGeometry*>        m_transformedGeometry;
+        uint32_t                                        m_buildIdx = 0;
+    };
+
     //-------------------------------------------------------------------------
 
     class NavmeshGenerator : public bfx::BuildProgressMonitor
@@ -45,7 +91,8 @@ namespace EE::Navmesh
 
     public:
 
-        NavmeshGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& outputPath, EntityModel::SerializedEntityCollection const& entityCollection, NavmeshBuildSettings const& buildSettings );
+        // The geometry cache is optional, without it all geometry will be collected from scratch
+        NavmeshGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& outputPath, EntityModel::SerializedEntityCollection const& entityCollection, NavmeshBuildSettings const& buildSettings, NavmeshGeometryCache* pGeometryCache = nullptr );
         ~NavmeshGenerator();
 
         inline char const* GetProgressMessage() const { return m_progressMessage; }
@@ -72,6 +119,10 @@ namespace EE::Navmesh
 
         bool CollectTriangles();
 
+        bool CollectMeshGeometry( TaskSystem& taskSystem );
+
+        void CollectBuildFaces( TaskSystem& taskSystem );
+
         bool BuildNavmesh( NavmeshData& navmeshData );
 
         bool SaveNavmesh( NavmeshData& navmeshData );
@@ -84,6 +135,8 @@ namespace EE::Navmesh
         TypeSystem::TypeRegistry const&                 m_typeRegistry;
         EntityModel::SerializedEntityCollection const&  m_entityCollection;
         NavmeshBuildSettings const&                     m_buildSettings;
+        NavmeshGeometryCache*                           m_pGeometryCache = nullptr;
+        NavmeshGeometryCache                            m_transientGeometryCache;
         
         // Build transient data
         bfx::Instance*                                  m_pNavpowerInstance = nullptr;
@@ -96,6 +149,7 @@ namespace EE::Navmesh
         float                                           m_progress = 0.0f;
         State                                           m_state = State::Idle;
         AsyncTask                                       m_asyncTask;
+        TaskSystem*                                     m_pTaskSystem = nullptr;
         bool                                            m_isGeneratingAsync = false;
     };
 }
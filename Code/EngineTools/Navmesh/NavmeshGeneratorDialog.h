@@ -15,6 +15,7 @@ namespace EE::EntityModel { class SerializedEntityCollection; }
 namespace EE::Navmesh
 {
     class NavmeshGenerator;
+    class NavmeshGeometryCache;
 
     //-------------------------------------------------------------------------
 
@@ -23,7 +24,7 @@ namespace EE::Navmesh
 
     public:
 
-        NavmeshGeneratorDialog( ToolsContext const* pToolsContext, NavmeshBuildSettings const& initialBuildSettings, EntityModel::SerializedEntityCollection const& entityCollection, FileSystem::Path const& navmeshOutputPath );
+        NavmeshGeneratorDialog( ToolsContext const* pToolsContext, NavmeshBuildSettings const& initialBuildSettings, EntityModel::SerializedEntityCollection const& entityCollection, FileSystem::Path const& navmeshOutputPath, NavmeshGeometryCache* pGeometryCache = nullptr );
         ~NavmeshGeneratorDialog();
 
         bool UpdateAndDrawDialog( UpdateContext const& ctx );
@@ -38,6 +39,7 @@ namespace EE::Navmesh
         EntityModel::SerializedEntityCollection const       m_entityCollection;
         FileSystem::Path const                              m_navmeshOutputPath;
         PropertyGrid                                        m_propertyGrid;
+        NavmeshGeometryCache*                               m_pGeometryCache = nullptr;
         NavmeshGenerator*                                   m_pGenerator = nullptr;
     };
 }
\ No newline at end of file
@@ -147,6 +147,17 @@ namespace EE::Physics
         }
     }
 
+    bool CollisionMeshCompiler::GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const
+    {
+        PhysicsCollisionMeshResourceDescriptor resourceDescriptor;
+        if ( !TryLoadResourceDescriptor( resourceID.GetResourcePath(), resourceDescriptor ) )
+        {
+            return false;
+        }
+
+        return AddReferencedSourceFiles( resourceDescriptor.m_sourcePath, outInputFilePaths );
+    }
+
     bool CollisionMeshCompiler::CookTriangleMeshData( Import::ImportedMesh const& ImportedMesh, Blob& outCookedData ) const
     {
         PX::Allocator allocator;
@@ -20,6 +20,7 @@ namespace EE::Physics
 
         CollisionMeshCompiler();
         virtual Resource::CompilationResult Compile( Resource::CompileContext const& ctx ) const override;
+        virtual bool GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const override;
 
     private:
 
@@ -213,6 +213,17 @@ namespace EE::Render
         return true;
     }
 
+    bool MeshCompiler::GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const
+    {
+        MeshResourceDescriptor resourceDescriptor;
+        if ( !TryLoadResourceDescriptor( resourceID.GetResourcePath(), resourceDescriptor ) )
+        {
+            return false;
+        }
+
+        return AddReferencedSourceFiles( resourceDescriptor.m_meshPath, outInputFilePaths );
+    }
+
     //-------------------------------------------------------------------------
 
     StaticMeshCompiler::StaticMeshCompiler()
@@ -738,6 +738,107 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    // Recursively gather all the files included by a shader, includes are resolved relative to the including file (same as the dxc default include handler)
+    // Returns false if an include cant be resolved, conditional compilation is ignored so this may return more files than are actually used
+    static bool GatherIncludedFiles( FileSystem::Path const& shaderFilePath, TVector<FileSystem::Path>& inOutIncludedFiles )
+    {
+        constexpr static int32_t const s_maxIncludedFiles = 256;
+
+        Blob fileData;
+        if ( !FileSystem::LoadFile( shaderFilePath, fileData ) )
+        {
+            return false;
+        }
+
+        auto SkipWhitespace = [] ( char const* pChar, char const* pEnd )
+        {
+            while ( pChar < pEnd && ( *pChar == ' ' || *pChar == '\t' ) )
+            {
+                pChar++;
+            }
+            return pChar;
+        };
+
+        FileSystem::Path const parentDirectory = shaderFilePath.GetParentDirectory();
+        char const* pLineStart = (char const*) fileData.data();
+        char const* const pFileEnd = pLineStart + fileData.size();
+        while ( pLineStart < pFileEnd )
+        {
+            char const* pLineEnd = (char const*) memchr( pLineStart, '\n', pFileEnd - pLineStart );
+            pLineEnd = ( pLineEnd != nullptr ) ? pLineEnd : pFileEnd;
+
+            char const* pChar = SkipWhitespace( pLineStart, pLineEnd );
+            if ( pChar < pLineEnd && *pChar == '#' )
+            {
+                pChar = SkipWhitespace( pChar + 1, pLineEnd );
+                if ( ( pLineEnd - pChar ) > 7 && strncmp( pChar, "include", 7 ) == 0 )
+                {
+                    // Macro includes cant be resolved without preprocessing the file
+                    pChar = SkipWhitespace( pChar + 7, pLineEnd );
+                    char const closingChar = ( *pChar == '"' ) ? '"' : ( *pChar == '<' ) ? '>' : 0;
+                    char const* pClosingChar = ( closingChar != 0 ) ? (char const*) memchr( pChar + 1, closingChar, pLineEnd - pChar - 1 ) : nullptr;
+                    if ( pClosingChar == nullptr )
+                    {
+                        return false;
+                    }
+
+                    FileSystem::Path const includedFilePath = parentDirectory + String( pChar + 1, pClosingChar );
+                    if ( !FileSystem::Exists( includedFilePath ) )
+                    {
+                        return false;
+                    }
+
+                    if ( !VectorContains( inOutIncludedFiles, includedFilePath ) )
+                    {
+                        if ( (int32_t) inOutIncludedFiles.size() >= s_maxIncludedFiles )
+                        {
+                            return false;
+                        }
+
+                        inOutIncludedFiles.emplace_back( includedFilePath );
+                        if ( !GatherIncludedFiles( includedFilePath, inOutIncludedFiles ) )
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+
+            pLineStart = pLineEnd + 1;
+        }
+
+        return true;
+    }
+
+    bool ShaderCompiler::GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const
+    {
+        ShaderResourceDescriptor resourceDescriptor;
+        if ( !TryLoadResourceDescriptor( resourceID.GetResourcePath(), resourceDescriptor ) )
+        {
+            return false;
+        }
+
+        if ( !resourceDescriptor.m_shaderPath.IsValid() )
+        {
+            return true;
+        }
+
+        FileSystem::Path const shaderFilePath = resourceDescriptor.m_shaderPath.ToFileSystemPath( m_rawResourceDirectoryPath );
+        if ( !FileSystem::Exists( shaderFilePath ) )
+        {
+            return true;
+        }
+
+        TVector<FileSystem::Path> includedFiles;
+        if ( !GatherIncludedFiles( shaderFilePath, includedFiles ) )
+        {
+            return false;
+        }
+
+        outInputFilePaths.insert( outInputFilePaths.end(), includedFiles.begin(), includedFiles.end() );
+        return true;
+    }
+
     Resource::CompilationResult ShaderCompiler::CompileShader( Resource::CompileContext const& ctx, int32_t compilerVersion ) const
     {
         ShaderResourceDescriptor resourceDescriptor;
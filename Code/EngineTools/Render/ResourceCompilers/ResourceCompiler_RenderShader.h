@@ -17,6 +17,10 @@ namespace EE::Render
         EE_REFLECT_TYPE( ShaderCompiler );
         static const int32_t s_version = 2;
 
+    public:
+
+        virtual bool GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const override;
+
     protected:
 
         using Resource::Compiler::Compiler;
@@ -0,0 +1,188 @@
+#include "CompiledResourceCache.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Types/UUID.h"
+#include <eastl/sort.h>
+#include <filesystem>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool CompiledResourceCache::Initialize( FileSystem::Path const& cacheDirectoryPath, uint64_t maxCacheSize )
+    {
+        EE_ASSERT( !IsInitialized() );
+        EE_ASSERT( cacheDirectoryPath.IsValid() && cacheDirectoryPath.IsDirectoryPath() );
+
+        if ( !cacheDirectoryPath.EnsureDirectoryExists() )
+        {
+            EE_LOG_WARNING( "Resource", "Compiled Resource Cache", "Failed to create cache directory: %s", cacheDirectoryPath.c_str() );
+            return false;
+        }
+
+        m_cacheDirectoryPath = cacheDirectoryPath;
+        m_maxCacheSize = maxCacheSize;
+        return true;
+    }
+
+    void CompiledResourceCache::Shutdown()
+    {
+        m_cacheDirectoryPath.Clear();
+    }
+
+    FileSystem::Path CompiledResourceCache::GetEntryPath( uint64_t key ) const
+    {
+        // Split entries into 256 sub-directories to keep directory sizes reasonable
+        InlineString const entryPath( InlineString::CtorSprintf(), "%02x/%016llx.cache", uint32_t( key >> 56 ), key );
+        return m_cacheDirectoryPath + entryPath.c_str();
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompiledResourceCache::TryRestore( uint64_t key, FileSystem::Path const& outputFilePath )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_ASSERT( outputFilePath.IsValid() && outputFilePath.IsFilePath() );
+
+        FileSystem::Path const entryPath = GetEntryPath( key );
+
+        std::error_code ec;
+        if ( !std::filesystem::exists( entryPath.c_str(), ec ) )
+        {
+            m_numMisses++;
+            return false;
+        }
+
+        if ( !outputFilePath.EnsureDirectoryExists() )
+        {
+            m_numMisses++;
+            return false;
+        }
+
+        std::filesystem::copy_file( entryPath.c_str(), outputFilePath.c_str(), std::filesystem::copy_options::overwrite_existing, ec );
+        if ( ec )
+        {
+            // The entry might have been evicted by another process between the checks, treat this as a miss
+            m_numMisses++;
+            return false;
+        }
+
+        // Touch the entry for LRU eviction, failures here are not important
+        std::filesystem::last_write_time( entryPath.c_str(), std::filesystem::file_time_type::clock::now(), ec );
+
+        m_numHits++;
+        return true;
+    }
+
+    bool CompiledResourceCache::Store( uint64_t key, FileSystem::Path const& compiledFilePath )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_ASSERT( compiledFilePath.IsValid() && compiledFilePath.IsFilePath() );
+
+        FileSystem::Path const entryPath = GetEntryPath( key );
+        if ( !entryPath.EnsureDirectoryExists() )
+        {
+            return false;
+        }
+
+        // Copy to a unique temporary file and then rename it into place, so that readers never see partially written entries
+        FileSystem::Path tempFilePath = entryPath;
+        tempFilePath.ReplaceExtension( UUID::GenerateID().ToString().c_str() );
+
+        std::error_code ec;
+        std::filesystem::copy_file( compiledFilePath.c_str(), tempFilePath.c_str(), std::filesystem::copy_options::overwrite_existing, ec );
+        if ( ec )
+        {
+            EE_LOG_WARNING( "Resource", "Compiled Resource Cache", "Failed to store cache entry for: %s (%s)", compiledFilePath.c_str(), ec.message().c_str() );
+            return false;
+        }
+
+        // If another process stored the same entry in the meantime, the contents are identical so overwriting it is fine
+        std::filesystem::rename( tempFilePath.c_str(), entryPath.c_str(), ec );
+        if ( ec )
+        {
+            std::filesystem::remove( tempFilePath.c_str(), ec );
+            return false;
+        }
+
+        return true;
+    }
+
+    void CompiledResourceCache::EvictEntries()
+    {
+        EE_ASSERT( IsInitialized() );
+
+        struct Entry
+        {
+            std::filesystem::path                   m_path;
+            std::filesystem::file_time_type         m_lastUsedTime;
+            uint64_t                                m_size;
+        };
+
+        // Gather all entries
+        //-------------------------------------------------------------------------
+
+        TVector<Entry> entries;
+        uint64_t totalSize = 0;
+
+        std::error_code ec;
+        for ( auto const& directoryEntry : std::filesystem::recursive_directory_iterator( m_cacheDirectoryPath.c_str(), ec ) )
+        {
+            if ( !directoryEntry.is_regular_file( ec ) || directoryEntry.path().extension() != ".cache" )
+            {
+                continue;
+            }
+
+            Entry& entry = entries.push_back();
+            entry.m_path = directoryEntry.path();
+            entry.m_lastUsedTime = directoryEntry.last_write_time( ec );
+            entry.m_size = directoryEntry.file_size( ec );
+            totalSize += entry.m_size;
+        }
+
+        // Remove least recently used entries
+        //-------------------------------------------------------------------------
+
+        if ( totalSize > m_maxCacheSize )
+        {
+            eastl::sort( entries.begin(), entries.end(), [] ( Entry const& a, Entry const& b ) { return a.m_lastUsedTime < b.m_lastUsedTime; } );
+
+            int32_t numEvictedEntries = 0;
+            for ( auto const& entry : entries )
+            {
+                if ( totalSize <= m_maxCacheSize )
+                {
+                    break;
+                }
+
+                // Another process might be using or removing the entry, just skip it if we fail
+                if ( std::filesystem::remove( entry.m_path, ec ) )
+                {
+                    totalSize -= entry.m_size;
+                    numEvictedEntries++;
+                }
+            }
+
+            m_numEvictedEntries += numEvictedEntries;
+            m_numEntries = (uint32_t) entries.size() - numEvictedEntries;
+        }
+        else
+        {
+            m_numEntries = (uint32_t) entries.size();
+        }
+
+        m_totalSize = totalSize;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompiledResourceCache::Statistics CompiledResourceCache::GetStatistics() const
+    {
+        Statistics stats;
+        stats.m_numHits = m_numHits;
+        stats.m_numMisses = m_numMisses;
+        stats.m_numEvictedEntries = m_numEvictedEntries;
+        stats.m_numEntries = m_numEntries;
+        stats.m_totalSize = m_totalSize;
+        return stats;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "Base/Resource/ResourceID.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+// Compiled Resource Cache
+//-------------------------------------------------------------------------
+// A content addressed store of compiled resources
+// Entries are keyed on a hash of the resource path, the compiler version and the contents of the descriptor, its source files and all its compile dependencies
+// Since keys dont depend on file timestamps or local paths, the cache directory can be shared between workspaces or placed on a build machine share
+// Eviction is LRU, entries are touched whenever they are restored so the entry modified time is the last use time
+
+namespace EE::Resource
+{
+    class EE_ENGINETOOLS_API CompiledResourceCache final
+    {
+    public:
+
+        struct Statistics
+        {
+            inline float GetHitRate() const { uint32_t const numLookups = m_numHits + m_numMisses; return ( numLookups > 0 ) ? float( m_numHits ) / numLookups : 0.0f; }
+
+        public:
+
+            uint32_t        m_numHits = 0;
+            uint32_t        m_numMisses = 0;
+            uint32_t        m_numEvictedEntries = 0;
+            uint32_t        m_numEntries = 0;
+            uint64_t        m_totalSize = 0; // The size of the cache on disk as of the last eviction pass
+        };
+
+    public:
+
+        bool Initialize( FileSystem::Path const& cacheDirectoryPath, uint64_t maxCacheSize );
+        void Shutdown();
+        inline bool IsInitialized() const { return m_cacheDirectoryPath.IsValid(); }
+
+        inline FileSystem::Path const& GetCacheDirectoryPath() const { return m_cacheDirectoryPath; }
+        inline uint64_t GetMaxCacheSize() const { return m_maxCacheSize; }
+
+        // Copy a cached entry to the output path if we have one, this counts as a lookup in the statistics
+        bool TryRestore( uint64_t key, FileSystem::Path const& outputFilePath );
+
+        // Add a compiled file to the cache, safe to call concurrently from multiple processes
+        bool Store( uint64_t key, FileSystem::Path const& compiledFilePath );
+
+        // Remove the least recently used entries until we are under the max cache size
+        void EvictEntries();
+
+        // Statistics
+        //-------------------------------------------------------------------------
+
+        // Compilation happens out of process, so allow the owner to record lookup results it was notified about
+        inline void RecordLookup( bool wasHit ) { wasHit ? m_numHits++ : m_numMisses++; }
+
+        Statistics GetStatistics() const;
+
+    private:
+
+        FileSystem::Path GetEntryPath( uint64_t key ) const;
+
+    private:
+
+        FileSystem::Path                    m_cacheDirectoryPath;
+        uint64_t                            m_maxCacheSize = 0;
+        std::atomic<uint32_t>               m_numHits = 0;
+        std::atomic<uint32_t>               m_numMisses = 0;
+        uint32_t                            m_numEvictedEntries = 0;
+        uint32_t                            m_numEntries = 0;
+        uint64_t                            m_totalSize = 0;
+    };
+}
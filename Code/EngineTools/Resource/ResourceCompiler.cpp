@@ -1,4 +1,5 @@
 #include "ResourceCompiler.h"
+#include "EngineTools/Import/Importer.h"
 #include "Base/FileSystem/FileSystem.h"
 
 //-------------------------------------------------------------------------
@@ -84,4 +85,23 @@ namespace EE::Resource
     {
         return Error( "Failed to compile resource: '%s'", (char const*) ctx.m_outputFilePath );
     }
+
+    //-------------------------------------------------------------------------
+
+    bool Compiler::AddReferencedSourceFiles( ResourcePath const& sourcePath, TVector<FileSystem::Path>& outInputFilePaths ) const
+    {
+        // Invalid paths will fail the compilation itself, so there is nothing to track
+        if ( !sourcePath.IsValid() )
+        {
+            return true;
+        }
+
+        FileSystem::Path const sourceFilePath = ResourcePath::ToFileSystemPath( m_rawResourceDirectoryPath, sourcePath );
+        if ( !FileSystem::Exists( sourceFilePath ) )
+        {
+            return true;
+        }
+
+        return Import::GetReferencedSourceFiles( sourceFilePath, outInputFilePaths );
+    }
 }
\ No newline at end of file
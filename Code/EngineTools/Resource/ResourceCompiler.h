@@ -16,6 +16,7 @@ namespace EE::Resource
         SuccessUpToDate = 0,
         Success = 1,
         SuccessWithWarnings = 2,
+        SuccessFromCache = 3,
     };
 
     // Log Delimiter
@@ -49,7 +50,7 @@ namespace EE::Resource
         FileSystem::Path const                          m_inputFilePath;
         FileSystem::Path const                          m_outputFilePath;
 
-        uint64_t                                        m_sourceResourceHash = 0; // The combined hash of the source resource and its dependencies
+        uint64_t                                        m_sourceResourceHash = 0; // The combined content hash of the source resource and its dependencies
     };
 
     // Resource Compiler
@@ -80,6 +81,10 @@ namespace EE::Resource
         // Get all referenced resources needed at runtime
         virtual bool GetInstallDependencies( ResourceID const& resourceID, TVector<ResourceID>& outReferencedResources ) const { return true; }
 
+        // Get any files that are read during compilation but are not compile dependencies (e.g. external gltf buffers, shader includes)
+        // These are included in the up-to-date check and the compiled resource cache key. Return false if they cant be determined, the resource will then never be cached
+        virtual bool GetAdditionalCompileInputs( ResourceID const& resourceID, TVector<FileSystem::Path>& outInputFilePaths ) const { return true; }
+
     protected:
 
         Compiler& operator=( Compiler const& ) = delete;
@@ -110,6 +115,9 @@ namespace EE::Resource
             }
         }
 
+        // Adds any external files that are read when importing the specified source file (e.g. gltf buffers) to the list of compile inputs
+        bool AddReferencedSourceFiles( ResourcePath const& sourcePath, TVector<FileSystem::Path>& outInputFilePaths ) const;
+
         // Converts a file path to a resource path
         inline bool ConvertFilePathToResourcePath( FileSystem::Path const& filePath, ResourcePath& resourcePath ) const
         {
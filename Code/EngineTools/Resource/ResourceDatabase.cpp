@@ -2,12 +2,56 @@
 #include "ResourceDescriptor.h"
 #include "Base/FileSystem/FileSystemUtils.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/Encoding/Hash.h"
 #include "Base/Types/Function.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Resource
 {
+    // Bump this whenever the format of the descriptor cache changes
+    constexpr static uint32_t const g_descriptorCacheVersion = 1;
+
+    // The descriptor cache is derived data so it lives in the compiled resource directory
+    constexpr static char const* const g_descriptorCacheFileName = "ResourceDatabase.cache";
+
+    //-------------------------------------------------------------------------
+
+    // The cached descriptors store binary property values, so they are only valid for the exact same type layouts they were written with
+    static uint64_t CalculateTypeRegistrySignature( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        TVector<uint64_t> signatureData;
+
+        for ( auto pTypeInfo : typeRegistry.GetAllTypes( true, true ) )
+        {
+            signatureData.emplace_back( pTypeInfo->m_ID.ToUint() );
+            signatureData.emplace_back( pTypeInfo->m_size );
+
+            for ( auto const& propertyInfo : pTypeInfo->m_properties )
+            {
+                signatureData.emplace_back( propertyInfo.m_ID.ToUint() );
+                signatureData.emplace_back( propertyInfo.m_typeID.ToUint() );
+                signatureData.emplace_back( propertyInfo.m_templateArgumentTypeID.ToUint() );
+                signatureData.emplace_back( propertyInfo.m_size );
+
+                if ( propertyInfo.IsEnumProperty() )
+                {
+                    TypeSystem::EnumInfo const* pEnumInfo = typeRegistry.GetEnumInfo( propertyInfo.m_typeID );
+                    for ( auto const& constant : pEnumInfo->m_constants )
+                    {
+                        signatureData.emplace_back( constant.m_ID.ToUint() );
+                        signatureData.emplace_back( (uint64_t) constant.m_value );
+                    }
+                }
+            }
+        }
+
+        return Hash::GetHash64( signatureData.data(), signatureData.size() * sizeof( uint64_t ) );
+    }
+
+    //-------------------------------------------------------------------------
+
     ResourceDatabase::FileEntry::~FileEntry()
     {
         EE::Delete( m_pDescriptor );
@@ -97,6 +141,7 @@ namespace EE::Resource
         m_dataDirectoryPathDepth = m_rawResourceDirPath.GetDirectoryDepth();
         m_pTaskSystem = pTaskSystem;
         m_pTypeRegistry = pTypeRegistry;
+        m_descriptorCachePath = m_compiledResourceDirPath + g_descriptorCacheFileName;
 
         // Start database build
         //-------------------------------------------------------------------------
@@ -131,6 +176,7 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         m_rawResourceDirPath.Clear();
+        m_descriptorCachePath.Clear();
         m_pTypeRegistry = nullptr;
     }
 
@@ -148,6 +194,7 @@ namespace EE::Resource
                 if ( m_state == DatabaseState::BuildingFileSystemCache )
                 {
                     EE_ASSERT( m_numItemsProcessed == m_totalItemsToProcess );
+                    m_fileSystemCacheBuildTime = m_buildTimer.GetElapsedTimeMilliseconds();
 
                     // Notify users that the DB has been rebuilt
                     m_filesystemCacheUpdatedEvent.Execute();
@@ -159,15 +206,13 @@ namespace EE::Resource
                     }
                     else // Nothing else to do
                     {
-                        m_state = DatabaseState::Ready;
+                        CompleteDatabaseBuild();
                     }
                 }
                 else if ( m_state == DatabaseState::BuildingDescriptorCache )
                 {
                     EE_ASSERT( m_numItemsProcessed == m_totalItemsToProcess );
-
-                    m_descriptorsToLoad.clear();
-                    m_state = DatabaseState::Ready;
+                    CompleteDatabaseBuild();
                 }
                 else // Error
                 {
@@ -204,7 +249,8 @@ namespace EE::Resource
         m_resourcesPerType.clear();
         m_resourcesPerPath.clear();
         m_reflectedDataDirectory.Clear();
-        m_descriptorsToLoad.empty();
+        m_descriptorsToLoad.clear();
+        ClearDescriptorCache();
         m_numItemsProcessed = m_totalItemsToProcess = 0;
         m_state = DatabaseState::Empty;
     }
@@ -269,6 +315,8 @@ namespace EE::Resource
                 EE_HALT();
             }
 
+            ReadDescriptorCache();
+
             // Add record for all files
             //-------------------------------------------------------------------------
 
@@ -294,9 +342,10 @@ namespace EE::Resource
                 {
                     auto pCreatedFileEntry = AddFileRecord( filePath, false );
 
-                    // Queue for descriptor load
+                    // Queue for descriptor load, the modified time is used to validate the cached descriptor
                     if ( pCreatedFileEntry->m_isRegisteredResourceType )
                     {
+                        pCreatedFileEntry->m_modifiedTime = FileSystem::GetFileModifiedTime( filePath );
                         m_descriptorsToLoad.emplace_back( pCreatedFileEntry );
                     }
                 }
@@ -311,6 +360,9 @@ namespace EE::Resource
 
         m_numItemsProcessed = 0;
         m_totalItemsToProcess = 0;
+        m_numDescriptorsLoadedFromCache = 0;
+        m_numDescriptorsParsed = 0;
+        m_buildTimer.Start();
 
         m_state = DatabaseState::BuildingFileSystemCache;
         m_pAsyncTask = EE::New<AsyncTask>( BuildFileSystemCache );
@@ -329,8 +381,22 @@ namespace EE::Resource
         {
             for ( uint32_t i = range.start; i < range.end; i++ )
             {
-                m_descriptorsToLoad[i]->LoadDescriptor( *m_pTypeRegistry );
-                m_descriptorsToLoad[i] = nullptr;
+                FileEntry* pFileEntry = m_descriptorsToLoad[i];
+
+                // Only parse the descriptor if it changed since it was cached
+                auto cachedIter = m_cachedDescriptorLookupMap.find( pFileEntry->m_resourceID.GetResourcePath() );
+                if ( cachedIter != m_cachedDescriptorLookupMap.end() && m_cachedDescriptors[cachedIter->second].m_modifiedTime == pFileEntry->m_modifiedTime )
+                {
+                    EE_ASSERT( pFileEntry->m_pDescriptor == nullptr );
+                    pFileEntry->m_pDescriptor = m_cachedDescriptors[cachedIter->second].m_descriptor.CreateTypeInstance<ResourceDescriptor>( *m_pTypeRegistry );
+                    m_numDescriptorsLoadedFromCache++;
+                }
+                else
+                {
+                    pFileEntry->LoadDescriptor( *m_pTypeRegistry );
+                    m_numDescriptorsParsed++;
+                }
+
                 m_numItemsProcessed++;
             }
         };
@@ -345,6 +411,104 @@ namespace EE::Resource
         m_pTaskSystem->ScheduleTask( m_pAsyncTask );
     }
 
+    void ResourceDatabase::CompleteDatabaseBuild()
+    {
+        EE_ASSERT( m_pAsyncTask == nullptr );
+
+        // Only update the cache if something changed, we dont cache failed descriptor loads so those will always cause a re-parse
+        int32_t const numDescriptors = (int32_t) m_descriptorsToLoad.size();
+        if ( m_numDescriptorsParsed > 0 || m_numDescriptorsLoadedFromCache != (int32_t) m_cachedDescriptors.size() )
+        {
+            WriteDescriptorCache();
+        }
+
+        EE_LOG_INFO( "Resource", "Resource Database", "Resource database built in %.2fms (%s start) - file system scan: %.2fms, descriptors: %d (%d from cache, %d parsed)", m_buildTimer.GetElapsedTimeMilliseconds().ToFloat(), ( m_numDescriptorsParsed == numDescriptors && numDescriptors > 0 ) ? "cold" : "warm", m_fileSystemCacheBuildTime.ToFloat(), numDescriptors, (int32_t) m_numDescriptorsLoadedFromCache, (int32_t) m_numDescriptorsParsed );
+
+        m_descriptorsToLoad.clear();
+        ClearDescriptorCache();
+        m_state = DatabaseState::Ready;
+    }
+
+    void ResourceDatabase::ReadDescriptorCache()
+    {
+        EE_ASSERT( m_cachedDescriptors.empty() && m_cachedDescriptorLookupMap.empty() );
+
+        if ( !FileSystem::Exists( m_descriptorCachePath ) )
+        {
+            return;
+        }
+
+        Serialization::BinaryInputArchive archive;
+        if ( !archive.ReadFromFile( m_descriptorCachePath ) )
+        {
+            EE_LOG_WARNING( "Resource", "Resource Database", "Failed to read descriptor cache: %s", m_descriptorCachePath.c_str() );
+            return;
+        }
+
+        uint32_t version = 0;
+        uint64_t typeRegistrySignature = 0;
+        archive << version << typeRegistrySignature;
+        if ( version != g_descriptorCacheVersion || typeRegistrySignature != CalculateTypeRegistrySignature( *m_pTypeRegistry ) )
+        {
+            return;
+        }
+
+        archive << m_cachedDescriptors;
+
+        m_cachedDescriptorLookupMap.reserve( m_cachedDescriptors.size() );
+        for ( int32_t i = 0; i < (int32_t) m_cachedDescriptors.size(); i++ )
+        {
+            m_cachedDescriptorLookupMap.insert( TPair<ResourcePath, int32_t>( ResourcePath( m_cachedDescriptors[i].m_resourcePath ), i ) );
+        }
+    }
+
+    void ResourceDatabase::WriteDescriptorCache()
+    {
+        TVector<CachedDescriptor> descriptorsToCache;
+        descriptorsToCache.reserve( m_descriptorsToLoad.size() );
+
+        for ( FileEntry const* pFileEntry : m_descriptorsToLoad )
+        {
+            if ( pFileEntry->m_pDescriptor == nullptr )
+            {
+                continue;
+            }
+
+            CachedDescriptor& cachedDescriptor = descriptorsToCache.emplace_back();
+            cachedDescriptor.m_resourcePath = pFileEntry->m_resourceID.GetResourcePath().GetString();
+            cachedDescriptor.m_modifiedTime = pFileEntry->m_modifiedTime;
+
+            // Reuse the existing binary data for unchanged descriptors
+            auto cachedIter = m_cachedDescriptorLookupMap.find( pFileEntry->m_resourceID.GetResourcePath() );
+            if ( cachedIter != m_cachedDescriptorLookupMap.end() && m_cachedDescriptors[cachedIter->second].m_modifiedTime == pFileEntry->m_modifiedTime )
+            {
+                cachedDescriptor.m_descriptor = eastl::move( m_cachedDescriptors[cachedIter->second].m_descriptor );
+            }
+            else
+            {
+                cachedDescriptor.m_descriptor.DescribeTypeInstance( *m_pTypeRegistry, pFileEntry->m_pDescriptor, false );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        Serialization::BinaryOutputArchive archive;
+        archive << g_descriptorCacheVersion << CalculateTypeRegistrySignature( *m_pTypeRegistry );
+        archive << descriptorsToCache;
+
+        if ( !archive.WriteToFile( m_descriptorCachePath ) )
+        {
+            EE_LOG_WARNING( "Resource", "Resource Database", "Failed to write descriptor cache: %s", m_descriptorCachePath.c_str() );
+        }
+    }
+
+    void ResourceDatabase::ClearDescriptorCache()
+    {
+        m_cachedDescriptors.clear();
+        m_cachedDescriptors.shrink_to_fit();
+        m_cachedDescriptorLookupMap.clear();
+    }
+
     //-------------------------------------------------------------------------
 
     ResourceDatabase::FileEntry const* ResourceDatabase::GetFileEntry( ResourcePath const& resourcePath ) const
@@ -1,6 +1,8 @@
 #pragma once
 #include "EngineTools/Core/FileSystem/FileSystemWatcher.h"
 #include "Base/Resource/ResourceID.h"
+#include "Base/TypeSystem/TypeDescriptors.h"
+#include "Base/Time/Timers.h"
 #include "Base/Types/StringID.h"
 #include "Base/Types/Event.h"
 #include "Base/Types/HashMap.h"
@@ -22,7 +24,9 @@ namespace EE::Resource
 {
     // Maintains a DB of all source resources in the source data folder
     //-------------------------------------------------------------------------
-    // The way we load descriptors is pretty naive and can definitely be improved
+    // Parsing descriptors is the expensive part of building the DB, so we persist the parsed descriptors (as binary type descriptors) in a cache file.
+    // On the next build, only descriptors whose file modified time doesnt match the cached one are re-parsed, all others are created from the cache.
+    // The cache is invalidated whenever the reflected types change, since the binary property data depends on the type layouts.
 
     class EE_ENGINETOOLS_API ResourceDatabase final
     {
@@ -55,6 +59,7 @@ namespace EE::Resource
 
             ResourceID                                              m_resourceID;
             FileSystem::Path                                        m_filePath;
+            uint64_t                                                m_modifiedTime = 0;     // Only set for registered resource types
             bool                                                    m_isRegisteredResourceType = false;
             struct ResourceDescriptor*                              m_pDescriptor = nullptr;
         };
@@ -76,6 +81,17 @@ namespace EE::Resource
             TVector<FileEntry*>                                     m_files;
         };
 
+    private:
+
+        struct CachedDescriptor
+        {
+            EE_SERIALIZE( m_resourcePath, m_modifiedTime, m_descriptor );
+
+            String                                                  m_resourcePath;
+            uint64_t                                                m_modifiedTime = 0;
+            TypeSystem::TypeDescriptor                              m_descriptor;
+        };
+
     public:
 
         ~ResourceDatabase();
@@ -181,6 +197,14 @@ namespace EE::Resource
 
         void StartDescriptorCacheBuild();
 
+        // Called once all descriptors are loaded, updates the persisted descriptor cache if needed
+        void CompleteDatabaseBuild();
+
+        // Persisted descriptor cache
+        void ReadDescriptorCache();
+        void WriteDescriptorCache();
+        void ClearDescriptorCache();
+
         // Cancel the rebuild of the database
         void CancelDatabaseBuild();
 
@@ -220,5 +244,14 @@ namespace EE::Resource
         std::atomic<int32_t>                                        m_numItemsProcessed = 0;
         int32_t                                                     m_totalItemsToProcess = 1;
         TVector<FileEntry*>                                         m_descriptorsToLoad;
+
+        // Descriptor cache
+        FileSystem::Path                                            m_descriptorCachePath;
+        TVector<CachedDescriptor>                                   m_cachedDescriptors;
+        THashMap<ResourcePath, int32_t>                             m_cachedDescriptorLookupMap;
+        std::atomic<int32_t>                                        m_numDescriptorsLoadedFromCache = 0;
+        std::atomic<int32_t>                                        m_numDescriptorsParsed = 0;
+        Timer<PlatformClock>                                        m_buildTimer;
+        Milliseconds                                                m_fileSystemCacheBuildTime = 0;
     };
 }
\ No newline at end of file
@@ -18,19 +18,10 @@ namespace EE::Resource
     public:
 
         // Try to read a descriptor from a file without knowing the type
+        // Descriptors are streamed directly into the descriptor type, no JSON document is created
         static inline ResourceDescriptor* TryReadFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& descriptorPath )
         {
-            Serialization::TypeArchiveReader typeReader( typeRegistry );
-
-            if ( !typeReader.ReadFromFile( descriptorPath ) )
-            {
-                EE_LOG_ERROR( "Resource", "Resource Descriptor", "Failed to read resource descriptor file: %s", descriptorPath.c_str() );
-                return nullptr;
-            }
-
-            //-------------------------------------------------------------------------
-
-            auto pDescriptor = typeReader.TryReadType();
+            auto pDescriptor = Serialization::TryCreateAndReadNativeTypeFromFile( typeRegistry, descriptorPath );
             if ( pDescriptor == nullptr )
             {
                 EE_LOG_ERROR( "Resource", "Resource Descriptor", "Failed to read resource descriptor file: %s", descriptorPath.c_str() );
@@ -55,18 +46,12 @@ namespace EE::Resource
         {
             static_assert( std::is_base_of<ResourceDescriptor, T>::value, "T must be a child of ResourceDescriptor" );
 
-            Serialization::TypeArchiveReader typeReader( typeRegistry );
-            if ( !typeReader.ReadFromFile( descriptorPath ) )
+            if ( !Serialization::ReadNativeTypeFromFile( typeRegistry, descriptorPath, &outData ) )
             {
                 EE_LOG_ERROR( "Resource", "Resource Descriptor", "Failed to read resource descriptor file: %s", descriptorPath.c_str() );
                 return false;
             }
 
-            if ( !typeReader.ReadType( &outData ) )
-            {
-                return false;
-            }
-
             return true;
         }
 
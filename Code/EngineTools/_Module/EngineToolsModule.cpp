@@ -1,4 +1,7 @@
 #include "EngineToolsModule.h"
+#include "EngineTools/Import/ImportCache.h"
+#include "Base/Resource/Settings/GlobalSettings_Resource.h"
+#include "Base/Settings/SettingsRegistry.h"
 
 //-------------------------------------------------------------------------
 
@@ -6,10 +9,22 @@ namespace EE
 {
     bool EngineToolsModule::InitializeModule( ModuleContext& context )
     {
+        // Share the resource compiler's import cache, so that tools that import source files (i.e. navmesh generation) can reuse its entries
+        auto pResourceSettings = context.m_pSettingsRegistry->GetGlobalSettings<Resource::ResourceGlobalSettings>();
+        EE_ASSERT( pResourceSettings != nullptr );
+
+        FileSystem::Path importCachePath = pResourceSettings->m_compiledResourceCachePath + "Import";
+        importCachePath.MakeIntoDirectoryPath();
+        Import::ImportCache::Initialize( importCachePath );
+
         return true;
     }
 
     void EngineToolsModule::ShutdownModule( ModuleContext& context )
     {
+        if ( Import::ImportCache::IsInitialized() )
+        {
+            Import::ImportCache::Shutdown();
+        }
     }
 }
\ No newline at end of file
@@ -137,7 +137,16 @@ namespace EE::AI
             m_isActive = true;
         }
 
-        // Called to update this action, this will be called directly after the try start if it succeeds
+        // Called when the AI scheduler gives this AI time to make decisions, this will not be called every frame
+        // All expensive decision making (target/goal selection, navmesh queries, etc...) needs to happen here
+        inline void UpdateDecisions( BehaviorContext const& ctx )
+        {
+            EE_ASSERT( m_isActive );
+            UpdateDecisionsInternal( ctx );
+        }
+
+        // Called every frame to update this action, this will be called directly after the try start if it succeeds
+        // This should only run the actions (steering, animation requests, etc...) for the decisions that were already made
         inline Status Update( BehaviorContext const& ctx )
         {
             EE_ASSERT( m_isActive );
@@ -167,6 +176,9 @@ namespace EE::AI
         // Called to start this action
         virtual void StartInternal( BehaviorContext const& ctx ) = 0;
 
+        // Called to make the time-sliced decisions for this action
+        virtual void UpdateDecisionsInternal( BehaviorContext const& ctx ) {}
+
         // Called to update this action, this will be called directly after the try start if it succeeds
         virtual Status UpdateInternal( BehaviorContext const& ctx ) = 0;
 
@@ -25,12 +25,10 @@ namespace EE::AI
 
     //-------------------------------------------------------------------------
 
-    void BehaviorSelector::Update()
+    void BehaviorSelector::UpdateDecisions()
     {
         EE_ASSERT( m_actionContext.IsValid() );
 
-        //-------------------------------------------------------------------------
-
         // HACK HACK HACK
         if ( m_pActiveBehavior == nullptr )
         {
@@ -39,7 +37,12 @@ namespace EE::AI
         }
         // HACK HACK HACK
 
-        //-------------------------------------------------------------------------
+        m_pActiveBehavior->UpdateDecisions( m_actionContext );
+    }
+
+    void BehaviorSelector::Update()
+    {
+        EE_ASSERT( m_actionContext.IsValid() );
 
         if ( m_pActiveBehavior != nullptr )
         {
@@ -42,7 +42,10 @@ namespace EE::AI
         BehaviorSelector( BehaviorContext const& context );
         ~BehaviorSelector();
 
-        // Update the currently active actions
+        // Choose which behavior should be active and let it make its decisions, this is time-sliced by the AI scheduler so it will not run every frame
+        void UpdateDecisions();
+
+        // Update the currently active behavior and its actions, this needs to run every frame
         void Update();
 
     private:
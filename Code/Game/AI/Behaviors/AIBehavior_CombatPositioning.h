@@ -16,6 +16,7 @@ namespace EE::AI
     private:
 
         virtual void StartInternal( BehaviorContext const& ctx ) override;
+        virtual void UpdateDecisionsInternal( BehaviorContext const& ctx ) override;
         virtual Status UpdateInternal( BehaviorContext const& ctx ) override;
         virtual void StopInternal( BehaviorContext const& ctx, StopReason reason ) override;
 
@@ -24,5 +25,6 @@ namespace EE::AI
         MoveToAction                m_moveToAction;
         IdleAction                  m_idleAction;
         ManualCountdownTimer        m_waitTimer;
+        bool                        m_needsMoveGoal = false; // The wait is over, the next decision update needs to pick a goal and start the move
     };
 }
\ No newline at end of file
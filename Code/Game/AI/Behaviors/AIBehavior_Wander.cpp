@@ -10,33 +10,48 @@ namespace EE::AI
     void WanderBehavior::StartInternal( BehaviorContext const& ctx )
     {
         m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
+        m_needsMoveGoal = false;
     }
 
-    Behavior::Status WanderBehavior::UpdateInternal( BehaviorContext const& ctx )
+    void WanderBehavior::UpdateDecisionsInternal( BehaviorContext const& ctx )
     {
+        if ( !m_needsMoveGoal )
+        {
+            return;
+        }
+
         // Remain in idle if there is no valid navmesh
         AABB navmeshBounds = ctx.m_pNavmeshSystem->GetNavmeshBounds( 0 );
         if ( !navmeshBounds.IsValid() )
         {
-            return Status::Running;
+            return;
         }
 
-        //-------------------------------------------------------------------------
+        // Pick a goal and find the path to it
+        Vector const boundsMin = navmeshBounds.GetMin();
+        Vector const boundsMax = navmeshBounds.GetMax();
+        Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.GetX(), boundsMax.GetX() ), Math::GetRandomFloat( boundsMin.GetY(), boundsMax.GetY() ), navmeshBounds.GetCenter().GetZ() );
+
+        m_moveToAction.Start( ctx, moveGoalPosition );
+        m_needsMoveGoal = false;
+    }
 
+    Behavior::Status WanderBehavior::UpdateInternal( BehaviorContext const& ctx )
+    {
         if ( m_waitTimer.IsRunning() )
         {
             m_idleAction.Update( ctx );
 
-            // Wait for the timer to elapse and start a move
+            // Wait for the timer to elapse, the move is started by the next decision update
             if ( m_waitTimer.Update( ctx.GetDeltaTime() ) )
             {
-                Vector const boundsMin = navmeshBounds.GetMin();
-                Vector const boundsMax = navmeshBounds.GetMax();
-                Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.GetX(), boundsMax.GetX() ), Math::GetRandomFloat( boundsMin.GetY(), boundsMax.GetY() ), navmeshBounds.GetCenter().GetZ() );
-
-                m_moveToAction.Start( ctx, moveGoalPosition );
+                m_needsMoveGoal = true;
             }
         }
+        else if ( m_needsMoveGoal )
+        {
+            m_idleAction.Update( ctx );
+        }
         else // We're moving
         {
             // Wait for the move to complete
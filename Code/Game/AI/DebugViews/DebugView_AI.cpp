@@ -54,6 +54,80 @@ namespace EE::AI
     void AIDebugView::DrawOverviewWindow( EntityWorldUpdateContext const& context )
     {
         ImGui::Text( "Num AI: %u", m_pAIManager->m_AIs.size() );
+
+        //-------------------------------------------------------------------------
+        // Scheduler
+        //-------------------------------------------------------------------------
+
+        AIScheduler& scheduler = m_pAIManager->m_scheduler;
+        AIScheduler::Settings& settings = scheduler.GetSettings();
+
+        ImGui::SeparatorText( "Decision Scheduling" );
+
+        float frameBudget = settings.m_frameBudget.ToFloat();
+        if ( ImGui::SliderFloat( "Frame Budget (ms)", &frameBudget, 0.1f, 10.0f ) )
+        {
+            settings.m_frameBudget = frameBudget;
+        }
+
+        ImGui::SliderFloat( "High Importance Distance", &settings.m_highImportanceDistance, 1.0f, 100.0f );
+        ImGui::SliderFloat( "Medium Importance Distance", &settings.m_mediumImportanceDistance, 1.0f, 200.0f );
+        ImGui::Text( "Total Decision Cost: %.3fms", scheduler.GetLastFrameCost().ToFloat() );
+
+        char const* const bucketNames[AIScheduler::s_numBuckets] = { "High", "Medium", "Low" };
+
+        if ( ImGui::BeginTable( "Scheduler Buckets", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+        {
+            ImGui::TableSetupColumn( "Bucket" );
+            ImGui::TableSetupColumn( "Interval (s)" );
+            ImGui::TableSetupColumn( "Agents" );
+            ImGui::TableSetupColumn( "Updated" );
+            ImGui::TableSetupColumn( "Carried Over" );
+            ImGui::TableSetupColumn( "Total (ms)" );
+            ImGui::TableSetupColumn( "Avg Agent (ms)" );
+            ImGui::TableSetupColumn( "Max Latency (s)" );
+            ImGui::TableHeadersRow();
+
+            for ( int32_t i = 0; i < AIScheduler::s_numBuckets; i++ )
+            {
+                AIScheduler::BucketStats const& stats = scheduler.GetBucketStats( (AIImportance) i );
+
+                ImGui::TableNextRow();
+
+                ImGui::TableNextColumn();
+                ImGui::Text( bucketNames[i] );
+
+                ImGui::TableNextColumn();
+                ImGui::PushID( i );
+                ImGui::SetNextItemWidth( -1 );
+                float interval = settings.m_updateIntervals[i].ToFloat();
+                if ( ImGui::InputFloat( "##Interval", &interval, 0.0f, 0.0f, "%.2f" ) )
+                {
+                    settings.m_updateIntervals[i] = Math::Max( interval, 0.0f );
+                }
+                ImGui::PopID();
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", stats.m_numAgents );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", stats.m_numUpdated );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", stats.m_numCarriedOver );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", stats.m_totalTime.ToFloat() );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", stats.m_averageAgentCost.ToFloat() );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", stats.m_maxTimeSinceUpdate.ToFloat() );
+            }
+
+            ImGui::EndTable();
+        }
     }
 }
 #endif
\ No newline at end of file
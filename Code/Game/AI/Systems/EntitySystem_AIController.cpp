@@ -8,6 +8,8 @@
 #include "Engine/Physics/Components/Component_PhysicsCharacter.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Base/Types/ScopedValue.h"
+#include "Base/Time/Timers.h"
+#include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
 
@@ -128,7 +130,25 @@ namespace EE::AI
         UpdateStage const updateStage = ctx.GetUpdateStage();
         if ( updateStage == UpdateStage::PrePhysics )
         {
-            m_behaviorSelector.Update();
+            // Decision updates are scheduled (and time-sliced) by the AI manager
+            AIComponent* pAIComponent = m_behaviorContext.m_pAIComponent;
+            if ( pAIComponent->IsDecisionUpdateScheduled() )
+            {
+                EE_PROFILE_SCOPE_AI( "Behavior Decisions" );
+
+                Milliseconds decisionUpdateCost = 0;
+                {
+                    ScopedTimer<PlatformClock> timer( decisionUpdateCost );
+                    m_behaviorSelector.UpdateDecisions();
+                }
+                pAIComponent->OnDecisionsUpdated( decisionUpdateCost );
+            }
+
+            // The active behavior (and its actions) always update, since they drive steering and the locomotion desires
+            {
+                EE_PROFILE_SCOPE_AI( "Behavior Update" );
+                m_behaviorSelector.Update();
+            }
 
             // Update animation and get root motion delta (remember that root motion is in character space, so we need to convert the displacement to world space)
             m_pAnimGraphComponent->EvaluateGraph( ctx.GetDeltaTime(), m_pCharacterMeshComponent->GetWorldTransform(), m_behaviorContext.m_pPhysicsWorld );
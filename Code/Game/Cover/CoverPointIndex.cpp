@@ -0,0 +1,216 @@
+#include "CoverPointIndex.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Profiling.h"
+#include <EASTL/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    static void SampleCoverVolume( CoverVolumeComponent const* pVolume, float spacing, TVector<CoverPoint>& outPoints )
+    {
+        Transform const& WT = pVolume->GetWorldTransform();
+        Float3 const volumeExtents = pVolume->GetVolumeLocalExtents();
+        Vector const forward = WT.GetForwardVector();
+        Vector const right = WT.GetRightVector();
+        Vector const coverFront = WT.GetTranslation() + ( forward * volumeExtents.m_y );
+
+        auto AddPoint = [&] ( Vector const& position )
+        {
+            CoverPoint& point = outPoints.emplace_back();
+            point.m_position = position;
+            point.m_facing = forward;
+            point.m_volumeID = pVolume->GetID();
+            point.m_coverType = pVolume->GetCoverType();
+        };
+
+        // Same layout as the volume visualization: a central point and then evenly spaced points to either side
+        AddPoint( coverFront );
+        for ( float horizontalOffset = spacing; horizontalOffset <= volumeExtents.m_x; horizontalOffset += spacing )
+        {
+            Vector const rightOffset = right * horizontalOffset;
+            AddPoint( coverFront + rightOffset );
+            AddPoint( coverFront - rightOffset );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CoverPointIndex::Clear()
+    {
+        m_points.clear();
+        m_cells.clear();
+    }
+
+    void CoverPointIndex::Build( TVector<CoverVolumeComponent const*> const& volumes, float cellSize )
+    {
+        EE_PROFILE_FUNCTION_AI();
+        EE_ASSERT( cellSize > 0.0f );
+
+        Clear();
+        m_cellSize = cellSize;
+
+        // Sample volumes
+        //-------------------------------------------------------------------------
+
+        TVector<CoverPoint> sampledPoints;
+        for ( auto pVolume : volumes )
+        {
+            SampleCoverVolume( pVolume, s_pointSpacing, sampledPoints );
+        }
+
+        // Sort points by cell so that each cell is a contiguous range
+        //-------------------------------------------------------------------------
+
+        struct SortEntry
+        {
+            uint64_t    m_cellKey;
+            int32_t     m_pointIdx;
+        };
+
+        TVector<SortEntry> sortEntries;
+        sortEntries.reserve( sampledPoints.size() );
+        for ( int32_t i = 0; i < (int32_t) sampledPoints.size(); i++ )
+        {
+            Vector const& position = sampledPoints[i].m_position;
+            sortEntries.push_back( { GetCellKey( GetCellCoordinate( position.GetX() ), GetCellCoordinate( position.GetY() ) ), i } );
+        }
+
+        eastl::sort( sortEntries.begin(), sortEntries.end(), [] ( SortEntry const& lhs, SortEntry const& rhs ) { return lhs.m_cellKey < rhs.m_cellKey || ( lhs.m_cellKey == rhs.m_cellKey && lhs.m_pointIdx < rhs.m_pointIdx ); } );
+
+        // Create cells
+        //-------------------------------------------------------------------------
+
+        m_points.reserve( sampledPoints.size() );
+        for ( auto const& entry : sortEntries )
+        {
+            Cell& cell = m_cells[entry.m_cellKey];
+            if ( cell.m_numPoints == 0 )
+            {
+                cell.m_firstPointIdx = (int32_t) m_points.size();
+            }
+
+            cell.m_numPoints++;
+            m_points.emplace_back( sampledPoints[entry.m_pointIdx] );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CoverPointIndex::FindCoverPoints( CoverQuery const& query, TVector<ScoredCoverPoint>& outResults ) const
+    {
+        EE_ASSERT( query.m_radius > 0.0f );
+        outResults.clear();
+
+        if ( m_points.empty() )
+        {
+            return;
+        }
+
+        float const radiusSq = query.m_radius * query.m_radius;
+        bool const hasCone = !query.m_coneDirection.IsNearZero3();
+        Vector const coneDirection = hasCone ? query.m_coneDirection.GetNormalized3() : Vector::Zero;
+        float const minConeDot = Math::Cos( query.m_coneHalfAngle.ToFloat() );
+
+        int32_t const minX = GetCellCoordinate( query.m_origin.GetX() - query.m_radius );
+        int32_t const maxX = GetCellCoordinate( query.m_origin.GetX() + query.m_radius );
+        int32_t const minY = GetCellCoordinate( query.m_origin.GetY() - query.m_radius );
+        int32_t const maxY = GetCellCoordinate( query.m_origin.GetY() + query.m_radius );
+
+        for ( int32_t x = minX; x <= maxX; x++ )
+        {
+            for ( int32_t y = minY; y <= maxY; y++ )
+            {
+                auto cellIter = m_cells.find( GetCellKey( x, y ) );
+                if ( cellIter == m_cells.end() )
+                {
+                    continue;
+                }
+
+                Cell const& cell = cellIter->second;
+                for ( int32_t i = cell.m_firstPointIdx; i < cell.m_firstPointIdx + cell.m_numPoints; i++ )
+                {
+                    CoverPoint const& point = m_points[i];
+
+                    Vector const toPoint = point.m_position - query.m_origin;
+                    float const distanceSq = toPoint.GetLengthSquared3();
+                    if ( distanceSq > radiusSq )
+                    {
+                        continue;
+                    }
+
+                    if ( hasCone && distanceSq > Math::Epsilon && toPoint.GetNormalized3().GetDot3( coneDirection ) < minConeDot )
+                    {
+                        continue;
+                    }
+
+                    // Closer points are better
+                    float score = 1.0f - ( Math::Sqrt( distanceSq ) / query.m_radius );
+
+                    // Cover needs to face the threat, and the more directly it does the better
+                    if ( query.m_hasThreat )
+                    {
+                        Vector const toThreat = ( query.m_threatPosition - point.m_position ).GetNormalized2();
+                        float const facingDot = point.m_facing.GetDot2( toThreat );
+                        if ( facingDot <= 0.0f )
+                        {
+                            continue;
+                        }
+
+                        score += facingDot;
+                    }
+
+                    outResults.push_back( { i, score } );
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        eastl::sort( outResults.begin(), outResults.end(), ScoredCoverPoint::IsBetter );
+        if ( query.m_maxResults > 0 && (int32_t) outResults.size() > query.m_maxResults )
+        {
+            outResults.resize( query.m_maxResults );
+        }
+    }
+
+    void CoverPointIndex::FindCoverPoints( TaskSystem* pTaskSystem, TSpan<CoverQuery const> queries, TVector<TVector<ScoredCoverPoint>>& outResults ) const
+    {
+        EE_PROFILE_FUNCTION_AI();
+        EE_ASSERT( pTaskSystem != nullptr );
+
+        outResults.resize( queries.size() );
+
+        struct CoverQueryTask final : public ITaskSet
+        {
+            CoverQueryTask( CoverPointIndex const* pIndex, TSpan<CoverQuery const> queries, TVector<TVector<ScoredCoverPoint>>& results )
+                : m_pIndex( pIndex )
+                , m_queries( queries )
+                , m_results( results )
+            {
+                m_SetSize = (uint32_t) queries.size();
+                m_MinRange = 8;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_AI( "Cover Queries" );
+
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    m_pIndex->FindCoverPoints( m_queries[i], m_results[i] );
+                }
+            }
+
+        private:
+
+            CoverPointIndex const*                      m_pIndex = nullptr;
+            TSpan<CoverQuery const>                     m_queries;
+            TVector<TVector<ScoredCoverPoint>>&         m_results;
+        };
+
+        CoverQueryTask task( this, queries, outResults );
+        pTaskSystem->ScheduleTask( &task );
+        pTaskSystem->WaitForTask( &task );
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "Game/Cover/Components/Component_CoverVolume.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Math/Math.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+// Cover Point Index
+//-------------------------------------------------------------------------
+// Cover volumes are sampled into discrete cover points when they are registered.
+// The points are stored in a uniform 2D grid (XY), so cover queries only visit the cells overlapping the query radius.
+
+namespace EE
+{
+    struct CoverPoint
+    {
+        Vector                  m_position = Vector::Zero;      // Point on the front face of the cover volume
+        Vector                  m_facing = Vector::Zero;        // Unit direction pointing away from the cover (i.e. towards the threats it protects against)
+        ComponentID             m_volumeID;
+        CoverType               m_coverType = CoverType::HighHidden;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct CoverQuery
+    {
+        Vector                  m_origin = Vector::Zero;
+        float                   m_radius = 10.0f;
+
+        // Optional: only accept cover that protects against this threat position
+        Vector                  m_threatPosition = Vector::Zero;
+        bool                    m_hasThreat = false;
+
+        // Optional: only accept points within a cone around this direction from the origin, a zero direction disables the cone test
+        Vector                  m_coneDirection = Vector::Zero;
+        Radians                 m_coneHalfAngle = Radians::PiDivTwo;
+
+        int32_t                 m_maxResults = 8;
+    };
+
+    struct ScoredCoverPoint
+    {
+        inline bool operator<( ScoredCoverPoint const& rhs ) const { return m_score < rhs.m_score; }
+
+        // Best first ordering, ties are broken on the point index so that results are deterministic
+        inline static bool IsBetter( ScoredCoverPoint const& lhs, ScoredCoverPoint const& rhs ) { return lhs.m_score > rhs.m_score || ( lhs.m_score == rhs.m_score && lhs.m_pointIdx < rhs.m_pointIdx ); }
+
+        int32_t                 m_pointIdx = InvalidIndex;
+        float                   m_score = 0.0f;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_GAME_API CoverPointIndex
+    {
+        struct Cell
+        {
+            int32_t             m_firstPointIdx = 0;
+            int32_t             m_numPoints = 0;
+        };
+
+    public:
+
+        constexpr static float const s_defaultCellSize = 8.0f;
+        constexpr static float const s_pointSpacing = 1.0f;
+
+    public:
+
+        // Sample all the volumes and rebuild the grid
+        void Build( TVector<CoverVolumeComponent const*> const& volumes, float cellSize = s_defaultCellSize );
+        void Clear();
+
+        inline int32_t GetNumPoints() const { return (int32_t) m_points.size(); }
+        inline int32_t GetNumCells() const { return (int32_t) m_cells.size(); }
+        inline CoverPoint const& GetPoint( int32_t pointIdx ) const { return m_points[pointIdx]; }
+        inline TVector<CoverPoint> const& GetPoints() const { return m_points; }
+
+        // Find the best cover points for the query, results are sorted by score (best first)
+        void FindCoverPoints( CoverQuery const& query, TVector<ScoredCoverPoint>& outResults ) const;
+
+        // Run multiple queries in parallel, the results array is resized to match the queries
+        void FindCoverPoints( TaskSystem* pTaskSystem, TSpan<CoverQuery const> queries, TVector<TVector<ScoredCoverPoint>>& outResults ) const;
+
+    private:
+
+        inline int32_t GetCellCoordinate( float value ) const { return Math::FloorToInt( value / m_cellSize ); }
+        inline static uint64_t GetCellKey( int32_t x, int32_t y ) { return ( uint64_t( uint32_t( x ) ) << 32 ) | uint64_t( uint32_t( y ) ); }
+
+    private:
+
+        TVector<CoverPoint>                 m_points;           // Sorted by cell
+        THashMap<uint64_t, Cell>            m_cells;
+        float                               m_cellSize = s_defaultCellSize;
+    };
+}
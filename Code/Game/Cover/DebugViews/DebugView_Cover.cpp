@@ -4,6 +4,7 @@
 #include "Engine/Entity/EntitySystem.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/UpdateContext.h"
+#include "Base/Drawing/DebugDrawing.h"
 #include "Base/Imgui/ImguiX.h"
 
 //-------------------------------------------------------------------------
@@ -25,7 +26,26 @@ namespace EE
 
     void CoverDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
-       
+        ImGui::Text( "Num Cover Volumes: %d", m_pCoverManager->m_coverVolumes.size() );
+        ImGui::Text( "Num Cover Points: %d", m_pCoverManager->m_coverPointIndex.GetNumPoints() );
+        ImGui::Text( "Num Grid Cells: %d", m_pCoverManager->m_coverPointIndex.GetNumCells() );
+        ImGui::Checkbox( "Draw Cover Points", &m_drawCoverPoints );
+    }
+
+    void CoverDebugView::DrawOverlayElements( EntityWorldUpdateContext const& context )
+    {
+        if ( !m_drawCoverPoints )
+        {
+            return;
+        }
+
+        auto drawingCtx = context.GetDrawingContext();
+        for ( auto const& coverPoint : m_pCoverManager->m_coverPointIndex.GetPoints() )
+        {
+            Color const color = ( coverPoint.m_coverType == CoverType::Low ) ? Colors::Yellow : Colors::GreenYellow;
+            drawingCtx.DrawPoint( coverPoint.m_position, color, 8.0f );
+            drawingCtx.DrawArrow( coverPoint.m_position, coverPoint.m_position + ( coverPoint.m_facing * 0.5f ), color, 2.0f );
+        }
     }
 }
 #endif
\ No newline at end of file
@@ -24,10 +24,12 @@ namespace EE
         virtual void Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld ) override;
         virtual void Shutdown() override;
         virtual void DrawMenu( EntityWorldUpdateContext const& context ) override;
+        virtual void DrawOverlayElements( EntityWorldUpdateContext const& context ) override;
 
     private:
 
         CoverManager*                   m_pCoverManager = nullptr;
+        bool                            m_drawCoverPoints = false;
     };
 }
 #endif
\ No newline at end of file
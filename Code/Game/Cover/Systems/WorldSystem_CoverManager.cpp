@@ -3,14 +3,24 @@
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityMap.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Systems.h"
+#include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    void CoverManager::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+    }
+
     void CoverManager::ShutdownSystem()
     {
         EE_ASSERT( m_coverVolumes.empty() );
+        m_coverPointIndex.Clear();
+        m_pTaskSystem = nullptr;
     }
 
     void CoverManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -18,6 +28,7 @@ namespace EE
         if ( auto pCoverComponent = TryCast<CoverVolumeComponent>( pComponent ) )
         {
             m_coverVolumes.Add( pCoverComponent );
+            m_isCoverPointIndexDirty = true;
         }
     }
 
@@ -26,11 +37,37 @@ namespace EE
         if ( auto pCoverComponent = TryCast<CoverVolumeComponent>( pComponent ) )
         {
             m_coverVolumes.Remove( pCoverComponent->GetID() );
+            m_isCoverPointIndexDirty = true;
+        }
+    }
+
+    void CoverManager::EndComponentRegistration()
+    {
+        // Cover volumes are static, so we only need to resample them when volumes are added or removed
+        if ( m_isCoverPointIndexDirty )
+        {
+            TVector<CoverVolumeComponent const*> volumes;
+            volumes.reserve( m_coverVolumes.size() );
+            for ( auto pCoverVolume : m_coverVolumes )
+            {
+                volumes.emplace_back( pCoverVolume );
+            }
+
+            m_coverPointIndex.Build( volumes );
+            m_isCoverPointIndexDirty = false;
         }
     }
 
     //-------------------------------------------------------------------------
 
+    void CoverManager::FindCover( TSpan<CoverQuery const> queries, TVector<TVector<ScoredCoverPoint>>& outResults ) const
+    {
+        EE_ASSERT( !m_isCoverPointIndexDirty );
+        m_coverPointIndex.FindCoverPoints( m_pTaskSystem, queries, outResults );
+    }
+
+    //-------------------------------------------------------------------------
+
     void CoverManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
     }
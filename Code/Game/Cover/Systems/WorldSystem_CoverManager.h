@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Game/_Module/API.h"
+#include "Game/Cover/CoverPointIndex.h"
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Base/Types/IDVector.h"
 
@@ -9,6 +10,7 @@
 namespace EE
 {
     class CoverVolumeComponent;
+    class TaskSystem;
 
     //-------------------------------------------------------------------------
 
@@ -20,15 +22,30 @@ namespace EE
 
         EE_ENTITY_WORLD_SYSTEM( CoverManager, RequiresUpdate( UpdateStage::PrePhysics ) );
 
+    public:
+
+        // Find the best cover points for a single query, results are sorted by score (best first)
+        inline void FindCover( CoverQuery const& query, TVector<ScoredCoverPoint>& outResults ) const { m_coverPointIndex.FindCoverPoints( query, outResults ); }
+
+        // Run the queries of many agents in parallel
+        void FindCover( TSpan<CoverQuery const> queries, TVector<TVector<ScoredCoverPoint>>& outResults ) const;
+
+        inline CoverPoint const& GetCoverPoint( int32_t pointIdx ) const { return m_coverPointIndex.GetPoint( pointIdx ); }
+
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void EndComponentRegistration() override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
     private:
 
+        TaskSystem*                                         m_pTaskSystem = nullptr;
         TIDVector<ComponentID, CoverVolumeComponent*>      m_coverVolumes;
+        CoverPointIndex                                     m_coverPointIndex;
+        bool                                                m_isCoverPointIndexDirty = false;
     };
 }
\ No newline at end of file